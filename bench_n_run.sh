@@ -0,0 +1,114 @@
+#!/bin/sh
+# Runs the ROM headless in Blastem for a given amount of frames and outputs the per frame benchmark as CSV.
+# The ROM has to be built with BENCH_AUTO_RUN set to T (see consts.h), so game_loop_auto() emits the stats through KDebug.
+# Eg:
+#    ./bench_n_run.sh 2000 bench.csv
+#    ./bench_n_run.sh 2000 bench.csv --build
+#    MAP_HIT_CODEC=1 ./bench_n_run.sh 2000 bench.csv --build
+#    BENCH_KERNELS=1 ./bench_n_run.sh 60 kernels.csv --build
+#    COLUMNS_FROM_ROM=1 ./bench_n_run.sh 2000 bench_rom_columns.csv --build
+#    SINGLE_PLANE=1 ./bench_n_run.sh 2000 bench_single_plane.csv --build
+#    FLOOR_CEILING=1 ./bench_n_run.sh 2000 bench_floor_ceiling.csv --build
+#    BENCH_KERNELS=1 WALL_MATERIALS=1 ./bench_n_run.sh 60 kernels_materials.csv --build
+#    BENCH_KERNELS=1 WALL_HIT_FUSED=1 ./bench_n_run.sh 60 kernels_fused.csv --build
+#
+# Output columns: frame,posX,posY,angle,cpu_cycles,dma_bytes,vblank_overrun_lines
+# Note cpu_cycles are measured from the start of the frame until waiting for VBlank, so interrupts time is included.
+# With MAP_HIT_CODEC set (see map_hit_compressed.h for the values) the ROM is built with RENDER_USE_MAP_HIT_COMPRESSED and
+# the codec ROM size and decode cycles per row are printed in the terminal. Its tables must have been generated first.
+# With BENCH_KERNELS set the ROM is built with BENCH_KERNELS instead (see bench.h) and the output columns are:
+#    kernel,calls,cpu_cycles,cycles_per_call
+# where cycles_per_call still includes the loop and call overhead reported by kernel call_overhead.
+# With COLUMNS_FROM_ROM set the ROM is built with RENDER_DMA_COLUMNS_FROM_ROM, to compare against the row by row DMA of the framebuffer.
+# With SINGLE_PLANE set the ROM is built with RENDER_SINGLE_PLANE_TILES_PAIR (one framebuffer plane of combined tiles).
+# With FLOOR_CEILING set the ROM is built with RENDER_FLOOR_CEILING_TEXTURED on top of RENDER_SINGLE_PLANE_TILES_PAIR.
+# With WALL_MATERIALS set the ROM is built with RENDER_WALL_MATERIALS (and the MAP_RUNTIME_LEVELS it needs).
+# With WALL_HIT_FUSED set the ROM is built with RENDER_USE_TAB_WALL_HIT_FUSED, so hitOnSideX/Y go through write_vline_fused().
+
+FRAMES="${1:-1000}"
+OUT_CSV="${2:-bench.csv}"
+
+# Edit accordingly
+BLASTEM="${BLASTEM:-blastem}"
+ROM="out/rom.bin"
+
+if [ "$3" = "--build" ]; then
+    if [ -z "$GDK" ]; then
+        echo "Please set GDK env path"
+        exit 1
+    fi
+    if [ -n "$BENCH_KERNELS" ]; then
+        FLAGS="-DBENCH_KERNELS=1"
+    else
+        FLAGS="-DBENCH_AUTO_RUN=1"
+    fi
+    if [ -n "$MAP_HIT_CODEC" ]; then
+        FLAGS="$FLAGS -DRENDER_USE_MAP_HIT_COMPRESSED=1 -DMAP_HIT_CODEC=$MAP_HIT_CODEC"
+    fi
+    if [ -n "$COLUMNS_FROM_ROM" ]; then
+        FLAGS="$FLAGS -DRENDER_DMA_COLUMNS_FROM_ROM=1"
+    fi
+    if [ -n "$SINGLE_PLANE" ]; then
+        FLAGS="$FLAGS -DRENDER_SINGLE_PLANE_TILES_PAIR=1"
+    fi
+    if [ -n "$FLOOR_CEILING" ]; then
+        FLAGS="$FLAGS -DRENDER_SINGLE_PLANE_TILES_PAIR=1 -DRENDER_FLOOR_CEILING_TEXTURED=1"
+    fi
+    if [ -n "$WALL_MATERIALS" ]; then
+        FLAGS="$FLAGS -DMAP_RUNTIME_LEVELS=1 -DRENDER_WALL_MATERIALS=1"
+    fi
+    if [ -n "$WALL_HIT_FUSED" ]; then
+        FLAGS="$FLAGS -DRENDER_USE_TAB_WALL_HIT_FUSED=1"
+    fi
+    make -f "$GDK/makefile.gen" -j1 release EXTRA_FLAGS="$FLAGS" || exit 1
+fi
+
+if [ ! -f "$ROM" ]; then
+    echo "Missing $ROM. Build it first or use option --build"
+    exit 1
+fi
+
+if ! command -v "$BLASTEM" > /dev/null 2>&1; then
+    echo "Please set BLASTEM env with the path of a Blastem nightly build (needs KDebug support)"
+    exit 1
+fi
+
+# -b: benchmark mode, runs headless for the given amount of frames and exits
+"$BLASTEM" -b "$FRAMES" "$ROM" 2>&1 | awk -v kernels="$BENCH_KERNELS" '
+    BEGIN {
+        if (kernels != "") print "kernel,calls,cpu_cycles,cycles_per_call"
+        else print "frame,posX,posY,angle,cpu_cycles,dma_bytes,vblank_overrun_lines"
+        cycles = ""
+    }
+    /KDEBUG TIMER:/ { cycles = $NF; next }
+    /KDEBUG MESSAGE: BENCH,END/ { exit }
+    /KDEBUG MESSAGE: CODEC,/ {
+        sub(/.*KDEBUG MESSAGE: CODEC,/, "")
+        split($0, f, ",")
+        # f: name, rom_bytes, rows
+        printf "codec %s: %d bytes of ROM, %d cycles per row\n", f[1], f[2], cycles / f[3] > "/dev/stderr"
+        cycles = ""
+        next
+    }
+    /KDEBUG MESSAGE: KERNEL,/ {
+        sub(/.*KDEBUG MESSAGE: KERNEL,/, "")
+        split($0, f, ",")
+        # f: name, calls
+        printf "%s,%d,%d,%.1f\n", f[1], f[2], cycles, cycles / f[2]
+        cycles = ""
+        next
+    }
+    /KDEBUG MESSAGE: BENCH,/ {
+        sub(/.*KDEBUG MESSAGE: BENCH,/, "")
+        split($0, f, ",")
+        # f: frame, posX, posY, angle, dma_bytes, vblank_overrun_lines
+        print f[1] "," f[2] "," f[3] "," f[4] "," cycles "," f[5] "," f[6]
+        cycles = ""
+    }
+' > "$OUT_CSV"
+
+if [ -n "$BENCH_KERNELS" ]; then
+    echo "$(($(wc -l < "$OUT_CSV") - 1)) kernels written into $OUT_CSV"
+else
+    echo "$(($(wc -l < "$OUT_CSV") - 1)) frames written into $OUT_CSV"
+fi
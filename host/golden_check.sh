@@ -0,0 +1,226 @@
+#!/bin/sh
+# Golden image regression of the renderer. Replays camera_path.txt through the host build (see Makefile) for every
+# switch combination listed below and compares the per frame framebuffer hashes against golden.txt.
+# Every combination must render exactly the same framebuffers than the default switches of consts.h.
+# RENDER_SINGLE_PLANE_TILES_PAIR writes a different framebuffer (combined tiles, Plane A region only), so its combinations
+# are compared against golden_single_plane.txt, rendered with that switch alone. Level 1 of MAP_RUNTIME_LEVELS (with its wall
+# materials) is compared against golden_level_1.txt, rendered with LEVEL_1_FLAGS alone. RENDER_HALVED_PLANES renders only the
+# bottom halves of the planes: RENDER_MIRROR_PLANES_USING_CPU_RAM mirrors them into the top halves in the framebuffer, so it's
+# compared against golden.txt, while the other strategies leave the top halves to the VDP and only their bottom halves are
+# hashed, compared against golden_halved.txt, rendered with HALVED_FLAGS alone. When the tables of map_hit_tables.sh exist,
+# every MAP_HIT_CODEC is round tripped against the uncompressed table and RENDER_USE_MAP_HIT_COMPRESSED is compared against
+# golden_map_hit.txt, rendered with MAP_HIT_FLAGS alone: the table holds one hit per map cell and angle, not per position, so
+# its frames differ from golden.txt by design. Last, input_path.txt replays joypad
+# states through handle_input() to check the frames RENDER_SKIP_STATIC_FRAME skips. Combinations with RENDER_DEPTH_BUFFER also
+# check the depth buffer against the drawn walls, and the ones with DMA_SCHEDULER replay a synthetic DMA load through it
+# (see host_main.c).
+# Eg:
+#    ./host/golden_check.sh
+#    ./host/golden_check.sh --update    regenerates both golden files (only after an intended output change)
+#
+# Not covered: the top halves the VDP mirrors (VRAM copy or VSCROLL at HInt) for RENDER_HALVED_PLANES, RENDER_SHOW_TEXCOORD and
+# MAP_HIT_CODEC_BANKED (SSF2 banks).
+
+cd "$(dirname "$0")" || exit 1
+
+GOLDEN="golden.txt"
+GOLDEN_SINGLE_PLANE="golden_single_plane.txt"
+SINGLE_PLANE_FLAGS="-DRENDER_SINGLE_PLANE_TILES_PAIR=1"
+GOLDEN_LEVEL_1="golden_level_1.txt"
+LEVEL_1_FLAGS="-DMAP_RUNTIME_LEVELS=1 -DRENDER_WALL_MATERIALS=1 -DHOST_LEVEL=1"
+GOLDEN_HALVED="golden_halved.txt"
+HALVED_FLAGS="-DHOST_HASH_BOTTOM_HALVES=1"
+MAP_HIT_TABLE="map_hit/tab_map_hit_OUTPUT.txt"
+GOLDEN_MAP_HIT="golden_map_hit.txt"
+MAP_HIT_FLAGS="-DRENDER_USE_MAP_HIT_COMPRESSED=1 -DHOST_MAP_HIT_TABLES=1 -DMAP_HIT_CODEC=0"
+PATH_FILE="camera_path.txt"
+OUTPUT="out/golden_output.txt"
+INPUT_FILE="input_path.txt"
+INPUT_START="416 3712 0"
+INPUT_OUTPUT="out/input_output.txt"
+INPUT_VIEWS="out/input_views.txt"
+
+run_combination () {
+    make -s clean all EXTRA_FLAGS="$1" > /dev/null || { echo "FAIL (build): $1"; return 1; }
+    out/host_render --path "$PATH_FILE" > "$OUTPUT" || { echo "FAIL (run): $1"; return 1; }
+}
+
+if [ "$1" = "--update" ]; then
+    run_combination "" || exit 1
+    cp "$OUTPUT" "$GOLDEN"
+    echo "$GOLDEN updated with $(wc -l < "$GOLDEN") frames"
+    run_combination "$SINGLE_PLANE_FLAGS" || exit 1
+    cp "$OUTPUT" "$GOLDEN_SINGLE_PLANE"
+    echo "$GOLDEN_SINGLE_PLANE updated with $(wc -l < "$GOLDEN_SINGLE_PLANE") frames"
+    run_combination "$LEVEL_1_FLAGS" || exit 1
+    cp "$OUTPUT" "$GOLDEN_LEVEL_1"
+    echo "$GOLDEN_LEVEL_1 updated with $(wc -l < "$GOLDEN_LEVEL_1") frames"
+    run_combination "$HALVED_FLAGS" || exit 1
+    cp "$OUTPUT" "$GOLDEN_HALVED"
+    echo "$GOLDEN_HALVED updated with $(wc -l < "$GOLDEN_HALVED") frames"
+    if [ -f "$MAP_HIT_TABLE" ]; then
+        run_combination "$MAP_HIT_FLAGS" || exit 1
+        cp "$OUTPUT" "$GOLDEN_MAP_HIT"
+        echo "$GOLDEN_MAP_HIT updated with $(wc -l < "$GOLDEN_MAP_HIT") frames"
+    else
+        echo "SKIP: $GOLDEN_MAP_HIT not updated, run map_hit_tables.sh first"
+    fi
+    exit 0
+fi
+
+FAILED=0
+
+# Reads combinations from stdin and compares each one against the given golden file
+check_combinations () {
+    while read -r FLAGS; do
+        case "$FLAGS" in "#"*) continue ;; esac
+        if ! run_combination "$FLAGS"; then
+            FAILED=1
+            continue
+        fi
+        # First mismatching frame as "posX posY angle hash" against the golden one
+        MISMATCH=$(diff "$1" "$OUTPUT" | grep -m 2 '^[<>]' | tr '\n' ' ')
+        if [ -n "$MISMATCH" ]; then
+            echo "FAIL: ${FLAGS:-default} => $MISMATCH"
+            FAILED=1
+        else
+            echo "OK:   ${FLAGS:-default}"
+        fi
+    done
+}
+
+check_combinations "$GOLDEN" <<COMBINATIONS
+
+-DRENDER_COLUMNS_UNROLL=1
+-DRENDER_COLUMNS_UNROLL=4
+-DRENDER_COLUMNS_UNROLL=5
+-DRENDER_COLUMNS_UNROLL=8
+-DRENDER_COLUMNS_UNROLL=16
+-DRENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS=0
+-DRENDER_USE_TAB_WALL_HIT_FUSED=1
+-DRENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED=0
+-DRENDER_USE_DDA_QUADRANT_KERNELS=1
+-DRENDER_USE_DDA_QUADRANT_KERNELS=1 -DRENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS=0
+-DRENDER_USE_DDA_QUADRANT_KERNELS=1 -DRENDER_COLUMNS_UNROLL=1
+-DRENDER_USE_DDA_QUADRANT_KERNELS=1 -DRENDER_COLUMNS_UNROLL=5
+-DRENDER_USE_TAB_DELTAS_FOLDED=1
+-DRENDER_USE_TAB_DELTAS_FOLDED=1 -DRENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS=0 -DRENDER_COLUMNS_UNROLL=4
+-DRENDER_INCREMENTAL_FRAMEBUFFER=1
+-DRENDER_INCREMENTAL_FRAMEBUFFER=1 -DRENDER_USE_TAB_WALL_HIT_FUSED=1
+-DRENDER_INCREMENTAL_FRAMEBUFFER=1 -DRENDER_DMA_DIRTY_ROWS=1
+-DRENDER_INCREMENTAL_FRAMEBUFFER=1 -DRENDER_DMA_DIRTY_ROWS=1 -DRENDER_USE_TAB_WALL_HIT_FUSED=1
+-DRENDER_CLEAR_FRAMEBUFFER=1 -DRENDER_CLEAR_FRAMEBUFFER_WITH_SP=0
+-DMAP_RUNTIME_LEVELS=1
+-DMAP_RUNTIME_LEVELS=1 -DRENDER_WALL_MATERIALS=1
+-DRENDER_DMA_COLUMNS_FROM_ROM=1
+-DRENDER_DMA_COLUMNS_FROM_ROM=1 -DRENDER_USE_TAB_WALL_HIT_FUSED=1 -DRENDER_COLUMNS_UNROLL=5
+-DRENDER_DEPTH_BUFFER=1
+-DRENDER_DEPTH_BUFFER=1 -DRENDER_USE_DDA_QUADRANT_KERNELS=1 -DRENDER_USE_TAB_WALL_HIT_FUSED=1
+-DDMA_SCHEDULER=1
+-DRENDER_MIRROR_PLANES_USING_CPU_RAM=1
+-DRENDER_MIRROR_PLANES_USING_CPU_RAM=1 -DRENDER_USE_TAB_WALL_HIT_FUSED=1
+-DRENDER_MIRROR_PLANES_USING_CPU_RAM=1 -DRENDER_USE_DDA_QUADRANT_KERNELS=1 -DRENDER_COLUMNS_UNROLL=1
+-DRENDER_MIRROR_PLANES_USING_CPU_RAM=1 -DRENDER_CLEAR_FRAMEBUFFER=1 -DRENDER_CLEAR_FRAMEBUFFER_WITH_SP=0
+COMBINATIONS
+
+check_combinations "$GOLDEN_SINGLE_PLANE" <<COMBINATIONS
+$SINGLE_PLANE_FLAGS
+$SINGLE_PLANE_FLAGS -DRENDER_USE_TAB_WALL_HIT_FUSED=1
+$SINGLE_PLANE_FLAGS -DRENDER_COLUMNS_UNROLL=4
+$SINGLE_PLANE_FLAGS -DRENDER_USE_DDA_QUADRANT_KERNELS=1
+$SINGLE_PLANE_FLAGS -DRENDER_USE_TAB_DELTAS_FOLDED=1
+COMBINATIONS
+
+check_combinations "$GOLDEN_LEVEL_1" <<COMBINATIONS
+$LEVEL_1_FLAGS
+$LEVEL_1_FLAGS -DRENDER_USE_DDA_QUADRANT_KERNELS=1
+$LEVEL_1_FLAGS -DRENDER_USE_TAB_DELTAS_FOLDED=1 -DRENDER_COLUMNS_UNROLL=4
+$LEVEL_1_FLAGS -DRENDER_INCREMENTAL_FRAMEBUFFER=1
+$LEVEL_1_FLAGS -DRENDER_INCREMENTAL_FRAMEBUFFER=1 -DRENDER_DMA_DIRTY_ROWS=1
+$LEVEL_1_FLAGS -DRENDER_DEPTH_BUFFER=1
+COMBINATIONS
+
+check_combinations "$GOLDEN_HALVED" <<COMBINATIONS
+$HALVED_FLAGS
+-DRENDER_MIRROR_PLANES_USING_VDP_VRAM=1
+-DRENDER_MIRROR_PLANES_USING_VDP_VRAM=1 -DRENDER_USE_TAB_WALL_HIT_FUSED=1 -DRENDER_COLUMNS_UNROLL=4
+-DRENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT=1
+-DRENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT=1 -DRENDER_USE_DDA_QUADRANT_KERNELS=1
+-DRENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS=1
+-DRENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS=1 -DRENDER_USE_TAB_DELTAS_FOLDED=1
+COMBINATIONS
+
+# RENDER_USE_MAP_HIT_COMPRESSED needs the tables generated by map_hit_tables.sh (too big to be committed)
+if [ -f "$MAP_HIT_TABLE" ]; then
+    # Round trips the uncompressed table through every codec (host_render --map-hit)
+    for CODEC in 0 1 2 3; do
+        FLAGS="-DRENDER_USE_MAP_HIT_COMPRESSED=1 -DHOST_MAP_HIT_TABLES=1 -DMAP_HIT_CODEC=$CODEC"
+        if ! make -s clean all EXTRA_FLAGS="$FLAGS" > /dev/null; then
+            echo "FAIL (build): $FLAGS"
+            FAILED=1
+        elif RESULT=$(out/host_render --map-hit "$MAP_HIT_TABLE" 2>&1); then
+            echo "OK:   map hit $RESULT"
+        else
+            echo "FAIL: map hit $FLAGS => $RESULT"
+            FAILED=1
+        fi
+    done
+
+    check_combinations "$GOLDEN_MAP_HIT" <<COMBINATIONS
+$MAP_HIT_FLAGS
+$MAP_HIT_FLAGS -DRENDER_COLUMNS_UNROLL=1
+$MAP_HIT_FLAGS -DRENDER_COLUMNS_UNROLL=5
+$MAP_HIT_FLAGS -DRENDER_USE_TAB_DELTAS_FOLDED=1
+-DRENDER_USE_MAP_HIT_COMPRESSED=1 -DHOST_MAP_HIT_TABLES=1 -DMAP_HIT_CODEC=1
+-DRENDER_USE_MAP_HIT_COMPRESSED=1 -DHOST_MAP_HIT_TABLES=1 -DMAP_HIT_CODEC=2
+-DRENDER_USE_MAP_HIT_COMPRESSED=1 -DHOST_MAP_HIT_TABLES=1 -DMAP_HIT_CODEC=3
+COMBINATIONS
+else
+    echo "SKIP: RENDER_USE_MAP_HIT_COMPRESSED, run map_hit_tables.sh first"
+fi
+
+# Replays input_path.txt through handle_input() (host_render --input) for every combination read from stdin. A frame must be
+# rendered if and only if its view differs from the previous frame one (or it's the first frame) when RENDER_SKIP_STATIC_FRAME,
+# always otherwise. And every frame, rendered or skipped, must leave the framebuffer of its view rendered from scratch.
+check_input_combinations () {
+    while read -r FLAGS; do
+        case "$FLAGS" in "#"*) continue ;; esac
+        case "$FLAGS" in *"-DRENDER_SKIP_STATIC_FRAME=1"*) SKIP=1 ;; *) SKIP=0 ;; esac
+        if ! make -s clean all EXTRA_FLAGS="$FLAGS" > /dev/null; then
+            echo "FAIL (build): $FLAGS"
+            FAILED=1
+            continue
+        fi
+        # shellcheck disable=SC2086
+        if ! out/host_render --input $INPUT_START "$INPUT_FILE" > "$INPUT_OUTPUT"; then
+            echo "FAIL (run): $FLAGS"
+            FAILED=1
+            continue
+        fi
+        cut -d ' ' -f 1-3 "$INPUT_OUTPUT" > "$INPUT_VIEWS"
+        out/host_render --path "$INPUT_VIEWS" > "$OUTPUT"
+        MISMATCH=$(awk -v skip=$SKIP '{
+                view = $1 " " $2 " " $3
+                expected = (!skip || NR == 1 || view != prev) ? 1 : 0
+                if ($4 != expected) { print "frame " NR " " view " rendered=" $4; exit }
+                prev = view
+            }' "$INPUT_OUTPUT")
+        [ -z "$MISMATCH" ] && MISMATCH=$(cut -d ' ' -f 1-3,5 "$INPUT_OUTPUT" | diff - "$OUTPUT" | grep -m 2 '^[<>]' | tr '\n' ' ')
+        if [ -n "$MISMATCH" ]; then
+            echo "FAIL: input ${FLAGS:-default} => $MISMATCH"
+            FAILED=1
+        else
+            echo "OK:   input ${FLAGS:-default}"
+        fi
+    done
+}
+
+check_input_combinations <<COMBINATIONS
+
+-DRENDER_SKIP_STATIC_FRAME=1
+-DRENDER_SKIP_STATIC_FRAME=1 -DRENDER_INCREMENTAL_FRAMEBUFFER=1 -DRENDER_DMA_DIRTY_ROWS=1
+-DRENDER_SKIP_STATIC_FRAME=1 -DRENDER_USE_TAB_DELTAS_FOLDED=1
+-DRENDER_SKIP_STATIC_FRAME=1 -DRENDER_SMOOTH_ROTATION=1
+COMBINATIONS
+
+exit $FAILED
@@ -0,0 +1,614 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <types.h>
+#include <vdp.h>
+#include "consts.h"
+#include "consts_ext.h"
+#include "frame_buffer.h"
+#include "game_loop.h"
+#include "map_matrix.h"
+#include "depth_buffer.h"
+#include "joy_6btn.h"
+#include "weapon.h"
+#include "vint_callback.h"
+#include "dma_sched.h"
+#include "map_hit_compressed.h"
+
+// Host build of the renderer (see Makefile). Raycasts the view at the given position and angle and emits the framebuffer.
+// Usage:
+//    host_render <posX> <posY> <angle> [out.bin]
+//    host_render --path <camera_path.txt>
+//    host_render --input <posX> <posY> <angle> <input_path.txt>
+//    host_render --map-hit <tab_map_hit_OUTPUT.txt>
+// Without out.bin prints the framebuffer tilemap entries in hexa: VERTICAL_ROWS rows of Plane A region followed by the ones of Plane B region. Only Plane A region with RENDER_SINGLE_PLANE_TILES_PAIR.
+// With out.bin writes the framebuffer as big endian words, same layout than the one DMAed into VRAM.
+// With --path replays every "posX posY angle" line of the file as consecutive frames and prints "posX posY angle hash" per frame,
+// where hash is the FNV-1a of the framebuffer (Plane A and B regions, only their bottom halves with HOST_HASH_BOTTOM_HALVES). See golden_check.sh
+// With RENDER_DMA_DIRTY_ROWS the hash is taken over a shadow of the planes which only receives the rows flagged as dirty,
+// so a row the renderer changed but didn't flag shows up as a golden mismatch.
+// With RENDER_DEPTH_BUFFER --path first unit tests the depth_buffer_*() helpers, then checks every frame's depth buffer against
+// the wall heights drawn into the framebuffer, and fails on the first mismatch.
+// With DMA_SCHEDULER --path first replays a synthetic load through dma_sched.c against a stubbed DMA (see checkDmaScheduler()).
+// With --input starts at the given view and runs one game_loop_inputFrame() per "joyState" line of the file, as if that
+// joypad state was read on that frame. Prints "posX posY angle rendered hash" per frame, rendered being 1 if the frame
+// went through dda() and hash the one of the framebuffer as left by that frame. With RENDER_SMOOTH_ROTATION it also fails when
+// a horizontal scroll isn't latched to the framebuffer of the frame that requested it. See golden_check.sh
+// With --map-hit (only with RENDER_USE_MAP_HIT_COMPRESSED) sets every row of the table through map_hit_setRow() and reads its
+// PIXEL_COLUMNS values back as dda() does, failing on the first one that differs from the uncompressed table given as output of
+// tab_map_hit_generator.js (or map_tables_generator). See map_hit_tables.sh
+
+#define FRAME_BUFFER_WORDS (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES)
+
+// Hashes only the bottom half rows of both planes. RENDER_HALVED_PLANES renders only those rows and the top halves are mirrored
+// by the VDP (VRAM copy or VSCROLL at HInt), except with RENDER_MIRROR_PLANES_USING_CPU_RAM which mirrors them in the framebuffer.
+// Set it alone to render golden_halved.txt (see golden_check.sh).
+#ifndef HOST_HASH_BOTTOM_HALVES
+#define HOST_HASH_BOTTOM_HALVES (RENDER_HALVED_PLANES && !RENDER_MIRROR_PLANES_USING_CPU_RAM)
+#endif
+
+// Level loaded before rendering when MAP_RUNTIME_LEVELS is set
+#ifndef HOST_LEVEL
+#define HOST_LEVEL 0
+#endif
+
+static int parseArg (const char* arg, long minValue, long maxValue, u16* value)
+{
+    char* end;
+    long v = strtol(arg, &end, 0);
+    if (*end != '\0' || v < minValue || v > maxValue)
+        return 0;
+    *value = (u16) v;
+    return 1;
+}
+
+// Stand-ins of the game side called by handle_input(). Only the joypad state matters to the renderer.
+static u16 host_joy_state;
+
+u16 joy_readJoypad_joy1 ()
+{
+    return host_joy_state;
+}
+
+void weapon_next (s16 dir) {}
+void weapon_fire () {}
+void weapon_updateSway (bool _isMoving) {}
+
+#if RENDER_SMOOTH_ROTATION
+// Last scroll requested by handle_input() in the current frame
+static bool host_hscroll_set;
+static bool host_hscroll_waits_framebuffer;
+
+void vint_enqueueHScroll (s16 offsetPx, bool withFramebuffer)
+{
+    host_hscroll_set = TRUE;
+    host_hscroll_waits_framebuffer = withFramebuffer;
+}
+#endif
+
+static u32 hashFrameBuffer (const u16* fb)
+{
+    // FNV-1a 32 bits over the big endian bytes of the framebuffer
+    u32 hash = 2166136261u;
+    for (u16 i = 0; i < FRAME_BUFFER_WORDS; ++i) {
+        #if HOST_HASH_BOTTOM_HALVES
+        if ((i % (VERTICAL_ROWS*TILEMAP_COLUMNS)) < (VERTICAL_ROWS/2)*TILEMAP_COLUMNS)
+            continue;
+        #endif
+        hash = (hash ^ (fb[i] >> 8)) * 16777619u;
+        hash = (hash ^ (fb[i] & 0xFF)) * 16777619u;
+    }
+    return hash;
+}
+
+#if RENDER_DMA_DIRTY_ROWS
+static u16 shadow_planes[FRAME_BUFFER_WORDS];
+
+static void copyDirtyRows (u16* dst, const u16* src, u16 dirty)
+{
+    for (u16 r = 0; dirty; ++r, dirty >>= 1) {
+        if (!(dirty & 1))
+            continue;
+        // Top row and its bottom mirror row, as render_DMA_dirty_rows_framebuffer() does
+        memcpy(dst + r*TILEMAP_COLUMNS, src + r*TILEMAP_COLUMNS, TILEMAP_COLUMNS*2);
+        memcpy(dst + (VERTICAL_ROWS-1-r)*TILEMAP_COLUMNS, src + (VERTICAL_ROWS-1-r)*TILEMAP_COLUMNS, TILEMAP_COLUMNS*2);
+    }
+}
+
+/// @brief Stands for the VBlank DMA of the dirty rows into VRAM.
+static void dmaDirtyRows ()
+{
+    const u16* fb = (const u16*) host_frame_buffer;
+    copyDirtyRows(shadow_planes, fb, fb_dirty_rows_A);
+    #if FRAME_BUFFER_PLANES == 2
+    copyDirtyRows(shadow_planes + VERTICAL_ROWS*TILEMAP_COLUMNS, fb + VERTICAL_ROWS*TILEMAP_COLUMNS, fb_dirty_rows_B);
+    #endif
+    fb_dirty_rows_A = 0;
+    fb_dirty_rows_B = 0;
+}
+#endif
+
+#if RENDER_DEPTH_BUFFER
+
+// Defined in tab_wall_div.h, included by game_loop.c
+extern const u16 tab_wall_div[FP * (STEP_COUNT + 1)];
+
+static int depthFailed (const char* what, u16 column, u16 width, u8 depth)
+{
+    fprintf(stderr, "depth buffer: %s at column %u width %u depth %u\n", what, column, width, depth);
+    return 0;
+}
+
+/// @brief Checks depth_buffer_isVisible(), depth_buffer_visibleMask() and depth_buffer_clipSpan() against a column by column
+/// reference, over every span of a few synthetic buffers: walls at both screen edges, FAR columns and a buffer with no wall at all.
+static int checkDepthHelpers ()
+{
+    static const u8 depths[] = { 0, 1, 64, 127, 128, DEPTH_BUFFER_FAR - 1, DEPTH_BUFFER_FAR };
+
+    for (u16 b = 0; b < 4; ++b) {
+        for (u16 c = 0; c < PIXEL_COLUMNS; ++c) {
+            switch (b) {
+                case 0: host_depth_buffer[c] = DEPTH_BUFFER_FAR; break; // no wall hit at all
+                case 1: host_depth_buffer[c] = (c == 0 || c == PIXEL_COLUMNS-1) ? 0 : 128; break; // closest walls at the edges
+                case 2: host_depth_buffer[c] = (c < 3 || c >= PIXEL_COLUMNS-3) ? DEPTH_BUFFER_FAR : 64; break; // FAR at the edges
+                default: host_depth_buffer[c] = (u8)((c * 37u + (c >> 3) * 101u) % 256u); break; // every depth, FAR included
+            }
+        }
+
+        for (u16 d = 0; d < sizeof(depths); ++d) {
+            const u8 depth = depths[d];
+            for (u16 l = 0; l <= PIXEL_COLUMNS; ++l) {
+                for (u16 r = l; r <= PIXEL_COLUMNS; ++r) {
+                    const u16 width = r - l;
+                    u16 firstVisible = r, lastVisible = r;
+                    u16 mask = 0;
+                    for (u16 c = l; c < r; ++c) {
+                        if (depth < host_depth_buffer[c]) {
+                            if (firstVisible == r)
+                                firstVisible = c;
+                            lastVisible = c;
+                            if (c - l < 16)
+                                mask |= 1 << (c - l);
+                        }
+                    }
+                    const bool visible = firstVisible != r;
+
+                    if (depth_buffer_isVisible(l, width, depth) != visible)
+                        return depthFailed("depth_buffer_isVisible()", l, width, depth);
+                    if (width <= 16 && depth_buffer_visibleMask(l, width, depth) != mask)
+                        return depthFailed("depth_buffer_visibleMask()", l, width, depth);
+
+                    u16 left = l, right = r;
+                    if (depth_buffer_clipSpan(&left, &right, depth) != visible)
+                        return depthFailed("depth_buffer_clipSpan() result", l, width, depth);
+                    if (visible ? (left != firstVisible || right != lastVisible + 1) : (left != l || right != r))
+                        return depthFailed("depth_buffer_clipSpan() span", l, width, depth);
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+/// @brief Every column of the depth buffer must match the wall drawn by the same dda(): no wall for DEPTH_BUFFER_FAR, otherwise
+/// as many empty top rows as tab_wall_div gives for the distances that share that depth (the framebuffer only keeps h2 / 8).
+static int checkDepthBuffer (const u16* fb, u16 posX, u16 posY, u16 angle)
+{
+    for (u16 c = 0; c < PIXEL_COLUMNS; ++c) {
+        // Even pixel columns go into Plane A region and odd ones into Plane B region
+        const u16* column = fb + (c & 1)*(VERTICAL_ROWS*TILEMAP_COLUMNS) + (c >> 1);
+        u16 emptyRows = 0;
+        while (emptyRows < VERTICAL_ROWS/2 && column[emptyRows*TILEMAP_COLUMNS] == 0)
+            ++emptyRows;
+
+        const u8 depth = host_depth_buffer[c];
+        u16 minRows = VERTICAL_ROWS/2, maxRows = VERTICAL_ROWS/2;
+        if (depth != DEPTH_BUFFER_FAR) {
+            minRows = tab_wall_div[depth << DEPTH_BUFFER_SHIFT] / 8;
+            maxRows = tab_wall_div[(depth << DEPTH_BUFFER_SHIFT) + (1 << DEPTH_BUFFER_SHIFT) - 1] / 8;
+        }
+        if (emptyRows < minRows || emptyRows > maxRows) {
+            fprintf(stderr, "depth buffer: frame %u %u %u column %u has depth %u but %u empty rows\n", posX, posY, angle, c, depth, emptyRows);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#endif
+
+#if DMA_SCHEDULER
+
+// Stand-ins of SGDK for dma_sched.c. Interrupts don't exist on host: the flushes are called in between the enqueues.
+void SYS_disableInts () {}
+void SYS_enableInts () {}
+void DMA_releaseTemp (u16 len) {}
+
+#define SCHED_FRAMES 64
+#define SCHED_MAX_TRANSFERS (SCHED_FRAMES * 8)
+#define SCHED_POOL_WORDS 0x8000
+
+typedef struct {
+    u32 from;
+    u16 to, lenInWord, doneInWord;
+    u16 prio, dueFrame;
+} SchedTransfer;
+
+static SchedTransfer sched_transfers[SCHED_MAX_TRANSFERS];
+static u16 sched_count;
+static u16 sched_pool[SCHED_POOL_WORDS];
+static u16 sched_poolNext;
+static u16 sched_frame;
+static bool sched_inVint;
+static u16 sched_windowWords; // DMAed in current window by transfers not due this frame
+static u16 sched_deferredLow; // low priority transfers finished on a later frame than the enqueueing one
+static const char* sched_error;
+
+static u16 schedEnqueue (u16 lenInWord, u16 prio, u16 maxDelayFrames)
+{
+    if (sched_poolNext + lenInWord > SCHED_POOL_WORDS)
+        sched_poolNext = 0;
+    SchedTransfer* t = &sched_transfers[sched_count];
+    t->from = (u32) (sched_pool + sched_poolNext);
+    t->to = (sched_count * 0x200) & 0x7FFF; // plus its length still within VRAM
+    t->lenInWord = lenInWord;
+    t->doneInWord = 0;
+    t->prio = prio;
+    t->dueFrame = sched_frame + maxDelayFrames;
+    sched_poolNext += lenInWord;
+    dma_sched_enqueue((void*) t->from, t->to, lenInWord, prio, maxDelayFrames);
+    return sched_count++;
+}
+
+void doDmaFast (u16 len, u32 fromAddr, u32 cmdAddr)
+{
+    // Newest first: the pool is reused once the transfers in it are done
+    for (u16 i = sched_count; i--;) {
+        SchedTransfer* t = &sched_transfers[i];
+        if (fromAddr < t->from || fromAddr >= t->from + t->lenInWord * 2)
+            continue;
+        if (fromAddr != t->from + t->doneInWord * 2 || len > t->lenInWord - t->doneInWord)
+            sched_error = "piece out of order or past the end of its transfer";
+        else if (cmdAddr != VDP_DMA_VRAM_ADDR((u32)(t->to + t->doneInWord * 2)))
+            sched_error = "piece DMAed to the wrong VRAM address";
+        // Same priority and deadline keep the enqueueing order, and low priority ones all use the same deadline
+        for (u16 k = 0; k < i; ++k)
+            if (t->prio == DMA_SCHED_PRIO_LOW && sched_transfers[k].prio == DMA_SCHED_PRIO_LOW
+                    && sched_transfers[k].doneInWord != sched_transfers[k].lenInWord)
+                sched_error = "low priority transfer DMAed before an earlier one";
+        t->doneInWord += len;
+        if (t->dueFrame != sched_frame || !sched_inVint)
+            sched_windowWords += len;
+        if (t->doneInWord == t->lenInWord && t->prio == DMA_SCHED_PRIO_LOW && t->dueFrame - FLOOR_CEILING_DMA_MAX_DELAY_FRAMES != sched_frame)
+            ++sched_deferredLow;
+        return;
+    }
+    sched_error = "DMA of a source that was never enqueued";
+}
+
+static int schedFailed (const char* what)
+{
+    fprintf(stderr, "dma_sched: frame %u: %s\n", sched_frame, what);
+    return 0;
+}
+
+/// @brief Replays SCHED_FRAMES frames of sprites (high priority, due this frame) and floor_ceiling.c like streaming (low
+/// priority, FLOOR_CEILING_DMA_MAX_DELAY_FRAMES) through dma_sched.c, heavy enough on some frames to defer the low priority
+/// ones. Checks the windows budgets, the deadlines, the enqueueing order of the low priority ones and the drop counter.
+static int checkDmaScheduler ()
+{
+    u32 seed = 12345;
+    dma_sched_reset();
+    for (sched_frame = 0; sched_frame < SCHED_FRAMES; ++sched_frame) {
+        // 3 tile chunks and then the tilemap, as floor_ceiling_update() does. Sprites: heavy on 3 frames every 8.
+        schedEnqueue((sched_frame & 3) == 3 ? VERTICAL_ROWS*PLANE_COLUMNS : FLOOR_CEILING_DMA_CHUNK_TILES*16,
+            DMA_SCHED_PRIO_LOW, FLOOR_CEILING_DMA_MAX_DELAY_FRAMES);
+        const u16 sprites = (sched_frame & 7) < 3 ? 6 : 1 + (sched_frame % 3);
+        for (u16 k = 0; k < sprites; ++k) {
+            seed = seed * 1103515245 + 12345;
+            schedEnqueue((sched_frame & 7) < 3 ? 900 : 16 + (seed >> 16) % 256, DMA_SCHED_PRIO_HIGH, 0);
+        }
+
+        sched_inVint = FALSE;
+        sched_windowWords = 0;
+        dma_sched_flushHint();
+        if (sched_windowWords > DMA_SCHED_HINT_BUDGET_IN_WORD)
+            return schedFailed("HInt window over its budget");
+
+        sched_inVint = TRUE;
+        sched_windowWords = 0;
+        dma_sched_flushVint();
+        if (sched_windowWords > DMA_SCHED_VINT_BUDGET_IN_WORD)
+            return schedFailed("VInt window over its budget with transfers not due");
+
+        if (sched_error)
+            return schedFailed(sched_error);
+        for (u16 i = 0; i < sched_count; ++i)
+            if (sched_transfers[i].dueFrame <= sched_frame && sched_transfers[i].doneInWord != sched_transfers[i].lenInWord)
+                return schedFailed("transfer not done by its deadline");
+    }
+    if (dma_sched_dropped)
+        return schedFailed("transfers dropped");
+    if (sched_deferredLow == 0)
+        return schedFailed("no low priority transfer was deferred, the load doesn't exercise the scheduler");
+
+    // A full queue drops and counts the transfer
+    sched_count = 0;
+    dma_sched_reset();
+    for (u16 i = 0; i <= DMA_SCHED_QUEUE_CAPACITY; ++i)
+        schedEnqueue(16, DMA_SCHED_PRIO_LOW, 1);
+    if (dma_sched_dropped != 1)
+        return schedFailed("full queue didn't count the dropped transfer");
+    sched_inVint = TRUE;
+    dma_sched_flushVint();
+    dma_sched_flushVint();
+    for (u16 i = 0; i <= DMA_SCHED_QUEUE_CAPACITY; ++i)
+        if (sched_transfers[i].doneInWord != (i < DMA_SCHED_QUEUE_CAPACITY ? 16 : 0))
+            return schedFailed("queued transfers lost or dropped one DMAed");
+    if (sched_error)
+        return schedFailed(sched_error);
+    return 1;
+}
+
+#endif
+
+static int replayPath (const char* path)
+{
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "Can't read %s\n", path);
+        return 1;
+    }
+
+    #if DMA_SCHEDULER
+    if (!checkDmaScheduler()) {
+        fclose(f);
+        return 1;
+    }
+    #endif
+
+    #if RENDER_DEPTH_BUFFER
+    if (!checkDepthHelpers()) {
+        fclose(f);
+        return 1;
+    }
+    #endif
+
+    char line[128];
+    u16 lineNum = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        ++lineNum;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+            continue;
+
+        char argX[32], argY[32], argA[32];
+        u16 posX, posY, angle;
+        if (sscanf(line, "%31s %31s %31s", argX, argY, argA) != 3
+                || !parseArg(argX, MIN_POS_XY, MAX_POS_XY, &posX)
+                || !parseArg(argY, MIN_POS_XY, MAX_POS_XY, &posY)
+                || !parseArg(argA, 0, 1023, &angle)) {
+            fprintf(stderr, "%s:%u: expected <posX> <posY> <angle>\n", path, lineNum);
+            fclose(f);
+            return 1;
+        }
+
+        game_loop_renderFrame(posX, posY, angle);
+        #if RENDER_DMA_COLUMNS_FROM_ROM
+        fb_expand_columns_from_ROM();
+        #endif
+        #if RENDER_DEPTH_BUFFER && !RENDER_SINGLE_PLANE_TILES_PAIR
+        if (!checkDepthBuffer((const u16*) host_frame_buffer, posX, posY, angle)) {
+            fclose(f);
+            return 1;
+        }
+        #endif
+        #if RENDER_DMA_DIRTY_ROWS
+        dmaDirtyRows();
+        printf("%u %u %u %08X\n", posX, posY, angle, hashFrameBuffer(shadow_planes));
+        #else
+        printf("%u %u %u %08X\n", posX, posY, angle, hashFrameBuffer((const u16*) host_frame_buffer));
+        #endif
+        #if RENDER_MIRROR_PLANES_USING_VDP_VRAM
+        fb_mirror_planes_in_VRAM();
+        #endif
+    }
+
+    fclose(f);
+    return 0;
+}
+
+static int replayInput (u16 posX, u16 posY, u16 angle, const char* path)
+{
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "Can't read %s\n", path);
+        return 1;
+    }
+
+    game_loop_inputStart(posX, posY, angle);
+
+    char line[128];
+    u16 lineNum = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        ++lineNum;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+            continue;
+
+        char argJoy[32];
+        if (sscanf(line, "%31s", argJoy) != 1 || !parseArg(argJoy, 0, 0xFFFF, &host_joy_state)) {
+            fprintf(stderr, "%s:%u: expected <joyState>\n", path, lineNum);
+            fclose(f);
+            return 1;
+        }
+
+        #if RENDER_SMOOTH_ROTATION
+        host_hscroll_set = FALSE;
+        #endif
+
+        const bool rendered = game_loop_inputFrame(&posX, &posY, &angle);
+
+        #if RENDER_SMOOTH_ROTATION
+        // A scroll that goes out on a frame that recasts must wait for its framebuffer, otherwise it shows over the old view
+        if (host_hscroll_set && host_hscroll_waits_framebuffer != rendered) {
+            fprintf(stderr, "%s:%u: horizontal scroll %s the framebuffer of a frame %s\n", path, lineNum,
+                    host_hscroll_waits_framebuffer ? "waits for" : "doesn't wait for", rendered ? "rendered" : "not rendered");
+            fclose(f);
+            return 1;
+        }
+        #endif
+        #if RENDER_DMA_COLUMNS_FROM_ROM
+        if (rendered)
+            fb_expand_columns_from_ROM();
+        #endif
+        #if RENDER_DMA_DIRTY_ROWS
+        dmaDirtyRows();
+        printf("%u %u %u %u %08X\n", posX, posY, angle, rendered, hashFrameBuffer(shadow_planes));
+        #else
+        printf("%u %u %u %u %08X\n", posX, posY, angle, rendered, hashFrameBuffer((const u16*) host_frame_buffer));
+        #endif
+        #if RENDER_MIRROR_PLANES_USING_VDP_VRAM
+        if (rendered)
+            fb_mirror_planes_in_VRAM();
+        #endif
+    }
+
+    fclose(f);
+    return 0;
+}
+
+#if RENDER_USE_MAP_HIT_COMPRESSED
+
+static int checkMapHit (const char* path)
+{
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "Can't read %s\n", path);
+        return 1;
+    }
+
+    map_hit_reset_vars();
+    for (u32 rowIndex = 0; rowIndex < MAP_HIT_ROWS; ++rowIndex) {
+        // Inverse of the row index taken by map_hit_setRow(). Any position inside the cell goes
+        const u32 cellAngle = rowIndex + MAP_HIT_MIN_CALCULATED_INDEX / PIXEL_COLUMNS;
+        const u16 a = cellAngle % AP;
+        const u16 mapX = (cellAngle / AP) / MAP_SIZE;
+        const u16 mapY = (cellAngle / AP) % MAP_SIZE;
+        map_hit_setRow(mapX * FP + FP/2, mapY * FP + FP/2, a);
+        map_hit_setIndexForStartingColumn(0);
+
+        for (u16 column = 0; column < PIXEL_COLUMNS; ++column) {
+            unsigned int expected;
+            if (fscanf(f, " %u ,", &expected) != 1) {
+                fprintf(stderr, "%s: expected %u rows of %u values, ends at row %u\n", path, MAP_HIT_ROWS, PIXEL_COLUMNS, rowIndex);
+                fclose(f);
+                return 1;
+            }
+            const u16 value = map_hit_decompressAt();
+            if (value != expected) {
+                fprintf(stderr, "%s codec: row %u (mapX %u mapY %u a %u) column %u decoded %u, expected %u\n",
+                        MAP_HIT_CODEC_NAME, rowIndex, mapX, mapY, a, column, value, expected);
+                fclose(f);
+                return 1;
+            }
+            map_hit_incrementColumn();
+        }
+    }
+
+    unsigned int extra;
+    const int trailing = fscanf(f, " %u", &extra);
+    fclose(f);
+    if (trailing == 1) {
+        fprintf(stderr, "%s: more than %u rows, the table doesn't match MAP_HIT_MIN/MAX_CALCULATED_INDEX\n", path, MAP_HIT_ROWS);
+        return 1;
+    }
+    printf("%s codec: %u rows match, %lu bytes of ROM\n", MAP_HIT_CODEC_NAME, MAP_HIT_ROWS, (unsigned long) map_hit_codec_romSize());
+    return 0;
+}
+
+#endif
+
+static void printFrameBuffer (const u16* fb)
+{
+    for (u16 row = 0; row < VERTICAL_ROWS*FRAME_BUFFER_PLANES; ++row) {
+        for (u16 col = 0; col < TILEMAP_COLUMNS; ++col)
+            printf(col == 0 ? "%04X" : " %04X", fb[row*TILEMAP_COLUMNS + col]);
+        printf("\n");
+    }
+}
+
+static int writeFrameBuffer (const u16* fb, const char* path)
+{
+    FILE* f = fopen(path, "wb");
+    if (f == NULL)
+        return 0;
+    for (u16 i = 0; i < FRAME_BUFFER_WORDS; ++i) {
+        fputc(fb[i] >> 8, f);
+        fputc(fb[i] & 0xFF, f);
+    }
+    return fclose(f) == 0;
+}
+
+int main (int argc, char** argv)
+{
+    u16 posX, posY, angle;
+
+    #if MAP_RUNTIME_LEVELS
+    // Goldens are rendered over level 0, unless HOST_LEVEL says otherwise (see golden_check.sh)
+    map_loadLevel(HOST_LEVEL);
+    #endif
+
+    if (argc == 3 && strcmp(argv[1], "--path") == 0) {
+        fb_allocate_frame_buffer();
+        return replayPath(argv[2]);
+    }
+
+    #if RENDER_USE_MAP_HIT_COMPRESSED
+    if (argc == 3 && strcmp(argv[1], "--map-hit") == 0)
+        return checkMapHit(argv[2]);
+    #endif
+
+    if (argc == 6 && strcmp(argv[1], "--input") == 0) {
+        if (!parseArg(argv[2], MIN_POS_XY, MAX_POS_XY, &posX)
+                || !parseArg(argv[3], MIN_POS_XY, MAX_POS_XY, &posY)
+                || !parseArg(argv[4], 0, 1023, &angle)) {
+            fprintf(stderr, "posX and posY in [%d, %d], angle in [0, 1023]\n", MIN_POS_XY, MAX_POS_XY);
+            return 1;
+        }
+        fb_allocate_frame_buffer();
+        return replayInput(posX, posY, angle, argv[5]);
+    }
+
+    if (argc < 4 || argc > 5
+            || !parseArg(argv[1], MIN_POS_XY, MAX_POS_XY, &posX)
+            || !parseArg(argv[2], MIN_POS_XY, MAX_POS_XY, &posY)
+            || !parseArg(argv[3], 0, 1023, &angle)) {
+        fprintf(stderr, "Usage: %s <posX> <posY> <angle> [out.bin]\n", argv[0]);
+        fprintf(stderr, "       %s --path <camera_path.txt>\n", argv[0]);
+        fprintf(stderr, "       %s --input <posX> <posY> <angle> <input_path.txt>\n", argv[0]);
+        #if RENDER_USE_MAP_HIT_COMPRESSED
+        fprintf(stderr, "       %s --map-hit <tab_map_hit_OUTPUT.txt>\n", argv[0]);
+        #endif
+        fprintf(stderr, "  posX and posY in [%d, %d], angle in [0, 1023]\n", MIN_POS_XY, MAX_POS_XY);
+        return 1;
+    }
+
+    fb_allocate_frame_buffer();
+    game_loop_renderFrame(posX, posY, angle);
+    #if RENDER_DMA_COLUMNS_FROM_ROM
+    // Stands for the DMA of every column from ROM
+    fb_expand_columns_from_ROM();
+    #endif
+
+    const u16* fb = (const u16*) host_frame_buffer;
+    if (argc == 5) {
+        if (!writeFrameBuffer(fb, argv[4])) {
+            fprintf(stderr, "Can't write %s\n", argv[4]);
+            return 1;
+        }
+    }
+    else {
+        printFrameBuffer(fb);
+    }
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Generates the map hit tables RENDER_USE_MAP_HIT_COMPRESSED needs in the host build. They are too big to be committed
+# (about 45 MB of text), so they go into host/map_hit/ which is ignored by git:
+#   tab_map_hit_OUTPUT.txt by map_tables_generator (built here with g++), the uncompressed table.
+#   map_hit_*_OUTPUT.txt by the compressor script of every codec (node), out of that table.
+# The host build includes the codec streams instead of the placeholders of map_hit_codec_*.c when HOST_MAP_HIT_TABLES is set,
+# and golden_check.sh uses them to round trip every codec against the uncompressed table (host_render --map-hit).
+# Must run again whenever map_matrix.c or the consts change. The generator sweep takes tens of minutes.
+# Eg:
+#    ./host/map_hit_tables.sh
+
+cd "$(dirname "$0")/../scripts" || exit 1
+
+OUT="../host/map_hit"
+mkdir -p "$OUT" || exit 1
+
+g++ -O3 -march=native -std=c++17 -pthread map_tables_generator.cpp -o "$OUT/map_tables_generator" || exit 1
+"$OUT/map_tables_generator" tab_map_hit || exit 1
+
+# Compressors read tab_map_hit_OUTPUT.txt and write their output in the current folder
+for COMPRESSOR in map_hit_block_turbopfor_16_compressor.js map_hit_rle_compressor.js map_hit_block_delta_compressor.js \
+        map_hit_simple16_bitpacking_compressor.js; do
+    node "$COMPRESSOR" > /dev/null || { echo "FAIL: $COMPRESSOR"; exit 1; }
+done
+
+mv tab_map_hit_OUTPUT.txt map_hit_*_OUTPUT.txt "$OUT/" || exit 1
+echo "Map hit tables saved to host/map_hit"
@@ -0,0 +1,4 @@
+// Host build: only the temp buffer release used by dma_sched.c, stubbed in host_main.c.
+#include <types.h>
+
+void DMA_releaseTemp (u16 len);
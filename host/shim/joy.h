@@ -0,0 +1,15 @@
+// Host build: only the button masks of SGDK's joy.h, read by handle_input().
+#include <types.h>
+
+#define BUTTON_UP       0x0001
+#define BUTTON_DOWN     0x0002
+#define BUTTON_LEFT     0x0004
+#define BUTTON_RIGHT    0x0008
+#define BUTTON_B        0x0010
+#define BUTTON_C        0x0020
+#define BUTTON_A        0x0040
+#define BUTTON_START    0x0080
+#define BUTTON_Z        0x0100
+#define BUTTON_Y        0x0200
+#define BUTTON_X        0x0400
+#define BUTTON_MODE     0x0800
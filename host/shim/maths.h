@@ -0,0 +1,11 @@
+#ifndef _HOST_SHIM_MATHS_H_
+#define _HOST_SHIM_MATHS_H_
+
+// Minimal subset of SGDK's maths.h for the host build.
+
+#include <types.h>
+
+#define mulu(op1, op2) ((u32)(u16)(op1) * (u32)(u16)(op2))
+#define muls(op1, op2) ((s32)(s16)(op1) * (s32)(s16)(op2))
+
+#endif // _HOST_SHIM_MATHS_H_
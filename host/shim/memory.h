@@ -0,0 +1,15 @@
+#ifndef _HOST_SHIM_MEMORY_H_
+#define _HOST_SHIM_MEMORY_H_
+
+// Minimal subset of SGDK's memory.h for the host build.
+
+#include <string.h>
+#include <types.h>
+
+static inline void memsetU32 (u32* to, u32 value, u16 len)
+{
+    while (len--)
+        *to++ = value;
+}
+
+#endif // _HOST_SHIM_MEMORY_H_
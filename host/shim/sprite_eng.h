@@ -0,0 +1,11 @@
+#ifndef _HOST_SHIM_SPRITE_ENG_H_
+#define _HOST_SHIM_SPRITE_ENG_H_
+
+// Only the types needed to parse spr_eng_override.h in the host build.
+
+#include <types.h>
+
+typedef struct Sprite Sprite;
+typedef struct SpriteDefinition SpriteDefinition;
+
+#endif // _HOST_SHIM_SPRITE_ENG_H_
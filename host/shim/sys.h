@@ -0,0 +1,5 @@
+// Host build: only the interrupt masking used by dma_sched.c, stubbed in host_main.c.
+#include <types.h>
+
+void SYS_disableInts ();
+void SYS_enableInts ();
@@ -0,0 +1,35 @@
+#ifndef _HOST_SHIM_VDP_H_
+#define _HOST_SHIM_VDP_H_
+
+// Minimal subset of SGDK's vdp.h and vdp_tile.h for the host build.
+
+#include <types.h>
+
+#define VDP_DATA_PORT 0xC00000
+#define VDP_CTRL_PORT 0xC00004
+#define VDP_HVCOUNTER_PORT 0xC00008
+
+#define VDP_DMA_VRAM_ADDR(adr) (((0x4000 + ((adr) & 0x3FFF)) << 16) + (((adr) >> 14) | 0x80))
+
+#define PAL0 0
+#define PAL1 1
+#define PAL2 2
+#define PAL3 3
+
+#define TILE_ATTR_PRIORITY_SFT 15
+#define TILE_ATTR_PALETTE_SFT 13
+#define TILE_ATTR_VFLIP_SFT 12
+#define TILE_ATTR_HFLIP_SFT 11
+#define TILE_ATTR_PRIORITY_MASK (1 << TILE_ATTR_PRIORITY_SFT)
+#define TILE_ATTR_PALETTE_MASK (3 << TILE_ATTR_PALETTE_SFT)
+#define TILE_ATTR_VFLIP_MASK (1 << TILE_ATTR_VFLIP_SFT)
+#define TILE_ATTR_HFLIP_MASK (1 << TILE_ATTR_HFLIP_SFT)
+#define TILE_ATTR_MASK (TILE_ATTR_PRIORITY_MASK | TILE_ATTR_PALETTE_MASK | TILE_ATTR_VFLIP_MASK | TILE_ATTR_HFLIP_MASK)
+#define TILE_INDEX_MASK (~TILE_ATTR_MASK & 0xFFFF)
+
+#define TILE_ATTR(pal, prio, flipV, flipH) \
+    (((flipH) << TILE_ATTR_HFLIP_SFT) + ((flipV) << TILE_ATTR_VFLIP_SFT) + ((pal) << TILE_ATTR_PALETTE_SFT) + ((prio) << TILE_ATTR_PRIORITY_SFT))
+#define TILE_ATTR_FULL(pal, prio, flipV, flipH, index) \
+    (((flipH) << TILE_ATTR_HFLIP_SFT) + ((flipV) << TILE_ATTR_VFLIP_SFT) + ((pal) << TILE_ATTR_PALETTE_SFT) + ((prio) << TILE_ATTR_PRIORITY_SFT) + (index))
+
+#endif // _HOST_SHIM_VDP_H_
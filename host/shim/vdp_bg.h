@@ -0,0 +1,2 @@
+// Host build: everything needed from SGDK's vdp_bg.h lives in the vdp.h shim.
+#include <vdp.h>
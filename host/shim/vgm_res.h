@@ -0,0 +1 @@
+// Generated by rescomp in the ROM build. Nothing of it is used by the host build.
@@ -0,0 +1,68 @@
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <types.h>
+#include "consts.h"
+
+/**
+ * Benchmark mode (see BENCH_AUTO_RUN in consts.h).
+ * game_loop_auto() sweeps the whole map and every frame emits a line through the KDebug interface, which
+ * Blastem prints on its terminal. Script bench_n_run.sh collects those lines and outputs them as CSV.
+ * Per frame we emit:
+ *   - the 68K cycles spent from the start of the frame until the wait for VBlank, using Blastem's cycle counter (see STOPWATCH_68K_CYCLES_START/STOP).
+ *     Blastem prints it as: KDEBUG TIMER: <cycles>
+ *   - the frame info line. Blastem prints it as: KDEBUG MESSAGE: BENCH,<frame>,<posX>,<posY>,<angle>,<dmaBytes>,<vblankOverrunLines>
+ *     It comes out at the start of next frame, once the VBlank that DMAs the frame is done, so dmaBytes and vblankOverrunLines
+ *     belong to the same frame than the cycles. Timer and line still go in pairs since nothing else is printed in between.
+ * With RENDER_USE_MAP_HIT_COMPRESSED, before the sweep we also emit the map hit codec stats:
+ *   - the 68K cycles spent decoding BENCH_MAP_HIT_CODEC_ROWS rows. Blastem prints it as: KDEBUG TIMER: <cycles>
+ *   - the codec line. Blastem prints it as: KDEBUG MESSAGE: CODEC,<name>,<romBytes>,<rows>
+ *
+ * Kernels mode (see BENCH_KERNELS in consts.h).
+ * bench_kernels() runs with interrupts and display disabled, and for every kernel emits:
+ *   - the 68K cycles spent calling it <calls> times in a row. Blastem prints it as: KDEBUG TIMER: <cycles>
+ *   - the kernel line. Blastem prints it as: KDEBUG MESSAGE: KERNEL,<name>,<calls>
+ * Kernels are called as functions from a loop, so every call also pays the loop and the call overhead. Kernel call_overhead
+ * measures that same loop calling an empty function, so subtract it to get the cost of the kernel as inlined by the renderer.
+ */
+
+#define BENCH_MSG_PREFIX "BENCH"
+#define BENCH_CODEC_MSG_PREFIX "CODEC"
+#define BENCH_MAP_HIT_CODEC_ROWS 256
+#define BENCH_KERNEL_MSG_PREFIX "KERNEL"
+
+// Bytes of the framebuffer DMAed at VInt on every frame
+#if RENDER_MIRROR_PLANES_USING_VDP_VRAM || RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT || RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS
+#define BENCH_FRAMEBUFFER_DMA_BYTES ((VERTICAL_ROWS/2)*TILEMAP_COLUMNS*2 * 2)
+#else
+#define BENCH_FRAMEBUFFER_DMA_BYTES (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES * 2)
+#endif
+
+void bench_reset ();
+
+/// @brief Emits the frame info line of the previous frame (see bench_markVIntEnd()) and starts Blastem's 68K cycle counter.
+/// Call it at the start of the frame.
+void bench_frameStart ();
+
+/// @brief Stops Blastem's 68K cycle counter (so it prints the cycles) and keeps the frame info until its VBlank is done.
+/// Call it right before waiting for VBlank.
+void bench_frameEnd (u16 posX, u16 posY, u16 angle);
+
+/// @brief Accumulates DMA bytes transferred at VInt or HInt. They go with the frame whose VBlank comes next.
+void bench_addDmaBytes (u16 bytes);
+
+/// @brief Call it at the end of VInt's DMA operations, before the display is turned on again.
+/// If the VCounter is already in the active display region then those scanlines are reported as overrun.
+/// The DMA bytes and overrun of this VBlank are snapshotted into the line of the frame that ended right before it.
+void bench_markVIntEnd ();
+
+/// @brief Decodes BENCH_MAP_HIT_CODEC_ROWS rows with the codec selected by MAP_HIT_CODEC and emits its ROM size and cycles.
+void bench_mapHitCodec ();
+
+/// @brief Times every hand written kernel in isolation with fixed inputs and emits their cycles. Ends with bench_end().
+void bench_kernels ();
+
+/// @brief Emits the end of the benchmark so the runner script can stop earlier.
+void bench_end ();
+
+#endif // _BENCH_H_
\ No newline at end of file
@@ -17,36 +17,161 @@
 #define DISPLAY_LOGOS_AT_START T
 #define DISPLAY_TITLE_SCREEN T
 
+#ifndef RENDER_SHOW_TEXCOORD
 #define RENDER_SHOW_TEXCOORD F // Show texture coords? Is not optimized though
+#endif
 
 // If TRUE then it will change from floor to roof bg color at HInt. If FALSE then we use single bg color (unless other switch is used).
-#define RENDER_SET_FLOOR_AND_ROOF_COLORS_ON_HINT T
+// Useless with RENDER_FLOOR_CEILING_TEXTURED since Plane B covers the BG color.
+#define RENDER_SET_FLOOR_AND_ROOF_COLORS_ON_HINT (!RENDER_FLOOR_CEILING_TEXTURED)
 // If TRUE then it changes the BG color as a grey ramp effect. Only if hint multi callbacks siwtch is enabled.
 #define RENDER_SET_ROOF_COLOR_RAMP_ONLY_HINT_MULTI_CALLBACKS F
 
+#ifndef RENDER_MIRROR_PLANES_USING_CPU_RAM
 #define RENDER_MIRROR_PLANES_USING_CPU_RAM F // Mirror bottom half of planes into top hal, by using CPU and RAM
+#endif
+#ifndef RENDER_MIRROR_PLANES_USING_VDP_VRAM
 #define RENDER_MIRROR_PLANES_USING_VDP_VRAM F // Mirror bottom half of planes into top hal, by using VRAM to VRAM copy
+#endif
+#ifndef RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT
 #define RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT F // Mirror bottom half of planes into top hal, by using VSCROLL table manipulation at HINT
+#endif
+#ifndef RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS
 #define RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS F // Mirror bottom half of planes into top half, by using VSCROLL table manipulation at multiple HINTs (fully optimized)
+#endif
 #define HMC_START_OFFSET_FACTOR 1 // Only for hints using VSCroll, this marks the initial offset factor
 // Render only half bottom region of both planes to later mirror them using one of the many available strategies.
-#define RENDER_HALVED_PLANES RENDER_MIRROR_PLANES_USING_CPU_RAM | RENDER_MIRROR_PLANES_USING_VDP_VRAM | RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT | RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS
+#define RENDER_HALVED_PLANES (RENDER_MIRROR_PLANES_USING_CPU_RAM | RENDER_MIRROR_PLANES_USING_VDP_VRAM | RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT | RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS)
 
 // Doesn't save registers in the stack so call it at the begin of game loop.
+#ifndef RENDER_CLEAR_FRAMEBUFFER
 #define RENDER_CLEAR_FRAMEBUFFER F
+#endif
+// Keeps previous frame's wall span per column and only rewrites the tilemap rows that changed, so the framebuffer is never cleared.
+// Not used along with RENDER_HALVED_PLANES.
+#ifndef RENDER_INCREMENTAL_FRAMEBUFFER
+#define RENDER_INCREMENTAL_FRAMEBUFFER F
+#endif
+// Only DMA the framebuffer rows changed by RENDER_INCREMENTAL_FRAMEBUFFER, so a static camera costs no VRAM bandwidth. Needs RENDER_INCREMENTAL_FRAMEBUFFER.
+#ifndef RENDER_DMA_DIRTY_ROWS
+#define RENDER_DMA_DIRTY_ROWS F
+#endif
+// Skips clearing, raycasting and DMAing the framebuffer on frames where posX, posY and angle didn't change, leaving that time to the game logic.
+#ifndef RENDER_SKIP_STATIC_FRAME
+#define RENDER_SKIP_STATIC_FRAME F
+#endif
+// Turning keeps its speed of one angle step per frame, but the view is only raycasted every RENDER_SMOOTH_ROTATION_SUBSTEPS steps.
+// Frames in between shift both planes with horizontal scroll by the steps turned so far and reuse last dda() result.
+// The shift uncovers up to (SUBSTEPS-1)*STEP_PX pixels of the plane columns past TILEMAP_COLUMNS at one edge, which get a copy of
+// the screen edge column on every recast (see RENDER_SMOOTH_ROTATION_GUARD_COLUMNS). Needs RENDER_SKIP_STATIC_FRAME.
+#ifndef RENDER_SMOOTH_ROTATION
+#define RENDER_SMOOTH_ROTATION F
+#endif
+#define RENDER_SMOOTH_ROTATION_SUBSTEPS 3 // Angle steps (1024/AP) per recast. dda() is skipped on 2 out of 3 turning frames.
+// Screen pixels swept by an angle step: the 90 degrees FOV (256 angle units) spans TILEMAP_COLUMNS*8 pixels
+#define RENDER_SMOOTH_ROTATION_STEP_PX ((1024/AP) * TILEMAP_COLUMNS*8 / 256)
+// Every column is DMAed straight from a ROM table holding all the possible columns (see tab_column_patterns.h), with VDP auto increment
+// set to the plane row stride. The framebuffer is not cleared and write_vline() only stores the pattern id. Trades 192KB of ROM for the CPU writes.
+// Not used along with RENDER_HALVED_PLANES, RENDER_INCREMENTAL_FRAMEBUFFER nor RENDER_SHOW_TEXCOORD.
+#ifndef RENDER_DMA_COLUMNS_FROM_ROM
+#define RENDER_DMA_COLUMNS_FROM_ROM F
+#endif
+// Every pair of 4 px columns goes into a single tilemap entry of Plane A, using a dictionary of combined 8 px tiles (see tab_tiles_pair.h).
+// Halves the framebuffer RAM and its DMA, and there is no clear. Plane B is left free. Not pixel exact against the two planes mode:
+// pairs outside the dictionary use the nearest one, and a combined tile has a single palette, so where an X side wall (PAL0) and
+// a Y side wall (PAL1) meet inside a tile the odd column shows with the even column's palette.
+// Not used along with RENDER_HALVED_PLANES, RENDER_INCREMENTAL_FRAMEBUFFER, RENDER_DMA_COLUMNS_FROM_ROM nor RENDER_SHOW_TEXCOORD.
+#ifndef RENDER_SINGLE_PLANE_TILES_PAIR
+#define RENDER_SINGLE_PLANE_TILES_PAIR F
+#endif
+// Plane regions held by the framebuffer: Plane A and Plane B, or only Plane A with RENDER_SINGLE_PLANE_TILES_PAIR
+#if RENDER_SINGLE_PLANE_TILES_PAIR
+#define FRAME_BUFFER_PLANES 1
+#else
+#define FRAME_BUFFER_PLANES 2
+#endif
+// Plane B horizontal scroll. With both planes in use Plane B is offset by 4 pixels so its columns interleave with those of Plane A.
+#if RENDER_SINGLE_PLANE_TILES_PAIR
+#define PLANE_B_HSCROLL 0
+#else
+#define PLANE_B_HSCROLL 4
+#endif
+// Plane columns past each screen edge that RENDER_SMOOTH_ROTATION's horizontal scroll can uncover, Plane B offset included.
+// They live at plane columns [TILEMAP_COLUMNS, TILEMAP_COLUMNS + GUARD) on the right and [PLANE_COLUMNS - GUARD, PLANE_COLUMNS) on the left.
+#define RENDER_SMOOTH_ROTATION_GUARD_COLUMNS (((RENDER_SMOOTH_ROTATION_SUBSTEPS-1)*RENDER_SMOOTH_ROTATION_STEP_PX + PLANE_B_HSCROLL + 7) / 8)
+// Textured floor and ceiling on the Plane B left free by RENDER_SINGLE_PLANE_TILES_PAIR. Every view (angle and position buckets) has its
+// own precomputed tileset (see tab_floor_ceiling.h), streamed into a VRAM back buffer a chunk per frame and then swapped in. Needs RENDER_SINGLE_PLANE_TILES_PAIR.
+#ifndef RENDER_FLOOR_CEILING_TEXTURED
+#define RENDER_FLOOR_CEILING_TEXTURED F
+#endif
 // Slightly faster with the use of SP as pointer. Doesn't save registers in the stack so call it at the begin of game loop. Overwrites USP so be sure is not used by any interruption callback.
+#ifndef RENDER_CLEAR_FRAMEBUFFER_WITH_SP
 #define RENDER_CLEAR_FRAMEBUFFER_WITH_SP T
+#endif
 
+#ifndef RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED
 #define RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED T
+#endif
+#ifndef RENDER_USE_TAB_WALL_HIT_FUSED
+#define RENDER_USE_TAB_WALL_HIT_FUSED F // One move.l gets both h2 and tileAttrib from a single table. Takes precedence over RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED.
+#endif
+#ifndef RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
 #define RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS T
+#endif
+#ifndef RENDER_USE_MAP_HIT_COMPRESSED
 #define RENDER_USE_MAP_HIT_COMPRESSED F
-#define RENDER_COLUMNS_UNROLL 2 // Use only multiple of 2. Supported values: 1, 2, 4. Glitches appear with 4, dang!
+#endif
+#ifndef MAP_HIT_CODEC
+#define MAP_HIT_CODEC MAP_HIT_CODEC_TURBOPFOR // Format of the compressed map hit table. See map_hit_compressed.h for the available codecs.
+#endif
+#ifndef RENDER_USE_DDA_QUADRANT_KERNELS
+#define RENDER_USE_DDA_QUADRANT_KERNELS F // Columns are dispatched per angle into sign specialized DDA kernels. Not used along with RENDER_USE_MAP_HIT_COMPRESSED.
+#endif
+#ifndef RENDER_USE_TAB_DELTAS_FOLDED
+#define RENDER_USE_TAB_DELTAS_FOLDED F // tab_deltas only keeps the first quadrant of angles (4x less ROM). The quadrant is resolved once per frame. Not used along with RENDER_USE_DDA_QUADRANT_KERNELS.
+#endif
+#ifndef RENDER_COLUMNS_UNROLL
+#define RENDER_COLUMNS_UNROLL 2 // Columns processed per iteration of the columns loop. Any value that divides PIXEL_COLUMNS (eg: 1, 2, 4, 5, 8, 10, 16).
+#endif
+// dda() records the wall distance of every column into a depth buffer in fixed RAM, so sprites can be occluded by walls. See depth_buffer.h
+#ifndef RENDER_DEPTH_BUFFER
+#define RENDER_DEPTH_BUFFER F
+#endif
 #define RENDER_ENABLE_FRAME_LOAD_CALCULATION T
 
+// Runs game_loop_auto() instead of game_loop() and every frame emits 68K cycles, DMA bytes and VBlank overrun through KDebug. See bench_n_run.sh
+#ifndef BENCH_AUTO_RUN
+#define BENCH_AUTO_RUN F
+#endif
+#define BENCH_POS_STEPPING 1 // Position stepping used by game_loop_auto(). Bigger values give shorter runs.
+// Instead of the game loop, times every hand written kernel in isolation with fixed inputs and emits its 68K cycles through KDebug. See bench_n_run.sh
+#ifndef BENCH_KERNELS
+#define BENCH_KERNELS F
+#endif
+
+// Set by host/Makefile. Compiles only the renderer (dda() and the framebuffer) with C versions of the asm blocks, so it runs on x86. See host/Makefile
+#ifndef HOST_BUILD
+#define HOST_BUILD F
+#endif
+
+#define PROFILER F // Records scanlines spent per zone of game_loop() into a ring buffer. See profiler.h
+#define PROFILER_OVERLAY T // Shows average scanlines per zone next to the CPU load. Needs RENDER_ENABLE_FRAME_LOAD_CALCULATION since it uses its font.
+#define PROFILER_DUMP_KDEBUG F // Emits min/avg/max scanlines per zone through KDebug every time the ring buffer wraps around
+
+#define DMA_STATS F // Records per frame the DMA bytes, V-Counter at start/end and scanlines stolen from active display of VInt and HUD HInt. See dma_stats.h
+#define DMA_STATS_OVERLAY T // Shows VInt and HInt averages under the CPU load. Needs RENDER_ENABLE_FRAME_LOAD_CALCULATION since it uses its font.
+#define DMA_STATS_DUMP_KDEBUG F // Emits the stats of every window through KDebug every time the ring buffer wraps around
+
 #define DMA_ALLOW_BUFFERED_SPRITE_TILES F // Set to TRUE if you have compressed sprites, otherwise FALSE.
 #define DMA_MAX_QUEUE_CAPACITY 8 // How many objects we can hold without crashing the system due to array out of bound access.
 #define DMA_TILES_THRESHOLD_FOR_HINT 200 // when this number of tiles is exceeded we move the exceeding tiles to VInt queue.
 #define DMA_LENGTH_IN_WORD_THRESHOLD_FOR_HINT ((DMA_TILES_THRESHOLD_FOR_HINT * 32) / 2)
+#ifndef DMA_SCHEDULER
+#define DMA_SCHEDULER F // Single tiles queue shared by HInt and VInt with per window budgets, priorities and deadlines. See dma_sched.h
+#endif
+#define DMA_SCHED_HINT_BUDGET_IN_WORD DMA_LENGTH_IN_WORD_THRESHOLD_FOR_HINT // Tiles words DMAed at the HUD palettes HInt.
+#define DMA_SCHED_VINT_BUDGET_IN_WORD 2048 // Tiles words DMAed at VInt once the framebuffer is done. Tune it with bench_n_run.sh vblank_overrun_lines.
+#define DMA_SCHED_QUEUE_CAPACITY (DMA_MAX_QUEUE_CAPACITY*2) // Deferred transfers stay in the queue, so it holds more than a frame worth of objects.
 
 #define DMA_ENQUEUE_HUD_TILEMAP_TO_FLUSH_AT_HINT T
 #define DMA_ENQUEUE_HUD_TILEMAP_TO_FLUSH_AT_VINT F
@@ -63,8 +188,32 @@
 #define FONT_TILES_TOTAL 0 // No font tiles
 #endif
 
+// Combined tiles loaded by RENDER_SINGLE_PLANE_TILES_PAIR (see tab_tiles_pair_dict.h). Keep in sync with tab_tiles_pair_generator.js
+#define TILES_PAIR_DICT_SIZE 256
+#define TILES_PAIR_WALL_TILES (1 + 8*8 + 8*8) // Wall tiles combined by the dictionary: empty tile + 8 heights * 8 shades * 2 banks
+#if RENDER_SINGLE_PLANE_TILES_PAIR
+#define VRAM_INDEX_AFTER_WALL_TILES TILES_PAIR_DICT_SIZE
+#else
 #define VRAM_INDEX_AFTER_WALL_TILES (1 + 8*8 + 8*8)
+#endif
+
+// Views precomputed for RENDER_FLOOR_CEILING_TEXTURED (see tab_floor_ceiling.h). Keep in sync with tab_floor_ceiling_generator.js
+// The floor is decoupled from the walls: it snaps every 1024/FLOOR_CEILING_ANGLES = 64 angle units while walls turn every 1024/AP = 8,
+// and a new view shows up FLOOR_CEILING_TILES/FLOOR_CEILING_DMA_CHUNK_TILES + 1 = 4 frames after the camera entered it (plus up to
+// FLOOR_CEILING_DMA_MAX_DELAY_FRAMES with DMA_SCHEDULER), so it slides
+// against the walls while turning. Matching AP would take 8 times the ROM (~3MB).
+#define FLOOR_CEILING_ANGLES 16 // Angle buckets along the 1024 angle units
+#define FLOOR_CEILING_POS_STEPS 2 // Position buckets per axis inside a map cell
+#define FLOOR_CEILING_VIEWS (FLOOR_CEILING_ANGLES*FLOOR_CEILING_POS_STEPS*FLOOR_CEILING_POS_STEPS)
+#define FLOOR_CEILING_TILES 192 // Tiles per view. Multiple of FLOOR_CEILING_DMA_CHUNK_TILES.
+#define FLOOR_CEILING_DMA_CHUNK_TILES 64 // Tiles streamed per frame. Power of two so an aligned chunk never crosses a 128KB boundary.
+#define FLOOR_CEILING_DMA_MAX_DELAY_FRAMES 2 // With DMA_SCHEDULER, frames a chunk or the tilemap can wait for VBlank budget. Below FLOOR_CEILING_TILES/FLOOR_CEILING_DMA_CHUNK_TILES + 1.
+#if RENDER_FLOOR_CEILING_TEXTURED
+#define VRAM_INDEX_FLOOR_CEILING VRAM_INDEX_AFTER_WALL_TILES
+#define VRAM_INDEX_FONT (VRAM_INDEX_FLOOR_CEILING + 2*FLOOR_CEILING_TILES) // Front and back buffers
+#else
 #define VRAM_INDEX_FONT VRAM_INDEX_AFTER_WALL_TILES
+#endif
 #define VRAM_INDEX_HUD (VRAM_INDEX_FONT + FONT_TILES_TOTAL)
 
 #define FS 8 // Fixed Point size in bits
@@ -84,10 +233,20 @@
 #define PLANE_COLUMNS 64
 
 // 320/4=80. 256/4=64.
-#define PIXEL_COLUMNS TILEMAP_COLUMNS*2
+#define PIXEL_COLUMNS (TILEMAP_COLUMNS*2)
 
 #define MAP_SIZE 16
 #define MAP_FRACTION 32 // How much we allow the player to be close to any wall
+// map[][] lives in RAM and is loaded from the levels in ROM (see map_matrix.h). START loads the next level.
+// Not used along with RENDER_USE_MAP_HIT_COMPRESSED, since tab_map_hit is generated from level 0.
+#ifndef MAP_RUNTIME_LEVELS
+#define MAP_RUNTIME_LEVELS F
+#endif
+// Map cell values 1..MAP_MATERIALS select the wall material (palette per side and tile bank). See tab_wall_materials.h
+// Needs MAP_RUNTIME_LEVELS. Replaces RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED. Not used along with RENDER_USE_TAB_WALL_HIT_FUSED.
+#ifndef RENDER_WALL_MATERIALS
+#define RENDER_WALL_MATERIALS F
+#endif
 #define MIN_POS_XY (FP + MAP_FRACTION)
 #define MAX_POS_XY (FP*(MAP_SIZE-1) - MAP_FRACTION)
 
@@ -98,5 +257,6 @@
 #define MAP_HIT_OFFSET_MAPXY 0
 #define MAP_HIT_OFFSET_SIDEDISTXY 4
 #define MAP_HIT_MIN_CALCULATED_INDEX 174080
+#define MAP_HIT_MAX_CALCULATED_INDEX 2447359
 
 #endif // _CONSTS_H_
\ No newline at end of file
@@ -37,10 +37,17 @@
 // If PLANE_COLUMNS = 32 then 4096 bytes + 1 tile (129 tiles or more).
 #define LAST_FREE_BYTES_LENGTH ((PLANE_COLUMNS == 64 ? 0xFFFF : 0xDFFF) - LAST_FREE_VRAM_AT + 32)
 
+#if HOST_BUILD
+#include <types.h>
+// Host build has no fixed RAM layout, so the frame_buffer is a regular array (linked with -no-pie to keep it in 32 bits address).
+extern u16 host_frame_buffer[VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES];
+#define RAM_FIXED_FRAME_BUFFER_ADDRESS ((u32) host_frame_buffer)
+#else
 #include <memory_base.h>
 
 // This is the fixed RAM address for the frame_buffer array, before the end of the heap.
-#define RAM_FIXED_FRAME_BUFFER_ADDRESS (MEMORY_HIGH - (VERTICAL_ROWS*TILEMAP_COLUMNS*2)*2)
+#define RAM_FIXED_FRAME_BUFFER_ADDRESS (MEMORY_HIGH - (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES)*2)
+#endif
 #if PLANE_COLUMNS == 64
 #include "hud_320.h"
 #else
@@ -71,4 +78,12 @@
 // This is the fixed RAM address for the WEAPON palettes data.
 #define RAM_FIXED_WEAPON_PALETTES_ADDRESS (RAM_FIXED_HUD_PALETTES_ADDRESS - (16*WEAPON_USED_PALS)*2)
 
+// This is the fixed RAM address for the depth buffer array (one u8 per column). See depth_buffer.h
+#if HOST_BUILD
+extern u8 host_depth_buffer[PIXEL_COLUMNS];
+#define RAM_FIXED_DEPTH_BUFFER_ADDRESS ((u32) host_depth_buffer)
+#else
+#define RAM_FIXED_DEPTH_BUFFER_ADDRESS (RAM_FIXED_WEAPON_PALETTES_ADDRESS - PIXEL_COLUMNS)
+#endif
+
 #endif // _CONSTS_EXT_H_
\ No newline at end of file
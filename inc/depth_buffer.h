@@ -0,0 +1,35 @@
+#ifndef _DEPTH_BUFFER_H_
+#define _DEPTH_BUFFER_H_
+
+#include <types.h>
+#include "consts.h"
+
+/**
+ * Per column depth buffer (see RENDER_DEPTH_BUFFER in consts.h).
+ * dda() stores for every one of the PIXEL_COLUMNS columns the perpendicular distance to the wall it hit, as sideDist >> DEPTH_BUFFER_SHIFT,
+ * into a u8 array at RAM_FIXED_DEPTH_BUFFER_ADDRESS. Columns with no wall hit get DEPTH_BUFFER_FAR.
+ * Sprites and billboards convert their distance with DEPTH_BUFFER_FROM_DIST() and clip against it: a column of the sprite is visible
+ * when its depth is smaller than the one in the buffer. The buffer holds last dda() result until next one.
+ */
+
+#define DEPTH_BUFFER_SHIFT 4 // sideDist goes up to FP*(STEP_COUNT+1)-1 = 4095, so it fits in a u8 with 1/16 of a map cell precision
+#define DEPTH_BUFFER_FAR 255 // No wall hit
+
+/// @brief Depth of a sprite at the given perpendicular distance, in the same fixed point units than sideDist (FP is one map cell).
+#define DEPTH_BUFFER_FROM_DIST(dist) ((dist) >= (u16)(256 << DEPTH_BUFFER_SHIFT) ? (u8)DEPTH_BUFFER_FAR : (u8)((dist) >> DEPTH_BUFFER_SHIFT))
+
+// Points to the depth of the column being raycasted. Reset by dda() and advanced once per column.
+extern u8* depth_ptr;
+
+/// @brief Tells whether any column in [column, column + width) is visible at the given depth. Exits on the first visible column.
+bool depth_buffer_isVisible (u16 column, u16 width, u8 depth);
+
+/// @brief Visibility of a group of up to 16 columns starting at column, one compare per column.
+/// @return bit i set means column + i is visible at the given depth. Eg: pick the sprite frame or hide the hardware sprites of the group.
+u16 depth_buffer_visibleMask (u16 column, u16 width, u8 depth);
+
+/// @brief Trims the occluded columns at both ends of [*left, *right). Walls in between don't split the span.
+/// @return FALSE if every column is occluded, in which case left and right are left untouched.
+bool depth_buffer_clipSpan (u16* left, u16* right, u8 depth);
+
+#endif // _DEPTH_BUFFER_H_
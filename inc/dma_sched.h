@@ -0,0 +1,46 @@
+#ifndef _DMA_SCHED_H_
+#define _DMA_SCHED_H_
+
+#include <types.h>
+#include "consts.h"
+
+/**
+ * DMA scheduler (see DMA_SCHEDULER in consts.h).
+ * Tiles transfers go into a single queue instead of the separate HInt and VInt queues. Every frame has two windows:
+ *   - the HUD palettes HInt, with a budget of DMA_SCHED_HINT_BUDGET_IN_WORD words.
+ *   - VBlank, with a budget of DMA_SCHED_VINT_BUDGET_IN_WORD words left after the framebuffer.
+ * Each window takes transfers by priority and then by deadline, splitting the one that doesn't fully fit in the budget.
+ * What is left after VBlank stays queued for next frame, unless its deadline is over in which case it goes anyway
+ * even if that means overrunning into active display. Transfers of the same priority and maxDelayFrames keep the order
+ * they were enqueued in, so a producer can rely on a later one never landing before an earlier one.
+ * HInt never reorders the queue nor changes its size, only VInt does. Enqueueing runs with interrupts disabled so neither
+ * of them sees a half appended entry. Transfers enqueued on a full queue (DMA_SCHED_QUEUE_CAPACITY) are dropped and counted
+ * in dma_sched_dropped, not static so it can be inspected with the emulator's memory viewer.
+ */
+
+#define DMA_SCHED_PRIO_HIGH 0 // Visible right now. Eg: current sprite frame.
+#define DMA_SCHED_PRIO_LOW 1 // Can wait. Eg: preloading.
+
+extern u16 dma_sched_dropped;
+
+void dma_sched_reset ();
+
+/// @brief Queues a transfer to VRAM.
+/// @param from source address in RAM or ROM
+/// @param to destination address in VRAM
+/// @param lenInWord length in words
+/// @param prio DMA_SCHED_PRIO_HIGH or DMA_SCHED_PRIO_LOW
+/// @param maxDelayFrames how many frames it can be deferred. 0 means it must be done this frame.
+void dma_sched_enqueue (void* from, u16 to, u16 lenInWord, u16 prio, u16 maxDelayFrames);
+
+/// @brief Same than dma_sched_enqueue() but from is a temp buffer got from DMA_allocateTemp(), released once DMAed.
+/// Never deferred since temp buffers are released at the end of the frame.
+void dma_sched_enqueueBuffered (void* from, u16 to, u16 lenInWord);
+
+/// @brief DMAs up to DMA_SCHED_HINT_BUDGET_IN_WORD words. Call it from the HUD palettes HInt.
+void dma_sched_flushHint ();
+
+/// @brief DMAs up to DMA_SCHED_VINT_BUDGET_IN_WORD words plus those transfers whose deadline is over. Call it from VInt.
+void dma_sched_flushVint ();
+
+#endif // _DMA_SCHED_H_
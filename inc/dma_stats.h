@@ -0,0 +1,83 @@
+#ifndef _DMA_STATS_H_
+#define _DMA_STATS_H_
+
+#include <types.h>
+#include "consts.h"
+#include "bench.h"
+
+/**
+ * DMA instrumentation (see DMA_STATS in consts.h).
+ * Every DMA batch, the one at VInt and the one at the HUD palettes HInt, records into a RAM ring buffer of DMA_STATS_RING_FRAMES frames:
+ *   - the bytes transferred
+ *   - the V-Counter at the start and at the end of the batch
+ *   - the scanlines stolen from active display: when the batch ends out of VBlank (status register flag, valid on NTSC and PAL)
+ *     having started in VBlank, or with the V-Counter wrapped below the one at the start, the batch ran into next display period.
+ * The ring buffer dma_stats_ring[] is not static so it can be inspected with the emulator's memory viewer (the dump buffer).
+ * Once the ring buffer wraps around it shows averages and maximums in the WINDOW plane, and optionally dumps them through KDebug.
+ */
+
+#define DMA_STATS_WINDOW_VINT 0
+#define DMA_STATS_WINDOW_HINT 1
+#define DMA_STATS_WINDOWS 2
+
+#define DMA_STATS_RING_FRAMES 32 // Must be a power of 2
+
+#define DMA_STATS_OVERLAY_X 1 // In tiles
+#define DMA_STATS_OVERLAY_Y 25 // In tiles. Row under the CPU load string
+#define DMA_STATS_OVERLAY_LEN 30 // In chars: bytes, end and stolen numbers (5+1 + 3+1 + 3+1) plus a space, per window
+
+typedef struct {
+    u16 bytes[DMA_STATS_WINDOWS];
+    u8 vcntStart[DMA_STATS_WINDOWS];
+    u8 vcntEnd[DMA_STATS_WINDOWS];
+    u8 stolenLines[DMA_STATS_WINDOWS];
+    u8 pad[2];
+} DmaStatsFrame;
+
+extern DmaStatsFrame dma_stats_ring[DMA_STATS_RING_FRAMES];
+
+// Accounts DMA bytes for the benchmark and for the current DMA batch, whichever is enabled
+#if BENCH_AUTO_RUN && DMA_STATS
+#define DMA_COUNT_BYTES(bytes) do { u16 b__ = (bytes); bench_addDmaBytes(b__); dma_stats_addBytes(b__); } while (0)
+#elif BENCH_AUTO_RUN
+#define DMA_COUNT_BYTES(bytes) bench_addDmaBytes(bytes)
+#elif DMA_STATS
+#define DMA_COUNT_BYTES(bytes) dma_stats_addBytes(bytes)
+#else
+#define DMA_COUNT_BYTES(bytes) ((void)(bytes))
+#endif
+
+#if DMA_STATS
+#define DMA_STATS_BATCH_BEGIN(window) dma_stats_batchBegin(window)
+#define DMA_STATS_BATCH_END(window) dma_stats_batchEnd(window)
+#define DMA_STATS_FRAME_END() dma_stats_frameEnd()
+#else
+#define DMA_STATS_BATCH_BEGIN(window)
+#define DMA_STATS_BATCH_END(window)
+#define DMA_STATS_FRAME_END()
+#endif
+
+void dma_stats_reset ();
+
+/// @brief Stores current V-Counter as the start of the window's batch. Following bytes are accounted to this window.
+void dma_stats_batchBegin (u16 window);
+
+/// @brief Accumulates bytes into the window of the batch in progress.
+void dma_stats_addBytes (u16 bytes);
+
+/// @brief Stores current V-Counter as the end of the window's batch and the scanlines stolen from active display, if any.
+void dma_stats_batchEnd (u16 window);
+
+/// @brief Moves the ring buffer to next frame. Refreshes the overlay (if enabled) and dumps the stats
+/// through KDebug (if enabled) once the ring buffer wraps around.
+/// Call it once per frame, after waiting for VBlank since the overlay is written into VRAM using the CPU.
+void dma_stats_frameEnd ();
+
+/// @brief Shows per window the average bytes, the average V-Counter at the end and the max stolen scanlines on the WINDOW plane.
+/// Only digits since the font has no letters loaded: VInt numbers first, then HInt.
+void dma_stats_showOverlay ();
+
+/// @brief Emits one line per window through KDebug as: DMA,<window>,<avgBytes>,<maxBytes>,<avgStart>,<avgEnd>,<framesStealing>,<maxStolen>
+void dma_stats_dump ();
+
+#endif // _DMA_STATS_H_
@@ -0,0 +1,23 @@
+#ifndef _FLOOR_CEILING_H_
+#define _FLOOR_CEILING_H_
+
+#include <types.h>
+
+/**
+ * Textured floor and ceiling (see RENDER_FLOOR_CEILING_TEXTURED in consts.h).
+ * Plane B shows the precomputed view (see tab_floor_ceiling.h) nearest to the camera. When the camera moves into another view
+ * its tileset is streamed into the VRAM back buffer, FLOOR_CEILING_DMA_CHUNK_TILES per frame, and on the next frame Plane B
+ * tilemap is DMAed pointing to it, which swaps front and back buffers. Tiles and tilemap never go in the same VBlank, unless
+ * DMA_SCHEDULER deferred the tiles (up to FLOOR_CEILING_DMA_MAX_DELAY_FRAMES), and even then the tiles go first.
+ */
+
+/// @brief Forgets the shown view, so next floor_ceiling_update() starts streaming the current one. Plane B must be cleared.
+void floor_ceiling_reset ();
+
+/// @brief Call it once per frame after the camera was updated. Enqueues at most one tiles chunk or the Plane B tilemap.
+/// @param posX camera position in fixed point
+/// @param posY camera position in fixed point
+/// @param angle camera angle in [0, 1023]
+void floor_ceiling_update (u16 posX, u16 posY, u16 angle);
+
+#endif // _FLOOR_CEILING_H_
@@ -24,6 +24,49 @@ extern u16* column_ptr;
 void write_vline (u16 h2, u16 tileAttrib);
 void write_vline_halved (u16 h2, u16 tileAttrib);
 
+/// @brief Same than write_vline() but h2 and tileAttrib come packed as (h2 << 16) | tileAttrib, as stored in tab_wall_hit_fused.h.
+void write_vline_fused (u32 h2_tileAttrib);
+/// @brief Same than write_vline_halved() but h2 and tileAttrib come packed as (h2 << 16) | tileAttrib, as stored in tab_wall_hit_fused.h.
+void write_vline_halved_fused (u32 h2_tileAttrib);
+
+/// @brief Sets all the column spans as empty, matching the zeroed framebuffer. Used by RENDER_INCREMENTAL_FRAMEBUFFER.
+void fb_reset_column_spans_state ();
+/// @brief Points to the span of the first column. Call it before the first write_vline_incremental() of the frame.
+void fb_reset_column_spans ();
+/// @brief Same result than clear_buffer() + write_vline(), but only rewrites the rows of the column that differ from previous frame.
+/// Advances to next column span, so it must be called exactly once per column (see write_vline_incremental_empty()).
+void write_vline_incremental (u16 h2, u16 tileAttrib);
+/// @brief Empties the column, rewriting only the rows that were used in previous frame. Advances to next column span.
+void write_vline_incremental_empty ();
+
+/// @brief Stores into the column the id of the tab_column_patterns entry that equals clear_buffer() + write_vline(h2, tileAttrib).
+/// Used by RENDER_DMA_COLUMNS_FROM_ROM, where the first row of Plane A and B regions of the framebuffer holds the id of every column.
+void write_vline_rom (u16 h2, u16 tileAttrib);
+/// @brief Stores into the column the id of the empty pattern (no wall hit).
+void write_vline_rom_empty ();
+/// @brief DMAs every column straight from its tab_column_patterns entry, with VDP stepping set to the plane row stride.
+void fb_DMA_columns_from_ROM ();
+/// @brief Host build counterpart of fb_DMA_columns_from_ROM(): expands every pattern id into its framebuffer column.
+void fb_expand_columns_from_ROM ();
+
+/// @brief Copies the left and right edge columns of every plane region of the framebuffer, as DMAed later by fb_DMA_guard_columns().
+/// Call it once dda() is done. Used by RENDER_SMOOTH_ROTATION.
+void fb_fill_guard_columns ();
+/// @brief DMAs the copied edge columns into the RENDER_SMOOTH_ROTATION_GUARD_COLUMNS plane columns past each screen edge, with VDP
+/// stepping set to the plane row stride. Only along with the framebuffer DMA of the same view.
+void fb_DMA_guard_columns ();
+
+/// @brief Used by RENDER_SINGLE_PLANE_TILES_PAIR. An even column is kept until the odd one arrives, then both go into a single
+/// column of Plane A region using the combined tiles of tab_tiles_pair.h. Writes all the rows, so the framebuffer is never cleared.
+void write_vline_pair (u16 h2, u16 tileAttrib);
+/// @brief Same than write_vline_pair() for a column with no wall hit.
+void write_vline_pair_empty ();
+
+// Bit i set means top row i and its bottom mirror row (VERTICAL_ROWS-1-i) changed since last DMA. Used by RENDER_DMA_DIRTY_ROWS.
+#define FB_DIRTY_ROWS_ALL ((1 << (VERTICAL_ROWS/2)) - 1)
+extern u16 fb_dirty_rows_A;
+extern u16 fb_dirty_rows_B;
+
 void fb_set_top_entries_column (u16 pixel_column);
 void fb_increment_entries_column ();
 
@@ -2,9 +2,28 @@
 #define _GAME_LOOP_H_
 
 #include <types.h>
+#include "consts.h"
 
 void game_loop ();
 
 void game_loop_auto ();
 
+#if HOST_BUILD
+/// @brief Clears the framebuffer and raycasts the view at the given position and angle into it. Only in the host build.
+void game_loop_renderFrame (u16 posX, u16 posY, u16 angle);
+/// @brief Sets up the view the way game_loop() does before its first frame, for game_loop_inputFrame(). Only in the host build.
+void game_loop_inputStart (u16 posX, u16 posY, u16 angle);
+/// @brief Runs the renderer part of one game_loop() frame: handle_input() with the joypad state returned by the host's
+/// joy_readJoypad_joy1(), then clearBuffer() and dda() unless RENDER_SKIP_STATIC_FRAME skips the frame. Only in the host build.
+/// @return TRUE if the framebuffer was rendered.
+bool game_loop_inputFrame (u16* posX, u16* posY, u16* angle);
+#endif
+
+#if BENCH_KERNELS
+/// @brief Calls hitOnSideX() (the wall shading lookup plus its write_vline) for the given distance. Only used by bench_kernels().
+void game_loop_benchHitOnSideX (u16 sideDistX, u16 mapY);
+/// @brief Calls hitOnSideY() (the wall shading lookup plus its write_vline) for the given distance. Only used by bench_kernels().
+void game_loop_benchHitOnSideY (u16 sideDistY, u16 mapX);
+#endif
+
 #endif // _GAME_LOOP_H_
\ No newline at end of file
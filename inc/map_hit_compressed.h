@@ -11,7 +11,13 @@
  *   max calculated index: 2447359
  *   final array size: (2447359 - 174080) + 1 = 2273280 elems
  * 
- * Then run script map_hit_block_turbopfor_16_compressor.js. Check correct values of constants before script execution.
+ * Then run the compressor script of the codec selected by MAP_HIT_CODEC (see consts.h) and paste its output into the codec file:
+ *   MAP_HIT_CODEC_TURBOPFOR:   map_hit_block_turbopfor_16_compressor.js  -> map_hit_codec_turbopfor.c
+ *   MAP_HIT_CODEC_RLE:         map_hit_rle_compressor.js                 -> map_hit_codec_rle.c
+ *   MAP_HIT_CODEC_BLOCK_DELTA: map_hit_block_delta_compressor.js         -> map_hit_codec_block_delta.c
+ *   MAP_HIT_CODEC_SIMPLE16:    map_hit_simple16_bitpacking_compressor.js -> map_hit_codec_simple16.c
+ *   MAP_HIT_CODEC_BANKED:      map_tables_generator tab_map_hit_banked   -> map_hit_codec_banked.c
+ * Check correct values of constants before script execution.
  *
  * In order to correctly access the table you need to calculate the offsets and also use the MAP_HIT_MIN_CALCULATED_INDEX:
  *   u32 calculatedIndex = (((mapX * MAP_SIZE + mapY) * (1024/(1024/AP)) + a) * PIXEL_COLUMNS + column) - MAP_HIT_MIN_CALCULATED_INDEX;
@@ -20,6 +26,10 @@
  *   u16 hit_mapXY = (value >> MAP_HIT_OFFSET_MAPXY) & MAP_HIT_MASK_MAPXY;
  *   u16 hit_mapXY = (value >> MAP_HIT_OFFSET_SIDEDISTXY) & MAP_HIT_MASK_SIDEDISTXY;
  * 
+ * With MAP_HIT_COMPRESSED_DECODE_ROW (see map_hit_compressed.c) map_hit_setRow() unpacks the PIXEL_COLUMNS values of the row
+ * in one pass using the codec's map_hit_codec_decodeRow(), and map_hit_decompressAt() just reads them back column by column.
+ * Build with BENCH_AUTO_RUN to get the codec ROM size and its decode cycles per row (see bench_n_run.sh).
+ * 
  * How to tell which side X or Y does hit_mapXY go?
  *   if (hit_mapXY < sideDistY)
  *       ...
@@ -27,6 +37,48 @@
  *       ...
  */
 
+#define MAP_HIT_CODEC_TURBOPFOR 0 // Blocks of MAP_HIT_COMPRESSED_BLOCK_ROWS rows stored as base + fixed bit width offsets. Deduplicated blocks.
+#define MAP_HIT_CODEC_RLE 1 // Runs of {value, count} per row.
+#define MAP_HIT_CODEC_BLOCK_DELTA 2 // First value of the row followed by the deltas. Same size than the raw table, only here as reference.
+#define MAP_HIT_CODEC_SIMPLE16 3 // 32 bits words holding a 4 bits selector and up to 28 values. Every row starts on a new word.
+#define MAP_HIT_CODEC_BANKED 4 // No compression. The table is split into SSF2 banks of 512KB beyond the 4MB and rows are read straight from ROM.
+
+#if MAP_HIT_CODEC == MAP_HIT_CODEC_TURBOPFOR
+#define MAP_HIT_CODEC_NAME "TURBOPFOR"
+#define MAP_HIT_COMPRESSED_BLOCK_ROWS 4
+#define MAP_HIT_COMPRESSED_BLOCK_SIZE (PIXEL_COLUMNS*MAP_HIT_COMPRESSED_BLOCK_ROWS)
+#elif MAP_HIT_CODEC == MAP_HIT_CODEC_RLE
+#define MAP_HIT_CODEC_NAME "RLE"
+#elif MAP_HIT_CODEC == MAP_HIT_CODEC_BLOCK_DELTA
+#define MAP_HIT_CODEC_NAME "BLOCK_DELTA"
+#elif MAP_HIT_CODEC == MAP_HIT_CODEC_SIMPLE16
+#define MAP_HIT_CODEC_NAME "SIMPLE16"
+#elif MAP_HIT_CODEC == MAP_HIT_CODEC_BANKED
+#define MAP_HIT_CODEC_NAME "BANKED"
+// The bank holding the current row is mapped into this 512KB region (0x380000-0x3FFFFF), so the rest of the ROM must fit in the first 3.5MB.
+#define MAP_HIT_BANK_REGION 7
+#define MAP_HIT_BANK_SIZE 0x80000
+// Only whole rows go into a bank, so a row never crosses banks
+#define MAP_HIT_BANK_ROWS (MAP_HIT_BANK_SIZE / ((PIXEL_COLUMNS)*2))
+#else
+#error "Unknown MAP_HIT_CODEC"
+#endif
+
+// Amount of rows of PIXEL_COLUMNS elems in the uncompressed table
+#define MAP_HIT_ROWS ((MAP_HIT_MAX_CALCULATED_INDEX - MAP_HIT_MIN_CALCULATED_INDEX + 1) / (PIXEL_COLUMNS))
+
+/// @brief Codec interface. Unpacks the PIXEL_COLUMNS values of row rowIndex (in [0, MAP_HIT_ROWS)) into dst.
+/// Every codec implements it in its own map_hit_codec_*.c and only the one selected by MAP_HIT_CODEC is compiled.
+void map_hit_codec_decodeRow (u16 rowIndex, u16* dst);
+/// @brief Codec interface. Bytes of ROM taken by the codec tables.
+u32 map_hit_codec_romSize ();
+
+#if MAP_HIT_CODEC == MAP_HIT_CODEC_BANKED
+#define MAP_HIT_BANKS ((MAP_HIT_ROWS + MAP_HIT_BANK_ROWS - 1) / MAP_HIT_BANK_ROWS)
+/// @brief Switches the bank holding row rowIndex into MAP_HIT_BANK_REGION (only if not already there) and returns the row address.
+const u16* map_hit_codec_mapRow (u16 rowIndex);
+#endif
+
 void map_hit_reset_vars ();
 void map_hit_setRow (u16 posX, u16 posY, u16 a);
 void map_hit_setIndexForStartingColumn (u16 column);
@@ -4,6 +4,42 @@
 #include <types.h>
 #include "consts.h"
 
+#if MAP_RUNTIME_LEVELS
+
+#define MAP_LEVELS 2
+
+/// @brief Level format: the layout plus where the player starts. Only map[][] depends on it at runtime,
+/// the DDA tables (tab_deltas, tab_wall_div, perf hash) don't depend on the layout so every level shares them.
+typedef struct {
+    u16 posX; // in [MIN_POS_XY, MAX_POS_XY]
+    u16 posY; // in [MIN_POS_XY, MAX_POS_XY]
+    u16 angle; // in [0, 1023], multiple of (1024/AP)
+    const u8 (*layout)[MAP_SIZE]; // MAP_SIZE rows of MAP_SIZE cells. Outer cells must be walls.
+} MapLevel;
+
+extern const MapLevel map_levels[MAP_LEVELS];
+
+#if RENDER_WALL_MATERIALS
+// Layout cells are 0 for empty and 1..MAP_MATERIALS for a wall of that material. See tab_wall_materials.h
+#define MAP_MATERIALS 4
+// map[][] cells hold the column of tab_wall_materials_X/Y[] for each side, column = 2*(material-1) + parity of the cell.
+// Bits 0-2: column for a hit on side X (parity mapY&1). Bits 3-5: column for a hit on side Y (parity mapX&1). Bit 6: always set, so walls are never 0.
+#define MAP_CELL_WALL 0x40
+#define MAP_CELL_COLUMN_X_MASK 0x07
+#define MAP_CELL_COLUMN_Y_MASK 0x38
+#endif
+
+// Layout of the current level, copied from ROM by map_loadLevel()
+extern u8 map[MAP_SIZE][MAP_SIZE];
+
+/// @brief Copies the layout of the given level into map[][]. Start position is at map_levels[level].
+/// With RENDER_WALL_MATERIALS the cells are encoded as the table columns of their material.
+void map_loadLevel (u16 level);
+
+#else
+
 extern const u8 map[MAP_SIZE][MAP_SIZE];
 
+#endif // MAP_RUNTIME_LEVELS
+
 #endif // _MAP_MATRIX_H_
\ No newline at end of file
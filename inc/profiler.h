@@ -0,0 +1,60 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include <types.h>
+#include "consts.h"
+
+/**
+ * Per zone profiler (see PROFILER in consts.h).
+ * Every zone records the amount of scanlines (V-Counter delta) it took into a RAM ring buffer of PROF_RING_FRAMES frames.
+ * Values are approximated when the zone crosses the VBlank period, since the V-Counter jumps back some lines there.
+ * Then it shows the average of each zone in the WINDOW plane next to the CPU load, and optionally dumps min/avg/max
+ * through KDebug every time the ring buffer wraps around.
+ * When PROFILER is FALSE all the zone macros are compiled out.
+ */
+
+#define PROF_ZONE_CLEAR_BUFFER 0
+#define PROF_ZONE_HANDLE_INPUT 1
+#define PROF_ZONE_WEAPON_UPDATE 2
+#define PROF_ZONE_HUD_UPDATE 3
+#define PROF_ZONE_SPR_ENG_UPDATE 4
+#define PROF_ZONE_DDA 5
+#define PROF_ZONE_VBLANK_WAIT 6
+#define PROF_ZONES_TOTAL 7
+#define PROF_ZONES_STRIDE 8 // PROF_ZONES_TOTAL rounded up to a power of 2 for faster ring buffer indexing
+
+#define PROF_RING_FRAMES 32 // Must be a power of 2
+
+#define PROF_OVERLAY_X 5 // In tiles. Right after the CPU load string
+#define PROF_OVERLAY_Y 24 // In tiles. Same row than the CPU load string
+
+#if PROFILER
+#define PROF_ZONE_BEGIN(zone) prof_zoneBegin(zone)
+#define PROF_ZONE_END(zone) prof_zoneEnd(zone)
+#define PROF_FRAME_END() prof_frameEnd()
+#else
+#define PROF_ZONE_BEGIN(zone)
+#define PROF_ZONE_END(zone)
+#define PROF_FRAME_END()
+#endif
+
+void prof_reset ();
+
+/// @brief Stores current V-Counter as the start of the zone.
+void prof_zoneBegin (u16 zone);
+
+/// @brief Stores the scanlines elapsed since prof_zoneBegin() of same zone into current ring buffer slot.
+void prof_zoneEnd (u16 zone);
+
+/// @brief Moves the ring buffer to next frame. Refreshes the overlay (if enabled) and dumps the stats
+/// through KDebug (if enabled) once the ring buffer wraps around.
+/// Call it once per frame, after waiting for VBlank since the overlay is written into VRAM using the CPU.
+void prof_frameEnd ();
+
+/// @brief Shows the average scanlines of every zone as 3 digits numbers on the WINDOW plane.
+void prof_showOverlay ();
+
+/// @brief Emits one line per zone through KDebug as: PROF,<zone>,<min>,<avg>,<max>
+void prof_dump ();
+
+#endif // _PROFILER_H_
\ No newline at end of file
@@ -35,6 +35,16 @@ void render_SYS_doVBlankProcessEx_ON_VBLANK ();
 void render_DMA_enqueue_framebuffer ();
 
 void render_DMA_row_by_row_framebuffer ();
+/// @brief Same than render_DMA_row_by_row_framebuffer() but only DMAs the rows flagged as dirty by RENDER_INCREMENTAL_FRAMEBUFFER,
+/// then clears the dirty flags. Used by RENDER_DMA_DIRTY_ROWS.
+/// @return amount of rows sent (both planes).
+u16 render_DMA_dirty_rows_framebuffer ();
+
+/// @brief DMAs every framebuffer column from ROM. Used by RENDER_DMA_COLUMNS_FROM_ROM. See fb_DMA_columns_from_ROM().
+void render_DMA_columns_from_ROM ();
+
+/// @brief DMAs the plane columns uncovered by the horizontal scroll of RENDER_SMOOTH_ROTATION. See fb_DMA_guard_columns().
+void render_DMA_guard_columns ();
 
 void render_mirror_planes_in_VRAM ();
 void render_copy_top_entries_in_VRAM ();
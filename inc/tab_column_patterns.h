@@ -0,0 +1,3117 @@
+#ifndef _TAB_COLUMN_PATTERNS_H_
+#define _TAB_COLUMN_PATTERNS_H_
+
+#include <types.h>
+#include "consts.h"
+
+/*
+Every wall column is fully determined by (h2, tileAttrib): empty rows, a top edge tile, the solid span and the V-flipped
+bottom edge tile. This table holds every possible column as it ends up in the framebuffer after clear_buffer() + write_vline(),
+so RENDER_DMA_COLUMNS_FROM_ROM DMAs it straight from ROM into the plane column (VDP auto increment set to the plane row stride).
+
+Content of pattern 1 + (h2 << 5) + key, being key = TAB_COLUMN_PATTERNS_KEY(tileAttrib):
+
+    if (h2 == 0) {
+        for (u16 r = 0; r < VERTICAL_ROWS; ++r)
+            pattern[r] = tileAttrib;
+        return;
+    }
+    u16 ta = h2 / 8;
+    for (u16 r = ta + 1; r < VERTICAL_ROWS/2; ++r) {
+        pattern[r] = tileAttrib;
+        pattern[(VERTICAL_ROWS-1)-r] = tileAttrib;
+    }
+    pattern[ta] = tileAttrib + (h2 & 7);
+    pattern[(VERTICAL_ROWS-1)-ta] = (tileAttrib + (h2 & 7)) | TILE_ATTR_VFLIP_MASK;
+
+Pattern 0 is the empty column (no wall hit).
+*/
+
+// VERTICAL_ROWS entries padded to 64 bytes. DMA source can't cross a 128KB boundary, and a 64 bytes aligned pattern never does.
+#define TAB_COLUMN_PATTERNS_STRIDE 32
+#define TAB_COLUMN_PATTERNS_STRIDE_SFT 5
+// Every h2 write_vline() accepts: 0 (solid column) up to the edge tile of the middle row
+#define TAB_COLUMN_PATTERNS_H2_VALUES ((VERTICAL_ROWS/2)*8)
+// tileAttrib is (PAL0 or PAL1) + 1 + d*8 + bank*8*8, so key = d + bank*8 + pal*16
+#define TAB_COLUMN_PATTERNS_KEYS 32
+#define TAB_COLUMN_PATTERNS_KEY(tileAttrib) ((((tileAttrib) >> 3) & 0xF) | (((tileAttrib) >> (TILE_ATTR_PALETTE_SFT-4)) & 0x10))
+#define TAB_COLUMN_PATTERNS_EMPTY 0
+
+// Table body generated with script tab_column_patterns_generator.js. Check correct values of constants before script execution.
+const u16 tab_column_patterns[(1 + TAB_COLUMN_PATTERNS_H2_VALUES*TAB_COLUMN_PATTERNS_KEYS) * TAB_COLUMN_PATTERNS_STRIDE] __attribute__((aligned(TAB_COLUMN_PATTERNS_STRIDE*2))) = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
+9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,0,0,0,0,0,0,0,0,
+17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,0,0,0,0,0,0,0,0,
+25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,0,0,0,0,0,0,0,0,
+33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,0,0,0,0,0,0,0,0,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,0,0,0,0,0,0,0,0,
+49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,0,0,0,0,0,0,0,0,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,0,0,0,0,0,0,0,0,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,0,0,0,0,0,0,0,0,
+73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,0,0,0,0,0,0,0,0,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,0,0,0,0,0,0,0,0,
+89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,0,0,0,0,0,0,0,0,
+97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,0,0,0,0,0,0,0,0,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,0,0,0,0,0,0,0,0,
+113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,0,0,0,0,0,0,0,0,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,0,0,0,0,0,0,0,0,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,0,0,0,0,0,0,0,0,
+8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,0,0,0,0,0,0,0,0,
+8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,0,0,0,0,0,0,0,0,
+8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,0,0,0,0,0,0,0,0,
+8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,0,0,0,0,0,0,0,0,
+8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,0,0,0,0,0,0,0,0,
+8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,0,0,0,0,0,0,0,0,
+8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,0,0,0,0,0,0,0,0,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,0,0,0,0,0,0,0,0,
+8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,0,0,0,0,0,0,0,0,
+8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,0,0,0,0,0,0,0,0,
+8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,0,0,0,0,0,0,0,0,
+8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,0,0,0,0,0,0,0,0,
+8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,0,0,0,0,0,0,0,0,
+8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,0,0,0,0,0,0,0,0,
+8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,0,0,0,0,0,0,0,0,
+2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,
+10,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,
+18,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,
+26,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,
+34,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,
+42,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,
+50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,
+58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,
+66,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,
+74,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,
+82,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,
+90,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,
+98,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,
+106,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,
+114,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,
+122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,
+8194,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,
+8202,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,
+8210,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,
+8218,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,
+8226,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,
+8234,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,
+8242,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,
+8250,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,
+8258,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,
+8266,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,
+8274,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,
+8282,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,
+8290,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,
+8298,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,
+8306,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,
+8314,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,
+3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,
+11,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,
+19,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,
+27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,
+35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,
+43,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,
+51,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,
+59,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,
+67,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,
+75,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,
+83,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,
+91,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,
+99,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,
+107,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,
+115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,
+123,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,
+8195,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,
+8203,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,
+8211,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,
+8219,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,
+8227,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,
+8235,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,
+8243,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,
+8251,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,
+8259,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,
+8267,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,
+8275,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,
+8283,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,
+8291,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,
+8299,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,
+8307,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,
+8315,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,
+4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,
+12,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,
+20,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,
+28,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,
+36,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,
+44,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,
+52,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,
+60,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,
+68,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,
+76,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,
+84,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,
+92,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,
+100,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,
+108,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,
+116,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,
+124,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,
+8196,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,
+8204,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,
+8212,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,
+8220,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,
+8228,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,
+8236,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,
+8244,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,
+8252,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,
+8260,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,
+8268,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,
+8276,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,
+8284,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,
+8292,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,
+8300,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,
+8308,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,
+8316,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,
+5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,
+13,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,
+21,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,
+29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,
+37,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,
+45,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,
+53,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,
+61,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,
+69,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,
+77,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,
+85,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,
+93,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,
+101,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,
+109,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,
+117,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,
+125,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,
+8197,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,
+8205,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,
+8213,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,
+8221,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,
+8229,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,
+8237,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,
+8245,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,
+8253,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,
+8261,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,
+8269,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,
+8277,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,
+8285,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,
+8293,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,
+8301,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,
+8309,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,
+8317,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,
+6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,
+14,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,
+22,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,
+30,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,
+38,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,
+46,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,
+54,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,
+62,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,
+70,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,
+78,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,
+86,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,
+94,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,
+102,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,
+110,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,
+118,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,
+126,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,
+8198,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,
+8206,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,
+8214,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,
+8222,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,
+8230,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,
+8238,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,
+8246,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,
+8254,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,
+8262,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,
+8270,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,
+8278,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,
+8286,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,
+8294,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,
+8302,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,
+8310,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,
+8318,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,
+7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,
+15,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,
+23,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,
+31,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,
+39,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,
+47,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,
+55,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,
+63,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,
+71,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,
+79,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,
+87,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,
+95,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,
+103,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,
+111,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,
+119,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,
+127,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,
+8199,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,
+8207,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,
+8215,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,
+8223,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,
+8231,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,
+8239,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,
+8247,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,
+8255,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,
+8263,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,
+8271,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,
+8279,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,
+8287,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,
+8295,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,
+8303,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,
+8311,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,
+8319,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,
+8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,
+16,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,
+24,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,
+32,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,
+40,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,
+48,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,
+56,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,
+64,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,
+72,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,
+80,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,
+88,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,
+96,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,
+104,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,
+112,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,
+120,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,
+128,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,
+8200,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,
+8208,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,
+8216,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,
+8224,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,
+8232,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,
+8240,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,
+8248,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,
+8256,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,
+8264,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,
+8272,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,
+8280,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,
+8288,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,
+8296,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,
+8304,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,
+8312,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,
+8320,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,
+0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,
+0,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,
+0,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,
+0,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,
+0,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,
+0,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,
+0,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,
+0,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,
+0,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,
+0,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,
+0,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,
+0,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,
+0,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,
+0,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,
+0,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,
+0,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,
+0,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,
+0,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,
+0,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,
+0,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,
+0,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,
+0,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,
+0,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,
+0,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,
+0,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,
+0,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,
+0,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,
+0,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,
+0,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,
+0,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,
+0,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,
+0,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,
+0,10,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,
+0,18,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,
+0,26,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,
+0,34,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,
+0,42,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,
+0,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,
+0,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,
+0,66,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,
+0,74,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,
+0,82,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,
+0,90,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,
+0,98,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,
+0,106,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,
+0,114,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,
+0,122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,
+0,8194,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,
+0,8202,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,
+0,8210,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,
+0,8218,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,
+0,8226,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,
+0,8234,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,
+0,8242,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,
+0,8250,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,
+0,8258,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,
+0,8266,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,
+0,8274,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,
+0,8282,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,
+0,8290,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,
+0,8298,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,
+0,8306,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,
+0,8314,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,
+0,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,
+0,11,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,
+0,19,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,
+0,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,
+0,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,
+0,43,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,
+0,51,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,
+0,59,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,
+0,67,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,
+0,75,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,
+0,83,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,
+0,91,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,
+0,99,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,
+0,107,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,
+0,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,
+0,123,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,
+0,8195,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,
+0,8203,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,
+0,8211,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,
+0,8219,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,
+0,8227,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,
+0,8235,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,
+0,8243,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,
+0,8251,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,
+0,8259,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,
+0,8267,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,
+0,8275,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,
+0,8283,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,
+0,8291,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,
+0,8299,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,
+0,8307,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,
+0,8315,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,
+0,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,
+0,12,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,
+0,20,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,
+0,28,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,
+0,36,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,
+0,44,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,
+0,52,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,
+0,60,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,
+0,68,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,
+0,76,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,
+0,84,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,
+0,92,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,
+0,100,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,
+0,108,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,
+0,116,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,
+0,124,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,
+0,8196,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,
+0,8204,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,
+0,8212,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,
+0,8220,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,
+0,8228,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,
+0,8236,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,
+0,8244,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,
+0,8252,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,
+0,8260,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,
+0,8268,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,
+0,8276,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,
+0,8284,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,
+0,8292,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,
+0,8300,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,
+0,8308,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,
+0,8316,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,
+0,5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,
+0,13,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,
+0,21,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,
+0,29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,
+0,37,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,
+0,45,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,
+0,53,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,
+0,61,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,
+0,69,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,
+0,77,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,
+0,85,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,
+0,93,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,
+0,101,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,
+0,109,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,
+0,117,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,
+0,125,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,
+0,8197,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,
+0,8205,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,
+0,8213,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,
+0,8221,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,
+0,8229,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,
+0,8237,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,
+0,8245,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,
+0,8253,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,
+0,8261,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,
+0,8269,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,
+0,8277,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,
+0,8285,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,
+0,8293,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,
+0,8301,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,
+0,8309,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,
+0,8317,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,
+0,6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,
+0,14,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,
+0,22,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,
+0,30,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,
+0,38,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,
+0,46,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,
+0,54,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,
+0,62,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,
+0,70,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,
+0,78,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,
+0,86,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,
+0,94,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,
+0,102,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,
+0,110,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,
+0,118,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,
+0,126,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,
+0,8198,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,
+0,8206,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,
+0,8214,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,
+0,8222,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,
+0,8230,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,
+0,8238,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,
+0,8246,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,
+0,8254,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,
+0,8262,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,
+0,8270,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,
+0,8278,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,
+0,8286,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,
+0,8294,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,
+0,8302,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,
+0,8310,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,
+0,8318,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,
+0,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,
+0,15,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,
+0,23,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,
+0,31,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,
+0,39,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,
+0,47,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,
+0,55,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,
+0,63,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,
+0,71,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,
+0,79,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,
+0,87,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,
+0,95,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,
+0,103,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,
+0,111,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,
+0,119,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,
+0,127,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,
+0,8199,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,
+0,8207,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,
+0,8215,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,
+0,8223,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,
+0,8231,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,
+0,8239,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,
+0,8247,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,
+0,8255,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,
+0,8263,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,
+0,8271,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,
+0,8279,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,
+0,8287,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,
+0,8295,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,
+0,8303,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,
+0,8311,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,
+0,8319,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,
+0,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,
+0,16,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,
+0,24,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,
+0,32,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,
+0,40,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,
+0,48,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,
+0,56,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,
+0,64,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,
+0,72,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,
+0,80,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,
+0,88,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,
+0,96,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,
+0,104,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,
+0,112,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,
+0,120,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,
+0,128,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,
+0,8200,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,
+0,8208,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,
+0,8216,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,
+0,8224,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,
+0,8232,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,
+0,8240,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,
+0,8248,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,
+0,8256,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,
+0,8264,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,
+0,8272,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,
+0,8280,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,
+0,8288,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,
+0,8296,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,
+0,8304,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,
+0,8312,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,
+0,8320,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,
+0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,
+0,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,
+0,0,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,
+0,0,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,
+0,0,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,
+0,0,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,
+0,0,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,
+0,0,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,
+0,0,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,
+0,0,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,
+0,0,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,
+0,0,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,
+0,0,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,
+0,0,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,
+0,0,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,
+0,0,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,
+0,0,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,
+0,0,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,
+0,0,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,
+0,0,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,
+0,0,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,
+0,0,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,
+0,0,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,
+0,0,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,
+0,0,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,
+0,0,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,
+0,0,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,
+0,0,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,
+0,0,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,
+0,0,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,
+0,0,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,
+0,0,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,
+0,0,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,
+0,0,10,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,
+0,0,18,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,
+0,0,26,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,
+0,0,34,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,
+0,0,42,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,
+0,0,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,
+0,0,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,
+0,0,66,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,
+0,0,74,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,
+0,0,82,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,
+0,0,90,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,
+0,0,98,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,
+0,0,106,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,
+0,0,114,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,
+0,0,122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,
+0,0,8194,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,
+0,0,8202,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,
+0,0,8210,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,
+0,0,8218,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,
+0,0,8226,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,
+0,0,8234,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,
+0,0,8242,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,
+0,0,8250,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,
+0,0,8258,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,
+0,0,8266,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,
+0,0,8274,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,
+0,0,8282,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,
+0,0,8290,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,
+0,0,8298,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,
+0,0,8306,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,
+0,0,8314,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,
+0,0,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,
+0,0,11,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,
+0,0,19,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,
+0,0,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,
+0,0,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,
+0,0,43,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,
+0,0,51,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,
+0,0,59,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,
+0,0,67,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,
+0,0,75,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,
+0,0,83,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,
+0,0,91,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,
+0,0,99,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,
+0,0,107,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,
+0,0,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,
+0,0,123,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,
+0,0,8195,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,
+0,0,8203,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,
+0,0,8211,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,
+0,0,8219,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,
+0,0,8227,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,
+0,0,8235,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,
+0,0,8243,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,
+0,0,8251,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,
+0,0,8259,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,
+0,0,8267,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,
+0,0,8275,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,
+0,0,8283,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,
+0,0,8291,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,
+0,0,8299,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,
+0,0,8307,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,
+0,0,8315,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,
+0,0,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,
+0,0,12,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,
+0,0,20,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,
+0,0,28,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,
+0,0,36,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,
+0,0,44,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,
+0,0,52,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,
+0,0,60,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,
+0,0,68,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,
+0,0,76,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,
+0,0,84,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,
+0,0,92,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,
+0,0,100,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,
+0,0,108,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,
+0,0,116,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,
+0,0,124,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,
+0,0,8196,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,
+0,0,8204,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,
+0,0,8212,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,
+0,0,8220,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,
+0,0,8228,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,
+0,0,8236,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,
+0,0,8244,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,
+0,0,8252,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,
+0,0,8260,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,
+0,0,8268,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,
+0,0,8276,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,
+0,0,8284,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,
+0,0,8292,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,
+0,0,8300,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,
+0,0,8308,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,
+0,0,8316,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,
+0,0,5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,
+0,0,13,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,
+0,0,21,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,
+0,0,29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,
+0,0,37,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,
+0,0,45,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,
+0,0,53,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,
+0,0,61,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,
+0,0,69,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,
+0,0,77,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,
+0,0,85,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,
+0,0,93,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,
+0,0,101,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,
+0,0,109,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,
+0,0,117,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,
+0,0,125,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,
+0,0,8197,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,
+0,0,8205,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,
+0,0,8213,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,
+0,0,8221,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,
+0,0,8229,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,
+0,0,8237,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,
+0,0,8245,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,
+0,0,8253,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,
+0,0,8261,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,
+0,0,8269,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,
+0,0,8277,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,
+0,0,8285,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,
+0,0,8293,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,
+0,0,8301,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,
+0,0,8309,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,
+0,0,8317,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,
+0,0,6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,
+0,0,14,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,
+0,0,22,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,
+0,0,30,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,
+0,0,38,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,
+0,0,46,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,
+0,0,54,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,
+0,0,62,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,
+0,0,70,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,
+0,0,78,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,
+0,0,86,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,
+0,0,94,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,
+0,0,102,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,
+0,0,110,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,
+0,0,118,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,
+0,0,126,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,
+0,0,8198,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,
+0,0,8206,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,
+0,0,8214,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,
+0,0,8222,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,
+0,0,8230,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,
+0,0,8238,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,
+0,0,8246,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,
+0,0,8254,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,
+0,0,8262,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,
+0,0,8270,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,
+0,0,8278,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,
+0,0,8286,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,
+0,0,8294,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,
+0,0,8302,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,
+0,0,8310,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,
+0,0,8318,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,
+0,0,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,
+0,0,15,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,
+0,0,23,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,
+0,0,31,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,
+0,0,39,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,
+0,0,47,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,
+0,0,55,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,
+0,0,63,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,
+0,0,71,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,
+0,0,79,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,
+0,0,87,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,
+0,0,95,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,
+0,0,103,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,
+0,0,111,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,
+0,0,119,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,
+0,0,127,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,
+0,0,8199,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,
+0,0,8207,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,
+0,0,8215,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,
+0,0,8223,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,
+0,0,8231,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,
+0,0,8239,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,
+0,0,8247,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,
+0,0,8255,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,
+0,0,8263,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,
+0,0,8271,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,
+0,0,8279,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,
+0,0,8287,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,
+0,0,8295,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,
+0,0,8303,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,
+0,0,8311,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,
+0,0,8319,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,
+0,0,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,
+0,0,16,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,
+0,0,24,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,
+0,0,32,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,
+0,0,40,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,
+0,0,48,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,
+0,0,56,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,
+0,0,64,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,
+0,0,72,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,
+0,0,80,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,
+0,0,88,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,
+0,0,96,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,
+0,0,104,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,
+0,0,112,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,
+0,0,120,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,
+0,0,128,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,
+0,0,8200,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,
+0,0,8208,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,
+0,0,8216,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,
+0,0,8224,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,
+0,0,8232,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,
+0,0,8240,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,
+0,0,8248,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,
+0,0,8256,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,
+0,0,8264,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,
+0,0,8272,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,
+0,0,8280,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,
+0,0,8288,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,
+0,0,8296,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,
+0,0,8304,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,
+0,0,8312,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,
+0,0,8320,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,10,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,18,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,26,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,34,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,42,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,66,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,74,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,82,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,90,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,98,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,106,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,114,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8194,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8202,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8210,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8218,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8226,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8234,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8242,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8250,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8258,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8266,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8274,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8282,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8290,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8298,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8306,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8314,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,11,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,19,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,43,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,51,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,59,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,67,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,75,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,83,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,91,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,99,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,107,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,123,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8195,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8203,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8211,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8219,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8227,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8235,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8243,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8251,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8259,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8267,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8275,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8283,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8291,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8299,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8307,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8315,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,12,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,20,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,28,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,36,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,44,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,52,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,60,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,68,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,76,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,84,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,92,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,100,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,108,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,116,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,124,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8196,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8204,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8212,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8220,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8228,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8236,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8244,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8252,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8260,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8268,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8276,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8284,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8292,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8300,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8308,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8316,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,13,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,21,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,37,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,45,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,53,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,61,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,69,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,77,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,85,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,93,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,101,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,109,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,117,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,125,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8197,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8205,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8213,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8221,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8229,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8237,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8245,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8253,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8261,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8269,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8277,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8285,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8293,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8301,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8309,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8317,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,14,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,22,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,30,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,38,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,46,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,54,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,62,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,70,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,78,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,86,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,94,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,102,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,110,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,118,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,126,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8198,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8206,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8214,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8222,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8230,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8238,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8246,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8254,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8262,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8270,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8278,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8286,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8294,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8302,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8310,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8318,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,15,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,23,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,31,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,39,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,47,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,55,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,63,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,71,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,79,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,87,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,95,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,103,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,111,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,119,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,127,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8199,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8207,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8215,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8223,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8231,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8239,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8247,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8255,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8263,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8271,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8279,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8287,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8295,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8303,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8311,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8319,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,16,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,24,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,32,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,40,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,48,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,56,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,64,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,72,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,80,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,88,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,96,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,104,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,112,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,120,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,128,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8200,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8208,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8216,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8224,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8232,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8240,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8248,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8256,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8264,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8272,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8280,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8288,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8296,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8304,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8312,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,8320,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,10,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,18,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,26,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,34,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,42,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,66,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,74,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,82,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,90,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,98,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,106,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,114,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8194,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8202,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8210,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8218,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8226,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8234,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8242,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8250,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8258,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8266,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8274,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8282,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8290,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8298,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8306,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8314,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,11,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,19,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,43,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,51,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,59,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,67,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,75,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,83,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,91,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,99,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,107,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,123,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8195,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8203,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8211,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8219,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8227,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8235,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8243,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8251,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8259,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8267,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8275,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8283,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8291,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8299,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8307,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8315,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,12,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,20,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,28,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,36,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,44,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,52,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,60,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,68,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,76,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,84,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,92,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,100,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,108,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,116,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,124,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8196,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8204,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8212,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8220,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8228,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8236,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8244,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8252,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8260,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8268,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8276,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8284,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8292,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8300,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8308,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8316,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,13,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,21,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,37,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,45,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,53,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,61,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,69,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,77,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,85,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,93,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,101,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,109,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,117,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,125,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8197,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8205,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8213,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8221,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8229,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8237,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8245,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8253,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8261,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8269,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8277,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8285,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8293,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8301,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8309,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8317,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,6,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,14,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,22,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,30,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,38,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,46,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,54,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,62,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,70,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,78,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,86,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,94,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,102,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,110,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,118,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,126,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8198,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8206,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8214,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8222,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8230,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8238,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8246,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8254,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8262,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8270,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8278,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8286,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8294,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8302,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8310,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8318,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,15,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,23,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,31,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,39,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,47,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,55,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,63,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,71,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,79,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,87,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,95,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,103,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,111,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,119,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,127,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8199,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8207,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8215,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8223,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8231,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8239,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8247,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8255,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8263,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8271,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8279,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8287,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8295,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8303,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8311,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8319,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,24,17,17,17,17,17,17,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,32,25,25,25,25,25,25,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,40,33,33,33,33,33,33,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,48,41,41,41,41,41,41,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,56,49,49,49,49,49,49,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,64,57,57,57,57,57,57,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,72,65,65,65,65,65,65,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,80,73,73,73,73,73,73,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,88,81,81,81,81,81,81,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,96,89,89,89,89,89,89,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,104,97,97,97,97,97,97,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,112,105,105,105,105,105,105,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,120,113,113,113,113,113,113,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,128,121,121,121,121,121,121,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8200,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8208,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8216,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8224,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8232,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8240,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8248,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8256,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8264,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8272,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8280,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8288,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8296,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8304,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8312,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8320,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,9,9,9,9,9,9,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,17,17,17,17,17,17,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,25,25,25,25,25,25,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,33,33,33,33,33,33,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,41,41,41,41,41,41,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,49,49,49,49,49,49,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,57,57,57,57,57,57,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,65,65,65,65,65,65,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,73,73,73,73,73,73,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,81,81,81,81,81,81,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,89,89,89,89,89,89,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,97,97,97,97,97,97,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,105,105,105,105,105,105,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,113,113,113,113,113,113,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,121,121,121,121,121,121,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,2,1,1,1,1,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,10,9,9,9,9,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,18,17,17,17,17,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,26,25,25,25,25,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,34,33,33,33,33,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,42,41,41,41,41,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,50,49,49,49,49,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,58,57,57,57,57,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,66,65,65,65,65,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,74,73,73,73,73,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,82,81,81,81,81,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,90,89,89,89,89,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,98,97,97,97,97,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,106,105,105,105,105,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,114,113,113,113,113,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,122,121,121,121,121,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8194,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8202,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8210,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8218,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8226,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8234,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8242,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8250,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8258,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8266,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8274,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8282,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8290,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8298,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8306,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8314,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,3,1,1,1,1,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,11,9,9,9,9,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,19,17,17,17,17,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,27,25,25,25,25,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,35,33,33,33,33,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,43,41,41,41,41,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,51,49,49,49,49,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,59,57,57,57,57,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,67,65,65,65,65,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,75,73,73,73,73,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,83,81,81,81,81,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,91,89,89,89,89,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,99,97,97,97,97,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,107,105,105,105,105,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,115,113,113,113,113,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,123,121,121,121,121,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8195,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8203,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8211,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8219,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8227,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8235,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8243,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8251,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8259,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8267,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8275,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8283,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8291,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8299,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8307,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8315,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,1,1,1,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,12,9,9,9,9,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,20,17,17,17,17,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,28,25,25,25,25,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,36,33,33,33,33,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,44,41,41,41,41,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,52,49,49,49,49,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,60,57,57,57,57,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,68,65,65,65,65,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,76,73,73,73,73,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,84,81,81,81,81,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,92,89,89,89,89,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,100,97,97,97,97,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,108,105,105,105,105,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,116,113,113,113,113,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,124,121,121,121,121,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8196,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8204,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8212,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8220,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8228,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8236,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8244,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8252,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8260,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8268,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8276,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8284,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8292,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8300,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8308,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8316,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,5,1,1,1,1,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,13,9,9,9,9,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,21,17,17,17,17,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,29,25,25,25,25,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,37,33,33,33,33,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,45,41,41,41,41,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,53,49,49,49,49,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,61,57,57,57,57,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,69,65,65,65,65,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,77,73,73,73,73,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,85,81,81,81,81,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,93,89,89,89,89,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,101,97,97,97,97,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,109,105,105,105,105,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,117,113,113,113,113,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,125,121,121,121,121,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8197,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8205,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8213,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8221,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8229,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8237,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8245,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8253,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8261,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8269,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8277,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8285,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8293,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8301,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8309,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8317,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,6,1,1,1,1,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,14,9,9,9,9,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,22,17,17,17,17,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,30,25,25,25,25,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,38,33,33,33,33,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,46,41,41,41,41,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,54,49,49,49,49,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,62,57,57,57,57,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,70,65,65,65,65,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,78,73,73,73,73,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,86,81,81,81,81,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,94,89,89,89,89,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,102,97,97,97,97,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,110,105,105,105,105,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,118,113,113,113,113,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,126,121,121,121,121,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8198,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8206,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8214,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8222,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8230,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8238,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8246,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8254,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8262,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8270,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8278,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8286,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8294,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8302,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8310,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8318,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,7,1,1,1,1,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,15,9,9,9,9,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,23,17,17,17,17,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,31,25,25,25,25,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,39,33,33,33,33,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,47,41,41,41,41,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,55,49,49,49,49,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,63,57,57,57,57,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,71,65,65,65,65,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,79,73,73,73,73,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,87,81,81,81,81,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,95,89,89,89,89,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,103,97,97,97,97,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,111,105,105,105,105,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,119,113,113,113,113,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,127,121,121,121,121,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8199,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8207,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8215,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8223,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8231,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8239,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8247,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8255,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8263,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8271,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8279,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8287,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8295,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8303,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8311,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8319,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8,1,1,1,1,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,16,9,9,9,9,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,24,17,17,17,17,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,32,25,25,25,25,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,40,33,33,33,33,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,48,41,41,41,41,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,56,49,49,49,49,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,64,57,57,57,57,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,72,65,65,65,65,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,80,73,73,73,73,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,88,81,81,81,81,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,96,89,89,89,89,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,104,97,97,97,97,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,112,105,105,105,105,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,120,113,113,113,113,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,128,121,121,121,121,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8200,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8208,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8216,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8224,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8232,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8240,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8248,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8256,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8264,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8272,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8280,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8288,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8296,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8304,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8312,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8320,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,9,9,9,9,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,17,17,17,17,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,25,25,25,25,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,33,33,33,33,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,41,41,41,41,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,49,49,49,49,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,57,57,57,57,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,65,65,65,65,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,73,73,73,73,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,81,81,81,81,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,89,89,89,89,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,97,97,97,97,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,105,105,105,105,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,113,113,113,113,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,121,121,121,121,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,1,1,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,10,9,9,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,18,17,17,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,26,25,25,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,34,33,33,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,42,41,41,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,50,49,49,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,58,57,57,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,66,65,65,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,74,73,73,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,82,81,81,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,90,89,89,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,98,97,97,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,106,105,105,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,114,113,113,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,122,121,121,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8194,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8202,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8210,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8218,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8226,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8234,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8242,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8250,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8258,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8266,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8274,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8282,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8290,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8298,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8306,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8314,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,3,1,1,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,11,9,9,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,19,17,17,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,27,25,25,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,35,33,33,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,43,41,41,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,51,49,49,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,59,57,57,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,67,65,65,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,75,73,73,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,83,81,81,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,91,89,89,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,99,97,97,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,107,105,105,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,115,113,113,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,123,121,121,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8195,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8203,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8211,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8219,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8227,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8235,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8243,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8251,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8259,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8267,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8275,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8283,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8291,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8299,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8307,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8315,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,4,1,1,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,12,9,9,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,20,17,17,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,28,25,25,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,36,33,33,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,44,41,41,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,52,49,49,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,60,57,57,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,68,65,65,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,76,73,73,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,84,81,81,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,92,89,89,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,100,97,97,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,108,105,105,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,116,113,113,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,124,121,121,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8196,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8204,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8212,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8220,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8228,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8236,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8244,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8252,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8260,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8268,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8276,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8284,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8292,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8300,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8308,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8316,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,5,1,1,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,13,9,9,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,21,17,17,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,29,25,25,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,37,33,33,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,45,41,41,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,53,49,49,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,61,57,57,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,69,65,65,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,77,73,73,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,85,81,81,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,93,89,89,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,101,97,97,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,109,105,105,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,117,113,113,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,125,121,121,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8197,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8205,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8213,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8221,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8229,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8237,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8245,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8253,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8261,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8269,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8277,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8285,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8293,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8301,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8309,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8317,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,6,1,1,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,14,9,9,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,22,17,17,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,30,25,25,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,38,33,33,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,46,41,41,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,54,49,49,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,62,57,57,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,70,65,65,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,78,73,73,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,86,81,81,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,94,89,89,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,102,97,97,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,110,105,105,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,118,113,113,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,126,121,121,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8198,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8206,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8214,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8222,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8230,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8238,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8246,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8254,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8262,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8270,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8278,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8286,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8294,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8302,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8310,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8318,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,7,1,1,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,15,9,9,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,23,17,17,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,31,25,25,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,39,33,33,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,47,41,41,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,55,49,49,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,63,57,57,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,71,65,65,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,79,73,73,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,87,81,81,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,95,89,89,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,103,97,97,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,111,105,105,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,119,113,113,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,127,121,121,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8199,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8207,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8215,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8223,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8231,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8239,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8247,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8255,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8263,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8271,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8279,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8287,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8295,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8303,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8311,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8319,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8,1,1,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,16,9,9,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,24,17,17,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,32,25,25,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,40,33,33,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,48,41,41,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,56,49,49,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,64,57,57,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,72,65,65,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,80,73,73,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,88,81,81,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,96,89,89,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,104,97,97,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,112,105,105,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,120,113,113,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,128,121,121,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8200,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8208,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8216,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8224,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8232,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8240,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8248,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8256,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8264,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8272,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8280,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8288,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8296,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8304,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8312,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8320,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,9,9,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,17,17,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25,25,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,33,33,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,41,41,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,49,49,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,57,57,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,65,65,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,73,73,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,81,81,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,89,89,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,97,97,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,105,105,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,113,113,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,121,121,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8193,8193,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8201,8201,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8209,8209,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8217,8217,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8225,8225,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8233,8233,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8241,8241,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8249,8249,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8257,8257,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8265,8265,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8273,8273,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8281,8281,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8289,8289,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8297,8297,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8305,8305,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8313,8313,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2,1,1,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,10,9,9,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,18,17,17,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,26,25,25,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,34,33,33,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,42,41,41,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,50,49,49,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,58,57,57,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,66,65,65,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,74,73,73,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,82,81,81,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,90,89,89,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,98,97,97,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,106,105,105,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,114,113,113,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,122,121,121,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8194,8193,8193,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8202,8201,8201,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8210,8209,8209,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8218,8217,8217,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8226,8225,8225,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8234,8233,8233,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8242,8241,8241,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8250,8249,8249,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8258,8257,8257,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8266,8265,8265,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8274,8273,8273,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8282,8281,8281,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8290,8289,8289,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8298,8297,8297,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8306,8305,8305,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8314,8313,8313,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,3,1,1,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,11,9,9,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,19,17,17,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,27,25,25,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,35,33,33,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,43,41,41,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,51,49,49,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,59,57,57,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,67,65,65,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,75,73,73,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,83,81,81,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,91,89,89,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,99,97,97,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,107,105,105,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,115,113,113,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,123,121,121,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8195,8193,8193,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8203,8201,8201,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8211,8209,8209,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8219,8217,8217,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8227,8225,8225,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8235,8233,8233,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8243,8241,8241,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8251,8249,8249,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8259,8257,8257,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8267,8265,8265,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8275,8273,8273,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8283,8281,8281,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8291,8289,8289,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8299,8297,8297,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8307,8305,8305,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8315,8313,8313,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,4,1,1,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,12,9,9,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,20,17,17,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,28,25,25,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,36,33,33,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,44,41,41,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,52,49,49,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,60,57,57,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,68,65,65,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,76,73,73,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,84,81,81,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,92,89,89,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,100,97,97,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,108,105,105,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,116,113,113,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,124,121,121,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8196,8193,8193,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8204,8201,8201,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8212,8209,8209,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8220,8217,8217,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8228,8225,8225,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8236,8233,8233,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8244,8241,8241,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8252,8249,8249,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8260,8257,8257,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8268,8265,8265,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8276,8273,8273,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8284,8281,8281,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8292,8289,8289,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8300,8297,8297,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8308,8305,8305,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8316,8313,8313,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,5,1,1,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,13,9,9,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,21,17,17,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,29,25,25,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,37,33,33,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,45,41,41,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,53,49,49,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,61,57,57,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,69,65,65,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,77,73,73,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,85,81,81,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,93,89,89,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,101,97,97,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,109,105,105,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,117,113,113,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,125,121,121,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8197,8193,8193,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8205,8201,8201,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8213,8209,8209,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8221,8217,8217,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8229,8225,8225,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8237,8233,8233,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8245,8241,8241,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8253,8249,8249,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8261,8257,8257,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8269,8265,8265,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8277,8273,8273,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8285,8281,8281,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8293,8289,8289,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8301,8297,8297,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8309,8305,8305,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8317,8313,8313,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,6,1,1,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,14,9,9,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,22,17,17,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,30,25,25,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,38,33,33,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,46,41,41,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,54,49,49,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,62,57,57,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,70,65,65,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,78,73,73,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,86,81,81,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,94,89,89,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,102,97,97,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,110,105,105,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,118,113,113,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,126,121,121,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8198,8193,8193,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8206,8201,8201,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8214,8209,8209,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8222,8217,8217,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8230,8225,8225,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8238,8233,8233,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8246,8241,8241,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8254,8249,8249,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8262,8257,8257,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8270,8265,8265,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8278,8273,8273,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8286,8281,8281,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8294,8289,8289,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8302,8297,8297,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8310,8305,8305,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8318,8313,8313,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,7,1,1,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,15,9,9,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,23,17,17,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,31,25,25,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,39,33,33,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,47,41,41,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,55,49,49,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,63,57,57,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,71,65,65,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,79,73,73,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,87,81,81,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,95,89,89,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,103,97,97,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,111,105,105,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,119,113,113,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,127,121,121,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8199,8193,8193,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8207,8201,8201,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8215,8209,8209,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8223,8217,8217,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8231,8225,8225,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8239,8233,8233,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8247,8241,8241,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8255,8249,8249,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8263,8257,8257,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8271,8265,8265,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8279,8273,8273,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8287,8281,8281,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8295,8289,8289,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8303,8297,8297,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8311,8305,8305,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8319,8313,8313,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8,1,1,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,16,9,9,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,24,17,17,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,32,25,25,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,40,33,33,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,48,41,41,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,56,49,49,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,64,57,57,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,72,65,65,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,80,73,73,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,88,81,81,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,96,89,89,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,104,97,97,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,112,105,105,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,120,113,113,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,128,121,121,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8200,8193,8193,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8208,8201,8201,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8216,8209,8209,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8224,8217,8217,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8232,8225,8225,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8240,8233,8233,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8248,8241,8241,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8256,8249,8249,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8264,8257,8257,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8272,8265,8265,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8280,8273,8273,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8288,8281,8281,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8296,8289,8289,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8304,8297,8297,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8312,8305,8305,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8320,8313,8313,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,9,9,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,17,17,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,25,25,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,33,33,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,41,41,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,49,49,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,57,57,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,65,65,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,73,73,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,81,81,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,89,89,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,97,97,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,105,105,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,113,113,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,121,121,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8193,8193,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8201,8201,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8209,8209,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8217,8217,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8225,8225,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8233,8233,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8241,8241,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8249,8249,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8257,8257,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8265,8265,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8273,8273,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8281,8281,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8289,8289,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8297,8297,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8305,8305,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8313,8313,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,1,1,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,10,9,9,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,18,17,17,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,26,25,25,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,34,33,33,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,42,41,41,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,50,49,49,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,58,57,57,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,66,65,65,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,74,73,73,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,82,81,81,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,90,89,89,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,98,97,97,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,106,105,105,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,114,113,113,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,122,121,121,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8194,8193,8193,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8202,8201,8201,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8210,8209,8209,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8218,8217,8217,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8226,8225,8225,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8234,8233,8233,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8242,8241,8241,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8250,8249,8249,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8258,8257,8257,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8266,8265,8265,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8274,8273,8273,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8282,8281,8281,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8290,8289,8289,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8298,8297,8297,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8306,8305,8305,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8314,8313,8313,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,3,1,1,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,11,9,9,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,19,17,17,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,27,25,25,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,35,33,33,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,43,41,41,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,51,49,49,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,59,57,57,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,67,65,65,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,75,73,73,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,83,81,81,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,91,89,89,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,99,97,97,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,107,105,105,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,115,113,113,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,123,121,121,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8195,8193,8193,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8203,8201,8201,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8211,8209,8209,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8219,8217,8217,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8227,8225,8225,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8235,8233,8233,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8243,8241,8241,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8251,8249,8249,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8259,8257,8257,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8267,8265,8265,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8275,8273,8273,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8283,8281,8281,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8291,8289,8289,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8299,8297,8297,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8307,8305,8305,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8315,8313,8313,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,4,1,1,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,12,9,9,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,20,17,17,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,28,25,25,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,36,33,33,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,44,41,41,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,52,49,49,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,60,57,57,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,68,65,65,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,76,73,73,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,84,81,81,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,92,89,89,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,100,97,97,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,108,105,105,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,116,113,113,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,124,121,121,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8196,8193,8193,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8204,8201,8201,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8212,8209,8209,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8220,8217,8217,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8228,8225,8225,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8236,8233,8233,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8244,8241,8241,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8252,8249,8249,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8260,8257,8257,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8268,8265,8265,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8276,8273,8273,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8284,8281,8281,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8292,8289,8289,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8300,8297,8297,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8308,8305,8305,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8316,8313,8313,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,1,1,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,13,9,9,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,21,17,17,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,29,25,25,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,37,33,33,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,45,41,41,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,53,49,49,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,61,57,57,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,69,65,65,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,77,73,73,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,85,81,81,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,93,89,89,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,101,97,97,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,109,105,105,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,117,113,113,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,125,121,121,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8197,8193,8193,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8205,8201,8201,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8213,8209,8209,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8221,8217,8217,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8229,8225,8225,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8237,8233,8233,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8245,8241,8241,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8253,8249,8249,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8261,8257,8257,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8269,8265,8265,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8277,8273,8273,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8285,8281,8281,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8293,8289,8289,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8301,8297,8297,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8309,8305,8305,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8317,8313,8313,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,6,1,1,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,14,9,9,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,22,17,17,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,30,25,25,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,38,33,33,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,46,41,41,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,54,49,49,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,62,57,57,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,70,65,65,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,78,73,73,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,86,81,81,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,94,89,89,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,102,97,97,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,110,105,105,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,118,113,113,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,126,121,121,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8198,8193,8193,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8206,8201,8201,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8214,8209,8209,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8222,8217,8217,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8230,8225,8225,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8238,8233,8233,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8246,8241,8241,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8254,8249,8249,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8262,8257,8257,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8270,8265,8265,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8278,8273,8273,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8286,8281,8281,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8294,8289,8289,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8302,8297,8297,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8310,8305,8305,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8318,8313,8313,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,7,1,1,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,15,9,9,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,23,17,17,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,31,25,25,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,39,33,33,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,47,41,41,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,55,49,49,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,63,57,57,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,71,65,65,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,79,73,73,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,87,81,81,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,95,89,89,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,103,97,97,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,111,105,105,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,119,113,113,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,127,121,121,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8199,8193,8193,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8207,8201,8201,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8215,8209,8209,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8223,8217,8217,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8231,8225,8225,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8239,8233,8233,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8247,8241,8241,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8255,8249,8249,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8263,8257,8257,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8271,8265,8265,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8279,8273,8273,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8287,8281,8281,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8295,8289,8289,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8303,8297,8297,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8311,8305,8305,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8319,8313,8313,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8,1,1,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,16,9,9,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,24,17,17,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,25,25,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,40,33,33,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,48,41,41,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,49,49,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,64,57,57,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,72,65,65,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,80,73,73,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,88,81,81,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,96,89,89,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,104,97,97,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,112,105,105,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,120,113,113,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,128,121,121,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8200,8193,8193,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8208,8201,8201,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8216,8209,8209,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8224,8217,8217,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8232,8225,8225,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8240,8233,8233,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8248,8241,8241,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8256,8249,8249,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8264,8257,8257,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8272,8265,8265,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8280,8273,8273,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8288,8281,8281,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8296,8289,8289,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8304,8297,8297,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8312,8305,8305,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8320,8313,8313,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,9,9,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,17,17,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,25,25,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,33,33,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,41,41,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,49,49,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,57,57,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,65,65,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,73,73,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,81,81,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,89,89,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,97,97,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,105,105,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,113,113,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,121,121,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8193,8193,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8201,8201,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8209,8209,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8217,8217,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8225,8225,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8233,8233,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8241,8241,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8249,8249,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8257,8257,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8265,8265,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8273,8273,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8281,8281,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8289,8289,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8297,8297,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8305,8305,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8313,8313,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,1,1,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,10,9,9,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,18,17,17,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,26,25,25,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,34,33,33,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,42,41,41,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,50,49,49,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,58,57,57,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,66,65,65,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,74,73,73,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,82,81,81,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,90,89,89,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,98,97,97,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,106,105,105,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,114,113,113,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,122,121,121,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8194,8193,8193,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8202,8201,8201,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8210,8209,8209,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8218,8217,8217,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8226,8225,8225,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8234,8233,8233,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8242,8241,8241,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8250,8249,8249,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8258,8257,8257,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8266,8265,8265,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8274,8273,8273,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8282,8281,8281,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8290,8289,8289,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8298,8297,8297,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8306,8305,8305,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8314,8313,8313,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,3,1,1,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,11,9,9,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,19,17,17,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,27,25,25,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,35,33,33,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,43,41,41,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,51,49,49,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,59,57,57,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,67,65,65,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,75,73,73,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,83,81,81,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,91,89,89,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,99,97,97,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,107,105,105,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,115,113,113,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,123,121,121,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8195,8193,8193,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8203,8201,8201,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8211,8209,8209,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8219,8217,8217,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8227,8225,8225,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8235,8233,8233,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8243,8241,8241,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8251,8249,8249,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8259,8257,8257,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8267,8265,8265,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8275,8273,8273,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8283,8281,8281,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8291,8289,8289,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8299,8297,8297,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8307,8305,8305,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8315,8313,8313,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,4,1,1,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,12,9,9,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,20,17,17,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,28,25,25,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,36,33,33,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,44,41,41,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,52,49,49,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,60,57,57,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,68,65,65,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,76,73,73,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,84,81,81,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,92,89,89,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,100,97,97,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,108,105,105,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,116,113,113,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,124,121,121,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8196,8193,8193,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8204,8201,8201,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8212,8209,8209,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8220,8217,8217,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8228,8225,8225,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8236,8233,8233,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8244,8241,8241,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8252,8249,8249,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8260,8257,8257,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8268,8265,8265,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8276,8273,8273,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8284,8281,8281,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8292,8289,8289,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8300,8297,8297,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8308,8305,8305,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8316,8313,8313,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,5,1,1,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,13,9,9,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,21,17,17,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,29,25,25,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,37,33,33,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,45,41,41,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,53,49,49,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,61,57,57,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,69,65,65,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,77,73,73,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,85,81,81,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,93,89,89,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,101,97,97,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,109,105,105,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,117,113,113,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,125,121,121,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8197,8193,8193,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8205,8201,8201,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8213,8209,8209,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8221,8217,8217,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8229,8225,8225,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8237,8233,8233,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8245,8241,8241,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8253,8249,8249,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8261,8257,8257,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8269,8265,8265,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8277,8273,8273,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8285,8281,8281,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8293,8289,8289,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8301,8297,8297,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8309,8305,8305,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8317,8313,8313,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,6,1,1,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,14,9,9,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,22,17,17,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,30,25,25,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,38,33,33,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,46,41,41,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,54,49,49,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,62,57,57,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,70,65,65,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,78,73,73,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,86,81,81,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,94,89,89,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,102,97,97,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,110,105,105,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,118,113,113,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,126,121,121,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8198,8193,8193,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8206,8201,8201,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8214,8209,8209,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8222,8217,8217,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8230,8225,8225,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8238,8233,8233,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8246,8241,8241,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8254,8249,8249,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8262,8257,8257,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8270,8265,8265,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8278,8273,8273,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8286,8281,8281,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8294,8289,8289,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8302,8297,8297,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8310,8305,8305,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8318,8313,8313,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,7,1,1,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,15,9,9,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,23,17,17,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,31,25,25,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,39,33,33,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,47,41,41,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,55,49,49,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,63,57,57,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,71,65,65,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,79,73,73,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,87,81,81,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,95,89,89,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,103,97,97,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,111,105,105,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,119,113,113,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,127,121,121,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8199,8193,8193,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8207,8201,8201,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8215,8209,8209,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8223,8217,8217,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8231,8225,8225,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8239,8233,8233,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8247,8241,8241,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8255,8249,8249,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8263,8257,8257,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8271,8265,8265,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8279,8273,8273,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8287,8281,8281,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8295,8289,8289,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8303,8297,8297,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8311,8305,8305,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8319,8313,8313,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8,1,1,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,16,9,9,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,24,17,17,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,32,25,25,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,40,33,33,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,48,41,41,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,56,49,49,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,64,57,57,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,72,65,65,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,80,73,73,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,88,81,81,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,96,89,89,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,104,97,97,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,112,105,105,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,120,113,113,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,128,121,121,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8200,8193,8193,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8208,8201,8201,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8216,8209,8209,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8224,8217,8217,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8232,8225,8225,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8240,8233,8233,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8248,8241,8241,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8256,8249,8249,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8264,8257,8257,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8272,8265,8265,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8280,8273,8273,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8288,8281,8281,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8296,8289,8289,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8304,8297,8297,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8312,8305,8305,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8320,8313,8313,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,1,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,9,9,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,17,17,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25,25,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,33,33,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,41,41,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,49,49,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,57,57,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,65,65,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,73,73,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,81,81,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,89,89,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,97,97,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,105,105,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,113,113,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,121,121,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8193,8193,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8201,8201,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8209,8209,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8217,8217,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8225,8225,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8233,8233,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8241,8241,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8249,8249,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8257,8257,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8265,8265,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8273,8273,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8281,8281,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8289,8289,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8297,8297,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8305,8305,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8313,8313,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,1,1,4098,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,10,9,9,4106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,18,17,17,4114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,26,25,25,4122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,34,33,33,4130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,42,41,41,4138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,50,49,49,4146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,58,57,57,4154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,66,65,65,4162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,74,73,73,4170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,82,81,81,4178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,90,89,89,4186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,98,97,97,4194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,106,105,105,4202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,114,113,113,4210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,122,121,121,4218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8194,8193,8193,12290,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8202,8201,8201,12298,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8210,8209,8209,12306,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8218,8217,8217,12314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8226,8225,8225,12322,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8234,8233,8233,12330,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8242,8241,8241,12338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8250,8249,8249,12346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8258,8257,8257,12354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8266,8265,8265,12362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8274,8273,8273,12370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8282,8281,8281,12378,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8290,8289,8289,12386,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8298,8297,8297,12394,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8306,8305,8305,12402,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8314,8313,8313,12410,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,3,1,1,4099,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,11,9,9,4107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,19,17,17,4115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,27,25,25,4123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,35,33,33,4131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,43,41,41,4139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,51,49,49,4147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,59,57,57,4155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,67,65,65,4163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,75,73,73,4171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,83,81,81,4179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,91,89,89,4187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,99,97,97,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,107,105,105,4203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,115,113,113,4211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,123,121,121,4219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8195,8193,8193,12291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8203,8201,8201,12299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8211,8209,8209,12307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8219,8217,8217,12315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8227,8225,8225,12323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8235,8233,8233,12331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8243,8241,8241,12339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8251,8249,8249,12347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8259,8257,8257,12355,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8267,8265,8265,12363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8275,8273,8273,12371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8283,8281,8281,12379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8291,8289,8289,12387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8299,8297,8297,12395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8307,8305,8305,12403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8315,8313,8313,12411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,4,1,1,4100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,12,9,9,4108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,20,17,17,4116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,28,25,25,4124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,36,33,33,4132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,44,41,41,4140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,52,49,49,4148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,60,57,57,4156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,68,65,65,4164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,76,73,73,4172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,84,81,81,4180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,92,89,89,4188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,100,97,97,4196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,108,105,105,4204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,116,113,113,4212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,124,121,121,4220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8196,8193,8193,12292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8204,8201,8201,12300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8212,8209,8209,12308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8220,8217,8217,12316,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8228,8225,8225,12324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8236,8233,8233,12332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8244,8241,8241,12340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8252,8249,8249,12348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8260,8257,8257,12356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8268,8265,8265,12364,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8276,8273,8273,12372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8284,8281,8281,12380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8292,8289,8289,12388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8300,8297,8297,12396,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8308,8305,8305,12404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8316,8313,8313,12412,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,5,1,1,4101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,13,9,9,4109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,21,17,17,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,29,25,25,4125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,37,33,33,4133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,45,41,41,4141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,53,49,49,4149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,61,57,57,4157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,69,65,65,4165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,77,73,73,4173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,85,81,81,4181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,93,89,89,4189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,101,97,97,4197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,109,105,105,4205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,117,113,113,4213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,125,121,121,4221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8197,8193,8193,12293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8205,8201,8201,12301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8213,8209,8209,12309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8221,8217,8217,12317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8229,8225,8225,12325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8237,8233,8233,12333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8245,8241,8241,12341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8253,8249,8249,12349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8261,8257,8257,12357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8269,8265,8265,12365,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8277,8273,8273,12373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8285,8281,8281,12381,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8293,8289,8289,12389,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8301,8297,8297,12397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8309,8305,8305,12405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8317,8313,8313,12413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,6,1,1,4102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,14,9,9,4110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,22,17,17,4118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,30,25,25,4126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,38,33,33,4134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,46,41,41,4142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,54,49,49,4150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,62,57,57,4158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,70,65,65,4166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,78,73,73,4174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,86,81,81,4182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,94,89,89,4190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,102,97,97,4198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,110,105,105,4206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,118,113,113,4214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,126,121,121,4222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8198,8193,8193,12294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8206,8201,8201,12302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8214,8209,8209,12310,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8222,8217,8217,12318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8230,8225,8225,12326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8238,8233,8233,12334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8246,8241,8241,12342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8254,8249,8249,12350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8262,8257,8257,12358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8270,8265,8265,12366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8278,8273,8273,12374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8286,8281,8281,12382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8294,8289,8289,12390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8302,8297,8297,12398,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8310,8305,8305,12406,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8318,8313,8313,12414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,7,1,1,4103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,15,9,9,4111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,23,17,17,4119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,31,25,25,4127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,39,33,33,4135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,47,41,41,4143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,55,49,49,4151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,63,57,57,4159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,71,65,65,4167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,79,73,73,4175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,87,81,81,4183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,95,89,89,4191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,103,97,97,4199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,111,105,105,4207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,119,113,113,4215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,127,121,121,4223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8199,8193,8193,12295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8207,8201,8201,12303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8215,8209,8209,12311,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8223,8217,8217,12319,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8231,8225,8225,12327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8239,8233,8233,12335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8247,8241,8241,12343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8255,8249,8249,12351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8263,8257,8257,12359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8271,8265,8265,12367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8279,8273,8273,12375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8287,8281,8281,12383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8295,8289,8289,12391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8303,8297,8297,12399,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8311,8305,8305,12407,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8319,8313,8313,12415,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8,1,1,4104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,16,9,9,4112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,24,17,17,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,32,25,25,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,40,33,33,4136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,48,41,41,4144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,56,49,49,4152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,64,57,57,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,72,65,65,4168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,80,73,73,4176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,88,81,81,4184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,96,89,89,4192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,104,97,97,4200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,112,105,105,4208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,120,113,113,4216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,128,121,121,4224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8200,8193,8193,12296,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8208,8201,8201,12304,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8216,8209,8209,12312,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8224,8217,8217,12320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8232,8225,8225,12328,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8240,8233,8233,12336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8248,8241,8241,12344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8256,8249,8249,12352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8264,8257,8257,12360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8272,8265,8265,12368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8280,8273,8273,12376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8288,8281,8281,12384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8296,8289,8289,12392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8304,8297,8297,12400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8312,8305,8305,12408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8320,8313,8313,12416,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,4097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,9,4105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,17,4113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25,4121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,33,4129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,41,4137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,49,4145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,57,4153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,65,4161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,73,4169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,81,4177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,89,4185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,97,4193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,105,4201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,113,4209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,121,4217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8193,12289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8201,12297,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8209,12305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8217,12313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8225,12321,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8233,12329,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8241,12337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8249,12345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8257,12353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8265,12361,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8273,12369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8281,12377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8289,12385,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8297,12393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8305,12401,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8313,12409,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,4098,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,10,4106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,18,4114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,26,4122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,34,4130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,42,4138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,50,4146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,58,4154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,66,4162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,74,4170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,82,4178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,90,4186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,98,4194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,106,4202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,114,4210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,122,4218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8194,12290,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8202,12298,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8210,12306,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8218,12314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8226,12322,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8234,12330,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8242,12338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8250,12346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8258,12354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8266,12362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8274,12370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8282,12378,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8290,12386,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8298,12394,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8306,12402,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8314,12410,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,3,4099,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,11,4107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,19,4115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,27,4123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,35,4131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,43,4139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,51,4147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,59,4155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,67,4163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,75,4171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,83,4179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,91,4187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,99,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,107,4203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,115,4211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,123,4219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8195,12291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8203,12299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8211,12307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8219,12315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8227,12323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8235,12331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8243,12339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8251,12347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8259,12355,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8267,12363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8275,12371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8283,12379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8291,12387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8299,12395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8307,12403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8315,12411,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,4,4100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,12,4108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,20,4116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,28,4124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,36,4132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,44,4140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,52,4148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,60,4156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,68,4164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,76,4172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,84,4180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,92,4188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,100,4196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,108,4204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,116,4212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,124,4220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8196,12292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8204,12300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8212,12308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8220,12316,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8228,12324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8236,12332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8244,12340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8252,12348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8260,12356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8268,12364,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8276,12372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8284,12380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8292,12388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8300,12396,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8308,12404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8316,12412,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,5,4101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,13,4109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,21,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,29,4125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,37,4133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,45,4141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,53,4149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,61,4157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,69,4165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,77,4173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,85,4181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,93,4189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,101,4197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,109,4205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,117,4213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,125,4221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8197,12293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8205,12301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8213,12309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8221,12317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8229,12325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8237,12333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8245,12341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8253,12349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8261,12357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8269,12365,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8277,12373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8285,12381,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8293,12389,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8301,12397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8309,12405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8317,12413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,6,4102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,14,4110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,22,4118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,30,4126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,38,4134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,46,4142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,54,4150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,62,4158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,70,4166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,78,4174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,86,4182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,94,4190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,102,4198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,110,4206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,118,4214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,126,4222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8198,12294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8206,12302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8214,12310,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8222,12318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8230,12326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8238,12334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8246,12342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8254,12350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8262,12358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8270,12366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8278,12374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8286,12382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8294,12390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8302,12398,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8310,12406,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8318,12414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,7,4103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,15,4111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,23,4119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,31,4127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,39,4135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,47,4143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,55,4151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,63,4159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,71,4167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,79,4175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,87,4183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,95,4191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,103,4199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,111,4207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,119,4215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,127,4223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8199,12295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8207,12303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8215,12311,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8223,12319,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8231,12327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8239,12335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8247,12343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8255,12351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8263,12359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8271,12367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8279,12375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8287,12383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8295,12391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8303,12399,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8311,12407,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8319,12415,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8,4104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,16,4112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,24,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,32,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,40,4136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,48,4144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,56,4152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,64,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,72,4168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,80,4176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,88,4184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,96,4192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,104,4200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,112,4208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,120,4216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,128,4224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8200,12296,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8208,12304,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8216,12312,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8224,12320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8232,12328,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8240,12336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8248,12344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8256,12352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8264,12360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8272,12368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8280,12376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8288,12384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8296,12392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8304,12400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8312,12408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8320,12416,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+#endif // _TAB_COLUMN_PATTERNS_H_
\ No newline at end of file
@@ -0,0 +1,146 @@
+#ifndef _TAB_DDA_QUADRANTS_H_
+#define _TAB_DDA_QUADRANTS_H_
+
+#include <types.h>
+#include "consts.h"
+
+#define DDA_QUADRANT_SEGMENTS 3 // Ray direction signs change at most once per axis along the columns, so at most 3 segments
+
+#define DDA_QUADRANT_NEG_X 1 // rayDirAngleX < 0 => stepX = -1
+#define DDA_QUADRANT_NEG_Y 2 // rayDirAngleY < 0 => stepY = -1
+
+// Table body generated with script tab_dda_quadrants_generator.js. Check correct values of constants before script execution.
+// For every angle there are DDA_QUADRANT_SEGMENTS pairs of: end column (exclusive), quadrant (DDA_QUADRANT_NEG_X | DDA_QUADRANT_NEG_Y).
+// Unused segments have end column = PIXEL_COLUMNS so they are skipped.
+const u8 tab_dda_quadrants[AP * DDA_QUADRANT_SEGMENTS * 2] = {
+40,0, 80,1, 80,0, // 0
+42,0, 80,1, 80,0, // 1
+44,0, 80,1, 80,0, // 2
+46,0, 80,1, 80,0, // 3
+48,0, 80,1, 80,0, // 4
+50,0, 80,1, 80,0, // 5
+52,0, 80,1, 80,0, // 6
+54,0, 80,1, 80,0, // 7
+57,0, 80,1, 80,0, // 8
+59,0, 80,1, 80,0, // 9
+61,0, 80,1, 80,0, // 10
+64,0, 80,1, 80,0, // 11
+67,0, 80,1, 80,0, // 12
+70,0, 80,1, 80,0, // 13
+73,0, 80,1, 80,0, // 14
+76,0, 80,1, 80,0, // 15
+80,0, 80,0, 80,0, // 16
+4,2, 80,0, 80,0, // 17
+7,2, 80,0, 80,0, // 18
+10,2, 80,0, 80,0, // 19
+13,2, 80,0, 80,0, // 20
+16,2, 80,0, 80,0, // 21
+19,2, 80,0, 80,0, // 22
+21,2, 80,0, 80,0, // 23
+23,2, 80,0, 80,0, // 24
+26,2, 80,0, 80,0, // 25
+28,2, 80,0, 80,0, // 26
+30,2, 80,0, 80,0, // 27
+32,2, 80,0, 80,0, // 28
+34,2, 80,0, 80,0, // 29
+36,2, 80,0, 80,0, // 30
+38,2, 80,0, 80,0, // 31
+40,2, 80,0, 80,0, // 32
+42,2, 80,0, 80,0, // 33
+44,2, 80,0, 80,0, // 34
+46,2, 80,0, 80,0, // 35
+48,2, 80,0, 80,0, // 36
+50,2, 80,0, 80,0, // 37
+52,2, 80,0, 80,0, // 38
+54,2, 80,0, 80,0, // 39
+56,2, 80,0, 80,0, // 40
+59,2, 80,0, 80,0, // 41
+61,2, 80,0, 80,0, // 42
+64,2, 80,0, 80,0, // 43
+67,2, 80,0, 80,0, // 44
+70,2, 80,0, 80,0, // 45
+73,2, 80,0, 80,0, // 46
+76,2, 80,0, 80,0, // 47
+80,2, 80,0, 80,0, // 48
+4,3, 80,2, 80,0, // 49
+7,3, 80,2, 80,0, // 50
+10,3, 80,2, 80,0, // 51
+13,3, 80,2, 80,0, // 52
+16,3, 80,2, 80,0, // 53
+19,3, 80,2, 80,0, // 54
+21,3, 80,2, 80,0, // 55
+23,3, 80,2, 80,0, // 56
+26,3, 80,2, 80,0, // 57
+28,3, 80,2, 80,0, // 58
+30,3, 80,2, 80,0, // 59
+32,3, 80,2, 80,0, // 60
+34,3, 80,2, 80,0, // 61
+36,3, 80,2, 80,0, // 62
+38,3, 80,2, 80,0, // 63
+40,3, 80,2, 80,0, // 64
+42,3, 80,2, 80,0, // 65
+44,3, 80,2, 80,0, // 66
+46,3, 80,2, 80,0, // 67
+48,3, 80,2, 80,0, // 68
+50,3, 80,2, 80,0, // 69
+52,3, 80,2, 80,0, // 70
+54,3, 80,2, 80,0, // 71
+56,3, 80,2, 80,0, // 72
+59,3, 80,2, 80,0, // 73
+61,3, 80,2, 80,0, // 74
+64,3, 80,2, 80,0, // 75
+67,3, 80,2, 80,0, // 76
+70,3, 80,2, 80,0, // 77
+73,3, 80,2, 80,0, // 78
+76,3, 80,2, 80,0, // 79
+80,3, 80,0, 80,0, // 80
+4,1, 80,3, 80,0, // 81
+7,1, 80,3, 80,0, // 82
+10,1, 80,3, 80,0, // 83
+13,1, 80,3, 80,0, // 84
+16,1, 80,3, 80,0, // 85
+19,1, 80,3, 80,0, // 86
+21,1, 80,3, 80,0, // 87
+24,1, 80,3, 80,0, // 88
+26,1, 80,3, 80,0, // 89
+28,1, 80,3, 80,0, // 90
+30,1, 80,3, 80,0, // 91
+32,1, 80,3, 80,0, // 92
+34,1, 80,3, 80,0, // 93
+36,1, 80,3, 80,0, // 94
+38,1, 80,3, 80,0, // 95
+40,1, 80,3, 80,0, // 96
+42,1, 80,3, 80,0, // 97
+44,1, 80,3, 80,0, // 98
+46,1, 80,3, 80,0, // 99
+48,1, 80,3, 80,0, // 100
+50,1, 80,3, 80,0, // 101
+52,1, 80,3, 80,0, // 102
+54,1, 80,3, 80,0, // 103
+57,1, 80,3, 80,0, // 104
+59,1, 80,3, 80,0, // 105
+61,1, 80,3, 80,0, // 106
+64,1, 80,3, 80,0, // 107
+67,1, 80,3, 80,0, // 108
+70,1, 80,3, 80,0, // 109
+73,1, 80,3, 80,0, // 110
+76,1, 80,3, 80,0, // 111
+80,1, 80,0, 80,0, // 112
+4,0, 80,1, 80,0, // 113
+7,0, 80,1, 80,0, // 114
+10,0, 80,1, 80,0, // 115
+13,0, 80,1, 80,0, // 116
+16,0, 80,1, 80,0, // 117
+19,0, 80,1, 80,0, // 118
+21,0, 80,1, 80,0, // 119
+24,0, 80,1, 80,0, // 120
+26,0, 80,1, 80,0, // 121
+28,0, 80,1, 80,0, // 122
+30,0, 80,1, 80,0, // 123
+32,0, 80,1, 80,0, // 124
+34,0, 80,1, 80,0, // 125
+36,0, 80,1, 80,0, // 126
+38,0, 80,1, 80,0, // 127
+};
+
+#endif // _TAB_DDA_QUADRANTS_H_
\ No newline at end of file
@@ -0,0 +1,2577 @@
+#ifndef _TAB_DELTAS_FOLDED_H_
+#define _TAB_DELTAS_FOLDED_H_
+
+#include <types.h>
+#include "consts.h"
+
+#define DELTA_PTR_OFFSET_AMNT 4
+
+// Table body generated with script tab_deltas_generator.js using argument folded. Check correct values of constants before script execution.
+// First 2 columns are sideDistX and sideDistY: from 182 up to 65535, but only 915 different values.
+// Last 2 columns are ray direction angle (signed): from 0 up to 65535, which actually are 717 signed different 
+// values: [-360, 360] (except few values due to precision lack).
+// Only the first quadrant of angles [0, AP/4). The other quadrants are resolved once per frame in dda(): see RENDER_USE_TAB_DELTAS_FOLDED.
+const u16 tab_deltas[(AP/4)*PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT] = {
+259, 256, 253, 256,
+266, 256, 246, 256,
+273, 256, 240, 256,
+281, 256, 234, 256,
+288, 256, 227, 256,
+297, 256, 221, 256,
+306, 256, 214, 256,
+315, 256, 208, 256,
+325, 256, 202, 256,
+336, 256, 195, 256,
+347, 256, 189, 256,
+359, 256, 182, 256,
+372, 256, 176, 256,
+386, 256, 170, 256,
+402, 256, 163, 256,
+418, 256, 157, 256,
+436, 256, 150, 256,
+455, 256, 144, 256,
+476, 256, 138, 256,
+500, 256, 131, 256,
+525, 256, 125, 256,
+554, 256, 118, 256,
+585, 256, 112, 256,
+621, 256, 106, 256,
+661, 256, 99, 256,
+706, 256, 93, 256,
+759, 256, 86, 256,
+819, 256, 80, 256,
+890, 256, 74, 256,
+975, 256, 67, 256,
+1078, 256, 61, 256,
+1205, 256, 54, 256,
+1365, 256, 48, 256,
+1575, 256, 42, 256,
+1862, 256, 35, 256,
+2276, 256, 29, 256,
+2926, 256, 22, 256,
+4096, 256, 16, 256,
+6827, 256, 10, 256,
+20480, 256, 3, 256,
+20480, 256, 65533, 256,
+6827, 256, 65526, 256,
+4096, 256, 65520, 256,
+2926, 256, 65514, 256,
+2276, 256, 65507, 256,
+1862, 256, 65501, 256,
+1575, 256, 65494, 256,
+1365, 256, 65488, 256,
+1205, 256, 65482, 256,
+1078, 256, 65475, 256,
+975, 256, 65469, 256,
+890, 256, 65462, 256,
+819, 256, 65456, 256,
+759, 256, 65450, 256,
+706, 256, 65443, 256,
+661, 256, 65437, 256,
+621, 256, 65430, 256,
+585, 256, 65424, 256,
+554, 256, 65418, 256,
+525, 256, 65411, 256,
+500, 256, 65405, 256,
+476, 256, 65398, 256,
+455, 256, 65392, 256,
+436, 256, 65386, 256,
+418, 256, 65379, 256,
+402, 256, 65373, 256,
+386, 256, 65366, 256,
+372, 256, 65360, 256,
+359, 256, 65354, 256,
+347, 256, 65347, 256,
+336, 256, 65341, 256,
+325, 256, 65334, 256,
+315, 256, 65328, 256,
+306, 256, 65322, 256,
+297, 256, 65315, 256,
+288, 256, 65309, 256,
+281, 256, 65302, 256,
+273, 256, 65296, 256,
+266, 256, 65290, 256,
+259, 256, 65283, 256,
+247, 269, 265, 243,
+253, 269, 259, 244,
+260, 269, 252, 244,
+267, 268, 246, 244,
+274, 268, 239, 245,
+281, 268, 233, 245,
+289, 267, 227, 245,
+297, 267, 220, 245,
+306, 267, 214, 246,
+316, 266, 208, 246,
+326, 266, 201, 246,
+337, 266, 195, 247,
+348, 265, 188, 247,
+360, 265, 182, 247,
+373, 265, 176, 248,
+387, 264, 169, 248,
+403, 264, 163, 248,
+419, 264, 156, 249,
+437, 263, 150, 249,
+456, 263, 144, 249,
+478, 263, 137, 250,
+501, 262, 131, 250,
+527, 262, 124, 250,
+555, 262, 118, 251,
+587, 261, 112, 251,
+623, 261, 105, 251,
+663, 261, 99, 251,
+709, 260, 92, 252,
+761, 260, 86, 252,
+822, 260, 80, 252,
+894, 259, 73, 253,
+980, 259, 67, 253,
+1083, 259, 61, 253,
+1211, 258, 54, 254,
+1373, 258, 48, 254,
+1586, 258, 41, 254,
+1876, 257, 35, 255,
+2296, 257, 29, 255,
+2959, 257, 22, 255,
+4159, 256, 16, 256,
+6998, 256, 9, 256,
+22045, 256, 3, 256,
+19166, 256, 65533, 256,
+6679, 255, 65526, 257,
+4044, 255, 65520, 257,
+2900, 255, 65513, 257,
+2261, 254, 65507, 258,
+1852, 254, 65501, 258,
+1569, 254, 65494, 258,
+1361, 253, 65488, 259,
+1201, 253, 65481, 259,
+1075, 253, 65475, 259,
+973, 252, 65469, 260,
+889, 252, 65462, 260,
+818, 252, 65456, 260,
+757, 252, 65449, 261,
+705, 251, 65443, 261,
+660, 251, 65437, 261,
+620, 251, 65430, 262,
+585, 250, 65424, 262,
+553, 250, 65418, 262,
+525, 250, 65411, 262,
+499, 249, 65405, 263,
+476, 249, 65398, 263,
+455, 249, 65392, 263,
+436, 249, 65386, 264,
+418, 248, 65379, 264,
+402, 248, 65373, 264,
+386, 248, 65366, 265,
+372, 247, 65360, 265,
+359, 247, 65354, 265,
+347, 247, 65347, 266,
+336, 246, 65341, 266,
+325, 246, 65334, 266,
+315, 246, 65328, 267,
+306, 246, 65322, 267,
+297, 245, 65315, 267,
+289, 245, 65309, 267,
+281, 245, 65302, 268,
+273, 244, 65296, 268,
+237, 285, 277, 230,
+242, 284, 270, 231,
+248, 283, 264, 231,
+254, 283, 258, 232,
+261, 282, 251, 232,
+268, 281, 245, 233,
+275, 280, 238, 234,
+282, 280, 232, 234,
+290, 279, 226, 235,
+299, 278, 219, 236,
+308, 277, 213, 236,
+317, 277, 207, 237,
+327, 276, 200, 238,
+338, 275, 194, 238,
+350, 274, 188, 239,
+362, 274, 181, 239,
+375, 273, 175, 240,
+389, 272, 168, 241,
+404, 272, 162, 241,
+421, 271, 156, 242,
+439, 270, 149, 243,
+459, 270, 143, 243,
+480, 269, 137, 244,
+503, 268, 130, 244,
+529, 267, 124, 245,
+558, 267, 117, 246,
+590, 266, 111, 246,
+626, 265, 105, 247,
+666, 265, 98, 248,
+713, 264, 92, 248,
+766, 263, 86, 249,
+827, 263, 79, 249,
+899, 262, 73, 250,
+986, 261, 66, 251,
+1090, 261, 60, 251,
+1219, 260, 54, 252,
+1383, 259, 47, 253,
+1598, 259, 41, 253,
+1892, 258, 35, 254,
+2318, 258, 28, 254,
+2991, 257, 22, 255,
+4218, 256, 16, 256,
+7147, 256, 9, 256,
+23404, 255, 3, 257,
+18363, 254, 65532, 258,
+6594, 254, 65526, 258,
+4019, 253, 65520, 259,
+2890, 253, 65513, 259,
+2256, 252, 65507, 260,
+1851, 251, 65501, 261,
+1568, 251, 65494, 261,
+1361, 250, 65488, 262,
+1202, 250, 65481, 263,
+1076, 249, 65475, 263,
+974, 248, 65469, 264,
+890, 248, 65462, 264,
+819, 247, 65456, 265,
+759, 247, 65450, 266,
+707, 246, 65443, 266,
+661, 245, 65437, 267,
+621, 245, 65431, 268,
+586, 244, 65424, 268,
+554, 244, 65418, 269,
+526, 243, 65411, 270,
+500, 243, 65405, 270,
+477, 242, 65399, 271,
+456, 241, 65392, 271,
+437, 241, 65386, 272,
+419, 240, 65380, 273,
+403, 240, 65373, 273,
+387, 239, 65367, 274,
+373, 239, 65360, 275,
+360, 238, 65354, 275,
+348, 238, 65348, 276,
+337, 237, 65341, 276,
+326, 237, 65335, 277,
+316, 236, 65329, 278,
+307, 235, 65322, 278,
+298, 235, 65316, 279,
+289, 234, 65310, 280,
+228, 303, 288, 216,
+233, 302, 281, 217,
+238, 301, 275, 218,
+244, 299, 269, 219,
+250, 298, 262, 220,
+256, 297, 256, 221,
+263, 296, 250, 222,
+269, 294, 243, 223,
+277, 293, 237, 224,
+284, 292, 231, 225,
+292, 291, 224, 226,
+301, 289, 218, 226,
+310, 288, 212, 227,
+319, 287, 205, 228,
+329, 286, 199, 229,
+340, 285, 193, 230,
+352, 284, 186, 231,
+364, 282, 180, 232,
+377, 281, 174, 233,
+392, 280, 167, 234,
+407, 279, 161, 235,
+424, 278, 155, 236,
+442, 277, 148, 237,
+461, 276, 142, 238,
+483, 275, 136, 239,
+507, 274, 129, 240,
+533, 272, 123, 241,
+562, 271, 117, 241,
+594, 270, 110, 242,
+630, 269, 104, 243,
+671, 268, 98, 244,
+717, 267, 91, 245,
+771, 266, 85, 246,
+833, 265, 79, 247,
+905, 264, 72, 248,
+992, 263, 66, 249,
+1097, 262, 60, 250,
+1227, 261, 53, 251,
+1393, 260, 47, 252,
+1609, 259, 41, 253,
+1905, 258, 34, 254,
+2335, 257, 28, 255,
+3015, 256, 22, 256,
+4254, 255, 15, 257,
+7222, 255, 9, 257,
+23883, 254, 3, 258,
+18272, 253, 65532, 259,
+6608, 252, 65526, 260,
+4033, 251, 65520, 261,
+2903, 250, 65513, 262,
+2267, 249, 65507, 263,
+1860, 248, 65501, 264,
+1576, 247, 65494, 265,
+1368, 246, 65488, 266,
+1208, 246, 65482, 267,
+1082, 245, 65475, 268,
+980, 244, 65469, 269,
+895, 243, 65463, 270,
+824, 242, 65456, 271,
+763, 241, 65450, 272,
+711, 241, 65444, 272,
+665, 240, 65437, 273,
+625, 239, 65431, 274,
+589, 238, 65425, 275,
+558, 237, 65418, 276,
+529, 236, 65412, 277,
+503, 236, 65406, 278,
+480, 235, 65399, 279,
+459, 234, 65393, 280,
+439, 233, 65387, 281,
+421, 233, 65380, 282,
+405, 232, 65374, 283,
+390, 231, 65368, 284,
+376, 230, 65361, 285,
+362, 229, 65355, 286,
+350, 229, 65349, 287,
+339, 228, 65342, 288,
+328, 227, 65336, 288,
+318, 226, 65330, 289,
+308, 226, 65323, 290,
+220, 325, 298, 202,
+225, 323, 292, 203,
+230, 321, 285, 204,
+235, 319, 279, 206,
+240, 317, 273, 207,
+246, 315, 267, 208,
+252, 313, 260, 209,
+258, 311, 254, 211,
+265, 309, 248, 212,
+271, 308, 241, 213,
+279, 306, 235, 214,
+286, 304, 229, 215,
+294, 302, 223, 217,
+303, 301, 216, 218,
+312, 299, 210, 219,
+322, 297, 204, 220,
+332, 296, 197, 222,
+343, 294, 191, 223,
+354, 292, 185, 224,
+367, 291, 179, 225,
+380, 289, 172, 227,
+395, 287, 166, 228,
+410, 286, 160, 229,
+427, 284, 154, 230,
+445, 283, 147, 232,
+465, 281, 141, 233,
+487, 280, 135, 234,
+510, 278, 128, 235,
+537, 277, 122, 237,
+566, 275, 116, 238,
+598, 274, 110, 239,
+634, 273, 103, 240,
+675, 271, 97, 242,
+722, 270, 91, 243,
+776, 268, 84, 244,
+838, 267, 78, 245,
+911, 266, 72, 247,
+998, 264, 66, 248,
+1104, 263, 59, 249,
+1235, 262, 53, 250,
+1400, 260, 47, 252,
+1617, 259, 41, 253,
+1913, 258, 34, 254,
+2343, 257, 28, 255,
+3021, 255, 22, 257,
+4250, 254, 15, 258,
+7168, 253, 9, 259,
+22871, 252, 3, 260,
+19210, 250, 65533, 262,
+6764, 249, 65526, 263,
+4105, 248, 65520, 264,
+2946, 247, 65514, 265,
+2298, 246, 65507, 267,
+1883, 245, 65501, 268,
+1596, 243, 65495, 269,
+1384, 242, 65489, 270,
+1222, 241, 65482, 272,
+1094, 240, 65476, 273,
+990, 239, 65470, 274,
+904, 238, 65464, 275,
+832, 237, 65457, 277,
+771, 236, 65451, 278,
+718, 235, 65445, 279,
+672, 234, 65438, 280,
+631, 233, 65432, 282,
+595, 232, 65426, 283,
+563, 231, 65420, 284,
+534, 230, 65413, 285,
+508, 229, 65407, 287,
+485, 228, 65401, 288,
+463, 227, 65394, 289,
+443, 226, 65388, 290,
+425, 225, 65382, 292,
+409, 224, 65376, 293,
+393, 223, 65369, 294,
+379, 222, 65363, 295,
+366, 221, 65357, 297,
+353, 220, 65351, 298,
+342, 219, 65344, 299,
+331, 218, 65338, 300,
+213, 351, 307, 187,
+218, 348, 301, 188,
+222, 345, 295, 190,
+227, 342, 289, 192,
+232, 339, 283, 193,
+237, 337, 276, 195,
+243, 334, 270, 196,
+248, 331, 264, 198,
+254, 329, 258, 199,
+261, 326, 252, 201,
+267, 324, 245, 202,
+274, 321, 239, 204,
+281, 319, 233, 206,
+289, 316, 227, 207,
+297, 314, 221, 209,
+306, 312, 214, 210,
+315, 309, 208, 212,
+325, 307, 202, 213,
+335, 305, 196, 215,
+346, 303, 189, 216,
+358, 301, 183, 218,
+370, 298, 177, 220,
+384, 296, 171, 221,
+398, 294, 165, 223,
+414, 292, 158, 224,
+431, 290, 152, 226,
+449, 288, 146, 227,
+469, 286, 140, 229,
+491, 284, 134, 230,
+514, 282, 127, 232,
+541, 281, 121, 234,
+570, 279, 115, 235,
+603, 277, 109, 237,
+639, 275, 103, 238,
+680, 273, 96, 240,
+727, 272, 90, 241,
+781, 270, 84, 243,
+843, 268, 78, 244,
+916, 266, 72, 246,
+1004, 265, 65, 248,
+1109, 263, 59, 249,
+1239, 261, 53, 251,
+1404, 260, 47, 252,
+1619, 258, 40, 254,
+1913, 257, 34, 255,
+2336, 255, 28, 257,
+2999, 254, 22, 258,
+4190, 252, 16, 260,
+6947, 251, 9, 262,
+20321, 249, 3, 263,
+21969, 248, 65533, 265,
+7130, 246, 65527, 266,
+4256, 245, 65521, 268,
+3033, 243, 65514, 269,
+2356, 242, 65508, 271,
+1926, 241, 65502, 272,
+1629, 239, 65496, 274,
+1411, 238, 65490, 276,
+1245, 237, 65483, 277,
+1113, 235, 65477, 279,
+1007, 234, 65471, 280,
+920, 233, 65465, 282,
+846, 231, 65459, 283,
+783, 230, 65452, 285,
+729, 229, 65446, 286,
+682, 228, 65440, 288,
+641, 226, 65434, 290,
+604, 225, 65427, 291,
+571, 224, 65421, 293,
+542, 223, 65415, 294,
+515, 222, 65409, 296,
+491, 220, 65403, 297,
+470, 219, 65396, 299,
+450, 218, 65390, 300,
+431, 217, 65384, 302,
+414, 216, 65378, 304,
+399, 215, 65372, 305,
+384, 214, 65365, 307,
+371, 213, 65359, 308,
+358, 212, 65353, 310,
+207, 382, 316, 172,
+211, 378, 310, 173,
+216, 374, 304, 175,
+220, 370, 298, 177,
+225, 366, 292, 179,
+229, 362, 286, 181,
+234, 359, 279, 183,
+240, 355, 273, 185,
+245, 351, 267, 186,
+251, 348, 261, 188,
+257, 345, 255, 190,
+263, 341, 249, 192,
+270, 338, 243, 194,
+277, 335, 237, 196,
+284, 332, 230, 198,
+292, 329, 224, 199,
+300, 326, 218, 201,
+309, 323, 212, 203,
+318, 320, 206, 205,
+328, 317, 200, 207,
+338, 314, 194, 209,
+349, 311, 188, 211,
+361, 308, 181, 212,
+374, 306, 175, 214,
+387, 303, 169, 216,
+402, 301, 163, 218,
+417, 298, 157, 220,
+434, 296, 151, 222,
+453, 293, 145, 224,
+473, 291, 139, 225,
+495, 288, 132, 227,
+519, 286, 126, 229,
+545, 284, 120, 231,
+574, 281, 114, 233,
+607, 279, 108, 235,
+643, 277, 102, 237,
+684, 275, 96, 238,
+731, 273, 90, 240,
+785, 271, 83, 242,
+847, 269, 77, 244,
+920, 267, 71, 246,
+1006, 265, 65, 248,
+1111, 263, 59, 250,
+1239, 261, 53, 251,
+1402, 259, 47, 253,
+1613, 257, 41, 255,
+1899, 255, 35, 257,
+2309, 253, 28, 259,
+2945, 251, 22, 261,
+4063, 250, 16, 263,
+6549, 248, 10, 264,
+16882, 246, 4, 266,
+29226, 244, 65534, 268,
+7833, 243, 65528, 270,
+4522, 241, 65522, 272,
+3179, 239, 65515, 274,
+2451, 238, 65509, 276,
+1994, 236, 65503, 277,
+1681, 235, 65497, 279,
+1453, 233, 65491, 281,
+1279, 232, 65485, 283,
+1142, 230, 65479, 285,
+1032, 229, 65473, 287,
+941, 227, 65466, 289,
+865, 226, 65460, 290,
+801, 224, 65454, 292,
+745, 223, 65448, 294,
+696, 221, 65442, 296,
+654, 220, 65436, 298,
+616, 219, 65430, 300,
+583, 217, 65424, 302,
+553, 216, 65417, 303,
+525, 215, 65411, 305,
+501, 213, 65405, 307,
+478, 212, 65399, 309,
+458, 211, 65393, 311,
+439, 210, 65387, 313,
+422, 208, 65381, 315,
+406, 207, 65375, 317,
+391, 206, 65368, 318,
+202, 420, 324, 156,
+206, 415, 318, 158,
+210, 409, 312, 160,
+214, 404, 306, 162,
+218, 398, 300, 164,
+223, 393, 294, 167,
+227, 388, 288, 169,
+232, 383, 282, 171,
+237, 379, 276, 173,
+243, 374, 270, 175,
+248, 369, 264, 177,
+254, 365, 258, 180,
+260, 361, 252, 182,
+266, 356, 246, 184,
+273, 352, 240, 186,
+280, 348, 234, 188,
+288, 344, 228, 190,
+295, 340, 222, 193,
+304, 337, 216, 195,
+312, 333, 210, 197,
+322, 329, 204, 199,
+331, 326, 198, 201,
+342, 322, 192, 203,
+353, 319, 186, 205,
+365, 316, 180, 208,
+377, 312, 174, 210,
+391, 309, 168, 212,
+406, 306, 162, 214,
+421, 303, 156, 216,
+438, 300, 150, 218,
+457, 297, 143, 221,
+477, 294, 137, 223,
+499, 291, 131, 225,
+523, 289, 125, 227,
+549, 286, 119, 229,
+578, 283, 113, 231,
+611, 281, 107, 233,
+647, 278, 101, 236,
+688, 276, 95, 238,
+734, 273, 89, 240,
+787, 271, 83, 242,
+849, 268, 77, 244,
+921, 266, 71, 246,
+1006, 264, 65, 249,
+1108, 261, 59, 251,
+1234, 259, 53, 253,
+1392, 257, 47, 255,
+1597, 255, 41, 257,
+1871, 253, 35, 259,
+2260, 251, 29, 262,
+2853, 249, 23, 264,
+3867, 247, 17, 266,
+6001, 245, 11, 268,
+13390, 243, 5, 270,
+57920, 241, 65535, 272,
+9156, 239, 65529, 274,
+4971, 237, 65523, 277,
+3412, 235, 65517, 279,
+2597, 233, 65511, 281,
+2096, 232, 65505, 283,
+1758, 230, 65499, 285,
+1513, 228, 65493, 287,
+1328, 226, 65487, 290,
+1184, 225, 65481, 292,
+1068, 223, 65475, 294,
+972, 221, 65469, 296,
+892, 220, 65463, 298,
+825, 218, 65457, 300,
+767, 217, 65451, 302,
+716, 215, 65444, 305,
+672, 214, 65438, 307,
+633, 212, 65432, 309,
+598, 211, 65426, 311,
+567, 209, 65420, 313,
+539, 208, 65414, 315,
+513, 206, 65408, 318,
+490, 205, 65402, 320,
+469, 204, 65396, 322,
+450, 202, 65390, 324,
+432, 201, 65384, 326,
+198, 469, 332, 140,
+201, 461, 326, 142,
+205, 453, 320, 145,
+209, 445, 314, 147,
+213, 438, 308, 150,
+217, 431, 302, 152,
+221, 424, 296, 154,
+226, 418, 290, 157,
+231, 411, 284, 159,
+235, 405, 278, 162,
+241, 399, 272, 164,
+246, 393, 266, 167,
+252, 387, 261, 169,
+257, 382, 255, 172,
+263, 377, 249, 174,
+270, 371, 243, 177,
+277, 366, 237, 179,
+284, 361, 231, 181,
+291, 356, 225, 184,
+299, 352, 219, 186,
+307, 347, 213, 189,
+316, 343, 207, 191,
+325, 338, 201, 194,
+335, 334, 196, 196,
+346, 330, 190, 199,
+357, 326, 184, 201,
+369, 322, 178, 203,
+381, 318, 172, 206,
+395, 315, 166, 208,
+409, 311, 160, 211,
+425, 307, 154, 213,
+442, 304, 148, 216,
+461, 300, 142, 218,
+480, 297, 136, 221,
+502, 294, 130, 223,
+526, 291, 125, 225,
+552, 288, 119, 228,
+581, 284, 113, 230,
+613, 281, 107, 233,
+649, 279, 101, 235,
+690, 276, 95, 238,
+736, 273, 89, 240,
+788, 270, 83, 243,
+848, 267, 77, 245,
+918, 265, 71, 248,
+1001, 262, 65, 250,
+1101, 260, 60, 252,
+1222, 257, 54, 255,
+1374, 255, 48, 257,
+1568, 252, 42, 260,
+1826, 250, 36, 262,
+2187, 248, 30, 265,
+2724, 245, 24, 267,
+3612, 243, 18, 270,
+5358, 241, 12, 272,
+10373, 239, 6, 274,
+65535, 237, 0, 277,
+11899, 235, 65530, 279,
+5739, 233, 65525, 282,
+3781, 231, 65519, 284,
+2819, 229, 65513, 287,
+2248, 227, 65507, 289,
+1869, 225, 65501, 292,
+1599, 223, 65495, 294,
+1397, 221, 65489, 297,
+1241, 219, 65483, 299,
+1116, 217, 65477, 301,
+1014, 216, 65471, 304,
+929, 214, 65465, 306,
+857, 212, 65460, 309,
+796, 211, 65454, 311,
+742, 209, 65448, 314,
+696, 207, 65442, 316,
+655, 206, 65436, 319,
+618, 204, 65430, 321,
+585, 203, 65424, 323,
+556, 201, 65418, 326,
+530, 200, 65412, 328,
+505, 198, 65406, 331,
+483, 197, 65400, 333,
+194, 531, 338, 123,
+197, 520, 332, 126,
+201, 509, 326, 129,
+204, 498, 321, 132,
+208, 488, 315, 134,
+212, 478, 309, 137,
+216, 469, 303, 140,
+220, 460, 297, 142,
+225, 451, 292, 145,
+229, 443, 286, 148,
+234, 435, 280, 151,
+239, 427, 274, 153,
+244, 420, 269, 156,
+249, 412, 263, 159,
+255, 405, 257, 162,
+261, 399, 251, 164,
+267, 392, 245, 167,
+273, 386, 240, 170,
+280, 380, 234, 173,
+287, 374, 228, 175,
+295, 368, 222, 178,
+303, 362, 216, 181,
+311, 357, 211, 184,
+320, 352, 205, 186,
+329, 347, 199, 189,
+339, 342, 193, 192,
+349, 337, 188, 194,
+361, 332, 182, 197,
+372, 328, 176, 200,
+385, 323, 170, 203,
+399, 319, 164, 205,
+413, 315, 159, 208,
+429, 311, 153, 211,
+446, 307, 147, 214,
+464, 303, 141, 216,
+484, 299, 135, 219,
+505, 295, 130, 222,
+529, 292, 124, 225,
+555, 288, 118, 227,
+583, 285, 112, 230,
+615, 282, 107, 233,
+650, 278, 101, 236,
+690, 275, 95, 238,
+735, 272, 89, 241,
+786, 269, 83, 244,
+844, 266, 78, 246,
+912, 263, 72, 249,
+992, 260, 66, 252,
+1087, 257, 60, 255,
+1203, 255, 54, 257,
+1346, 252, 49, 260,
+1527, 249, 43, 263,
+1765, 247, 37, 266,
+2091, 244, 31, 268,
+2564, 242, 26, 271,
+3314, 239, 20, 274,
+4684, 237, 14, 277,
+7985, 235, 8, 279,
+27061, 232, 2, 282,
+19483, 230, 65533, 285,
+7163, 228, 65527, 288,
+4388, 226, 65521, 290,
+3163, 224, 65515, 293,
+2473, 222, 65509, 296,
+2030, 220, 65504, 298,
+1721, 218, 65498, 301,
+1494, 216, 65492, 304,
+1320, 214, 65486, 307,
+1182, 212, 65481, 309,
+1071, 210, 65475, 312,
+978, 208, 65469, 315,
+900, 206, 65463, 318,
+834, 205, 65457, 320,
+777, 203, 65452, 323,
+727, 201, 65446, 326,
+683, 199, 65440, 329,
+644, 198, 65434, 331,
+610, 196, 65428, 334,
+578, 195, 65423, 337,
+550, 193, 65417, 340,
+191, 615, 344, 107,
+194, 598, 338, 110,
+197, 582, 332, 113,
+201, 567, 327, 116,
+204, 552, 321, 119,
+208, 539, 315, 122,
+212, 526, 310, 125,
+215, 513, 304, 128,
+220, 501, 298, 131,
+224, 490, 293, 134,
+228, 479, 287, 137,
+233, 469, 282, 140,
+238, 459, 276, 143,
+243, 449, 270, 146,
+248, 440, 265, 149,
+253, 432, 259, 152,
+259, 423, 253, 155,
+265, 415, 248, 158,
+271, 407, 242, 161,
+277, 400, 236, 164,
+284, 393, 231, 167,
+291, 386, 225, 170,
+299, 379, 219, 173,
+307, 372, 214, 176,
+315, 366, 208, 179,
+324, 360, 203, 182,
+333, 354, 197, 185,
+343, 348, 191, 188,
+353, 343, 186, 191,
+364, 338, 180, 194,
+376, 332, 174, 197,
+389, 327, 169, 200,
+402, 323, 163, 203,
+416, 318, 157, 206,
+432, 313, 152, 209,
+449, 309, 146, 212,
+467, 305, 140, 215,
+486, 300, 135, 218,
+507, 296, 129, 221,
+531, 292, 123, 224,
+556, 288, 118, 227,
+584, 285, 112, 230,
+615, 281, 107, 233,
+649, 277, 101, 236,
+688, 274, 95, 239,
+731, 270, 90, 242,
+780, 267, 84, 245,
+837, 264, 78, 248,
+901, 261, 73, 251,
+977, 258, 67, 254,
+1067, 255, 61, 257,
+1175, 252, 56, 260,
+1307, 249, 50, 263,
+1473, 246, 44, 267,
+1688, 243, 39, 270,
+1975, 240, 33, 273,
+2379, 238, 28, 276,
+2992, 235, 22, 279,
+4031, 233, 16, 282,
+6175, 230, 11, 285,
+13188, 228, 5, 288,
+65535, 225, 65535, 291,
+10371, 223, 65530, 294,
+5478, 221, 65524, 297,
+3722, 219, 65518, 300,
+2819, 217, 65513, 303,
+2268, 214, 65507, 306,
+1897, 212, 65501, 309,
+1631, 210, 65496, 312,
+1430, 208, 65490, 315,
+1273, 206, 65485, 318,
+1147, 204, 65479, 321,
+1044, 202, 65473, 324,
+958, 201, 65468, 327,
+885, 199, 65462, 330,
+822, 197, 65456, 333,
+768, 195, 65451, 336,
+720, 193, 65445, 339,
+678, 192, 65439, 342,
+641, 190, 65434, 345,
+188, 731, 348, 90,
+191, 705, 343, 93,
+194, 681, 337, 96,
+197, 659, 332, 99,
+201, 638, 326, 103,
+204, 618, 321, 106,
+208, 599, 316, 109,
+211, 582, 310, 113,
+215, 565, 305, 116,
+219, 550, 299, 119,
+223, 535, 294, 123,
+228, 521, 288, 126,
+232, 508, 283, 129,
+237, 495, 277, 132,
+241, 483, 272, 136,
+246, 472, 266, 139,
+251, 461, 261, 142,
+257, 450, 255, 146,
+263, 440, 250, 149,
+268, 431, 244, 152,
+275, 422, 239, 155,
+281, 413, 233, 159,
+288, 405, 228, 162,
+295, 396, 222, 165,
+302, 389, 217, 169,
+310, 381, 211, 172,
+319, 374, 206, 175,
+327, 367, 200, 178,
+337, 361, 195, 182,
+346, 354, 189, 185,
+357, 348, 184, 188,
+368, 342, 178, 192,
+379, 336, 173, 195,
+392, 331, 167, 198,
+405, 325, 162, 201,
+419, 320, 156, 205,
+435, 315, 151, 208,
+451, 310, 145, 211,
+469, 305, 140, 215,
+488, 301, 134, 218,
+509, 296, 129, 221,
+531, 292, 123, 225,
+556, 288, 118, 228,
+583, 284, 112, 231,
+613, 280, 107, 234,
+646, 276, 101, 238,
+683, 272, 96, 241,
+725, 268, 90, 244,
+771, 265, 85, 248,
+825, 261, 79, 251,
+886, 258, 74, 254,
+957, 255, 68, 257,
+1040, 251, 63, 261,
+1140, 248, 58, 264,
+1260, 245, 52, 267,
+1409, 242, 47, 271,
+1597, 239, 41, 274,
+1844, 236, 36, 277,
+2181, 234, 30, 280,
+2668, 231, 25, 284,
+3435, 228, 19, 287,
+4823, 226, 14, 290,
+8093, 223, 8, 294,
+25130, 221, 3, 297,
+22743, 218, 65533, 300,
+7829, 216, 65528, 303,
+4728, 214, 65522, 307,
+3387, 211, 65517, 310,
+2638, 209, 65511, 313,
+2161, 207, 65506, 317,
+1830, 205, 65500, 320,
+1587, 203, 65495, 323,
+1400, 201, 65489, 327,
+1253, 199, 65484, 330,
+1134, 197, 65478, 333,
+1036, 195, 65473, 336,
+953, 193, 65467, 340,
+883, 191, 65462, 343,
+822, 189, 65456, 346,
+769, 187, 65451, 350,
+186, 905, 352, 72,
+189, 863, 347, 76,
+192, 824, 342, 80,
+195, 789, 336, 83,
+198, 756, 331, 87,
+201, 727, 326, 90,
+204, 699, 320, 94,
+208, 674, 315, 97,
+212, 650, 310, 101,
+215, 628, 305, 104,
+219, 607, 299, 108,
+223, 588, 294, 112,
+227, 570, 289, 115,
+231, 552, 283, 119,
+236, 536, 278, 122,
+240, 521, 273, 126,
+245, 507, 267, 129,
+250, 493, 262, 133,
+255, 480, 257, 136,
+261, 468, 251, 140,
+266, 457, 246, 144,
+272, 446, 241, 147,
+278, 435, 235, 151,
+285, 425, 230, 154,
+292, 415, 225, 158,
+299, 406, 219, 161,
+306, 398, 214, 165,
+314, 389, 209, 168,
+322, 381, 203, 172,
+331, 373, 198, 176,
+340, 366, 193, 179,
+350, 359, 187, 183,
+360, 352, 182, 186,
+371, 345, 177, 190,
+382, 339, 171, 193,
+394, 333, 166, 197,
+407, 327, 161, 200,
+421, 321, 156, 204,
+436, 316, 150, 208,
+452, 310, 145, 211,
+470, 305, 140, 215,
+488, 300, 134, 218,
+508, 296, 129, 222,
+530, 291, 124, 225,
+554, 286, 118, 229,
+580, 282, 113, 232,
+609, 278, 108, 236,
+641, 274, 102, 240,
+676, 270, 97, 243,
+715, 266, 92, 247,
+759, 262, 86, 250,
+809, 258, 81, 254,
+866, 255, 76, 257,
+931, 251, 70, 261,
+1007, 248, 65, 264,
+1097, 245, 60, 268,
+1204, 241, 54, 272,
+1335, 238, 49, 275,
+1497, 235, 44, 279,
+1704, 232, 38, 282,
+1978, 229, 33, 286,
+2356, 227, 28, 289,
+2913, 224, 22, 293,
+3816, 221, 17, 296,
+5530, 218, 12, 300,
+10036, 216, 7, 304,
+54219, 213, 1, 307,
+15935, 211, 65532, 311,
+6947, 209, 65527, 314,
+4441, 206, 65521, 318,
+3264, 204, 65516, 321,
+2580, 202, 65511, 325,
+2133, 200, 65505, 328,
+1818, 197, 65500, 332,
+1584, 195, 65495, 336,
+1404, 193, 65489, 339,
+1260, 191, 65484, 343,
+1143, 189, 65479, 346,
+1046, 187, 65473, 350,
+964, 185, 65468, 353,
+184, 1191, 356, 55,
+187, 1114, 350, 59,
+190, 1046, 345, 63,
+193, 986, 340, 66,
+196, 933, 335, 70,
+199, 885, 330, 74,
+202, 841, 325, 78,
+205, 802, 320, 82,
+208, 766, 314, 86,
+212, 734, 309, 89,
+215, 704, 304, 93,
+219, 676, 299, 97,
+223, 650, 294, 101,
+227, 627, 289, 105,
+231, 605, 284, 108,
+235, 584, 278, 112,
+240, 565, 273, 116,
+244, 547, 268, 120,
+249, 530, 263, 124,
+254, 514, 258, 127,
+259, 499, 253, 131,
+265, 485, 248, 135,
+270, 472, 242, 139,
+276, 459, 237, 143,
+282, 447, 232, 147,
+289, 436, 227, 150,
+295, 425, 222, 154,
+302, 415, 217, 158,
+310, 405, 212, 162,
+317, 396, 206, 166,
+326, 387, 201, 169,
+334, 378, 196, 173,
+343, 370, 191, 177,
+353, 362, 186, 181,
+363, 355, 181, 185,
+373, 348, 176, 188,
+384, 341, 170, 192,
+396, 334, 165, 196,
+409, 328, 160, 200,
+423, 322, 155, 204,
+437, 316, 150, 208,
+453, 310, 145, 211,
+469, 305, 140, 215,
+487, 299, 135, 219,
+507, 294, 129, 223,
+528, 289, 124, 227,
+550, 284, 119, 230,
+575, 280, 114, 234,
+602, 275, 109, 238,
+632, 271, 104, 242,
+665, 267, 99, 246,
+702, 263, 93, 249,
+743, 259, 88, 253,
+789, 255, 83, 257,
+841, 251, 78, 261,
+900, 248, 73, 265,
+968, 244, 68, 269,
+1048, 241, 63, 272,
+1142, 237, 57, 276,
+1254, 234, 52, 280,
+1391, 231, 47, 284,
+1561, 228, 42, 288,
+1779, 225, 37, 291,
+2068, 222, 32, 295,
+2468, 219, 27, 299,
+3060, 216, 21, 303,
+4027, 214, 16, 307,
+5886, 211, 11, 310,
+10934, 209, 6, 314,
+65535, 206, 1, 318,
+15287, 204, 65532, 322,
+6951, 201, 65527, 326,
+4499, 199, 65521, 330,
+3325, 197, 65516, 333,
+2637, 194, 65511, 337,
+2185, 192, 65506, 341,
+1866, 190, 65501, 345,
+1627, 188, 65496, 349,
+1443, 186, 65491, 352,
+1296, 184, 65485, 356,
+183, 1747, 358, 38,
+186, 1576, 353, 42,
+188, 1436, 348, 46,
+191, 1319, 343, 50,
+194, 1219, 338, 54,
+197, 1134, 333, 58,
+200, 1059, 328, 62,
+203, 994, 323, 66,
+206, 936, 318, 70,
+209, 885, 313, 74,
+213, 839, 308, 78,
+216, 797, 303, 82,
+220, 760, 298, 86,
+223, 726, 294, 90,
+227, 695, 289, 94,
+231, 666, 284, 98,
+235, 640, 279, 102,
+239, 615, 274, 107,
+244, 593, 269, 111,
+248, 572, 264, 115,
+253, 552, 259, 119,
+258, 534, 254, 123,
+263, 517, 249, 127,
+269, 501, 244, 131,
+274, 486, 239, 135,
+280, 471, 234, 139,
+286, 458, 229, 143,
+292, 445, 224, 147,
+299, 433, 219, 151,
+306, 422, 214, 155,
+313, 411, 209, 159,
+321, 401, 204, 163,
+328, 391, 200, 167,
+337, 382, 195, 171,
+346, 373, 190, 176,
+355, 365, 185, 180,
+365, 357, 180, 184,
+375, 349, 175, 188,
+386, 342, 170, 192,
+397, 335, 165, 196,
+410, 328, 160, 200,
+423, 321, 155, 204,
+437, 315, 150, 208,
+452, 309, 145, 212,
+468, 303, 140, 216,
+485, 298, 135, 220,
+503, 292, 130, 224,
+523, 287, 125, 228,
+545, 282, 120, 232,
+568, 277, 115, 236,
+593, 272, 110, 241,
+621, 268, 106, 245,
+652, 264, 101, 249,
+685, 259, 96, 253,
+723, 255, 91, 257,
+765, 251, 86, 261,
+811, 247, 81, 265,
+864, 244, 76, 269,
+925, 240, 71, 273,
+994, 237, 66, 277,
+1075, 233, 61, 281,
+1169, 230, 56, 285,
+1283, 227, 51, 289,
+1420, 223, 46, 293,
+1591, 220, 41, 297,
+1808, 217, 36, 301,
+2094, 215, 31, 305,
+2487, 212, 26, 310,
+3061, 209, 21, 314,
+3981, 206, 16, 318,
+5692, 204, 12, 322,
+9981, 201, 7, 326,
+40492, 199, 2, 330,
+19688, 196, 65533, 334,
+7919, 194, 65528, 338,
+4956, 192, 65523, 342,
+3607, 189, 65518, 346,
+2835, 187, 65513, 350,
+2335, 185, 65508, 354,
+1985, 183, 65503, 358,
+182, 3291, 359, 20,
+185, 2707, 354, 24,
+187, 2299, 350, 29,
+190, 1998, 345, 33,
+193, 1766, 340, 37,
+195, 1583, 336, 41,
+198, 1434, 331, 46,
+201, 1311, 326, 50,
+204, 1207, 321, 54,
+207, 1118, 317, 59,
+210, 1042, 312, 63,
+213, 975, 307, 67,
+217, 917, 302, 71,
+220, 865, 298, 76,
+224, 818, 293, 80,
+227, 777, 288, 84,
+231, 739, 283, 89,
+235, 705, 279, 93,
+239, 674, 274, 97,
+244, 645, 269, 102,
+248, 619, 264, 106,
+252, 595, 260, 110,
+257, 573, 255, 114,
+262, 552, 250, 119,
+267, 533, 245, 123,
+272, 515, 241, 127,
+278, 498, 236, 132,
+283, 482, 231, 136,
+289, 467, 226, 140,
+296, 453, 222, 145,
+302, 440, 217, 149,
+309, 428, 212, 153,
+316, 416, 207, 157,
+323, 405, 203, 162,
+331, 395, 198, 166,
+339, 385, 193, 170,
+348, 375, 189, 175,
+357, 366, 184, 179,
+366, 358, 179, 183,
+376, 349, 174, 188,
+387, 342, 170, 192,
+398, 334, 165, 196,
+409, 327, 160, 200,
+422, 320, 155, 205,
+435, 314, 151, 209,
+449, 307, 146, 213,
+464, 301, 141, 218,
+481, 295, 136, 222,
+498, 290, 132, 226,
+517, 284, 127, 231,
+537, 279, 122, 235,
+558, 274, 117, 239,
+582, 269, 113, 243,
+607, 265, 108, 248,
+635, 260, 103, 252,
+666, 256, 98, 256,
+700, 251, 94, 261,
+737, 247, 89, 265,
+778, 243, 84, 269,
+825, 240, 79, 273,
+877, 236, 75, 278,
+937, 232, 70, 282,
+1005, 229, 65, 286,
+1084, 225, 60, 291,
+1176, 222, 56, 295,
+1285, 219, 51, 299,
+1417, 216, 46, 304,
+1579, 213, 42, 308,
+1782, 210, 37, 312,
+2046, 207, 32, 316,
+2402, 204, 27, 321,
+2907, 202, 23, 325,
+3682, 199, 18, 329,
+5018, 196, 13, 334,
+7880, 194, 8, 338,
+18332, 191, 4, 342,
+56153, 189, 65535, 347,
+11091, 187, 65530, 351,
+6153, 185, 65525, 355,
+4257, 182, 65521, 359,
+182, 28963, 360, 2,
+184, 9654, 355, 7,
+187, 5793, 351, 11,
+189, 4138, 346, 16,
+192, 3218, 342, 20,
+194, 2633, 337, 25,
+197, 2228, 333, 29,
+200, 1931, 328, 34,
+203, 1704, 324, 38,
+205, 1524, 319, 43,
+208, 1379, 315, 48,
+211, 1259, 310, 52,
+215, 1159, 305, 57,
+218, 1073, 301, 61,
+221, 999, 296, 66,
+225, 934, 292, 70,
+228, 878, 287, 75,
+232, 828, 283, 79,
+235, 783, 278, 84,
+239, 743, 274, 88,
+243, 706, 269, 93,
+248, 674, 265, 97,
+252, 644, 260, 102,
+256, 616, 256, 106,
+261, 591, 251, 111,
+266, 568, 247, 115,
+271, 546, 242, 120,
+276, 527, 238, 124,
+281, 508, 233, 129,
+287, 491, 229, 134,
+293, 475, 224, 138,
+299, 460, 219, 143,
+305, 446, 215, 147,
+311, 432, 210, 152,
+318, 420, 206, 156,
+325, 408, 201, 161,
+333, 397, 197, 165,
+341, 386, 192, 170,
+349, 376, 188, 174,
+358, 367, 183, 179,
+367, 358, 179, 183,
+376, 349, 174, 188,
+386, 341, 170, 192,
+397, 333, 165, 197,
+408, 325, 161, 201,
+420, 318, 156, 206,
+432, 311, 152, 210,
+446, 305, 147, 215,
+460, 299, 143, 219,
+475, 293, 138, 224,
+491, 287, 134, 229,
+508, 281, 129, 233,
+527, 276, 124, 238,
+546, 271, 120, 242,
+568, 266, 115, 247,
+591, 261, 111, 251,
+616, 256, 106, 256,
+644, 252, 102, 260,
+674, 248, 97, 265,
+706, 243, 93, 269,
+743, 239, 88, 274,
+783, 235, 84, 278,
+828, 232, 79, 283,
+878, 228, 75, 287,
+934, 225, 70, 292,
+999, 221, 66, 296,
+1073, 218, 61, 301,
+1159, 215, 57, 305,
+1259, 211, 52, 310,
+1379, 208, 48, 315,
+1524, 205, 43, 319,
+1704, 203, 38, 324,
+1931, 200, 34, 328,
+2228, 197, 29, 333,
+2633, 194, 25, 337,
+3218, 192, 20, 342,
+4138, 189, 16, 346,
+5793, 187, 11, 351,
+9654, 184, 7, 355,
+28963, 182, 2, 360,
+182, 4257, 359, 65521,
+185, 6153, 355, 65525,
+187, 11091, 351, 65530,
+189, 56153, 347, 65535,
+191, 18332, 342, 4,
+194, 7880, 338, 8,
+196, 5018, 334, 13,
+199, 3682, 329, 18,
+202, 2907, 325, 23,
+204, 2402, 321, 27,
+207, 2046, 316, 32,
+210, 1782, 312, 37,
+213, 1579, 308, 42,
+216, 1417, 304, 46,
+219, 1285, 299, 51,
+222, 1176, 295, 56,
+225, 1084, 291, 60,
+229, 1005, 286, 65,
+232, 937, 282, 70,
+236, 877, 278, 75,
+240, 825, 273, 79,
+243, 778, 269, 84,
+247, 737, 265, 89,
+251, 700, 261, 94,
+256, 666, 256, 98,
+260, 635, 252, 103,
+265, 607, 248, 108,
+269, 582, 243, 113,
+274, 558, 239, 117,
+279, 537, 235, 122,
+284, 517, 231, 127,
+290, 498, 226, 132,
+295, 481, 222, 136,
+301, 464, 218, 141,
+307, 449, 213, 146,
+314, 435, 209, 151,
+320, 422, 205, 155,
+327, 409, 200, 160,
+334, 398, 196, 165,
+342, 387, 192, 170,
+349, 376, 188, 174,
+358, 366, 183, 179,
+366, 357, 179, 184,
+375, 348, 175, 189,
+385, 339, 170, 193,
+395, 331, 166, 198,
+405, 323, 162, 203,
+416, 316, 157, 207,
+428, 309, 153, 212,
+440, 302, 149, 217,
+453, 296, 145, 222,
+467, 289, 140, 226,
+482, 283, 136, 231,
+498, 278, 132, 236,
+515, 272, 127, 241,
+533, 267, 123, 245,
+552, 262, 119, 250,
+573, 257, 114, 255,
+595, 252, 110, 260,
+619, 248, 106, 264,
+645, 244, 102, 269,
+674, 239, 97, 274,
+705, 235, 93, 279,
+739, 231, 89, 283,
+777, 227, 84, 288,
+818, 224, 80, 293,
+865, 220, 76, 298,
+917, 217, 71, 302,
+975, 213, 67, 307,
+1042, 210, 63, 312,
+1118, 207, 59, 317,
+1207, 204, 54, 321,
+1311, 201, 50, 326,
+1434, 198, 46, 331,
+1583, 195, 41, 336,
+1766, 193, 37, 340,
+1998, 190, 33, 345,
+2299, 187, 29, 350,
+2707, 185, 24, 354,
+3291, 182, 20, 359,
+183, 1985, 358, 65503,
+185, 2335, 354, 65508,
+187, 2835, 350, 65513,
+189, 3607, 346, 65518,
+192, 4956, 342, 65523,
+194, 7919, 338, 65528,
+196, 19688, 334, 65533,
+199, 40492, 330, 2,
+201, 9981, 326, 7,
+204, 5692, 322, 12,
+206, 3981, 318, 16,
+209, 3061, 314, 21,
+212, 2487, 310, 26,
+215, 2094, 305, 31,
+217, 1808, 301, 36,
+220, 1591, 297, 41,
+223, 1420, 293, 46,
+227, 1283, 289, 51,
+230, 1169, 285, 56,
+233, 1075, 281, 61,
+237, 994, 277, 66,
+240, 925, 273, 71,
+244, 864, 269, 76,
+247, 811, 265, 81,
+251, 765, 261, 86,
+255, 723, 257, 91,
+259, 685, 253, 96,
+264, 652, 249, 101,
+268, 621, 245, 106,
+272, 593, 241, 110,
+277, 568, 236, 115,
+282, 545, 232, 120,
+287, 523, 228, 125,
+292, 503, 224, 130,
+298, 485, 220, 135,
+303, 468, 216, 140,
+309, 452, 212, 145,
+315, 437, 208, 150,
+321, 423, 204, 155,
+328, 410, 200, 160,
+335, 397, 196, 165,
+342, 386, 192, 170,
+349, 375, 188, 175,
+357, 365, 184, 180,
+365, 355, 180, 185,
+373, 346, 176, 190,
+382, 337, 171, 195,
+391, 328, 167, 200,
+401, 321, 163, 204,
+411, 313, 159, 209,
+422, 306, 155, 214,
+433, 299, 151, 219,
+445, 292, 147, 224,
+458, 286, 143, 229,
+471, 280, 139, 234,
+486, 274, 135, 239,
+501, 269, 131, 244,
+517, 263, 127, 249,
+534, 258, 123, 254,
+552, 253, 119, 259,
+572, 248, 115, 264,
+593, 244, 111, 269,
+615, 239, 107, 274,
+640, 235, 102, 279,
+666, 231, 98, 284,
+695, 227, 94, 289,
+726, 223, 90, 294,
+760, 220, 86, 298,
+797, 216, 82, 303,
+839, 213, 78, 308,
+885, 209, 74, 313,
+936, 206, 70, 318,
+994, 203, 66, 323,
+1059, 200, 62, 328,
+1134, 197, 58, 333,
+1219, 194, 54, 338,
+1319, 191, 50, 343,
+1436, 188, 46, 348,
+1576, 186, 42, 353,
+1747, 183, 38, 358,
+184, 1296, 356, 65485,
+186, 1443, 352, 65491,
+188, 1627, 349, 65496,
+190, 1866, 345, 65501,
+192, 2185, 341, 65506,
+194, 2637, 337, 65511,
+197, 3325, 333, 65516,
+199, 4499, 330, 65521,
+201, 6951, 326, 65527,
+204, 15287, 322, 65532,
+206, 65535, 318, 1,
+209, 10934, 314, 6,
+211, 5886, 310, 11,
+214, 4027, 307, 16,
+216, 3060, 303, 21,
+219, 2468, 299, 27,
+222, 2068, 295, 32,
+225, 1779, 291, 37,
+228, 1561, 288, 42,
+231, 1391, 284, 47,
+234, 1254, 280, 52,
+237, 1142, 276, 57,
+241, 1048, 272, 63,
+244, 968, 269, 68,
+248, 900, 265, 73,
+251, 841, 261, 78,
+255, 789, 257, 83,
+259, 743, 253, 88,
+263, 702, 249, 93,
+267, 665, 246, 99,
+271, 632, 242, 104,
+275, 602, 238, 109,
+280, 575, 234, 114,
+284, 550, 230, 119,
+289, 528, 227, 124,
+294, 507, 223, 129,
+299, 487, 219, 135,
+305, 469, 215, 140,
+310, 453, 211, 145,
+316, 437, 208, 150,
+322, 423, 204, 155,
+328, 409, 200, 160,
+334, 396, 196, 165,
+341, 384, 192, 170,
+348, 373, 188, 176,
+355, 363, 185, 181,
+362, 353, 181, 186,
+370, 343, 177, 191,
+378, 334, 173, 196,
+387, 326, 169, 201,
+396, 317, 166, 206,
+405, 310, 162, 212,
+415, 302, 158, 217,
+425, 295, 154, 222,
+436, 289, 150, 227,
+447, 282, 147, 232,
+459, 276, 143, 237,
+472, 270, 139, 242,
+485, 265, 135, 248,
+499, 259, 131, 253,
+514, 254, 127, 258,
+530, 249, 124, 263,
+547, 244, 120, 268,
+565, 240, 116, 273,
+584, 235, 112, 278,
+605, 231, 108, 284,
+627, 227, 105, 289,
+650, 223, 101, 294,
+676, 219, 97, 299,
+704, 215, 93, 304,
+734, 212, 89, 309,
+766, 208, 86, 314,
+802, 205, 82, 320,
+841, 202, 78, 325,
+885, 199, 74, 330,
+933, 196, 70, 335,
+986, 193, 66, 340,
+1046, 190, 63, 345,
+1114, 187, 59, 350,
+1191, 184, 55, 356,
+185, 964, 353, 65468,
+187, 1046, 350, 65473,
+189, 1143, 346, 65479,
+191, 1260, 343, 65484,
+193, 1404, 339, 65489,
+195, 1584, 336, 65495,
+197, 1818, 332, 65500,
+200, 2133, 328, 65505,
+202, 2580, 325, 65511,
+204, 3264, 321, 65516,
+206, 4441, 318, 65521,
+209, 6947, 314, 65527,
+211, 15935, 311, 65532,
+213, 54219, 307, 1,
+216, 10036, 304, 7,
+218, 5530, 300, 12,
+221, 3816, 296, 17,
+224, 2913, 293, 22,
+227, 2356, 289, 28,
+229, 1978, 286, 33,
+232, 1704, 282, 38,
+235, 1497, 279, 44,
+238, 1335, 275, 49,
+241, 1204, 272, 54,
+245, 1097, 268, 60,
+248, 1007, 264, 65,
+251, 931, 261, 70,
+255, 866, 257, 76,
+258, 809, 254, 81,
+262, 759, 250, 86,
+266, 715, 247, 92,
+270, 676, 243, 97,
+274, 641, 240, 102,
+278, 609, 236, 108,
+282, 580, 232, 113,
+286, 554, 229, 118,
+291, 530, 225, 124,
+296, 508, 222, 129,
+300, 488, 218, 134,
+305, 470, 215, 140,
+310, 452, 211, 145,
+316, 436, 208, 150,
+321, 421, 204, 156,
+327, 407, 200, 161,
+333, 394, 197, 166,
+339, 382, 193, 171,
+345, 371, 190, 177,
+352, 360, 186, 182,
+359, 350, 183, 187,
+366, 340, 179, 193,
+373, 331, 176, 198,
+381, 322, 172, 203,
+389, 314, 168, 209,
+398, 306, 165, 214,
+406, 299, 161, 219,
+415, 292, 158, 225,
+425, 285, 154, 230,
+435, 278, 151, 235,
+446, 272, 147, 241,
+457, 266, 144, 246,
+468, 261, 140, 251,
+480, 255, 136, 257,
+493, 250, 133, 262,
+507, 245, 129, 267,
+521, 240, 126, 273,
+536, 236, 122, 278,
+552, 231, 119, 283,
+570, 227, 115, 289,
+588, 223, 112, 294,
+607, 219, 108, 299,
+628, 215, 104, 305,
+650, 212, 101, 310,
+674, 208, 97, 315,
+699, 204, 94, 320,
+727, 201, 90, 326,
+756, 198, 87, 331,
+789, 195, 83, 336,
+824, 192, 80, 342,
+863, 189, 76, 347,
+905, 186, 72, 352,
+187, 769, 350, 65451,
+189, 822, 346, 65456,
+191, 883, 343, 65462,
+193, 953, 340, 65467,
+195, 1036, 336, 65473,
+197, 1134, 333, 65478,
+199, 1253, 330, 65484,
+201, 1400, 327, 65489,
+203, 1587, 323, 65495,
+205, 1830, 320, 65500,
+207, 2161, 317, 65506,
+209, 2638, 313, 65511,
+211, 3387, 310, 65517,
+214, 4728, 307, 65522,
+216, 7829, 303, 65528,
+218, 22743, 300, 65533,
+221, 25130, 297, 3,
+223, 8093, 294, 8,
+226, 4823, 290, 14,
+228, 3435, 287, 19,
+231, 2668, 284, 25,
+234, 2181, 280, 30,
+236, 1844, 277, 36,
+239, 1597, 274, 41,
+242, 1409, 271, 47,
+245, 1260, 267, 52,
+248, 1140, 264, 58,
+251, 1040, 261, 63,
+255, 957, 257, 68,
+258, 886, 254, 74,
+261, 825, 251, 79,
+265, 771, 248, 85,
+268, 725, 244, 90,
+272, 683, 241, 96,
+276, 646, 238, 101,
+280, 613, 234, 107,
+284, 583, 231, 112,
+288, 556, 228, 118,
+292, 531, 225, 123,
+296, 509, 221, 129,
+301, 488, 218, 134,
+305, 469, 215, 140,
+310, 451, 211, 145,
+315, 435, 208, 151,
+320, 419, 205, 156,
+325, 405, 201, 162,
+331, 392, 198, 167,
+336, 379, 195, 173,
+342, 368, 192, 178,
+348, 357, 188, 184,
+354, 346, 185, 189,
+361, 337, 182, 195,
+367, 327, 178, 200,
+374, 319, 175, 206,
+381, 310, 172, 211,
+389, 302, 169, 217,
+396, 295, 165, 222,
+405, 288, 162, 228,
+413, 281, 159, 233,
+422, 275, 155, 239,
+431, 268, 152, 244,
+440, 263, 149, 250,
+450, 257, 146, 255,
+461, 251, 142, 261,
+472, 246, 139, 266,
+483, 241, 136, 272,
+495, 237, 132, 277,
+508, 232, 129, 283,
+521, 228, 126, 288,
+535, 223, 123, 294,
+550, 219, 119, 299,
+565, 215, 116, 305,
+582, 211, 113, 310,
+599, 208, 109, 316,
+618, 204, 106, 321,
+638, 201, 103, 326,
+659, 197, 99, 332,
+681, 194, 96, 337,
+705, 191, 93, 343,
+731, 188, 90, 348,
+190, 641, 345, 65434,
+192, 678, 342, 65439,
+193, 720, 339, 65445,
+195, 768, 336, 65451,
+197, 822, 333, 65456,
+199, 885, 330, 65462,
+201, 958, 327, 65468,
+202, 1044, 324, 65473,
+204, 1147, 321, 65479,
+206, 1273, 318, 65485,
+208, 1430, 315, 65490,
+210, 1631, 312, 65496,
+212, 1897, 309, 65501,
+214, 2268, 306, 65507,
+217, 2819, 303, 65513,
+219, 3722, 300, 65518,
+221, 5478, 297, 65524,
+223, 10371, 294, 65530,
+225, 65535, 291, 65535,
+228, 13188, 288, 5,
+230, 6175, 285, 11,
+233, 4031, 282, 16,
+235, 2992, 279, 22,
+238, 2379, 276, 28,
+240, 1975, 273, 33,
+243, 1688, 270, 39,
+246, 1473, 267, 44,
+249, 1307, 263, 50,
+252, 1175, 260, 56,
+255, 1067, 257, 61,
+258, 977, 254, 67,
+261, 901, 251, 73,
+264, 837, 248, 78,
+267, 780, 245, 84,
+270, 731, 242, 90,
+274, 688, 239, 95,
+277, 649, 236, 101,
+281, 615, 233, 107,
+285, 584, 230, 112,
+288, 556, 227, 118,
+292, 531, 224, 123,
+296, 507, 221, 129,
+300, 486, 218, 135,
+305, 467, 215, 140,
+309, 449, 212, 146,
+313, 432, 209, 152,
+318, 416, 206, 157,
+323, 402, 203, 163,
+327, 389, 200, 169,
+332, 376, 197, 174,
+338, 364, 194, 180,
+343, 353, 191, 186,
+348, 343, 188, 191,
+354, 333, 185, 197,
+360, 324, 182, 203,
+366, 315, 179, 208,
+372, 307, 176, 214,
+379, 299, 173, 219,
+386, 291, 170, 225,
+393, 284, 167, 231,
+400, 277, 164, 236,
+407, 271, 161, 242,
+415, 265, 158, 248,
+423, 259, 155, 253,
+432, 253, 152, 259,
+440, 248, 149, 265,
+449, 243, 146, 270,
+459, 238, 143, 276,
+469, 233, 140, 282,
+479, 228, 137, 287,
+490, 224, 134, 293,
+501, 220, 131, 298,
+513, 215, 128, 304,
+526, 212, 125, 310,
+539, 208, 122, 315,
+552, 204, 119, 321,
+567, 201, 116, 327,
+582, 197, 113, 332,
+598, 194, 110, 338,
+615, 191, 107, 344,
+193, 550, 340, 65417,
+195, 578, 337, 65423,
+196, 610, 334, 65428,
+198, 644, 331, 65434,
+199, 683, 329, 65440,
+201, 727, 326, 65446,
+203, 777, 323, 65452,
+205, 834, 320, 65457,
+206, 900, 318, 65463,
+208, 978, 315, 65469,
+210, 1071, 312, 65475,
+212, 1182, 309, 65481,
+214, 1320, 307, 65486,
+216, 1494, 304, 65492,
+218, 1721, 301, 65498,
+220, 2030, 298, 65504,
+222, 2473, 296, 65509,
+224, 3163, 293, 65515,
+226, 4388, 290, 65521,
+228, 7163, 288, 65527,
+230, 19483, 285, 65533,
+232, 27061, 282, 2,
+235, 7985, 279, 8,
+237, 4684, 277, 14,
+239, 3314, 274, 20,
+242, 2564, 271, 26,
+244, 2091, 268, 31,
+247, 1765, 266, 37,
+249, 1527, 263, 43,
+252, 1346, 260, 49,
+255, 1203, 257, 54,
+257, 1087, 255, 60,
+260, 992, 252, 66,
+263, 912, 249, 72,
+266, 844, 246, 78,
+269, 786, 244, 83,
+272, 735, 241, 89,
+275, 690, 238, 95,
+278, 650, 236, 101,
+282, 615, 233, 107,
+285, 583, 230, 112,
+288, 555, 227, 118,
+292, 529, 225, 124,
+295, 505, 222, 130,
+299, 484, 219, 135,
+303, 464, 216, 141,
+307, 446, 214, 147,
+311, 429, 211, 153,
+315, 413, 208, 159,
+319, 399, 205, 164,
+323, 385, 203, 170,
+328, 372, 200, 176,
+332, 361, 197, 182,
+337, 349, 194, 188,
+342, 339, 192, 193,
+347, 329, 189, 199,
+352, 320, 186, 205,
+357, 311, 184, 211,
+362, 303, 181, 216,
+368, 295, 178, 222,
+374, 287, 175, 228,
+380, 280, 173, 234,
+386, 273, 170, 240,
+392, 267, 167, 245,
+399, 261, 164, 251,
+405, 255, 162, 257,
+412, 249, 159, 263,
+420, 244, 156, 269,
+427, 239, 153, 274,
+435, 234, 151, 280,
+443, 229, 148, 286,
+451, 225, 145, 292,
+460, 220, 142, 297,
+469, 216, 140, 303,
+478, 212, 137, 309,
+488, 208, 134, 315,
+498, 204, 132, 321,
+509, 201, 129, 326,
+520, 197, 126, 332,
+531, 194, 123, 338,
+197, 483, 333, 65400,
+198, 505, 331, 65406,
+200, 530, 328, 65412,
+201, 556, 326, 65418,
+203, 585, 323, 65424,
+204, 618, 321, 65430,
+206, 655, 319, 65436,
+207, 696, 316, 65442,
+209, 742, 314, 65448,
+211, 796, 311, 65454,
+212, 857, 309, 65460,
+214, 929, 306, 65465,
+216, 1014, 304, 65471,
+217, 1116, 301, 65477,
+219, 1241, 299, 65483,
+221, 1397, 297, 65489,
+223, 1599, 294, 65495,
+225, 1869, 292, 65501,
+227, 2248, 289, 65507,
+229, 2819, 287, 65513,
+231, 3781, 284, 65519,
+233, 5739, 282, 65525,
+235, 11899, 279, 65530,
+237, 65535, 277, 0,
+239, 10373, 274, 6,
+241, 5358, 272, 12,
+243, 3612, 270, 18,
+245, 2724, 267, 24,
+248, 2187, 265, 30,
+250, 1826, 262, 36,
+252, 1568, 260, 42,
+255, 1374, 257, 48,
+257, 1222, 255, 54,
+260, 1101, 252, 60,
+262, 1001, 250, 65,
+265, 918, 248, 71,
+267, 848, 245, 77,
+270, 788, 243, 83,
+273, 736, 240, 89,
+276, 690, 238, 95,
+279, 649, 235, 101,
+281, 613, 233, 107,
+284, 581, 230, 113,
+288, 552, 228, 119,
+291, 526, 225, 125,
+294, 502, 223, 130,
+297, 480, 221, 136,
+300, 461, 218, 142,
+304, 442, 216, 148,
+307, 425, 213, 154,
+311, 409, 211, 160,
+315, 395, 208, 166,
+318, 381, 206, 172,
+322, 369, 203, 178,
+326, 357, 201, 184,
+330, 346, 199, 190,
+334, 335, 196, 196,
+338, 325, 194, 201,
+343, 316, 191, 207,
+347, 307, 189, 213,
+352, 299, 186, 219,
+356, 291, 184, 225,
+361, 284, 181, 231,
+366, 277, 179, 237,
+371, 270, 177, 243,
+377, 263, 174, 249,
+382, 257, 172, 255,
+387, 252, 169, 261,
+393, 246, 167, 266,
+399, 241, 164, 272,
+405, 235, 162, 278,
+411, 231, 159, 284,
+418, 226, 157, 290,
+424, 221, 154, 296,
+431, 217, 152, 302,
+438, 213, 150, 308,
+445, 209, 147, 314,
+453, 205, 145, 320,
+461, 201, 142, 326,
+469, 198, 140, 332,
+201, 432, 326, 65384,
+202, 450, 324, 65390,
+204, 469, 322, 65396,
+205, 490, 320, 65402,
+206, 513, 318, 65408,
+208, 539, 315, 65414,
+209, 567, 313, 65420,
+211, 598, 311, 65426,
+212, 633, 309, 65432,
+214, 672, 307, 65438,
+215, 716, 305, 65444,
+217, 767, 302, 65451,
+218, 825, 300, 65457,
+220, 892, 298, 65463,
+221, 972, 296, 65469,
+223, 1068, 294, 65475,
+225, 1184, 292, 65481,
+226, 1328, 290, 65487,
+228, 1513, 287, 65493,
+230, 1758, 285, 65499,
+232, 2096, 283, 65505,
+233, 2597, 281, 65511,
+235, 3412, 279, 65517,
+237, 4971, 277, 65523,
+239, 9156, 274, 65529,
+241, 57920, 272, 65535,
+243, 13390, 270, 5,
+245, 6001, 268, 11,
+247, 3867, 266, 17,
+249, 2853, 264, 23,
+251, 2260, 262, 29,
+253, 1871, 259, 35,
+255, 1597, 257, 41,
+257, 1392, 255, 47,
+259, 1234, 253, 53,
+261, 1108, 251, 59,
+264, 1006, 249, 65,
+266, 921, 246, 71,
+268, 849, 244, 77,
+271, 787, 242, 83,
+273, 734, 240, 89,
+276, 688, 238, 95,
+278, 647, 236, 101,
+281, 611, 233, 107,
+283, 578, 231, 113,
+286, 549, 229, 119,
+289, 523, 227, 125,
+291, 499, 225, 131,
+294, 477, 223, 137,
+297, 457, 221, 143,
+300, 438, 218, 150,
+303, 421, 216, 156,
+306, 406, 214, 162,
+309, 391, 212, 168,
+312, 377, 210, 174,
+316, 365, 208, 180,
+319, 353, 205, 186,
+322, 342, 203, 192,
+326, 331, 201, 198,
+329, 322, 199, 204,
+333, 312, 197, 210,
+337, 304, 195, 216,
+340, 295, 193, 222,
+344, 288, 190, 228,
+348, 280, 188, 234,
+352, 273, 186, 240,
+356, 266, 184, 246,
+361, 260, 182, 252,
+365, 254, 180, 258,
+369, 248, 177, 264,
+374, 243, 175, 270,
+379, 237, 173, 276,
+383, 232, 171, 282,
+388, 227, 169, 288,
+393, 223, 167, 294,
+398, 218, 164, 300,
+404, 214, 162, 306,
+409, 210, 160, 312,
+415, 206, 158, 318,
+420, 202, 156, 324,
+206, 391, 318, 65368,
+207, 406, 317, 65375,
+208, 422, 315, 65381,
+210, 439, 313, 65387,
+211, 458, 311, 65393,
+212, 478, 309, 65399,
+213, 501, 307, 65405,
+215, 525, 305, 65411,
+216, 553, 303, 65417,
+217, 583, 302, 65424,
+219, 616, 300, 65430,
+220, 654, 298, 65436,
+221, 696, 296, 65442,
+223, 745, 294, 65448,
+224, 801, 292, 65454,
+226, 865, 290, 65460,
+227, 941, 289, 65466,
+229, 1032, 287, 65473,
+230, 1142, 285, 65479,
+232, 1279, 283, 65485,
+233, 1453, 281, 65491,
+235, 1681, 279, 65497,
+236, 1994, 277, 65503,
+238, 2451, 276, 65509,
+239, 3179, 274, 65515,
+241, 4522, 272, 65522,
+243, 7833, 270, 65528,
+244, 29226, 268, 65534,
+246, 16882, 266, 4,
+248, 6549, 264, 10,
+250, 4063, 263, 16,
+251, 2945, 261, 22,
+253, 2309, 259, 28,
+255, 1899, 257, 35,
+257, 1613, 255, 41,
+259, 1402, 253, 47,
+261, 1239, 251, 53,
+263, 1111, 250, 59,
+265, 1006, 248, 65,
+267, 920, 246, 71,
+269, 847, 244, 77,
+271, 785, 242, 83,
+273, 731, 240, 90,
+275, 684, 238, 96,
+277, 643, 237, 102,
+279, 607, 235, 108,
+281, 574, 233, 114,
+284, 545, 231, 120,
+286, 519, 229, 126,
+288, 495, 227, 132,
+291, 473, 225, 139,
+293, 453, 224, 145,
+296, 434, 222, 151,
+298, 417, 220, 157,
+301, 402, 218, 163,
+303, 387, 216, 169,
+306, 374, 214, 175,
+308, 361, 212, 181,
+311, 349, 211, 188,
+314, 338, 209, 194,
+317, 328, 207, 200,
+320, 318, 205, 206,
+323, 309, 203, 212,
+326, 300, 201, 218,
+329, 292, 199, 224,
+332, 284, 198, 230,
+335, 277, 196, 237,
+338, 270, 194, 243,
+341, 263, 192, 249,
+345, 257, 190, 255,
+348, 251, 188, 261,
+351, 245, 186, 267,
+355, 240, 185, 273,
+359, 234, 183, 279,
+362, 229, 181, 286,
+366, 225, 179, 292,
+370, 220, 177, 298,
+374, 216, 175, 304,
+378, 211, 173, 310,
+382, 207, 172, 316,
+212, 358, 310, 65353,
+213, 371, 308, 65359,
+214, 384, 307, 65365,
+215, 399, 305, 65372,
+216, 414, 304, 65378,
+217, 431, 302, 65384,
+218, 450, 300, 65390,
+219, 470, 299, 65396,
+220, 491, 297, 65403,
+222, 515, 296, 65409,
+223, 542, 294, 65415,
+224, 571, 293, 65421,
+225, 604, 291, 65427,
+226, 641, 290, 65434,
+228, 682, 288, 65440,
+229, 729, 286, 65446,
+230, 783, 285, 65452,
+231, 846, 283, 65459,
+233, 920, 282, 65465,
+234, 1007, 280, 65471,
+235, 1113, 279, 65477,
+237, 1245, 277, 65483,
+238, 1411, 276, 65490,
+239, 1629, 274, 65496,
+241, 1926, 272, 65502,
+242, 2356, 271, 65508,
+243, 3033, 269, 65514,
+245, 4256, 268, 65521,
+246, 7130, 266, 65527,
+248, 21969, 265, 65533,
+249, 20321, 263, 3,
+251, 6947, 262, 9,
+252, 4190, 260, 16,
+254, 2999, 258, 22,
+255, 2336, 257, 28,
+257, 1913, 255, 34,
+258, 1619, 254, 40,
+260, 1404, 252, 47,
+261, 1239, 251, 53,
+263, 1109, 249, 59,
+265, 1004, 248, 65,
+266, 916, 246, 72,
+268, 843, 244, 78,
+270, 781, 243, 84,
+272, 727, 241, 90,
+273, 680, 240, 96,
+275, 639, 238, 103,
+277, 603, 237, 109,
+279, 570, 235, 115,
+281, 541, 234, 121,
+282, 514, 232, 127,
+284, 491, 230, 134,
+286, 469, 229, 140,
+288, 449, 227, 146,
+290, 431, 226, 152,
+292, 414, 224, 158,
+294, 398, 223, 165,
+296, 384, 221, 171,
+298, 370, 220, 177,
+301, 358, 218, 183,
+303, 346, 216, 189,
+305, 335, 215, 196,
+307, 325, 213, 202,
+309, 315, 212, 208,
+312, 306, 210, 214,
+314, 297, 209, 221,
+316, 289, 207, 227,
+319, 281, 206, 233,
+321, 274, 204, 239,
+324, 267, 202, 245,
+326, 261, 201, 252,
+329, 254, 199, 258,
+331, 248, 198, 264,
+334, 243, 196, 270,
+337, 237, 195, 276,
+339, 232, 193, 283,
+342, 227, 192, 289,
+345, 222, 190, 295,
+348, 218, 188, 301,
+351, 213, 187, 307,
+218, 331, 300, 65338,
+219, 342, 299, 65344,
+220, 353, 298, 65351,
+221, 366, 297, 65357,
+222, 379, 295, 65363,
+223, 393, 294, 65369,
+224, 409, 293, 65376,
+225, 425, 292, 65382,
+226, 443, 290, 65388,
+227, 463, 289, 65394,
+228, 485, 288, 65401,
+229, 508, 287, 65407,
+230, 534, 285, 65413,
+231, 563, 284, 65420,
+232, 595, 283, 65426,
+233, 631, 282, 65432,
+234, 672, 280, 65438,
+235, 718, 279, 65445,
+236, 771, 278, 65451,
+237, 832, 277, 65457,
+238, 904, 275, 65464,
+239, 990, 274, 65470,
+240, 1094, 273, 65476,
+241, 1222, 272, 65482,
+242, 1384, 270, 65489,
+243, 1596, 269, 65495,
+245, 1883, 268, 65501,
+246, 2298, 267, 65507,
+247, 2946, 265, 65514,
+248, 4105, 264, 65520,
+249, 6764, 263, 65526,
+250, 19210, 262, 65533,
+252, 22871, 260, 3,
+253, 7168, 259, 9,
+254, 4250, 258, 15,
+255, 3021, 257, 22,
+257, 2343, 255, 28,
+258, 1913, 254, 34,
+259, 1617, 253, 41,
+260, 1400, 252, 47,
+262, 1235, 250, 53,
+263, 1104, 249, 59,
+264, 998, 248, 66,
+266, 911, 247, 72,
+267, 838, 245, 78,
+268, 776, 244, 84,
+270, 722, 243, 91,
+271, 675, 242, 97,
+273, 634, 240, 103,
+274, 598, 239, 110,
+275, 566, 238, 116,
+277, 537, 237, 122,
+278, 510, 235, 128,
+280, 487, 234, 135,
+281, 465, 233, 141,
+283, 445, 232, 147,
+284, 427, 230, 154,
+286, 410, 229, 160,
+287, 395, 228, 166,
+289, 380, 227, 172,
+291, 367, 225, 179,
+292, 354, 224, 185,
+294, 343, 223, 191,
+296, 332, 222, 197,
+297, 322, 220, 204,
+299, 312, 219, 210,
+301, 303, 218, 216,
+302, 294, 217, 223,
+304, 286, 215, 229,
+306, 279, 214, 235,
+308, 271, 213, 241,
+309, 265, 212, 248,
+311, 258, 211, 254,
+313, 252, 209, 260,
+315, 246, 208, 267,
+317, 240, 207, 273,
+319, 235, 206, 279,
+321, 230, 204, 285,
+323, 225, 203, 292,
+325, 220, 202, 298,
+226, 308, 290, 65323,
+226, 318, 289, 65330,
+227, 328, 288, 65336,
+228, 339, 288, 65342,
+229, 350, 287, 65349,
+229, 362, 286, 65355,
+230, 376, 285, 65361,
+231, 390, 284, 65368,
+232, 405, 283, 65374,
+233, 421, 282, 65380,
+233, 439, 281, 65387,
+234, 459, 280, 65393,
+235, 480, 279, 65399,
+236, 503, 278, 65406,
+236, 529, 277, 65412,
+237, 558, 276, 65418,
+238, 589, 275, 65425,
+239, 625, 274, 65431,
+240, 665, 273, 65437,
+241, 711, 272, 65444,
+241, 763, 272, 65450,
+242, 824, 271, 65456,
+243, 895, 270, 65463,
+244, 980, 269, 65469,
+245, 1082, 268, 65475,
+246, 1208, 267, 65482,
+246, 1368, 266, 65488,
+247, 1576, 265, 65494,
+248, 1860, 264, 65501,
+249, 2267, 263, 65507,
+250, 2903, 262, 65513,
+251, 4033, 261, 65520,
+252, 6608, 260, 65526,
+253, 18272, 259, 65532,
+254, 23883, 258, 3,
+255, 7222, 257, 9,
+255, 4254, 257, 15,
+256, 3015, 256, 22,
+257, 2335, 255, 28,
+258, 1905, 254, 34,
+259, 1609, 253, 41,
+260, 1393, 252, 47,
+261, 1227, 251, 53,
+262, 1097, 250, 60,
+263, 992, 249, 66,
+264, 905, 248, 72,
+265, 833, 247, 79,
+266, 771, 246, 85,
+267, 717, 245, 91,
+268, 671, 244, 98,
+269, 630, 243, 104,
+270, 594, 242, 110,
+271, 562, 241, 117,
+272, 533, 241, 123,
+274, 507, 240, 129,
+275, 483, 239, 136,
+276, 461, 238, 142,
+277, 442, 237, 148,
+278, 424, 236, 155,
+279, 407, 235, 161,
+280, 392, 234, 167,
+281, 377, 233, 174,
+282, 364, 232, 180,
+284, 352, 231, 186,
+285, 340, 230, 193,
+286, 329, 229, 199,
+287, 319, 228, 205,
+288, 310, 227, 212,
+289, 301, 226, 218,
+291, 292, 226, 224,
+292, 284, 225, 231,
+293, 277, 224, 237,
+294, 269, 223, 243,
+296, 263, 222, 250,
+297, 256, 221, 256,
+298, 250, 220, 262,
+299, 244, 219, 269,
+301, 238, 218, 275,
+302, 233, 217, 281,
+303, 228, 216, 288,
+234, 289, 280, 65310,
+235, 298, 279, 65316,
+235, 307, 278, 65322,
+236, 316, 278, 65329,
+237, 326, 277, 65335,
+237, 337, 276, 65341,
+238, 348, 276, 65348,
+238, 360, 275, 65354,
+239, 373, 275, 65360,
+239, 387, 274, 65367,
+240, 403, 273, 65373,
+240, 419, 273, 65380,
+241, 437, 272, 65386,
+241, 456, 271, 65392,
+242, 477, 271, 65399,
+243, 500, 270, 65405,
+243, 526, 270, 65411,
+244, 554, 269, 65418,
+244, 586, 268, 65424,
+245, 621, 268, 65431,
+245, 661, 267, 65437,
+246, 707, 266, 65443,
+247, 759, 266, 65450,
+247, 819, 265, 65456,
+248, 890, 264, 65462,
+248, 974, 264, 65469,
+249, 1076, 263, 65475,
+250, 1202, 263, 65481,
+250, 1361, 262, 65488,
+251, 1568, 261, 65494,
+251, 1851, 261, 65501,
+252, 2256, 260, 65507,
+253, 2890, 259, 65513,
+253, 4019, 259, 65520,
+254, 6594, 258, 65526,
+254, 18363, 258, 65532,
+255, 23404, 257, 3,
+256, 7147, 256, 9,
+256, 4218, 256, 16,
+257, 2991, 255, 22,
+258, 2318, 254, 28,
+258, 1892, 254, 35,
+259, 1598, 253, 41,
+259, 1383, 253, 47,
+260, 1219, 252, 54,
+261, 1090, 251, 60,
+261, 986, 251, 66,
+262, 899, 250, 73,
+263, 827, 249, 79,
+263, 766, 249, 86,
+264, 713, 248, 92,
+265, 666, 248, 98,
+265, 626, 247, 105,
+266, 590, 246, 111,
+267, 558, 246, 117,
+267, 529, 245, 124,
+268, 503, 244, 130,
+269, 480, 244, 137,
+270, 459, 243, 143,
+270, 439, 243, 149,
+271, 421, 242, 156,
+272, 404, 241, 162,
+272, 389, 241, 168,
+273, 375, 240, 175,
+274, 362, 239, 181,
+274, 350, 239, 188,
+275, 338, 238, 194,
+276, 327, 238, 200,
+277, 317, 237, 207,
+277, 308, 236, 213,
+278, 299, 236, 219,
+279, 290, 235, 226,
+280, 282, 234, 232,
+280, 275, 234, 238,
+281, 268, 233, 245,
+282, 261, 232, 251,
+283, 254, 232, 258,
+283, 248, 231, 264,
+284, 242, 231, 270,
+285, 237, 230, 277,
+244, 273, 268, 65296,
+245, 281, 268, 65302,
+245, 289, 267, 65309,
+245, 297, 267, 65315,
+246, 306, 267, 65322,
+246, 315, 267, 65328,
+246, 325, 266, 65334,
+246, 336, 266, 65341,
+247, 347, 266, 65347,
+247, 359, 265, 65354,
+247, 372, 265, 65360,
+248, 386, 265, 65366,
+248, 402, 264, 65373,
+248, 418, 264, 65379,
+249, 436, 264, 65386,
+249, 455, 263, 65392,
+249, 476, 263, 65398,
+249, 499, 263, 65405,
+250, 525, 262, 65411,
+250, 553, 262, 65418,
+250, 585, 262, 65424,
+251, 620, 262, 65430,
+251, 660, 261, 65437,
+251, 705, 261, 65443,
+252, 757, 261, 65449,
+252, 818, 260, 65456,
+252, 889, 260, 65462,
+252, 973, 260, 65469,
+253, 1075, 259, 65475,
+253, 1201, 259, 65481,
+253, 1361, 259, 65488,
+254, 1569, 258, 65494,
+254, 1852, 258, 65501,
+254, 2261, 258, 65507,
+255, 2900, 257, 65513,
+255, 4044, 257, 65520,
+255, 6679, 257, 65526,
+256, 19166, 256, 65533,
+256, 22045, 256, 3,
+256, 6998, 256, 9,
+256, 4159, 256, 16,
+257, 2959, 255, 22,
+257, 2296, 255, 29,
+257, 1876, 255, 35,
+258, 1586, 254, 41,
+258, 1373, 254, 48,
+258, 1211, 254, 54,
+259, 1083, 253, 61,
+259, 980, 253, 67,
+259, 894, 253, 73,
+260, 822, 252, 80,
+260, 761, 252, 86,
+260, 709, 252, 92,
+261, 663, 251, 99,
+261, 623, 251, 105,
+261, 587, 251, 112,
+262, 555, 251, 118,
+262, 527, 250, 124,
+262, 501, 250, 131,
+263, 478, 250, 137,
+263, 456, 249, 144,
+263, 437, 249, 150,
+264, 419, 249, 156,
+264, 403, 248, 163,
+264, 387, 248, 169,
+265, 373, 248, 176,
+265, 360, 247, 182,
+265, 348, 247, 188,
+266, 337, 247, 195,
+266, 326, 246, 201,
+266, 316, 246, 208,
+267, 306, 246, 214,
+267, 297, 245, 220,
+267, 289, 245, 227,
+268, 281, 245, 233,
+268, 274, 245, 239,
+268, 267, 244, 246,
+269, 260, 244, 252,
+269, 253, 244, 259,
+269, 247, 243, 265,
+};
+
+#endif // _TAB_DELTAS_FOLDED_H_
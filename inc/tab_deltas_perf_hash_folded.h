@@ -0,0 +1,2580 @@
+#ifndef _TAB_DELTAS_PERF_HASH_FOLDED_H_
+#define _TAB_DELTAS_PERF_HASH_FOLDED_H_
+
+#include <types.h>
+#include "consts.h"
+
+#define DELTA_PTR_OFFSET_AMNT 6
+
+#define ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES 2
+
+// Table body generated with script tab_deltas_perf_hash_generator.js using argument folded. Check correct values of constants before script execution.
+// First 2 columns are sideDistX and sideDistY: from 182 up to 65535, but only 915 different values.
+// Middle 2 columns are ray direction angle (signed): from 0 up to 65535, which actually are 717 signed different 
+// values: [-360, 360] (except few values due to precision lack).
+// Last 2 columns are sideDistX_perf_hash and sideDistY_perf_hash: index into the table for pre calculated op1*op2 >> FS.
+// Only the first quadrant of angles [0, AP/4). The other quadrants are resolved once per frame in dda(): see RENDER_USE_TAB_DELTAS_FOLDED.
+const u16 tab_deltas[(AP/4)*PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT] = {
+259, 256, 253, 256, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 256, 246, 256, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 256, 240, 256, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 256, 234, 256, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 256, 227, 256, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 256, 221, 256, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 256, 214, 256, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 256, 208, 256, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 256, 202, 256, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+336, 256, 195, 256, 154*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+347, 256, 189, 256, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+359, 256, 182, 256, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+372, 256, 176, 256, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+386, 256, 170, 256, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+402, 256, 163, 256, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+418, 256, 157, 256, 236*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+436, 256, 150, 256, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+455, 256, 144, 256, 267*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+476, 256, 138, 256, 285*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+500, 256, 131, 256, 304*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+525, 256, 125, 256, 321*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+554, 256, 118, 256, 343*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+585, 256, 112, 256, 365*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+621, 256, 106, 256, 391*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+661, 256, 99, 256, 419*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+706, 256, 93, 256, 444*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+759, 256, 86, 256, 471*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+819, 256, 80, 256, 499*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+890, 256, 74, 256, 529*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+975, 256, 67, 256, 561*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1078, 256, 61, 256, 591*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1205, 256, 54, 256, 624*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1365, 256, 48, 256, 653*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1575, 256, 42, 256, 685*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1862, 256, 35, 256, 722*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2276, 256, 29, 256, 758*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2926, 256, 22, 256, 791*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4096, 256, 16, 256, 827*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6827, 256, 10, 256, 862*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+20480, 256, 3, 256, 899*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+20480, 256, 65533, 256, 899*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6827, 256, 65526, 256, 862*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4096, 256, 65520, 256, 827*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2926, 256, 65514, 256, 791*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2276, 256, 65507, 256, 758*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1862, 256, 65501, 256, 722*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1575, 256, 65494, 256, 685*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1365, 256, 65488, 256, 653*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1205, 256, 65482, 256, 624*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1078, 256, 65475, 256, 591*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+975, 256, 65469, 256, 561*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+890, 256, 65462, 256, 529*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+819, 256, 65456, 256, 499*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+759, 256, 65450, 256, 471*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+706, 256, 65443, 256, 444*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+661, 256, 65437, 256, 419*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+621, 256, 65430, 256, 391*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+585, 256, 65424, 256, 365*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+554, 256, 65418, 256, 343*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+525, 256, 65411, 256, 321*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+500, 256, 65405, 256, 304*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+476, 256, 65398, 256, 285*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+455, 256, 65392, 256, 267*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+436, 256, 65386, 256, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+418, 256, 65379, 256, 236*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+402, 256, 65373, 256, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+386, 256, 65366, 256, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+372, 256, 65360, 256, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+359, 256, 65354, 256, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+347, 256, 65347, 256, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+336, 256, 65341, 256, 154*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 256, 65334, 256, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 256, 65328, 256, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 256, 65322, 256, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 256, 65315, 256, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 256, 65309, 256, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 256, 65302, 256, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 256, 65296, 256, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 256, 65290, 256, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 256, 65283, 256, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 269, 265, 243, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 269, 259, 244, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 269, 252, 244, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 268, 246, 244, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 268, 239, 245, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 268, 233, 245, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 267, 227, 245, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 267, 220, 245, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 267, 214, 246, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 266, 208, 246, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+326, 266, 201, 246, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+337, 266, 195, 247, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 265, 188, 247, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+360, 265, 182, 247, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+373, 265, 176, 248, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+387, 264, 169, 248, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+403, 264, 163, 248, 221*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+419, 264, 156, 249, 237*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+437, 263, 150, 249, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+456, 263, 144, 249, 268*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+478, 263, 137, 250, 287*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+501, 262, 131, 250, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+527, 262, 124, 250, 323*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+555, 262, 118, 251, 344*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+587, 261, 112, 251, 367*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+623, 261, 105, 251, 392*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+663, 261, 99, 251, 420*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+709, 260, 92, 252, 446*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+761, 260, 86, 252, 473*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+822, 260, 80, 252, 500*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+894, 259, 73, 253, 531*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+980, 259, 67, 253, 564*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1083, 259, 61, 253, 593*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1211, 258, 54, 254, 627*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1373, 258, 48, 254, 655*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1586, 258, 41, 254, 690*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1876, 257, 35, 255, 726*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2296, 257, 29, 255, 759*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2959, 257, 22, 255, 794*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4159, 256, 16, 256, 830*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6998, 256, 9, 256, 865*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+22045, 256, 3, 256, 901*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+19166, 256, 65533, 256, 894*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6679, 255, 65526, 257, 860*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4044, 255, 65520, 257, 825*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2900, 255, 65513, 257, 787*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2261, 254, 65507, 258, 755*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1852, 254, 65501, 258, 720*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1569, 254, 65494, 258, 684*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1361, 253, 65488, 259, 652*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1201, 253, 65481, 259, 620*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1075, 253, 65475, 259, 589*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+973, 252, 65469, 260, 559*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+889, 252, 65462, 260, 528*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+818, 252, 65456, 260, 498*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+757, 252, 65449, 261, 470*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+705, 251, 65443, 261, 443*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+660, 251, 65437, 261, 418*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+620, 251, 65430, 262, 390*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+585, 250, 65424, 262, 365*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+553, 250, 65418, 262, 342*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+525, 250, 65411, 262, 321*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+499, 249, 65405, 263, 303*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+476, 249, 65398, 263, 285*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+455, 249, 65392, 263, 267*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+436, 249, 65386, 264, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+418, 248, 65379, 264, 236*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+402, 248, 65373, 264, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+386, 248, 65366, 265, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+372, 247, 65360, 265, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+359, 247, 65354, 265, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+347, 247, 65347, 266, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+336, 246, 65341, 266, 154*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 246, 65334, 266, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 246, 65328, 267, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 246, 65322, 267, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 245, 65315, 267, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 245, 65309, 267, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 245, 65302, 268, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 244, 65296, 268, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 285, 277, 230, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+242, 284, 270, 231, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 283, 264, 231, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 283, 258, 232, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 282, 251, 232, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 281, 245, 233, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 280, 238, 234, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 280, 232, 234, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+290, 279, 226, 235, 108*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 278, 219, 236, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+308, 277, 213, 236, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+317, 277, 207, 237, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+327, 276, 200, 238, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+338, 275, 194, 238, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+350, 274, 188, 239, 168*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+362, 274, 181, 239, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+375, 273, 175, 240, 193*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+389, 272, 168, 241, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+404, 272, 162, 241, 222*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+421, 271, 156, 242, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+439, 270, 149, 243, 255*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+459, 270, 143, 243, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+480, 269, 137, 244, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+503, 268, 130, 244, 307*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+529, 267, 124, 245, 325*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+558, 267, 117, 246, 346*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+590, 266, 111, 246, 370*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+626, 265, 105, 247, 394*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+666, 265, 98, 248, 422*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+713, 264, 92, 248, 448*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+766, 263, 86, 249, 476*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+827, 263, 79, 249, 503*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+899, 262, 73, 250, 533*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+986, 261, 66, 251, 565*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1090, 261, 60, 251, 596*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1219, 260, 54, 252, 628*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1383, 259, 47, 253, 658*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1598, 259, 41, 253, 695*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1892, 258, 35, 254, 728*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2318, 258, 28, 254, 763*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2991, 257, 22, 255, 795*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4218, 256, 16, 256, 832*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7147, 256, 9, 256, 867*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+23404, 255, 3, 257, 904*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+18363, 254, 65532, 258, 893*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6594, 254, 65526, 258, 858*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4019, 253, 65520, 259, 821*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2890, 253, 65513, 259, 786*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2256, 252, 65507, 260, 753*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1851, 251, 65501, 261, 719*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1568, 251, 65494, 261, 683*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1361, 250, 65488, 262, 652*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1202, 250, 65481, 263, 621*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1076, 249, 65475, 263, 590*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+974, 248, 65469, 264, 560*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+890, 248, 65462, 264, 529*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+819, 247, 65456, 265, 499*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+759, 247, 65450, 266, 471*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+707, 246, 65443, 266, 445*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+661, 245, 65437, 267, 419*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+621, 245, 65431, 268, 391*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+586, 244, 65424, 268, 366*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+554, 244, 65418, 269, 343*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+526, 243, 65411, 270, 322*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+500, 243, 65405, 270, 304*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+477, 242, 65399, 271, 286*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+456, 241, 65392, 271, 268*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+437, 241, 65386, 272, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+419, 240, 65380, 273, 237*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+403, 240, 65373, 273, 221*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+387, 239, 65367, 274, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+373, 239, 65360, 275, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+360, 238, 65354, 275, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 238, 65348, 276, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+337, 237, 65341, 276, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+326, 237, 65335, 277, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 236, 65329, 278, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+307, 235, 65322, 278, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+298, 235, 65316, 279, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 234, 65310, 280, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 303, 288, 216, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 302, 281, 217, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 301, 275, 218, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 299, 269, 219, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 298, 262, 220, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 297, 256, 221, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 296, 250, 222, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 294, 243, 223, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 293, 237, 224, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 111*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 292, 231, 225, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 291, 224, 226, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+301, 289, 218, 226, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+310, 288, 212, 227, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+319, 287, 205, 228, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+329, 286, 199, 229, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+340, 285, 193, 230, 158*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+352, 284, 186, 231, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+364, 282, 180, 232, 182*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+377, 281, 174, 233, 195*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+392, 280, 167, 234, 210*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+407, 279, 161, 235, 225*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+424, 278, 155, 236, 242*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+442, 277, 148, 237, 257*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+461, 276, 142, 238, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+483, 275, 136, 239, 292*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+507, 274, 129, 240, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+533, 272, 123, 241, 328*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+562, 271, 117, 241, 347*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+594, 270, 110, 242, 373*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+630, 269, 104, 243, 397*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+671, 268, 98, 244, 423*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+717, 267, 91, 245, 451*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+771, 266, 85, 246, 480*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+833, 265, 79, 247, 506*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+905, 264, 72, 248, 537*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+992, 263, 66, 249, 567*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1097, 262, 60, 250, 598*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1227, 261, 53, 251, 630*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1393, 260, 47, 252, 662*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1609, 259, 41, 253, 697*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1905, 258, 34, 254, 731*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2335, 257, 28, 255, 764*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3015, 256, 22, 256, 798*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4254, 255, 15, 257, 834*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7222, 255, 9, 257, 870*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+23883, 254, 3, 258, 905*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+18272, 253, 65532, 259, 891*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6608, 252, 65526, 260, 859*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4033, 251, 65520, 261, 824*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2903, 250, 65513, 262, 788*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2267, 249, 65507, 263, 756*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1860, 248, 65501, 264, 721*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1576, 247, 65494, 265, 686*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1368, 246, 65488, 266, 654*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1208, 246, 65482, 267, 626*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1082, 245, 65475, 268, 592*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+980, 244, 65469, 269, 564*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+895, 243, 65463, 270, 532*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+824, 242, 65456, 271, 501*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+763, 241, 65450, 272, 474*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+711, 241, 65444, 272, 447*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+665, 240, 65437, 273, 421*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+625, 239, 65431, 274, 393*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+589, 238, 65425, 275, 369*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+558, 237, 65418, 276, 346*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+529, 236, 65412, 277, 325*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+503, 236, 65406, 278, 307*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+480, 235, 65399, 279, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+459, 234, 65393, 280, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+439, 233, 65387, 281, 255*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+421, 233, 65380, 282, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+405, 232, 65374, 283, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+390, 231, 65368, 284, 208*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+376, 230, 65361, 285, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+362, 229, 65355, 286, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+350, 229, 65349, 287, 168*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+339, 228, 65342, 288, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+328, 227, 65336, 288, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+318, 226, 65330, 289, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+308, 226, 65323, 290, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 325, 298, 202, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 323, 292, 203, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 321, 285, 204, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 319, 279, 206, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 317, 273, 207, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 315, 267, 208, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 313, 260, 209, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 131*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 311, 254, 211, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 309, 248, 212, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 308, 241, 213, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+279, 306, 235, 214, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 304, 229, 215, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 122*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+294, 302, 223, 217, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 301, 216, 218, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+312, 299, 210, 219, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+322, 297, 204, 220, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+332, 296, 197, 222, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+343, 294, 191, 223, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+354, 292, 185, 224, 172*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+367, 291, 179, 225, 185*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+380, 289, 172, 227, 198*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+395, 287, 166, 228, 213*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+410, 286, 160, 229, 228*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+427, 284, 154, 230, 244*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+445, 283, 147, 232, 259*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+465, 281, 141, 233, 276*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+487, 280, 135, 234, 296*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+510, 278, 128, 235, 312*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+537, 277, 122, 237, 332*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+566, 275, 116, 238, 350*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+598, 274, 110, 239, 375*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+634, 273, 103, 240, 401*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+675, 271, 97, 242, 426*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+722, 270, 91, 243, 454*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+776, 268, 84, 244, 481*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+838, 267, 78, 245, 509*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+911, 266, 72, 247, 538*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+998, 264, 66, 248, 569*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1104, 263, 59, 249, 600*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1235, 262, 53, 250, 632*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1400, 260, 47, 252, 664*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1617, 259, 41, 253, 699*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1913, 258, 34, 254, 732*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2343, 257, 28, 255, 766*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3021, 255, 22, 257, 799*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4250, 254, 15, 258, 833*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7168, 253, 9, 259, 869*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+22871, 252, 3, 260, 903*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+19210, 250, 65533, 262, 895*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6764, 249, 65526, 263, 861*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4105, 248, 65520, 264, 828*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2946, 247, 65514, 265, 793*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2298, 246, 65507, 267, 760*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1883, 245, 65501, 268, 727*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1596, 243, 65495, 269, 693*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1384, 242, 65489, 270, 659*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1222, 241, 65482, 272, 629*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1094, 240, 65476, 273, 597*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+990, 239, 65470, 274, 566*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+904, 238, 65464, 275, 536*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+832, 237, 65457, 277, 505*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+771, 236, 65451, 278, 480*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+718, 235, 65445, 279, 452*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+672, 234, 65438, 280, 424*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+631, 233, 65432, 282, 398*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+595, 232, 65426, 283, 374*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+563, 231, 65420, 284, 348*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+534, 230, 65413, 285, 329*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+508, 229, 65407, 287, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+485, 228, 65401, 288, 294*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+463, 227, 65394, 289, 274*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+443, 226, 65388, 290, 258*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+425, 225, 65382, 292, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+409, 224, 65376, 293, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+393, 223, 65369, 294, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+379, 222, 65363, 295, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+366, 221, 65357, 297, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+353, 220, 65351, 298, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+342, 219, 65344, 299, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+331, 218, 65338, 300, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 351, 307, 187, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 169*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 348, 301, 188, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+222, 345, 295, 190, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 163*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 342, 289, 192, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 339, 283, 193, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 337, 276, 195, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 334, 270, 196, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 331, 264, 198, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 329, 258, 199, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 326, 252, 201, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 324, 245, 202, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 142*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 321, 239, 204, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 319, 233, 206, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 316, 227, 207, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 314, 221, 209, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 312, 214, 210, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 309, 208, 212, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 307, 202, 213, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+335, 305, 196, 215, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+346, 303, 189, 216, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+358, 301, 183, 218, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+370, 298, 177, 220, 188*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+384, 296, 171, 221, 202*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+398, 294, 165, 223, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+414, 292, 158, 224, 232*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+431, 290, 152, 226, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 108*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+449, 288, 146, 227, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+469, 286, 140, 229, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+491, 284, 134, 230, 299*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+514, 282, 127, 232, 314*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+541, 281, 121, 234, 334*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+570, 279, 115, 235, 353*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+603, 277, 109, 237, 378*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+639, 275, 103, 238, 404*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+680, 273, 96, 240, 429*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+727, 272, 90, 241, 458*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+781, 270, 84, 243, 485*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+843, 268, 78, 244, 512*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+916, 266, 72, 246, 540*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1004, 265, 65, 248, 572*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1109, 263, 59, 249, 602*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1239, 261, 53, 251, 633*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1404, 260, 47, 252, 666*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1619, 258, 40, 254, 700*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1913, 257, 34, 255, 732*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2336, 255, 28, 257, 765*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2999, 254, 22, 258, 797*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4190, 252, 16, 260, 831*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6947, 251, 9, 262, 863*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+20321, 249, 3, 263, 898*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+21969, 248, 65533, 265, 900*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7130, 246, 65527, 266, 866*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4256, 245, 65521, 268, 835*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3033, 243, 65514, 269, 800*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2356, 242, 65508, 271, 767*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1926, 241, 65502, 272, 733*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1629, 239, 65496, 274, 702*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1411, 238, 65490, 276, 668*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1245, 237, 65483, 277, 635*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1113, 235, 65477, 279, 604*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1007, 234, 65471, 280, 575*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+920, 233, 65465, 282, 543*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+846, 231, 65459, 283, 514*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+783, 230, 65452, 285, 486*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+729, 229, 65446, 286, 459*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+682, 228, 65440, 288, 431*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+641, 226, 65434, 290, 406*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+604, 225, 65427, 291, 379*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+571, 224, 65421, 293, 354*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+542, 223, 65415, 294, 335*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+515, 222, 65409, 296, 315*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+491, 220, 65403, 297, 299*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+470, 219, 65396, 299, 280*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+450, 218, 65390, 300, 263*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+431, 217, 65384, 302, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+414, 216, 65378, 304, 232*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+399, 215, 65372, 305, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+384, 214, 65365, 307, 202*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+371, 213, 65359, 308, 189*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+358, 212, 65353, 310, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+207, 382, 316, 172, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 378, 310, 173, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 196*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 374, 304, 175, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 370, 298, 177, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 188*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 366, 292, 179, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 362, 286, 181, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 359, 279, 183, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 355, 273, 185, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 173*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 351, 267, 186, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 169*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 348, 261, 188, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 345, 255, 190, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 163*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 341, 249, 192, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 159*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 338, 243, 194, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 335, 237, 196, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 332, 230, 198, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 329, 224, 199, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+300, 326, 218, 201, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+309, 323, 212, 203, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+318, 320, 206, 205, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+328, 317, 200, 207, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+338, 314, 194, 209, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+349, 311, 188, 211, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+361, 308, 181, 212, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+374, 306, 175, 214, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+387, 303, 169, 216, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+402, 301, 163, 218, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+417, 298, 157, 220, 235*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+434, 296, 151, 222, 250*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+453, 293, 145, 224, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 111*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+473, 291, 139, 225, 283*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+495, 288, 132, 227, 301*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+519, 286, 126, 229, 317*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+545, 284, 120, 231, 336*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+574, 281, 114, 233, 357*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+607, 279, 108, 235, 381*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+643, 277, 102, 237, 407*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+684, 275, 96, 238, 433*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+731, 273, 90, 240, 460*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+785, 271, 83, 242, 487*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+847, 269, 77, 244, 515*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+920, 267, 71, 246, 543*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1006, 265, 65, 248, 574*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1111, 263, 59, 250, 603*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1239, 261, 53, 251, 633*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1402, 259, 47, 253, 665*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1613, 257, 41, 255, 698*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1899, 255, 35, 257, 730*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2309, 253, 28, 259, 762*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2945, 251, 22, 261, 792*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4063, 250, 16, 263, 826*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6549, 248, 10, 264, 857*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+16882, 246, 4, 266, 890*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+29226, 244, 65534, 268, 909*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7833, 243, 65528, 270, 872*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4522, 241, 65522, 272, 840*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3179, 239, 65515, 274, 804*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2451, 238, 65509, 276, 770*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1994, 236, 65503, 277, 738*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1681, 235, 65497, 279, 704*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1453, 233, 65491, 281, 675*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1279, 232, 65485, 283, 641*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1142, 230, 65479, 285, 610*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1032, 229, 65473, 287, 577*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+941, 227, 65466, 289, 552*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+865, 226, 65460, 290, 521*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+801, 224, 65454, 292, 494*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+745, 223, 65448, 294, 468*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+696, 221, 65442, 296, 438*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+654, 220, 65436, 298, 415*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+616, 219, 65430, 300, 387*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+583, 217, 65424, 302, 363*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+553, 216, 65417, 303, 342*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+525, 215, 65411, 305, 321*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+501, 213, 65405, 307, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+478, 212, 65399, 309, 287*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+458, 211, 65393, 311, 270*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+439, 210, 65387, 313, 255*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+422, 208, 65381, 315, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+406, 207, 65375, 317, 224*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+391, 206, 65368, 318, 209*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+202, 420, 324, 156, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 238*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 415, 318, 158, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+210, 409, 312, 160, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 404, 306, 162, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 222*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 398, 300, 164, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 393, 294, 167, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 388, 288, 169, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 206*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 383, 282, 171, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 201*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 379, 276, 173, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 374, 270, 175, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 369, 264, 177, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 187*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 365, 258, 180, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 361, 252, 182, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 356, 246, 184, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 174*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 352, 240, 186, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 348, 234, 188, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 344, 228, 190, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 162*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+295, 340, 222, 193, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 158*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+304, 337, 216, 195, 122*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+312, 333, 210, 197, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+322, 329, 204, 199, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+331, 326, 198, 201, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+342, 322, 192, 203, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+353, 319, 186, 205, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+365, 316, 180, 208, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+377, 312, 174, 210, 195*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+391, 309, 168, 212, 209*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+406, 306, 162, 214, 224*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+421, 303, 156, 216, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+438, 300, 150, 218, 254*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+457, 297, 143, 221, 269*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+477, 294, 137, 223, 286*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+499, 291, 131, 225, 303*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+523, 289, 125, 227, 320*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+549, 286, 119, 229, 339*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+578, 283, 113, 231, 359*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+611, 281, 107, 233, 384*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+647, 278, 101, 236, 411*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+688, 276, 95, 238, 435*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+734, 273, 89, 240, 461*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+787, 271, 83, 242, 489*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+849, 268, 77, 244, 517*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+921, 266, 71, 246, 544*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1006, 264, 65, 249, 574*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1108, 261, 59, 251, 601*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1234, 259, 53, 253, 631*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1392, 257, 47, 255, 661*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1597, 255, 41, 257, 694*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1871, 253, 35, 259, 725*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2260, 251, 29, 262, 754*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2853, 249, 23, 264, 785*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3867, 247, 17, 266, 819*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6001, 245, 11, 268, 854*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+13390, 243, 5, 270, 887*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+57920, 241, 65535, 272, 913*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+9156, 239, 65529, 274, 877*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4971, 237, 65523, 277, 845*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3412, 235, 65517, 279, 811*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2597, 233, 65511, 281, 776*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2096, 232, 65505, 283, 745*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1758, 230, 65499, 285, 709*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1513, 228, 65493, 287, 679*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1328, 226, 65487, 290, 649*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1184, 225, 65481, 292, 618*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1068, 223, 65475, 294, 586*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+972, 221, 65469, 296, 558*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+892, 220, 65463, 298, 530*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+825, 218, 65457, 300, 502*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+767, 217, 65451, 302, 477*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+716, 215, 65444, 305, 450*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+672, 214, 65438, 307, 424*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+633, 212, 65432, 309, 400*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+598, 211, 65426, 311, 375*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+567, 209, 65420, 313, 351*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+539, 208, 65414, 315, 333*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+513, 206, 65408, 318, 313*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+490, 205, 65402, 320, 298*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+469, 204, 65396, 322, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+450, 202, 65390, 324, 263*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+432, 201, 65384, 326, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+198, 469, 332, 140, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 461, 326, 142, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+205, 453, 320, 145, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 445, 314, 147, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 259*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 438, 308, 150, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 254*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 431, 302, 152, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 424, 296, 154, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 242*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 418, 290, 157, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 236*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 411, 284, 159, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 229*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 405, 278, 162, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 399, 272, 164, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 393, 266, 167, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 387, 261, 169, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 382, 255, 172, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 377, 249, 174, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 195*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 371, 243, 177, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 189*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 366, 237, 179, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 361, 231, 181, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 356, 225, 184, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 174*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 352, 219, 186, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+307, 347, 213, 189, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 343, 207, 191, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 338, 201, 194, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+335, 334, 196, 196, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+346, 330, 190, 199, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 148*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+357, 326, 184, 201, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+369, 322, 178, 203, 187*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+381, 318, 172, 206, 199*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+395, 315, 166, 208, 213*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+409, 311, 160, 211, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+425, 307, 154, 213, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+442, 304, 148, 216, 257*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 122*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+461, 300, 142, 218, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+480, 297, 136, 221, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+502, 294, 130, 223, 306*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+526, 291, 125, 225, 322*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+552, 288, 119, 228, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+581, 284, 113, 230, 361*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+613, 281, 107, 233, 385*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+649, 279, 101, 235, 412*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+690, 276, 95, 238, 436*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+736, 273, 89, 240, 463*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+788, 270, 83, 243, 490*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+848, 267, 77, 245, 516*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+918, 265, 71, 248, 542*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1001, 262, 65, 250, 571*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1101, 260, 60, 252, 599*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1222, 257, 54, 255, 629*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1374, 255, 48, 257, 656*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1568, 252, 42, 260, 683*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1826, 250, 36, 262, 716*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2187, 248, 30, 265, 750*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2724, 245, 24, 267, 782*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3612, 243, 18, 270, 814*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5358, 241, 12, 272, 847*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+10373, 239, 6, 274, 882*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+65535, 237, 0, 277, 914*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+11899, 235, 65530, 279, 885*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5739, 233, 65525, 282, 851*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3781, 231, 65519, 284, 817*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2819, 229, 65513, 287, 783*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2248, 227, 65507, 289, 752*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1869, 225, 65501, 292, 724*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1599, 223, 65495, 294, 696*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1397, 221, 65489, 297, 663*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1241, 219, 65483, 299, 634*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1116, 217, 65477, 301, 606*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1014, 216, 65471, 304, 576*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+929, 214, 65465, 306, 546*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+857, 212, 65460, 309, 518*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+796, 211, 65454, 311, 492*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+742, 209, 65448, 314, 466*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+696, 207, 65442, 316, 438*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+655, 206, 65436, 319, 416*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+618, 204, 65430, 321, 388*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+585, 203, 65424, 323, 365*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+556, 201, 65418, 326, 345*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+530, 200, 65412, 328, 326*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+505, 198, 65406, 331, 308*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+483, 197, 65400, 333, 292*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 531, 338, 123, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 327*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 520, 332, 126, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 318*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 509, 326, 129, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 311*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 498, 321, 132, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 302*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 488, 315, 134, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 297*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 478, 309, 137, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 287*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 469, 303, 140, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 460, 297, 142, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 272*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 451, 292, 145, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 264*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 443, 286, 148, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 258*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 435, 280, 151, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 427, 274, 153, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 244*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 420, 269, 156, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 238*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 412, 263, 159, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 230*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 405, 257, 162, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 399, 251, 164, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 392, 245, 167, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 210*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 386, 240, 170, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 380, 234, 173, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 198*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+287, 374, 228, 175, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+295, 368, 222, 178, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 186*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 362, 216, 181, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+311, 357, 211, 184, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+320, 352, 205, 186, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+329, 347, 199, 189, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+339, 342, 193, 192, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+349, 337, 188, 194, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+361, 332, 182, 197, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+372, 328, 176, 200, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+385, 323, 170, 203, 203*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+399, 319, 164, 205, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+413, 315, 159, 208, 231*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+429, 311, 153, 211, 246*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+446, 307, 147, 214, 260*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+464, 303, 141, 216, 275*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+484, 299, 135, 219, 293*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+505, 295, 130, 222, 308*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+529, 292, 124, 225, 325*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+555, 288, 118, 227, 344*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+583, 285, 112, 230, 363*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+615, 282, 107, 233, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+650, 278, 101, 236, 413*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+690, 275, 95, 238, 436*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+735, 272, 89, 241, 462*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+786, 269, 83, 244, 488*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+844, 266, 78, 246, 513*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+912, 263, 72, 249, 539*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+992, 260, 66, 252, 567*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1087, 257, 60, 255, 595*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1203, 255, 54, 257, 622*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1346, 252, 49, 260, 651*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1527, 249, 43, 263, 681*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1765, 247, 37, 266, 710*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2091, 244, 31, 268, 743*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2564, 242, 26, 271, 774*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3314, 239, 20, 274, 808*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4684, 237, 14, 277, 841*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7985, 235, 8, 279, 875*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+27061, 232, 2, 282, 907*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+19483, 230, 65533, 285, 896*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7163, 228, 65527, 288, 868*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4388, 226, 65521, 290, 837*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3163, 224, 65515, 293, 803*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2473, 222, 65509, 296, 772*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2030, 220, 65504, 298, 740*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1721, 218, 65498, 301, 707*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1494, 216, 65492, 304, 677*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1320, 214, 65486, 307, 648*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1182, 212, 65481, 309, 617*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1071, 210, 65475, 312, 587*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+978, 208, 65469, 315, 563*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+900, 206, 65463, 318, 534*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+834, 205, 65457, 320, 507*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+777, 203, 65452, 323, 482*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+727, 201, 65446, 326, 458*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+683, 199, 65440, 329, 432*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+644, 198, 65434, 331, 408*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+610, 196, 65428, 334, 383*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+578, 195, 65423, 337, 359*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+550, 193, 65417, 340, 340*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+191, 615, 344, 107, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 598, 338, 110, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 375*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 582, 332, 113, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 362*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 567, 327, 116, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 351*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 552, 321, 119, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 539, 315, 122, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 333*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 526, 310, 125, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 322*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 513, 304, 128, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 313*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 501, 298, 131, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+224, 490, 293, 134, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 298*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 479, 287, 137, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 288*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 469, 282, 140, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 459, 276, 143, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 449, 270, 146, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 440, 265, 149, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 256*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 432, 259, 152, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 423, 253, 155, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 241*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 415, 248, 158, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 407, 242, 161, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 225*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 400, 236, 164, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 218*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 393, 231, 167, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 386, 225, 170, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 379, 219, 173, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+307, 372, 214, 176, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 366, 208, 179, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+324, 360, 203, 182, 142*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+333, 354, 197, 185, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 172*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+343, 348, 191, 188, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+353, 343, 186, 191, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+364, 338, 180, 194, 182*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+376, 332, 174, 197, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+389, 327, 169, 200, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+402, 323, 163, 203, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+416, 318, 157, 206, 234*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+432, 313, 152, 209, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 131*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+449, 309, 146, 212, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+467, 305, 140, 215, 277*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+486, 300, 135, 218, 295*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+507, 296, 129, 221, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+531, 292, 123, 224, 327*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+556, 288, 118, 227, 345*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+584, 285, 112, 230, 364*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+615, 281, 107, 233, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+649, 277, 101, 236, 412*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+688, 274, 95, 239, 435*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+731, 270, 90, 242, 460*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+780, 267, 84, 245, 484*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+837, 264, 78, 248, 508*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+901, 261, 73, 251, 535*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+977, 258, 67, 254, 562*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1067, 255, 61, 257, 585*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1175, 252, 56, 260, 615*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1307, 249, 50, 263, 645*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1473, 246, 44, 267, 676*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1688, 243, 39, 270, 705*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1975, 240, 33, 273, 735*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2379, 238, 28, 276, 768*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2992, 235, 22, 279, 796*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4031, 233, 16, 282, 823*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6175, 230, 11, 285, 856*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+13188, 228, 5, 288, 886*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+65535, 225, 65535, 291, 914*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+10371, 223, 65530, 294, 881*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5478, 221, 65524, 297, 848*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3722, 219, 65518, 300, 816*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2819, 217, 65513, 303, 783*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2268, 214, 65507, 306, 757*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1897, 212, 65501, 309, 729*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1631, 210, 65496, 312, 703*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1430, 208, 65490, 315, 671*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1273, 206, 65485, 318, 640*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1147, 204, 65479, 321, 612*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1044, 202, 65473, 324, 581*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+958, 201, 65468, 327, 555*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+885, 199, 65462, 330, 526*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+822, 197, 65456, 333, 500*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+768, 195, 65451, 336, 478*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+720, 193, 65445, 339, 453*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+678, 192, 65439, 342, 428*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+641, 190, 65434, 345, 406*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+188, 731, 348, 90, 6*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 460*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+191, 705, 343, 93, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 443*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 681, 337, 96, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 430*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 659, 332, 99, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 417*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 638, 326, 103, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 403*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 618, 321, 106, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 388*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 599, 316, 109, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 376*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 582, 310, 113, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 362*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 565, 305, 116, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 349*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 550, 299, 119, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 340*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 535, 294, 123, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 330*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 521, 288, 126, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 319*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 508, 283, 129, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 495, 277, 132, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 301*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 483, 272, 136, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 292*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 472, 266, 139, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 282*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 461, 261, 142, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 450, 255, 146, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 263*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 440, 250, 149, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 256*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 431, 244, 152, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 422, 239, 155, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 413, 233, 159, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 231*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 405, 228, 162, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+295, 396, 222, 165, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 214*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+302, 389, 217, 169, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+310, 381, 211, 172, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 199*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+319, 374, 206, 175, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+327, 367, 200, 178, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 185*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+337, 361, 195, 182, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+346, 354, 189, 185, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 172*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+357, 348, 184, 188, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+368, 342, 178, 192, 186*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+379, 336, 173, 195, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 154*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+392, 331, 167, 198, 210*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+405, 325, 162, 201, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+419, 320, 156, 205, 237*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+435, 315, 151, 208, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+451, 310, 145, 211, 264*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+469, 305, 140, 215, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+488, 301, 134, 218, 297*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+509, 296, 129, 221, 311*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+531, 292, 123, 225, 327*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+556, 288, 118, 228, 345*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+583, 284, 112, 231, 363*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+613, 280, 107, 234, 385*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+646, 276, 101, 238, 410*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+683, 272, 96, 241, 432*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+725, 268, 90, 244, 456*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+771, 265, 85, 248, 480*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+825, 261, 79, 251, 502*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+886, 258, 74, 254, 527*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+957, 255, 68, 257, 554*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1040, 251, 63, 261, 579*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1140, 248, 58, 264, 609*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1260, 245, 52, 267, 639*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1409, 242, 47, 271, 667*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1597, 239, 41, 274, 694*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1844, 236, 36, 277, 718*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2181, 234, 30, 280, 748*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2668, 231, 25, 284, 780*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3435, 228, 19, 287, 812*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4823, 226, 14, 290, 843*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+8093, 223, 8, 294, 876*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+25130, 221, 3, 297, 906*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+22743, 218, 65533, 300, 902*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7829, 216, 65528, 303, 871*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4728, 214, 65522, 307, 842*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3387, 211, 65517, 310, 810*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2638, 209, 65511, 313, 779*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2161, 207, 65506, 317, 747*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1830, 205, 65500, 320, 717*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1587, 203, 65495, 323, 691*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1400, 201, 65489, 327, 664*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1253, 199, 65484, 330, 636*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1134, 197, 65478, 333, 608*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1036, 195, 65473, 336, 578*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+953, 193, 65467, 340, 553*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+883, 191, 65462, 343, 525*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+822, 189, 65456, 346, 500*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+769, 187, 65451, 350, 479*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+186, 905, 352, 72, 4*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 537*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+189, 863, 347, 76, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 519*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+192, 824, 342, 80, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 501*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+195, 789, 336, 83, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 491*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+198, 756, 331, 87, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 469*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 727, 326, 90, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 458*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 699, 320, 94, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 439*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 674, 315, 97, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 425*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 650, 310, 101, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 413*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 628, 305, 104, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 396*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 607, 299, 108, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 381*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 588, 294, 112, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 368*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 570, 289, 115, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 353*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 552, 283, 119, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 536, 278, 122, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 331*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 521, 273, 126, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 319*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 507, 267, 129, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 493, 262, 133, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 300*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 480, 257, 136, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 468, 251, 140, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 278*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 457, 246, 144, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 269*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 446, 241, 147, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 260*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 435, 235, 151, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+285, 425, 230, 154, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 415, 225, 158, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 406, 219, 161, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 224*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 398, 214, 165, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+314, 389, 209, 168, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+322, 381, 203, 172, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 199*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+331, 373, 198, 176, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+340, 366, 193, 179, 158*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+350, 359, 187, 183, 168*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+360, 352, 182, 186, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+371, 345, 177, 190, 189*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 163*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+382, 339, 171, 193, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+394, 333, 166, 197, 212*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+407, 327, 161, 200, 225*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+421, 321, 156, 204, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+436, 316, 150, 208, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+452, 310, 145, 211, 265*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+470, 305, 140, 215, 280*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+488, 300, 134, 218, 297*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+508, 296, 129, 222, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+530, 291, 124, 225, 326*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+554, 286, 118, 229, 343*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+580, 282, 113, 232, 360*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+609, 278, 108, 236, 382*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+641, 274, 102, 240, 406*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+676, 270, 97, 243, 427*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+715, 266, 92, 247, 449*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+759, 262, 86, 250, 471*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+809, 258, 81, 254, 496*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+866, 255, 76, 257, 522*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+931, 251, 70, 261, 547*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1007, 248, 65, 264, 575*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1097, 245, 60, 268, 598*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1204, 241, 54, 272, 623*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1335, 238, 49, 275, 650*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1497, 235, 44, 279, 678*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1704, 232, 38, 282, 706*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1978, 229, 33, 286, 736*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2356, 227, 28, 289, 767*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2913, 224, 22, 293, 790*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3816, 221, 17, 296, 818*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5530, 218, 12, 300, 849*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+10036, 216, 7, 304, 880*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+54219, 213, 1, 307, 911*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+15935, 211, 65532, 311, 889*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6947, 209, 65527, 314, 863*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4441, 206, 65521, 318, 838*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3264, 204, 65516, 321, 806*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2580, 202, 65511, 325, 775*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2133, 200, 65505, 328, 746*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1818, 197, 65500, 332, 715*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1584, 195, 65495, 336, 689*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1404, 193, 65489, 339, 666*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1260, 191, 65484, 343, 639*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1143, 189, 65479, 346, 611*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1046, 187, 65473, 350, 582*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+964, 185, 65468, 353, 556*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+184, 1191, 356, 55, 2*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 619*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+187, 1114, 350, 59, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 605*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+190, 1046, 345, 63, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 582*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+193, 986, 340, 66, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 565*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+196, 933, 335, 70, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 548*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+199, 885, 330, 74, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 526*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+202, 841, 325, 78, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 511*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+205, 802, 320, 82, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 495*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 766, 314, 86, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 476*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 734, 309, 89, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 461*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 704, 304, 93, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 442*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 676, 299, 97, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 427*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 650, 294, 101, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 413*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 627, 289, 105, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 395*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 605, 284, 108, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 380*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 584, 278, 112, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 364*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 565, 273, 116, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 349*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 547, 268, 120, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 338*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 530, 263, 124, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 326*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 514, 258, 127, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 314*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 499, 253, 131, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 303*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 485, 248, 135, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 294*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 472, 242, 139, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 282*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+276, 459, 237, 143, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 447, 232, 147, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 261*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 436, 227, 150, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+295, 425, 222, 154, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+302, 415, 217, 158, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+310, 405, 212, 162, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+317, 396, 206, 166, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 214*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+326, 387, 201, 169, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+334, 378, 196, 173, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 196*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+343, 370, 191, 177, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 188*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+353, 362, 186, 181, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+363, 355, 181, 185, 181*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 173*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+373, 348, 176, 188, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+384, 341, 170, 192, 202*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 159*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+396, 334, 165, 196, 214*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+409, 328, 160, 200, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+423, 322, 155, 204, 241*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+437, 316, 150, 208, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+453, 310, 145, 211, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+469, 305, 140, 215, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+487, 299, 135, 219, 296*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+507, 294, 129, 223, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+528, 289, 124, 227, 324*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+550, 284, 119, 230, 340*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+575, 280, 114, 234, 358*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+602, 275, 109, 238, 377*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+632, 271, 104, 242, 399*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+665, 267, 99, 246, 421*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+702, 263, 93, 249, 441*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+743, 259, 88, 253, 467*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+789, 255, 83, 257, 491*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+841, 251, 78, 261, 511*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+900, 248, 73, 265, 534*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+968, 244, 68, 269, 557*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1048, 241, 63, 272, 583*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1142, 237, 57, 276, 610*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1254, 234, 52, 280, 637*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1391, 231, 47, 284, 660*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1561, 228, 42, 288, 682*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1779, 225, 37, 291, 712*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2068, 222, 32, 295, 742*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2468, 219, 27, 299, 771*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3060, 216, 21, 303, 801*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4027, 214, 16, 307, 822*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5886, 211, 11, 310, 853*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+10934, 209, 6, 314, 883*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+65535, 206, 1, 318, 914*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+15287, 204, 65532, 322, 888*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6951, 201, 65527, 326, 864*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4499, 199, 65521, 330, 839*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3325, 197, 65516, 333, 809*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2637, 194, 65511, 337, 778*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2185, 192, 65506, 341, 749*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1866, 190, 65501, 345, 723*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1627, 188, 65496, 349, 701*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 6*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1443, 186, 65491, 352, 674*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 4*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1296, 184, 65485, 356, 644*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 2*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+183, 1747, 358, 38, 1*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 708*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+186, 1576, 353, 42, 4*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 686*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+188, 1436, 348, 46, 6*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 673*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+191, 1319, 343, 50, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 647*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 1219, 338, 54, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 628*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 1134, 333, 58, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 608*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+200, 1059, 328, 62, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 584*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+203, 994, 323, 66, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 568*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 936, 318, 70, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 550*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 885, 313, 74, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 526*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 839, 308, 78, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 510*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 797, 303, 82, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 493*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 760, 298, 86, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 472*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 726, 294, 90, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 457*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 695, 289, 94, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 437*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 666, 284, 98, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 422*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 640, 279, 102, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 405*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 615, 274, 107, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 593, 269, 111, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 372*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 572, 264, 115, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 355*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 552, 259, 119, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 534, 254, 123, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 329*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 517, 249, 127, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 316*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 501, 244, 131, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 486, 239, 135, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 295*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 471, 234, 139, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 281*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 458, 229, 143, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 270*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 445, 224, 147, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 259*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 433, 219, 151, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 249*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 422, 214, 155, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+313, 411, 209, 159, 131*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 229*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+321, 401, 204, 163, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 219*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+328, 391, 200, 167, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 209*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+337, 382, 195, 171, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+346, 373, 190, 176, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+355, 365, 185, 180, 173*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+365, 357, 180, 184, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+375, 349, 175, 188, 193*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+386, 342, 170, 192, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+397, 335, 165, 196, 215*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+410, 328, 160, 200, 228*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+423, 321, 155, 204, 241*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+437, 315, 150, 208, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+452, 309, 145, 212, 265*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+468, 303, 140, 216, 278*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+485, 298, 135, 220, 294*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+503, 292, 130, 224, 307*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+523, 287, 125, 228, 320*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+545, 282, 120, 232, 336*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+568, 277, 115, 236, 352*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+593, 272, 110, 241, 372*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+621, 268, 106, 245, 391*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+652, 264, 101, 249, 414*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+685, 259, 96, 253, 434*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+723, 255, 91, 257, 455*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+765, 251, 86, 261, 475*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+811, 247, 81, 265, 497*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+864, 244, 76, 269, 520*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+925, 240, 71, 273, 545*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+994, 237, 66, 277, 568*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1075, 233, 61, 281, 589*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1169, 230, 56, 285, 614*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1283, 227, 51, 289, 642*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1420, 223, 46, 293, 670*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1591, 220, 41, 297, 692*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1808, 217, 36, 301, 714*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2094, 215, 31, 305, 744*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2487, 212, 26, 310, 773*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3061, 209, 21, 314, 802*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3981, 206, 16, 318, 820*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5692, 204, 12, 322, 850*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+9981, 201, 7, 326, 879*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+40492, 199, 2, 330, 910*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+19688, 196, 65533, 334, 897*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7919, 194, 65528, 338, 874*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4956, 192, 65523, 342, 844*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3607, 189, 65518, 346, 813*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2835, 187, 65513, 350, 784*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2335, 185, 65508, 354, 764*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1985, 183, 65503, 358, 737*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 1*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+182, 3291, 359, 20, 0*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 807*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+185, 2707, 354, 24, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 781*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+187, 2299, 350, 29, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 761*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+190, 1998, 345, 33, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 739*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+193, 1766, 340, 37, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 711*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+195, 1583, 336, 41, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 688*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+198, 1434, 331, 46, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 672*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 1311, 326, 50, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 646*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 1207, 321, 54, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 625*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+207, 1118, 317, 59, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 607*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+210, 1042, 312, 63, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 580*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 975, 307, 67, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 561*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 917, 302, 71, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 541*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 865, 298, 76, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 521*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+224, 818, 293, 80, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 498*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 777, 288, 84, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 482*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 739, 283, 89, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 465*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 705, 279, 93, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 443*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 674, 274, 97, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 425*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 645, 269, 102, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 409*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 619, 264, 106, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 389*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 595, 260, 110, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 374*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 573, 255, 114, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 356*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 552, 250, 119, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 533, 245, 123, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 328*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 515, 241, 127, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 315*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 498, 236, 132, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 302*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+283, 482, 231, 136, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 291*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 467, 226, 140, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 277*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 453, 222, 145, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+302, 440, 217, 149, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 256*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+309, 428, 212, 153, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 245*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 416, 207, 157, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 234*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+323, 405, 203, 162, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+331, 395, 198, 166, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 213*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+339, 385, 193, 170, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 203*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 375, 189, 175, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 193*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+357, 366, 184, 179, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+366, 358, 179, 183, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+376, 349, 174, 188, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+387, 342, 170, 192, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+398, 334, 165, 196, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+409, 327, 160, 200, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+422, 320, 155, 205, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+435, 314, 151, 209, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+449, 307, 146, 213, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+464, 301, 141, 218, 275*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+481, 295, 136, 222, 290*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+498, 290, 132, 226, 302*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 108*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+517, 284, 127, 231, 316*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+537, 279, 122, 235, 332*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+558, 274, 117, 239, 346*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+582, 269, 113, 243, 362*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+607, 265, 108, 248, 381*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+635, 260, 103, 252, 402*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+666, 256, 98, 256, 422*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+700, 251, 94, 261, 440*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+737, 247, 89, 265, 464*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+778, 243, 84, 269, 483*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+825, 240, 79, 273, 502*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+877, 236, 75, 278, 523*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+937, 232, 70, 282, 551*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1005, 229, 65, 286, 573*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1084, 225, 60, 291, 594*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1176, 222, 56, 295, 616*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1285, 219, 51, 299, 643*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1417, 216, 46, 304, 669*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1579, 213, 42, 308, 687*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1782, 210, 37, 312, 713*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2046, 207, 32, 316, 741*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2402, 204, 27, 321, 769*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2907, 202, 23, 325, 789*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3682, 199, 18, 329, 815*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5018, 196, 13, 334, 846*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+7880, 194, 8, 338, 873*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+18332, 191, 4, 342, 892*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+56153, 189, 65535, 347, 912*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+11091, 187, 65530, 351, 884*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+6153, 185, 65525, 355, 855*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4257, 182, 65521, 359, 836*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 0*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+182, 28963, 360, 2, 0*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 908*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+184, 9654, 355, 7, 2*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 878*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+187, 5793, 351, 11, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 852*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+189, 4138, 346, 16, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 829*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+192, 3218, 342, 20, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 805*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 2633, 337, 25, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 777*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 2228, 333, 29, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 751*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+200, 1931, 328, 34, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 734*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+203, 1704, 324, 38, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 706*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+205, 1524, 319, 43, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 680*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 1379, 315, 48, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 657*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 1259, 310, 52, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 638*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 1159, 305, 57, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 613*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 1073, 301, 61, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 588*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 999, 296, 66, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 570*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 934, 292, 70, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 549*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 878, 287, 75, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 524*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 828, 283, 79, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 504*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 783, 278, 84, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 486*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 743, 274, 88, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 467*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 706, 269, 93, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 444*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 674, 265, 97, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 425*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 644, 260, 102, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 408*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 616, 256, 106, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 387*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 591, 251, 111, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 371*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 568, 247, 115, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 352*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 546, 242, 120, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 337*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+276, 527, 238, 124, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 323*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 508, 233, 129, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+287, 491, 229, 134, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 299*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+293, 475, 224, 138, 111*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 284*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 460, 219, 143, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 272*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+305, 446, 215, 147, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 260*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+311, 432, 210, 152, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+318, 420, 206, 156, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 238*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 408, 201, 161, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 226*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+333, 397, 197, 165, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 215*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+341, 386, 192, 170, 159*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+349, 376, 188, 174, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+358, 367, 183, 179, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 185*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+367, 358, 179, 183, 185*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+376, 349, 174, 188, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+386, 341, 170, 192, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 159*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+397, 333, 165, 197, 215*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+408, 325, 161, 201, 226*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+420, 318, 156, 206, 238*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+432, 311, 152, 210, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+446, 305, 147, 215, 260*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+460, 299, 143, 219, 272*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+475, 293, 138, 224, 284*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 111*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+491, 287, 134, 229, 299*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+508, 281, 129, 233, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+527, 276, 124, 238, 323*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+546, 271, 120, 242, 337*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+568, 266, 115, 247, 352*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+591, 261, 111, 251, 371*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+616, 256, 106, 256, 387*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+644, 252, 102, 260, 408*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+674, 248, 97, 265, 425*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+706, 243, 93, 269, 444*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+743, 239, 88, 274, 467*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+783, 235, 84, 278, 486*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+828, 232, 79, 283, 504*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+878, 228, 75, 287, 524*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+934, 225, 70, 292, 549*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+999, 221, 66, 296, 570*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1073, 218, 61, 301, 588*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1159, 215, 57, 305, 613*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1259, 211, 52, 310, 638*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1379, 208, 48, 315, 657*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1524, 205, 43, 319, 680*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1704, 203, 38, 324, 706*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1931, 200, 34, 328, 734*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2228, 197, 29, 333, 751*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2633, 194, 25, 337, 777*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3218, 192, 20, 342, 805*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+4138, 189, 16, 346, 829*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+5793, 187, 11, 351, 852*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+9654, 184, 7, 355, 878*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 2*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+28963, 182, 2, 360, 908*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 0*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+182, 4257, 359, 65521, 0*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 836*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+185, 6153, 355, 65525, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 855*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+187, 11091, 351, 65530, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 884*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+189, 56153, 347, 65535, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 912*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+191, 18332, 342, 4, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 892*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 7880, 338, 8, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 873*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+196, 5018, 334, 13, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 846*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+199, 3682, 329, 18, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 815*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+202, 2907, 325, 23, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 789*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 2402, 321, 27, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 769*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+207, 2046, 316, 32, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 741*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+210, 1782, 312, 37, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 713*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 1579, 308, 42, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 687*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 1417, 304, 46, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 669*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 1285, 299, 51, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 643*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+222, 1176, 295, 56, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 616*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 1084, 291, 60, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 594*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 1005, 286, 65, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 573*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 937, 282, 70, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 551*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 877, 278, 75, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 523*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 825, 273, 79, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 502*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 778, 269, 84, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 483*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 737, 265, 89, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 464*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 700, 261, 94, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 440*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 666, 256, 98, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 422*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 635, 252, 103, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 402*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 607, 248, 108, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 381*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 582, 243, 113, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 362*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 558, 239, 117, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 346*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+279, 537, 235, 122, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 332*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 517, 231, 127, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 316*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+290, 498, 226, 132, 108*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 302*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+295, 481, 222, 136, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 290*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+301, 464, 218, 141, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 275*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+307, 449, 213, 146, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+314, 435, 209, 151, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+320, 422, 205, 155, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+327, 409, 200, 160, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+334, 398, 196, 165, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+342, 387, 192, 170, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+349, 376, 188, 174, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+358, 366, 183, 179, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+366, 357, 179, 184, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+375, 348, 175, 189, 193*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+385, 339, 170, 193, 203*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+395, 331, 166, 198, 213*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+405, 323, 162, 203, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+416, 316, 157, 207, 234*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+428, 309, 153, 212, 245*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+440, 302, 149, 217, 256*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+453, 296, 145, 222, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+467, 289, 140, 226, 277*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+482, 283, 136, 231, 291*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+498, 278, 132, 236, 302*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+515, 272, 127, 241, 315*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+533, 267, 123, 245, 328*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+552, 262, 119, 250, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+573, 257, 114, 255, 356*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+595, 252, 110, 260, 374*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+619, 248, 106, 264, 389*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+645, 244, 102, 269, 409*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+674, 239, 97, 274, 425*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+705, 235, 93, 279, 443*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+739, 231, 89, 283, 465*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+777, 227, 84, 288, 482*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+818, 224, 80, 293, 498*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+865, 220, 76, 298, 521*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+917, 217, 71, 302, 541*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+975, 213, 67, 307, 561*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1042, 210, 63, 312, 580*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1118, 207, 59, 317, 607*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1207, 204, 54, 321, 625*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1311, 201, 50, 326, 646*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1434, 198, 46, 331, 672*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1583, 195, 41, 336, 688*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1766, 193, 37, 340, 711*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1998, 190, 33, 345, 739*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2299, 187, 29, 350, 761*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+2707, 185, 24, 354, 781*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+3291, 182, 20, 359, 807*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 0*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+183, 1985, 358, 65503, 1*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 737*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+185, 2335, 354, 65508, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 764*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+187, 2835, 350, 65513, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 784*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+189, 3607, 346, 65518, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 813*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+192, 4956, 342, 65523, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 844*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 7919, 338, 65528, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 874*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+196, 19688, 334, 65533, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 897*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+199, 40492, 330, 2, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 910*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 9981, 326, 7, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 879*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 5692, 322, 12, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 850*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 3981, 318, 16, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 820*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 3061, 314, 21, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 802*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 2487, 310, 26, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 773*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 2094, 305, 31, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 744*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 1808, 301, 36, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 714*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 1591, 297, 41, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 692*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 1420, 293, 46, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 670*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 1283, 289, 51, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 642*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 1169, 285, 56, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 614*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 1075, 281, 61, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 589*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 994, 277, 66, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 568*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 925, 273, 71, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 545*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 864, 269, 76, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 520*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 811, 265, 81, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 497*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 765, 261, 86, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 475*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 723, 257, 91, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 455*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 685, 253, 96, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 434*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 652, 249, 101, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 414*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 621, 245, 106, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 391*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 593, 241, 110, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 372*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 568, 236, 115, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 352*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 545, 232, 120, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 336*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+287, 523, 228, 125, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 320*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 503, 224, 130, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 307*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+298, 485, 220, 135, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 294*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 468, 216, 140, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 278*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+309, 452, 212, 145, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 265*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 437, 208, 150, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+321, 423, 204, 155, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 241*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+328, 410, 200, 160, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 228*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+335, 397, 196, 165, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 215*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+342, 386, 192, 170, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+349, 375, 188, 175, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 193*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+357, 365, 184, 180, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+365, 355, 180, 185, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 173*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+373, 346, 176, 190, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+382, 337, 171, 195, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+391, 328, 167, 200, 209*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+401, 321, 163, 204, 219*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+411, 313, 159, 209, 229*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 131*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+422, 306, 155, 214, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+433, 299, 151, 219, 249*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+445, 292, 147, 224, 259*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+458, 286, 143, 229, 270*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+471, 280, 139, 234, 281*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+486, 274, 135, 239, 295*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+501, 269, 131, 244, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+517, 263, 127, 249, 316*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+534, 258, 123, 254, 329*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+552, 253, 119, 259, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+572, 248, 115, 264, 355*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+593, 244, 111, 269, 372*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+615, 239, 107, 274, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+640, 235, 102, 279, 405*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+666, 231, 98, 284, 422*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+695, 227, 94, 289, 437*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+726, 223, 90, 294, 457*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+760, 220, 86, 298, 472*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+797, 216, 82, 303, 493*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+839, 213, 78, 308, 510*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+885, 209, 74, 313, 526*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+936, 206, 70, 318, 550*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+994, 203, 66, 323, 568*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1059, 200, 62, 328, 584*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1134, 197, 58, 333, 608*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1219, 194, 54, 338, 628*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1319, 191, 50, 343, 647*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1436, 188, 46, 348, 673*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 6*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1576, 186, 42, 353, 686*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 4*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1747, 183, 38, 358, 708*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 1*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+184, 1296, 356, 65485, 2*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 644*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+186, 1443, 352, 65491, 4*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 674*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+188, 1627, 349, 65496, 6*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 701*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+190, 1866, 345, 65501, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 723*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+192, 2185, 341, 65506, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 749*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+194, 2637, 337, 65511, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 778*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 3325, 333, 65516, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 809*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+199, 4499, 330, 65521, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 839*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 6951, 326, 65527, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 864*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 15287, 322, 65532, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 888*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 65535, 318, 1, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 914*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 10934, 314, 6, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 883*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 5886, 310, 11, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 853*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 4027, 307, 16, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 822*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 3060, 303, 21, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 801*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 2468, 299, 27, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 771*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+222, 2068, 295, 32, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 742*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 1779, 291, 37, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 712*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 1561, 288, 42, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 682*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 1391, 284, 47, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 660*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 1254, 280, 52, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 637*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 1142, 276, 57, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 610*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 1048, 272, 63, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 583*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 968, 269, 68, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 557*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 900, 265, 73, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 534*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 841, 261, 78, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 511*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 789, 257, 83, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 491*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 743, 253, 88, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 467*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 702, 249, 93, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 441*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 665, 246, 99, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 421*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 632, 242, 104, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 399*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 602, 238, 109, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 377*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 575, 234, 114, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 358*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 550, 230, 119, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 340*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 528, 227, 124, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 324*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+294, 507, 223, 129, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 487, 219, 135, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 296*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+305, 469, 215, 140, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+310, 453, 211, 145, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 437, 208, 150, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+322, 423, 204, 155, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 241*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+328, 409, 200, 160, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+334, 396, 196, 165, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 214*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+341, 384, 192, 170, 159*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 202*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 373, 188, 176, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+355, 363, 185, 181, 173*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 181*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+362, 353, 181, 186, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+370, 343, 177, 191, 188*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+378, 334, 173, 196, 196*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+387, 326, 169, 201, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+396, 317, 166, 206, 214*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+405, 310, 162, 212, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+415, 302, 158, 217, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+425, 295, 154, 222, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+436, 289, 150, 227, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+447, 282, 147, 232, 261*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+459, 276, 143, 237, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+472, 270, 139, 242, 282*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+485, 265, 135, 248, 294*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+499, 259, 131, 253, 303*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+514, 254, 127, 258, 314*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+530, 249, 124, 263, 326*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+547, 244, 120, 268, 338*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+565, 240, 116, 273, 349*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+584, 235, 112, 278, 364*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+605, 231, 108, 284, 380*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+627, 227, 105, 289, 395*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+650, 223, 101, 294, 413*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+676, 219, 97, 299, 427*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+704, 215, 93, 304, 442*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+734, 212, 89, 309, 461*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+766, 208, 86, 314, 476*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+802, 205, 82, 320, 495*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+841, 202, 78, 325, 511*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+885, 199, 74, 330, 526*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+933, 196, 70, 335, 548*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+986, 193, 66, 340, 565*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1046, 190, 63, 345, 582*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1114, 187, 59, 350, 605*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+1191, 184, 55, 356, 619*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 2*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+185, 964, 353, 65468, 3*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 556*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+187, 1046, 350, 65473, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 582*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+189, 1143, 346, 65479, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 611*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+191, 1260, 343, 65484, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 639*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+193, 1404, 339, 65489, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 666*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+195, 1584, 336, 65495, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 689*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 1818, 332, 65500, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 715*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+200, 2133, 328, 65505, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 746*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+202, 2580, 325, 65511, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 775*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 3264, 321, 65516, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 806*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 4441, 318, 65521, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 838*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 6947, 314, 65527, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 863*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 15935, 311, 65532, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 889*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 54219, 307, 1, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 911*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 10036, 304, 7, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 880*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 5530, 300, 12, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 849*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 3816, 296, 17, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 818*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+224, 2913, 293, 22, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 790*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 2356, 289, 28, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 767*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 1978, 286, 33, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 736*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 1704, 282, 38, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 706*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 1497, 279, 44, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 678*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 1335, 275, 49, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 650*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 1204, 272, 54, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 623*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 1097, 268, 60, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 598*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 1007, 264, 65, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 575*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 931, 261, 70, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 547*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 866, 257, 76, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 522*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 809, 254, 81, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 496*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 759, 250, 86, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 471*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 715, 247, 92, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 449*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 676, 243, 97, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 427*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 641, 240, 102, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 406*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 609, 236, 108, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 382*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 580, 232, 113, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 360*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 554, 229, 118, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 343*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 530, 225, 124, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 326*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 508, 222, 129, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+300, 488, 218, 134, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 297*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+305, 470, 215, 140, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 280*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+310, 452, 211, 145, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 265*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 436, 208, 150, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+321, 421, 204, 156, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+327, 407, 200, 161, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 225*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+333, 394, 197, 166, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 212*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+339, 382, 193, 171, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+345, 371, 190, 177, 163*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 189*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+352, 360, 186, 182, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+359, 350, 183, 187, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 168*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+366, 340, 179, 193, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 158*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+373, 331, 176, 198, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+381, 322, 172, 203, 199*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+389, 314, 168, 209, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+398, 306, 165, 214, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+406, 299, 161, 219, 224*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+415, 292, 158, 225, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+425, 285, 154, 230, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+435, 278, 151, 235, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+446, 272, 147, 241, 260*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+457, 266, 144, 246, 269*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+468, 261, 140, 251, 278*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+480, 255, 136, 257, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+493, 250, 133, 262, 300*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+507, 245, 129, 267, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+521, 240, 126, 273, 319*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+536, 236, 122, 278, 331*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+552, 231, 119, 283, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+570, 227, 115, 289, 353*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+588, 223, 112, 294, 368*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+607, 219, 108, 299, 381*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+628, 215, 104, 305, 396*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+650, 212, 101, 310, 413*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+674, 208, 97, 315, 425*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+699, 204, 94, 320, 439*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+727, 201, 90, 326, 458*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+756, 198, 87, 331, 469*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+789, 195, 83, 336, 491*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+824, 192, 80, 342, 501*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+863, 189, 76, 347, 519*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+905, 186, 72, 352, 537*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 4*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+187, 769, 350, 65451, 5*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 479*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+189, 822, 346, 65456, 7*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 500*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+191, 883, 343, 65462, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 525*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+193, 953, 340, 65467, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 553*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+195, 1036, 336, 65473, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 578*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 1134, 333, 65478, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 608*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+199, 1253, 330, 65484, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 636*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 1400, 327, 65489, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 664*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+203, 1587, 323, 65495, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 691*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+205, 1830, 320, 65500, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 717*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+207, 2161, 317, 65506, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 747*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 2638, 313, 65511, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 779*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 3387, 310, 65517, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 810*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 4728, 307, 65522, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 842*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 7829, 303, 65528, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 871*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 22743, 300, 65533, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 902*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 25130, 297, 3, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 906*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 8093, 294, 8, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 876*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 4823, 290, 14, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 843*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 3435, 287, 19, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 812*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 2668, 284, 25, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 780*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 2181, 280, 30, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 748*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 1844, 277, 36, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 718*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 1597, 274, 41, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 694*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+242, 1409, 271, 47, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 667*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 1260, 267, 52, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 639*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 1140, 264, 58, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 609*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 1040, 261, 63, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 579*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 957, 257, 68, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 554*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 886, 254, 74, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 527*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 825, 251, 79, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 502*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 771, 248, 85, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 480*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 725, 244, 90, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 456*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 683, 241, 96, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 432*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+276, 646, 238, 101, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 410*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 613, 234, 107, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 385*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 583, 231, 112, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 363*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 556, 228, 118, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 345*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 531, 225, 123, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 327*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 509, 221, 129, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 311*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+301, 488, 218, 134, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 297*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+305, 469, 215, 140, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+310, 451, 211, 145, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 264*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 435, 208, 151, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+320, 419, 205, 156, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 237*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 405, 201, 162, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+331, 392, 198, 167, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 210*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+336, 379, 195, 173, 154*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+342, 368, 192, 178, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 186*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 357, 188, 184, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+354, 346, 185, 189, 172*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+361, 337, 182, 195, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+367, 327, 178, 200, 185*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+374, 319, 175, 206, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+381, 310, 172, 211, 199*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+389, 302, 169, 217, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+396, 295, 165, 222, 214*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+405, 288, 162, 228, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+413, 281, 159, 233, 231*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+422, 275, 155, 239, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+431, 268, 152, 244, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+440, 263, 149, 250, 256*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+450, 257, 146, 255, 263*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+461, 251, 142, 261, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+472, 246, 139, 266, 282*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+483, 241, 136, 272, 292*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+495, 237, 132, 277, 301*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+508, 232, 129, 283, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+521, 228, 126, 288, 319*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+535, 223, 123, 294, 330*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+550, 219, 119, 299, 340*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+565, 215, 116, 305, 349*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+582, 211, 113, 310, 362*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+599, 208, 109, 316, 376*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+618, 204, 106, 321, 388*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+638, 201, 103, 326, 403*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+659, 197, 99, 332, 417*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+681, 194, 96, 337, 430*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+705, 191, 93, 343, 443*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+731, 188, 90, 348, 460*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 6*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+190, 641, 345, 65434, 8*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 406*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+192, 678, 342, 65439, 10*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 428*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+193, 720, 339, 65445, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 453*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+195, 768, 336, 65451, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 478*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 822, 333, 65456, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 500*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+199, 885, 330, 65462, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 526*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 958, 327, 65468, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 555*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+202, 1044, 324, 65473, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 581*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 1147, 321, 65479, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 612*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 1273, 318, 65485, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 640*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 1430, 315, 65490, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 671*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+210, 1631, 312, 65496, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 703*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 1897, 309, 65501, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 729*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 2268, 306, 65507, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 757*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 2819, 303, 65513, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 783*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 3722, 300, 65518, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 816*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 5478, 297, 65524, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 848*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 10371, 294, 65530, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 881*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 65535, 291, 65535, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 914*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 13188, 288, 5, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 886*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 6175, 285, 11, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 856*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 4031, 282, 16, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 823*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 2992, 279, 22, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 796*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 2379, 276, 28, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 768*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 1975, 273, 33, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 735*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 1688, 270, 39, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 705*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 1473, 267, 44, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 676*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 1307, 263, 50, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 645*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 1175, 260, 56, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 615*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 1067, 257, 61, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 585*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 977, 254, 67, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 562*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 901, 251, 73, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 535*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 837, 248, 78, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 508*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 780, 245, 84, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 484*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 731, 242, 90, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 460*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 688, 239, 95, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 435*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 649, 236, 101, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 412*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 615, 233, 107, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+285, 584, 230, 112, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 364*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 556, 227, 118, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 345*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 531, 224, 123, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 327*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 507, 221, 129, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+300, 486, 218, 135, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 295*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+305, 467, 215, 140, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 277*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+309, 449, 212, 146, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+313, 432, 209, 152, 131*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+318, 416, 206, 157, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 234*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+323, 402, 203, 163, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+327, 389, 200, 169, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+332, 376, 197, 174, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+338, 364, 194, 180, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 182*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+343, 353, 191, 186, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 343, 188, 191, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+354, 333, 185, 197, 172*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+360, 324, 182, 203, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 142*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+366, 315, 179, 208, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+372, 307, 176, 214, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+379, 299, 173, 219, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+386, 291, 170, 225, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+393, 284, 167, 231, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+400, 277, 164, 236, 218*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+407, 271, 161, 242, 225*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+415, 265, 158, 248, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+423, 259, 155, 253, 241*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+432, 253, 152, 259, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+440, 248, 149, 265, 256*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+449, 243, 146, 270, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+459, 238, 143, 276, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+469, 233, 140, 282, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+479, 228, 137, 287, 288*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+490, 224, 134, 293, 298*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+501, 220, 131, 298, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+513, 215, 128, 304, 313*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+526, 212, 125, 310, 322*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+539, 208, 122, 315, 333*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+552, 204, 119, 321, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+567, 201, 116, 327, 351*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+582, 197, 113, 332, 362*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+598, 194, 110, 338, 375*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+615, 191, 107, 344, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 9*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+193, 550, 340, 65417, 11*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 340*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+195, 578, 337, 65423, 13*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 359*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+196, 610, 334, 65428, 14*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 383*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+198, 644, 331, 65434, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 408*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+199, 683, 329, 65440, 17*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 432*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 727, 326, 65446, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 458*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+203, 777, 323, 65452, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 482*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+205, 834, 320, 65457, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 507*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 900, 318, 65463, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 534*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 978, 315, 65469, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 563*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+210, 1071, 312, 65475, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 587*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 1182, 309, 65481, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 617*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 1320, 307, 65486, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 648*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 1494, 304, 65492, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 677*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 1721, 301, 65498, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 707*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 2030, 298, 65504, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 740*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+222, 2473, 296, 65509, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 772*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+224, 3163, 293, 65515, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 803*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 4388, 290, 65521, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 837*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 7163, 288, 65527, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 868*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 19483, 285, 65533, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 896*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 27061, 282, 2, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 907*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 7985, 279, 8, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 875*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 4684, 277, 14, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 841*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 3314, 274, 20, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 808*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+242, 2564, 271, 26, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 774*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 2091, 268, 31, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 743*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 1765, 266, 37, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 710*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 1527, 263, 43, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 681*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 1346, 260, 49, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 651*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 1203, 257, 54, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 622*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 1087, 255, 60, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 595*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 992, 252, 66, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 567*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 912, 249, 72, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 539*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 844, 246, 78, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 513*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 786, 244, 83, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 488*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 735, 241, 89, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 462*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 690, 238, 95, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 436*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 650, 236, 101, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 413*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 615, 233, 107, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 386*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+285, 583, 230, 112, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 363*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 555, 227, 118, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 344*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 529, 225, 124, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 325*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+295, 505, 222, 130, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 308*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 484, 219, 135, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 293*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 464, 216, 141, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 275*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+307, 446, 214, 147, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 260*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+311, 429, 211, 153, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 246*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 413, 208, 159, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 231*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+319, 399, 205, 164, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+323, 385, 203, 170, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 203*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+328, 372, 200, 176, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+332, 361, 197, 182, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+337, 349, 194, 188, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+342, 339, 192, 193, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+347, 329, 189, 199, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+352, 320, 186, 205, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+357, 311, 184, 211, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+362, 303, 181, 216, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+368, 295, 178, 222, 186*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+374, 287, 175, 228, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+380, 280, 173, 234, 198*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+386, 273, 170, 240, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+392, 267, 167, 245, 210*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+399, 261, 164, 251, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+405, 255, 162, 257, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+412, 249, 159, 263, 230*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+420, 244, 156, 269, 238*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+427, 239, 153, 274, 244*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+435, 234, 151, 280, 251*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+443, 229, 148, 286, 258*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+451, 225, 145, 292, 264*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+460, 220, 142, 297, 272*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+469, 216, 140, 303, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+478, 212, 137, 309, 287*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+488, 208, 134, 315, 297*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+498, 204, 132, 321, 302*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+509, 201, 129, 326, 311*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+520, 197, 126, 332, 318*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+531, 194, 123, 338, 327*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 12*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+197, 483, 333, 65400, 15*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 292*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+198, 505, 331, 65406, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 308*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+200, 530, 328, 65412, 18*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 326*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 556, 326, 65418, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 345*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+203, 585, 323, 65424, 21*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 365*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 618, 321, 65430, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 388*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 655, 319, 65436, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 416*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+207, 696, 316, 65442, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 438*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 742, 314, 65448, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 466*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 796, 311, 65454, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 492*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 857, 309, 65460, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 518*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 929, 306, 65465, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 546*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 1014, 304, 65471, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 576*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 1116, 301, 65477, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 606*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 1241, 299, 65483, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 634*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 1397, 297, 65489, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 663*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 1599, 294, 65495, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 696*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 1869, 292, 65501, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 724*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 2248, 289, 65507, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 752*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 2819, 287, 65513, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 783*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 3781, 284, 65519, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 817*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 5739, 282, 65525, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 851*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 11899, 279, 65530, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 885*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 65535, 277, 0, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 914*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 10373, 274, 6, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 882*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 5358, 272, 12, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 847*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 3612, 270, 18, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 814*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 2724, 267, 24, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 782*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 2187, 265, 30, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 750*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 1826, 262, 36, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 716*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 1568, 260, 42, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 683*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 1374, 257, 48, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 656*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 1222, 255, 54, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 629*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 1101, 252, 60, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 599*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 1001, 250, 65, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 571*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 918, 248, 71, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 542*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 848, 245, 77, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 516*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 788, 243, 83, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 490*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 736, 240, 89, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 463*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+276, 690, 238, 95, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 436*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+279, 649, 235, 101, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 412*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 613, 233, 107, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 385*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 581, 230, 113, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 361*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 552, 228, 119, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 341*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 526, 225, 125, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 322*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+294, 502, 223, 130, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 306*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 480, 221, 136, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+300, 461, 218, 142, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+304, 442, 216, 148, 122*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 257*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+307, 425, 213, 154, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+311, 409, 211, 160, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 395, 208, 166, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 213*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+318, 381, 206, 172, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 199*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+322, 369, 203, 178, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 187*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+326, 357, 201, 184, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 175*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+330, 346, 199, 190, 148*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+334, 335, 196, 196, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+338, 325, 194, 201, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+343, 316, 191, 207, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+347, 307, 189, 213, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+352, 299, 186, 219, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+356, 291, 184, 225, 174*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+361, 284, 181, 231, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+366, 277, 179, 237, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+371, 270, 177, 243, 189*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+377, 263, 174, 249, 195*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+382, 257, 172, 255, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+387, 252, 169, 261, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+393, 246, 167, 266, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+399, 241, 164, 272, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+405, 235, 162, 278, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+411, 231, 159, 284, 229*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+418, 226, 157, 290, 236*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+424, 221, 154, 296, 242*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+431, 217, 152, 302, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+438, 213, 150, 308, 254*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+445, 209, 147, 314, 259*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+453, 205, 145, 320, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+461, 201, 142, 326, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+469, 198, 140, 332, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 16*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+201, 432, 326, 65384, 19*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 248*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+202, 450, 324, 65390, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 263*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+204, 469, 322, 65396, 22*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+205, 490, 320, 65402, 23*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 298*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 513, 318, 65408, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 313*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 539, 315, 65414, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 333*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+209, 567, 313, 65420, 27*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 351*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 598, 311, 65426, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 375*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 633, 309, 65432, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 400*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 672, 307, 65438, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 424*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 716, 305, 65444, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 450*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 767, 302, 65451, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 477*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 825, 300, 65457, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 502*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 892, 298, 65463, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 530*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 972, 296, 65469, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 558*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 1068, 294, 65475, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 586*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 1184, 292, 65481, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 618*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 1328, 290, 65487, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 649*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 1513, 287, 65493, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 679*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 1758, 285, 65499, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 709*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 2096, 283, 65505, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 745*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 2597, 281, 65511, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 776*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 3412, 279, 65517, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 811*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 4971, 277, 65523, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 845*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 9156, 274, 65529, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 877*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 57920, 272, 65535, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 913*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 13390, 270, 5, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 887*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 6001, 268, 11, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 854*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 3867, 266, 17, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 819*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 2853, 264, 23, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 785*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 2260, 262, 29, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 754*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 1871, 259, 35, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 725*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 1597, 257, 41, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 694*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 1392, 255, 47, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 661*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 1234, 253, 53, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 631*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 1108, 251, 59, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 601*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 1006, 249, 65, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 574*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 921, 246, 71, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 544*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 849, 244, 77, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 517*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 787, 242, 83, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 489*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 734, 240, 89, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 461*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+276, 688, 238, 95, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 435*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 647, 236, 101, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 411*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 611, 233, 107, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 384*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+283, 578, 231, 113, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 359*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 549, 229, 119, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 339*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 523, 227, 125, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 320*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 499, 225, 131, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 303*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+294, 477, 223, 137, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 286*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 457, 221, 143, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 269*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+300, 438, 218, 150, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 254*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 421, 216, 156, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 406, 214, 162, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 224*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+309, 391, 212, 168, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 209*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+312, 377, 210, 174, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 195*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 365, 208, 180, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+319, 353, 205, 186, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+322, 342, 203, 192, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+326, 331, 201, 198, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+329, 322, 199, 204, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+333, 312, 197, 210, 151*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+337, 304, 195, 216, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 122*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+340, 295, 193, 222, 158*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 113*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+344, 288, 190, 228, 162*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 280, 188, 234, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+352, 273, 186, 240, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+356, 266, 184, 246, 174*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+361, 260, 182, 252, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+365, 254, 180, 258, 183*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+369, 248, 177, 264, 187*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+374, 243, 175, 270, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+379, 237, 173, 276, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+383, 232, 171, 282, 201*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+388, 227, 169, 288, 206*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+393, 223, 167, 294, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+398, 218, 164, 300, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+404, 214, 162, 306, 222*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+409, 210, 160, 312, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+415, 206, 158, 318, 233*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+420, 202, 156, 324, 238*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 20*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+206, 391, 318, 65368, 24*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 209*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+207, 406, 317, 65375, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 224*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+208, 422, 315, 65381, 26*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 240*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+210, 439, 313, 65387, 28*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 255*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+211, 458, 311, 65393, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 270*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 478, 309, 65399, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 287*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 501, 307, 65405, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 525, 305, 65411, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 321*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 553, 303, 65417, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 342*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 583, 302, 65424, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 363*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 616, 300, 65430, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 387*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 654, 298, 65436, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 415*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 696, 296, 65442, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 438*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 745, 294, 65448, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 468*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+224, 801, 292, 65454, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 494*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 865, 290, 65460, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 521*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 941, 289, 65466, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 552*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 1032, 287, 65473, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 577*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 1142, 285, 65479, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 610*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 1279, 283, 65485, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 641*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 1453, 281, 65491, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 675*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 1681, 279, 65497, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 704*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 1994, 277, 65503, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 738*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 2451, 276, 65509, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 770*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 3179, 274, 65515, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 804*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 4522, 272, 65522, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 840*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 7833, 270, 65528, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 872*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 29226, 268, 65534, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 909*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 16882, 266, 4, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 890*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 6549, 264, 10, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 857*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 4063, 263, 16, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 826*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 2945, 261, 22, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 792*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 2309, 259, 28, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 762*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 1899, 257, 35, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 730*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 1613, 255, 41, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 698*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 1402, 253, 47, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 665*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 1239, 251, 53, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 633*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 1111, 250, 59, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 603*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 1006, 248, 65, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 574*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 920, 246, 71, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 543*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 847, 244, 77, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 515*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 785, 242, 83, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 487*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 731, 240, 90, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 460*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 684, 238, 96, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 433*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 643, 237, 102, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 407*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+279, 607, 235, 108, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 381*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 574, 233, 114, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 357*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 545, 231, 120, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 336*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 519, 229, 126, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 317*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 495, 227, 132, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 301*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 473, 225, 139, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 283*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+293, 453, 224, 145, 111*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 266*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 434, 222, 151, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 250*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+298, 417, 220, 157, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 235*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+301, 402, 218, 163, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 387, 216, 169, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 374, 214, 175, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+308, 361, 212, 181, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 179*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+311, 349, 211, 188, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 167*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+314, 338, 209, 194, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+317, 328, 207, 200, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+320, 318, 205, 206, 138*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+323, 309, 203, 212, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+326, 300, 201, 218, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 118*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+329, 292, 199, 224, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+332, 284, 198, 230, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+335, 277, 196, 237, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+338, 270, 194, 243, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+341, 263, 192, 249, 159*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+345, 257, 190, 255, 163*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 251, 188, 261, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+351, 245, 186, 267, 169*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+355, 240, 185, 273, 173*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+359, 234, 183, 279, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+362, 229, 181, 286, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+366, 225, 179, 292, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+370, 220, 177, 298, 188*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+374, 216, 175, 304, 192*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+378, 211, 173, 310, 196*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 29*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+382, 207, 172, 316, 200*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 25*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+212, 358, 310, 65353, 30*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+213, 371, 308, 65359, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 189*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+214, 384, 307, 65365, 32*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 202*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+215, 399, 305, 65372, 33*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 217*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+216, 414, 304, 65378, 34*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 232*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+217, 431, 302, 65384, 35*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 450, 300, 65390, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 263*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 470, 299, 65396, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 280*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 491, 297, 65403, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 299*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+222, 515, 296, 65409, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 315*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 542, 294, 65415, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 335*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+224, 571, 293, 65421, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 354*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 604, 291, 65427, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 379*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 641, 290, 65434, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 406*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 682, 288, 65440, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 431*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 729, 286, 65446, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 459*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 783, 285, 65452, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 486*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 846, 283, 65459, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 514*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 920, 282, 65465, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 543*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 1007, 280, 65471, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 575*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 1113, 279, 65477, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 604*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 1245, 277, 65483, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 635*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 1411, 276, 65490, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 668*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 1629, 274, 65496, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 702*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 1926, 272, 65502, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 733*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+242, 2356, 271, 65508, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 767*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 3033, 269, 65514, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 800*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 4256, 268, 65521, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 835*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 7130, 266, 65527, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 866*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 21969, 265, 65533, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 900*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 20321, 263, 3, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 898*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 6947, 262, 9, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 863*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 4190, 260, 16, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 831*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 2999, 258, 22, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 797*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 2336, 257, 28, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 765*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 1913, 255, 34, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 732*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 1619, 254, 40, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 700*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 1404, 252, 47, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 666*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 1239, 251, 53, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 633*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 1109, 249, 59, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 602*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 1004, 248, 65, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 572*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 916, 246, 72, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 540*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 843, 244, 78, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 512*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 781, 243, 84, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 485*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 727, 241, 90, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 458*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 680, 240, 96, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 429*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 639, 238, 103, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 404*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 603, 237, 109, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 378*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+279, 570, 235, 115, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 353*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 541, 234, 121, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 334*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 514, 232, 127, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 314*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 491, 230, 134, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 299*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 469, 229, 140, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 279*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 449, 227, 146, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 262*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+290, 431, 226, 152, 108*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 247*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 414, 224, 158, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 232*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+294, 398, 223, 165, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 216*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 384, 221, 171, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 202*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+298, 370, 220, 177, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 188*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+301, 358, 218, 183, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 176*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 346, 216, 189, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 164*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+305, 335, 215, 196, 123*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 153*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+307, 325, 213, 202, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+309, 315, 212, 208, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+312, 306, 210, 214, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+314, 297, 209, 221, 132*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+316, 289, 207, 227, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+319, 281, 206, 233, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+321, 274, 204, 239, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+324, 267, 202, 245, 142*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+326, 261, 201, 252, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+329, 254, 199, 258, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+331, 248, 198, 264, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+334, 243, 196, 270, 152*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+337, 237, 195, 276, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+339, 232, 193, 283, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+342, 227, 192, 289, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+345, 222, 190, 295, 163*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+348, 218, 188, 301, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+351, 213, 187, 307, 169*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 31*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+218, 331, 300, 65338, 36*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 149*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+219, 342, 299, 65344, 37*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 160*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+220, 353, 298, 65351, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 171*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+221, 366, 297, 65357, 39*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 184*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+222, 379, 295, 65363, 40*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 197*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+223, 393, 294, 65369, 41*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 211*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+224, 409, 293, 65376, 42*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 227*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+225, 425, 292, 65382, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 243*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 443, 290, 65388, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 258*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 463, 289, 65394, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 274*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 485, 288, 65401, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 294*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 508, 287, 65407, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 310*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 534, 285, 65413, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 329*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 563, 284, 65420, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 348*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 595, 283, 65426, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 374*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 631, 282, 65432, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 398*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 672, 280, 65438, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 424*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 718, 279, 65445, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 452*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 771, 278, 65451, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 480*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 832, 277, 65457, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 505*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 904, 275, 65464, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 536*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 990, 274, 65470, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 566*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 1094, 273, 65476, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 597*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 1222, 272, 65482, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 629*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+242, 1384, 270, 65489, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 659*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 1596, 269, 65495, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 693*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 1883, 268, 65501, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 727*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 2298, 267, 65507, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 760*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 2946, 265, 65514, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 793*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 4105, 264, 65520, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 828*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 6764, 263, 65526, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 861*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 19210, 262, 65533, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 895*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 22871, 260, 3, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 903*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 7168, 259, 9, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 869*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 4250, 258, 15, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 833*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 3021, 257, 22, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 799*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 2343, 255, 28, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 766*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 1913, 254, 34, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 732*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 1617, 253, 41, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 699*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 1400, 252, 47, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 664*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 1235, 250, 53, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 632*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 1104, 249, 59, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 600*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 998, 248, 66, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 569*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 911, 247, 72, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 538*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 838, 245, 78, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 509*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 776, 244, 84, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 481*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 722, 243, 91, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 454*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 675, 242, 97, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 426*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 634, 240, 103, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 401*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 598, 239, 110, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 375*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 566, 238, 116, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 350*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 537, 237, 122, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 332*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 510, 235, 128, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 312*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 487, 234, 135, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 296*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 465, 233, 141, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 276*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+283, 445, 232, 147, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 259*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 427, 230, 154, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 244*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 410, 229, 160, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 228*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+287, 395, 228, 166, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 213*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 380, 227, 172, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 198*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 367, 225, 179, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 185*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 354, 224, 185, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 172*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+294, 343, 223, 191, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 161*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 332, 222, 197, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 150*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 322, 220, 204, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 140*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 312, 219, 210, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 130*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+301, 303, 218, 216, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+302, 294, 217, 223, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+304, 286, 215, 229, 122*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+306, 279, 214, 235, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+308, 271, 213, 241, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+309, 265, 212, 248, 127*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+311, 258, 211, 254, 129*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+313, 252, 209, 260, 131*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+315, 246, 208, 267, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+317, 240, 207, 273, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+319, 235, 206, 279, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+321, 230, 204, 285, 139*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+323, 225, 203, 292, 141*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 43*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+325, 220, 202, 298, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 38*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 308, 290, 65323, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+226, 318, 289, 65330, 44*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 136*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+227, 328, 288, 65336, 45*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 146*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+228, 339, 288, 65342, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 157*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 350, 287, 65349, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 168*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+229, 362, 286, 65355, 47*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+230, 376, 285, 65361, 48*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 194*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+231, 390, 284, 65368, 49*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 208*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+232, 405, 283, 65374, 50*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 223*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 421, 282, 65380, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+233, 439, 281, 65387, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 255*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 459, 280, 65393, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 480, 279, 65399, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 503, 278, 65406, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 307*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 529, 277, 65412, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 325*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 558, 276, 65418, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 346*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 589, 275, 65425, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 369*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 625, 274, 65431, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 393*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 665, 273, 65437, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 421*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 711, 272, 65444, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 447*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 763, 272, 65450, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 474*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+242, 824, 271, 65456, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 501*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 895, 270, 65463, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 532*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 980, 269, 65469, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 564*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 1082, 268, 65475, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 592*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 1208, 267, 65482, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 626*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 1368, 266, 65488, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 654*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 1576, 265, 65494, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 686*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 1860, 264, 65501, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 721*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 2267, 263, 65507, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 756*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 2903, 262, 65513, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 788*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 4033, 261, 65520, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 824*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 6608, 260, 65526, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 859*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 18272, 259, 65532, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 891*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 23883, 258, 3, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 905*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 7222, 257, 9, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 870*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 4254, 257, 15, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 834*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 3015, 256, 22, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 798*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 2335, 255, 28, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 764*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 1905, 254, 34, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 731*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 1609, 253, 41, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 697*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 1393, 252, 47, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 662*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 1227, 251, 53, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 630*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 1097, 250, 60, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 598*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 992, 249, 66, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 567*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 905, 248, 72, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 537*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 833, 247, 79, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 506*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 771, 246, 85, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 480*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 717, 245, 91, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 451*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 671, 244, 98, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 423*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 630, 243, 104, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 397*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 594, 242, 110, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 373*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 562, 241, 117, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 347*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 533, 241, 123, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 328*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 507, 240, 129, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 309*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 483, 239, 136, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 292*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+276, 461, 238, 142, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 273*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 442, 237, 148, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 257*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 424, 236, 155, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 242*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+279, 407, 235, 161, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 225*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 392, 234, 167, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 210*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 377, 233, 174, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 195*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 364, 232, 180, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 182*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 352, 231, 186, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 170*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+285, 340, 230, 193, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 158*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+286, 329, 229, 199, 104*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 147*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+287, 319, 228, 205, 105*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 137*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+288, 310, 227, 212, 106*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 128*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+289, 301, 226, 218, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+291, 292, 226, 224, 109*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+292, 284, 225, 231, 110*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+293, 277, 224, 237, 111*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+294, 269, 223, 243, 112*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+296, 263, 222, 250, 114*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+297, 256, 221, 256, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+298, 250, 220, 262, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+299, 244, 219, 269, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+301, 238, 218, 275, 119*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+302, 233, 217, 281, 120*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 51*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+303, 228, 216, 288, 121*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 46*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+234, 289, 280, 65310, 52*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 298, 279, 65316, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 116*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+235, 307, 278, 65322, 53*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 125*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+236, 316, 278, 65329, 54*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 326, 277, 65335, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+237, 337, 276, 65341, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 348, 276, 65348, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+238, 360, 275, 65354, 56*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 373, 275, 65360, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+239, 387, 274, 65367, 57*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 403, 273, 65373, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 221*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+240, 419, 273, 65380, 58*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 237*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 437, 272, 65386, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+241, 456, 271, 65392, 59*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 268*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+242, 477, 271, 65399, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 286*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 500, 270, 65405, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 304*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+243, 526, 270, 65411, 61*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 322*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 554, 269, 65418, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 343*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 586, 268, 65424, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 366*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 621, 268, 65431, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 391*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 661, 267, 65437, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 419*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 707, 266, 65443, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 445*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 759, 266, 65450, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 471*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 819, 265, 65456, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 499*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 890, 264, 65462, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 529*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 974, 264, 65469, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 560*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 1076, 263, 65475, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 590*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 1202, 263, 65481, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 621*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 1361, 262, 65488, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 652*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 1568, 261, 65494, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 683*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 1851, 261, 65501, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 719*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 2256, 260, 65507, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 753*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 2890, 259, 65513, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 786*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 4019, 259, 65520, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 821*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 6594, 258, 65526, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 858*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 18363, 258, 65532, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 893*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 23404, 257, 3, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 904*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 7147, 256, 9, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 867*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 4218, 256, 16, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 832*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 2991, 255, 22, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 795*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 2318, 254, 28, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 763*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 1892, 254, 35, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 728*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 1598, 253, 41, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 695*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 1383, 253, 47, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 658*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 1219, 252, 54, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 628*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 1090, 251, 60, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 596*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 986, 251, 66, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 565*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 899, 250, 73, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 533*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 827, 249, 79, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 503*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 766, 249, 86, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 476*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 713, 248, 92, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 448*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 666, 248, 98, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 422*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 626, 247, 105, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 394*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 590, 246, 111, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 370*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 558, 246, 117, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 346*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 529, 245, 124, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 325*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 503, 244, 130, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 307*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 480, 244, 137, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 289*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 459, 243, 143, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 271*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+270, 439, 243, 149, 88*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 255*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+271, 421, 242, 156, 89*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 239*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 404, 241, 162, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 222*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+272, 389, 241, 168, 90*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 207*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+273, 375, 240, 175, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 193*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 362, 239, 181, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 180*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+274, 350, 239, 188, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 168*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+275, 338, 238, 194, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 156*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+276, 327, 238, 200, 94*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 145*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 317, 237, 207, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 135*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+277, 308, 236, 213, 95*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 126*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+278, 299, 236, 219, 96*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 117*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+279, 290, 235, 226, 97*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 108*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 282, 234, 232, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+280, 275, 234, 238, 98*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 93*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+281, 268, 233, 245, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+282, 261, 232, 251, 100*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+283, 254, 232, 258, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+283, 248, 231, 264, 101*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+284, 242, 231, 270, 102*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 60*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+285, 237, 230, 277, 103*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 55*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+244, 273, 268, 65296, 62*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 91*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 281, 268, 65302, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 289, 267, 65309, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+245, 297, 267, 65315, 63*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 306, 267, 65322, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 315, 267, 65328, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 133*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 325, 266, 65334, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 143*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+246, 336, 266, 65341, 64*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 154*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 347, 266, 65347, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 165*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 359, 265, 65354, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 177*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+247, 372, 265, 65360, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 190*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 386, 265, 65366, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 204*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 402, 264, 65373, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 220*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+248, 418, 264, 65379, 66*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 236*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 436, 264, 65386, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 252*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 455, 263, 65392, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 267*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 476, 263, 65398, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 285*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+249, 499, 263, 65405, 67*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 303*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 525, 262, 65411, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 321*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 553, 262, 65418, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 342*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+250, 585, 262, 65424, 68*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 365*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 620, 262, 65430, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 390*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 660, 261, 65437, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 418*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+251, 705, 261, 65443, 69*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 443*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 757, 261, 65449, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 470*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 818, 260, 65456, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 498*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 889, 260, 65462, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 528*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+252, 973, 260, 65469, 70*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 559*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 1075, 259, 65475, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 589*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 1201, 259, 65481, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 620*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+253, 1361, 259, 65488, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 652*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 1569, 258, 65494, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 684*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 1852, 258, 65501, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 720*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+254, 2261, 258, 65507, 72*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 755*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 2900, 257, 65513, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 787*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 4044, 257, 65520, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 825*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+255, 6679, 257, 65526, 73*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 860*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 19166, 256, 65533, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 894*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 22045, 256, 3, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 901*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 6998, 256, 9, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 865*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+256, 4159, 256, 16, 74*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 830*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 2959, 255, 22, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 794*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 2296, 255, 29, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 759*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+257, 1876, 255, 35, 75*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 726*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 1586, 254, 41, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 690*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 1373, 254, 48, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 655*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+258, 1211, 254, 54, 76*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 627*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 1083, 253, 61, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 593*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 980, 253, 67, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 564*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+259, 894, 253, 73, 77*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 531*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 822, 252, 80, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 500*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 761, 252, 86, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 473*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+260, 709, 252, 92, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 446*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 663, 251, 99, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 420*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 623, 251, 105, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 392*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+261, 587, 251, 112, 79*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 367*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 555, 251, 118, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 344*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 527, 250, 124, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 323*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+262, 501, 250, 131, 80*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 305*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 478, 250, 137, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 287*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 456, 249, 144, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 268*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+263, 437, 249, 150, 81*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 253*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 419, 249, 156, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 237*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 403, 248, 163, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 221*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+264, 387, 248, 169, 82*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 205*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 373, 248, 176, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 191*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 360, 247, 182, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 178*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+265, 348, 247, 188, 83*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 166*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 337, 247, 195, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 155*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 326, 246, 201, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 144*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+266, 316, 246, 208, 84*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 134*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 306, 246, 214, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 124*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 297, 245, 220, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 115*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+267, 289, 245, 227, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 107*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 281, 245, 233, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 99*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 274, 245, 239, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 92*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+268, 267, 244, 246, 86*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 85*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 260, 244, 252, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 78*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 253, 244, 259, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 71*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+269, 247, 243, 265, 87*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES, 65*ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES,
+};
+
+#endif // _TAB_DELTAS_PERF_HASH_FOLDED_H_
@@ -22,6 +22,8 @@
  *   u16 hit_mapXY = (value >> MAP_HIT_OFFSET_MAPXY) & MAP_HIT_MASK_MAPXY;
  *   u16 hit_mapXY = (value >> MAP_HIT_OFFSET_SIDEDISTXY) & MAP_HIT_MASK_SIDEDISTXY;
  * 
+ * The table doesn't fit in the 4MB along with the rest of tables. See MAP_HIT_CODEC_BANKED in map_hit_compressed.h to place it into SSF2 banks.
+ * 
  * How to tell which side X or Y does hit_mapXY go?
  *   if (hit_mapXY < sideDistY)
  *       ...
@@ -0,0 +1,151 @@
+#ifndef _TAB_TILES_PAIR_H_
+#define _TAB_TILES_PAIR_H_
+
+#include <types.h>
+#include "consts.h"
+
+/*
+RENDER_SINGLE_PLANE_TILES_PAIR puts every pair of 4 px columns (even column in the left half, odd column in the right half)
+into a single tilemap entry of Plane A. Row r of the pair holds wall tiles tileA and tileB (tile index of what clear_buffer() +
+write_vline() would set in Plane A and Plane B regions), and this table gives the combined tile in VRAM for it:
+
+    u8 slot = tab_tiles_pair[tileA * TILES_PAIR_WALL_TILES + tileB];
+
+The slot is the index of the pair in tab_tiles_pair_dict.h, which is also its VRAM tile index. Pairs that don't fit in the
+dictionary get the visually nearest pair of the dictionary (see tab_tiles_pair_generator.js). Slot 0 is the empty pair.
+*/
+
+// Table body generated with script tab_tiles_pair_generator.js out of tiles_pair_generator.js output. Check correct values of constants before script execution.
+const u8 tab_tiles_pair[TILES_PAIR_WALL_TILES * TILES_PAIR_WALL_TILES] = {
+0,218,218,218,244,244,244,185,228,218,218,218,244,244,244,185,228,218,218,218,185,185,185,185,228,218,218,218,185,185,185,185,228,218,218,218,185,185,185,185,228,218,218,218,185,185,185,185,75,218,218,218,185,185,185,185,75,139,139,139,139,149,149,149,57,182,182,182,244,244,244,155,191,182,182,182,244,244,244,155,191,182,182,182,244,244,244,155,191,182,182,182,244,244,244,155,191,182,182,182,244,244,244,155,191,182,182,182,244,244,244,155,46,182,182,182,244,244,244,155,46,55,55,55,244,244,244,119,32,
+226,124,124,124,124,124,124,226,226,124,124,124,124,124,124,226,226,124,124,124,124,124,124,226,226,37,124,124,118,124,124,226,226,8,89,124,223,237,250,226,226,160,251,219,223,237,250,226,226,80,251,219,254,254,198,226,226,20,251,159,254,254,198,226,226,232,232,232,232,124,226,226,226,232,232,232,232,124,226,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,144,232,232,232,153,226,226,226,239,239,239,202,153,165,226,226,220,239,233,202,153,165,226,226,220,239,132,202,153,165,226,226,
+226,124,124,124,118,212,166,177,226,161,124,178,118,212,166,177,226,125,89,178,118,212,166,177,226,37,89,178,118,196,166,252,226,231,89,170,223,237,250,252,226,231,89,219,223,237,250,252,226,138,45,219,223,237,198,194,226,48,45,219,184,179,198,194,226,232,232,178,223,212,198,226,226,232,232,180,116,225,165,226,226,232,232,180,116,225,165,163,226,232,232,180,116,153,165,163,226,144,85,183,190,153,165,163,226,239,71,183,190,153,165,163,226,220,40,120,156,153,165,163,226,25,34,61,156,153,165,163,226,
+226,124,124,178,118,212,166,177,216,161,178,178,118,212,166,177,216,125,178,178,118,212,166,177,216,37,178,178,118,196,166,252,216,205,205,170,223,237,250,252,216,205,205,84,223,237,250,252,216,158,143,42,223,237,198,194,216,158,93,42,223,179,198,194,216,232,178,178,223,212,198,194,216,232,180,180,116,225,165,163,216,232,186,180,116,225,165,163,235,232,186,180,116,153,165,163,235,144,186,169,190,153,165,163,235,239,186,69,190,153,165,163,235,241,121,36,127,153,165,163,235,137,64,31,65,153,165,163,173,
+238,124,118,118,118,212,166,177,216,161,118,118,118,212,166,177,216,125,118,118,118,212,166,177,216,37,118,118,118,196,166,252,216,249,209,209,118,237,250,252,216,249,205,209,83,237,250,252,216,249,181,146,41,237,198,194,216,249,181,97,41,237,198,194,216,232,192,192,116,212,198,194,216,232,192,192,116,225,165,163,216,232,192,192,116,225,165,163,235,232,157,192,116,197,165,163,235,206,157,192,66,197,165,163,235,206,157,192,66,197,165,163,235,206,157,129,29,114,165,163,235,206,157,67,27,72,165,163,173,
+238,124,212,212,212,212,166,177,216,161,212,212,212,212,166,177,216,125,212,212,212,212,166,177,216,37,118,118,118,196,166,252,216,249,222,222,222,196,250,252,216,249,205,209,222,77,250,252,216,249,176,176,141,28,250,194,216,249,176,176,105,28,250,194,216,167,212,212,212,212,250,194,216,232,154,154,201,225,174,163,216,232,154,154,201,225,174,163,235,232,154,154,201,207,199,163,235,206,154,154,201,62,199,163,235,206,154,154,201,62,199,163,235,206,154,154,117,23,103,163,235,206,154,154,74,39,98,163,173,
+238,124,166,166,166,166,166,177,216,161,166,166,166,166,166,177,216,218,166,166,166,166,166,177,216,218,227,227,227,227,166,252,216,218,227,227,227,227,166,252,216,218,195,195,195,227,73,252,216,218,195,195,195,128,22,252,216,139,176,176,195,133,22,252,216,182,168,168,168,204,166,252,216,182,168,168,168,204,174,252,216,182,168,168,168,204,174,200,235,182,168,168,168,204,174,200,235,182,168,168,168,204,59,200,235,182,168,168,168,204,59,200,235,182,168,168,168,106,18,76,235,55,154,154,168,99,49,90,173,
+188,218,177,177,177,177,177,177,171,218,177,177,177,177,177,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,17,122,182,182,164,164,164,203,177,122,182,182,164,164,164,203,215,122,182,182,164,164,164,203,177,86,182,182,164,164,164,203,177,86,182,182,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,38,94,
+243,218,218,211,211,211,211,171,171,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,171,218,218,218,211,211,211,113,171,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,19,182,182,245,245,245,245,88,171,182,182,245,245,245,245,88,171,182,182,245,245,245,245,88,171,182,182,245,245,245,245,88,171,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,171,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+226,124,161,161,161,161,161,226,226,161,161,161,161,161,161,226,226,125,161,161,161,161,161,226,226,37,161,161,118,161,161,226,226,8,89,161,223,237,250,226,226,160,251,219,223,237,250,226,226,80,251,219,254,254,198,226,226,20,251,159,254,254,198,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,144,232,232,232,232,226,226,226,239,239,239,239,153,226,226,226,220,239,239,202,153,226,226,226,220,239,132,202,153,165,226,226,
+226,124,124,178,118,212,166,177,226,161,161,178,118,212,166,177,226,125,89,178,118,212,166,177,226,37,89,178,118,196,166,194,226,231,89,170,223,237,250,194,226,231,89,219,223,237,250,194,226,138,45,219,223,179,198,194,226,48,45,219,184,179,198,194,226,232,232,178,223,179,198,226,226,232,232,232,223,179,198,226,226,232,232,232,116,225,198,226,226,232,232,232,116,153,165,226,226,144,144,183,190,153,165,226,226,239,239,183,190,153,165,226,226,220,40,120,156,153,165,163,226,224,34,61,156,153,165,163,226,
+226,124,178,178,118,212,166,177,216,161,178,178,118,212,166,177,216,125,178,178,118,212,166,177,216,37,178,178,118,196,166,194,216,205,205,170,223,237,250,194,216,205,205,84,223,237,250,194,216,158,143,42,223,179,198,194,216,158,93,42,223,179,198,194,216,232,178,178,223,179,198,194,216,232,232,178,223,179,198,194,216,232,232,180,116,225,198,194,216,232,232,180,116,153,165,163,216,144,186,169,190,153,165,163,216,239,186,69,190,153,165,163,235,241,121,36,127,153,165,163,235,137,64,31,65,153,165,163,173,
+238,124,118,118,118,212,166,177,216,161,118,118,118,212,166,177,216,125,118,118,118,212,166,177,216,37,118,118,118,196,166,194,216,249,209,209,118,237,250,194,216,249,205,209,83,237,250,194,216,249,181,146,41,237,198,194,216,249,181,97,41,237,198,194,216,232,118,118,118,212,198,194,216,232,192,192,116,212,198,194,216,232,192,192,116,225,198,194,216,232,157,192,116,197,165,163,216,144,157,192,66,197,165,163,216,206,157,192,66,197,165,163,235,206,157,129,29,114,165,163,235,206,157,67,27,72,165,163,173,
+238,124,212,212,212,212,166,177,216,161,212,212,212,212,166,177,216,125,212,212,212,212,166,177,216,37,118,118,118,196,166,194,216,249,222,222,222,196,250,194,216,249,205,209,222,77,250,194,216,249,176,176,141,28,250,194,216,249,176,176,105,28,250,194,216,167,212,212,212,212,250,194,216,232,154,154,201,212,250,194,216,232,154,154,201,225,174,194,216,232,154,154,201,207,199,163,216,206,154,154,201,62,199,163,216,206,154,154,201,62,199,163,235,206,154,154,117,23,103,163,235,206,154,154,74,39,98,163,173,
+238,124,166,166,166,166,166,177,216,161,166,166,166,166,166,177,216,218,166,166,166,166,166,177,216,218,227,227,227,227,166,252,216,218,227,227,227,227,166,252,216,218,195,195,195,227,73,252,216,218,195,195,195,128,22,252,216,139,176,176,195,133,22,252,216,182,195,195,195,166,166,252,216,182,168,168,168,204,166,252,216,182,168,168,168,204,174,252,216,182,168,168,168,204,166,200,216,182,168,168,168,204,59,200,216,182,168,168,168,204,59,200,235,182,168,168,168,106,18,76,235,55,154,154,168,99,49,90,173,
+188,218,177,177,177,177,177,177,122,218,177,177,177,177,177,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,17,122,182,182,164,164,164,203,177,122,182,182,164,164,164,203,177,122,182,182,164,164,164,203,177,122,182,182,164,164,164,203,177,122,182,182,164,164,164,203,177,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,38,94,
+243,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,19,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,171,182,182,245,245,245,245,88,171,182,182,245,245,245,245,88,102,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+226,124,125,125,125,125,226,226,226,125,125,125,125,125,226,226,226,125,125,125,125,125,125,226,226,37,125,125,118,125,226,226,226,8,89,219,223,237,250,226,226,160,251,219,223,237,250,226,226,80,251,219,254,254,254,226,226,20,251,159,254,254,254,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,144,232,232,232,232,226,226,226,239,239,239,239,232,226,226,226,220,239,239,202,153,226,226,226,220,239,239,202,153,226,226,226,
+226,124,89,178,118,212,166,226,226,161,89,178,118,212,166,226,226,125,89,178,118,212,166,226,226,37,89,178,118,196,250,194,226,231,89,219,223,237,250,194,226,231,89,219,223,237,250,194,226,138,45,219,223,179,198,194,226,48,45,219,184,179,198,194,226,232,232,219,223,179,198,226,226,232,232,232,223,179,198,226,226,232,232,232,223,179,198,226,226,232,232,232,232,179,198,226,226,144,144,232,190,153,165,226,226,239,239,183,190,153,165,226,226,220,220,120,156,153,165,226,226,224,34,61,156,153,165,226,226,
+226,124,178,178,118,212,166,194,216,161,178,178,118,212,166,194,216,125,178,178,118,212,166,194,216,37,178,178,118,196,250,194,216,205,205,170,223,237,250,194,216,205,205,84,223,237,250,194,216,158,143,42,223,179,198,194,216,158,93,42,223,179,198,194,216,232,178,178,223,179,198,194,216,232,232,178,223,179,198,194,216,232,232,178,223,179,198,194,216,232,232,180,116,179,198,194,216,144,186,169,190,153,165,194,216,239,186,69,190,153,165,163,216,241,121,36,127,153,165,163,216,137,64,31,65,153,165,163,216,
+188,124,118,118,118,212,166,194,216,161,118,118,118,212,166,194,216,125,118,118,118,212,166,194,216,37,118,118,118,196,250,194,216,249,209,209,118,237,250,194,216,249,205,209,83,237,250,194,216,249,181,146,41,237,198,194,216,249,181,97,41,237,198,194,216,232,118,118,118,237,198,194,216,232,118,118,118,237,198,194,216,232,192,192,116,237,198,194,216,232,157,192,116,237,198,194,216,144,157,192,66,197,165,194,216,206,157,192,66,197,165,163,216,206,157,129,29,114,165,163,216,206,157,67,27,72,165,163,216,
+188,124,212,212,212,212,166,194,216,161,212,212,212,212,166,194,216,125,212,212,212,212,166,194,216,37,118,118,118,196,250,194,216,249,222,222,222,196,250,194,216,249,205,209,222,77,250,194,216,249,176,176,141,28,250,194,216,249,176,176,105,28,250,194,216,232,212,212,212,212,250,194,216,232,212,212,212,212,250,194,216,232,154,154,201,212,250,194,216,232,154,154,201,207,250,194,216,144,154,154,201,212,199,194,216,206,154,154,201,62,199,163,216,206,154,154,117,23,103,163,216,206,154,154,74,39,98,163,216,
+188,124,166,166,166,166,166,252,216,161,166,166,166,166,166,252,216,125,166,166,166,166,166,252,216,218,227,227,227,227,166,252,216,218,227,227,227,227,166,252,216,218,195,195,195,227,73,252,216,218,195,195,195,128,22,252,216,249,176,176,195,133,22,252,216,182,195,195,195,166,166,252,216,182,168,168,168,166,166,252,216,182,168,168,168,204,166,252,216,182,168,168,168,204,166,252,216,182,168,168,168,204,166,252,216,182,168,168,168,204,59,200,216,182,168,168,168,106,18,76,216,55,154,154,168,99,49,90,216,
+188,218,177,177,177,177,177,177,122,218,177,177,177,177,177,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,177,122,218,218,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,17,122,182,182,193,193,193,234,177,122,182,182,164,164,164,203,215,122,182,182,164,164,164,203,177,122,182,182,164,164,164,203,177,122,182,182,164,164,164,203,68,122,182,182,164,164,164,203,68,122,182,182,164,164,164,79,15,86,55,55,154,164,164,92,38,94,
+243,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,19,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+226,37,37,37,37,37,226,226,226,37,37,37,37,37,226,226,226,37,37,37,37,37,226,226,226,37,37,37,37,37,226,226,226,8,37,219,254,254,226,226,226,160,251,219,254,254,254,226,226,80,251,219,254,254,254,226,226,20,251,159,254,254,254,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,232,232,232,232,232,226,226,226,144,232,232,232,232,226,226,226,239,239,239,239,232,226,226,226,220,239,239,239,232,226,226,226,220,239,239,202,153,226,226,226,
+226,124,89,178,118,118,250,226,226,161,89,178,118,118,250,226,226,125,89,178,118,118,250,226,226,37,89,178,118,118,250,226,226,231,89,219,223,237,250,226,226,231,89,219,223,237,250,194,226,138,45,219,184,179,198,194,226,48,45,219,184,179,198,194,226,232,232,219,184,179,198,226,226,232,232,232,184,179,198,226,226,232,232,232,184,179,198,226,226,232,232,232,232,179,198,226,226,144,144,232,184,179,198,226,226,239,239,239,190,153,198,226,226,220,220,120,156,153,165,226,226,224,220,61,156,153,165,226,226,
+226,124,178,178,118,118,250,194,226,161,178,178,118,118,250,194,216,125,178,178,118,118,250,194,216,37,178,178,118,118,250,194,216,205,205,170,223,237,250,194,216,205,205,84,223,237,250,194,216,158,143,42,223,179,198,194,216,158,93,42,223,179,198,194,216,232,178,178,223,179,198,194,226,232,232,178,223,179,198,194,226,232,232,178,223,179,198,194,226,232,232,178,223,179,198,194,226,144,144,169,223,179,198,194,226,239,186,69,190,153,198,194,226,220,121,36,127,153,165,194,226,137,64,31,65,153,165,163,226,
+188,118,118,118,118,118,250,194,216,118,118,118,118,118,250,194,216,118,118,118,118,118,250,194,216,37,118,118,118,118,250,194,216,249,209,209,118,237,250,194,216,249,205,209,83,237,250,194,216,249,181,146,41,237,198,194,216,249,181,97,41,237,198,194,216,232,118,118,118,237,198,194,216,232,118,118,118,237,198,194,216,232,232,118,118,237,198,194,216,232,232,192,116,237,198,194,216,144,157,192,118,237,198,194,216,239,157,192,66,197,198,194,216,206,157,129,29,114,165,194,216,206,157,67,27,72,165,163,216,
+188,124,196,196,196,196,250,194,216,161,196,196,196,196,250,194,216,125,196,196,196,196,250,194,216,37,118,118,118,196,250,194,216,249,222,222,222,196,250,194,216,249,205,209,222,77,250,194,216,249,176,176,141,28,250,194,216,249,176,176,105,28,250,194,216,232,176,176,196,196,250,194,216,232,176,176,196,196,250,194,216,232,154,154,201,196,250,194,216,232,154,154,201,196,250,194,216,144,154,154,201,196,250,194,216,206,154,154,201,62,199,194,216,206,154,154,117,23,103,194,216,206,154,154,74,39,98,163,216,
+188,124,166,166,166,166,166,252,216,161,166,166,166,166,166,252,216,218,227,227,227,227,166,252,216,218,227,227,227,227,166,252,216,218,227,227,227,227,73,252,216,218,195,195,195,227,73,252,216,218,195,195,195,128,22,252,216,249,176,176,195,133,22,252,216,182,195,195,195,227,166,252,216,182,195,195,195,227,166,252,216,182,168,168,168,204,174,252,216,182,168,168,168,204,166,252,216,182,168,168,168,204,59,252,216,182,168,168,168,204,59,252,216,182,168,168,168,106,18,252,216,55,154,154,168,99,49,252,216,
+188,218,234,234,234,234,234,177,122,218,193,193,193,193,234,177,122,218,193,193,193,193,234,177,122,218,218,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,17,122,182,193,193,193,193,234,215,122,182,182,164,164,164,203,215,122,182,182,164,164,164,203,215,122,182,182,164,164,164,203,68,122,182,182,164,164,164,203,68,122,182,182,164,164,164,203,68,122,182,182,164,164,164,79,15,122,55,55,154,164,164,92,38,122,
+243,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,19,182,182,245,245,245,245,113,253,182,182,245,245,245,245,88,111,182,182,245,245,245,245,88,111,182,182,245,245,245,245,88,102,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+226,8,251,219,254,254,226,226,226,8,251,219,254,254,226,226,226,8,251,219,254,254,226,226,226,8,251,219,254,254,226,226,226,8,251,219,254,254,226,226,226,160,251,219,254,254,254,226,226,80,251,219,254,254,254,226,226,20,251,159,254,254,254,226,226,144,144,144,254,254,226,226,226,144,144,144,144,254,226,226,226,144,144,144,144,144,226,226,226,144,144,144,144,144,226,226,226,144,144,144,144,144,226,226,226,239,239,239,239,239,226,226,226,220,239,239,239,239,226,226,226,220,239,239,239,239,226,226,226,
+226,89,89,219,223,237,250,226,226,89,89,219,223,237,250,226,226,89,89,219,223,237,250,226,226,37,89,219,223,237,250,226,226,231,89,219,223,237,250,226,226,231,89,219,223,237,250,226,226,138,45,219,184,179,198,194,226,48,45,219,184,179,198,194,226,232,89,219,184,179,198,226,226,232,144,219,184,179,198,226,226,232,144,219,184,179,198,226,226,232,144,144,184,179,198,226,226,144,144,144,184,179,198,226,226,239,239,239,184,179,198,226,226,220,220,239,156,179,198,226,226,224,220,219,156,153,198,226,226,
+226,124,170,170,223,237,250,194,226,161,170,170,223,237,250,194,226,205,205,170,223,237,250,194,226,205,205,170,223,237,250,194,226,205,205,170,223,237,250,194,216,205,205,84,223,237,250,194,216,158,143,42,223,179,198,194,216,158,93,42,223,179,198,194,216,232,205,170,223,179,198,194,226,232,205,170,223,179,198,194,226,232,232,170,223,179,198,194,226,232,232,170,223,179,198,194,226,144,144,169,223,179,198,194,226,239,186,69,223,179,198,194,226,220,121,36,223,179,198,194,226,224,64,31,223,153,198,194,226,
+188,209,209,209,118,237,250,194,216,209,209,209,118,237,250,194,216,209,209,209,118,237,250,194,216,249,209,209,118,237,250,194,216,249,209,209,83,237,250,194,216,249,205,209,83,237,250,194,216,249,181,146,41,237,198,194,216,249,181,97,41,237,198,194,216,232,209,209,83,237,198,194,216,232,209,209,83,237,198,194,216,232,209,209,83,237,198,194,216,232,157,192,116,237,198,194,216,144,157,192,66,237,198,194,216,239,157,192,66,237,198,194,216,206,157,129,29,237,198,194,216,206,157,67,27,237,198,194,216,
+188,222,222,222,222,196,250,194,216,222,222,222,222,196,250,194,216,222,222,222,222,196,250,194,216,249,222,222,222,196,250,194,216,249,222,222,222,77,250,194,216,249,205,209,222,77,250,194,216,249,176,176,141,28,250,194,216,249,176,176,105,28,250,194,216,176,176,176,222,77,250,194,216,232,176,176,222,77,250,194,216,232,176,176,222,225,250,194,216,232,154,154,201,207,250,194,216,144,154,154,201,62,250,194,216,206,154,154,201,62,250,194,216,206,154,154,117,23,250,194,216,206,154,154,74,39,250,194,216,
+188,227,227,227,227,227,166,252,216,227,227,227,227,227,166,252,216,227,227,227,227,227,166,252,216,218,227,227,227,227,73,252,216,218,227,227,227,227,73,252,216,218,195,195,195,227,73,252,216,218,195,195,195,128,22,252,216,249,176,176,195,133,22,252,216,182,195,195,195,227,73,252,216,182,195,195,195,227,73,252,216,182,168,168,168,227,174,252,216,182,168,168,168,204,73,252,216,182,168,168,168,204,59,252,216,182,168,168,168,204,59,252,216,182,168,168,168,106,18,252,216,55,154,154,168,99,49,252,216,
+188,218,234,234,234,234,234,177,122,218,193,193,193,193,234,177,122,218,193,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,17,122,182,193,193,193,193,234,81,122,182,182,193,193,193,234,215,122,182,182,164,164,164,203,81,122,182,182,164,164,164,203,81,122,182,182,164,164,164,203,68,122,182,182,164,164,164,203,68,122,182,182,164,164,164,79,15,122,55,55,154,164,164,92,38,122,
+243,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,19,182,182,245,245,245,245,113,111,182,182,245,245,245,245,88,111,182,182,245,245,245,245,88,111,182,182,245,245,245,245,88,111,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,111,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+226,162,251,219,254,254,226,226,226,162,251,219,254,254,226,226,226,162,251,219,254,254,226,226,226,162,251,219,254,254,226,226,226,162,251,219,254,254,226,226,226,6,251,219,254,254,254,226,226,80,251,159,254,254,254,226,226,20,251,159,254,254,254,226,226,248,248,248,254,254,226,226,226,248,248,248,254,254,226,226,226,248,248,248,254,254,226,226,226,248,248,248,248,254,226,226,226,248,248,248,248,248,226,226,226,47,47,47,47,47,226,226,226,220,220,220,220,220,226,226,226,220,220,220,220,254,226,226,226,
+226,231,89,219,219,219,198,226,226,231,89,219,219,219,198,226,226,231,89,219,219,219,198,226,226,231,89,219,219,219,198,226,226,231,89,219,219,219,198,226,226,231,91,219,219,219,198,226,226,138,45,219,184,179,198,226,226,48,45,219,184,179,198,226,226,248,91,219,184,179,198,226,226,248,248,219,184,179,198,226,226,248,248,219,184,179,198,226,226,248,248,219,184,179,198,226,226,248,248,219,184,179,198,226,226,47,47,47,184,179,198,226,226,220,220,219,184,179,198,226,226,224,220,219,184,179,198,226,226,
+226,205,205,84,223,223,198,194,226,205,205,84,223,223,198,194,226,205,205,84,223,223,198,194,226,205,205,84,223,223,198,194,226,205,205,84,223,223,198,194,226,205,205,84,223,223,198,194,226,158,143,42,223,179,198,194,226,158,93,42,223,179,198,194,216,248,205,84,223,179,198,194,226,248,205,84,223,179,198,194,226,248,205,84,223,179,198,194,226,248,248,84,223,179,198,194,226,248,248,84,223,179,198,194,226,47,47,69,223,179,198,194,226,220,121,36,223,179,198,194,226,224,64,31,223,179,198,194,226,
+188,209,209,209,83,237,198,194,216,209,209,209,83,237,198,194,216,209,209,209,83,237,198,194,216,249,209,209,83,237,198,194,216,249,209,209,83,237,198,194,216,249,205,209,83,237,198,194,216,249,181,146,41,237,198,194,216,249,181,97,41,237,198,194,216,249,209,209,83,237,198,194,216,248,209,209,83,237,198,194,216,248,209,209,83,237,198,194,216,248,209,209,83,237,198,194,216,248,157,192,83,237,198,194,216,47,157,192,66,237,198,194,216,206,157,129,29,237,198,194,216,206,157,67,27,237,198,194,216,
+188,222,222,222,222,77,250,194,216,222,222,222,222,77,250,194,216,222,222,222,222,77,250,194,216,249,222,222,222,77,250,194,216,249,222,222,222,77,250,194,216,249,205,209,222,77,250,194,216,249,176,176,141,28,250,194,216,249,176,176,105,28,250,194,216,176,176,176,222,77,250,194,216,176,176,176,222,77,250,194,216,232,176,176,222,77,250,194,216,232,154,154,222,77,250,194,216,248,154,154,201,77,250,194,216,47,154,154,201,62,250,194,216,206,154,154,117,23,250,194,216,206,154,154,74,39,250,194,216,
+188,227,227,227,227,227,73,252,216,227,227,227,227,227,73,252,216,227,227,227,227,227,73,252,216,249,227,227,227,227,73,252,216,249,227,227,227,227,73,252,216,249,195,195,195,227,73,252,216,249,195,195,195,128,22,252,216,249,176,176,195,133,22,252,216,195,195,195,195,227,73,252,216,182,195,195,195,227,73,252,216,182,195,195,195,227,73,252,216,182,168,168,168,204,73,252,216,182,168,168,168,204,73,252,216,182,168,168,168,204,59,252,216,182,168,168,168,106,18,252,216,55,154,154,168,99,49,252,216,
+188,218,234,234,234,234,234,81,122,218,193,193,193,193,234,81,122,218,193,193,193,193,234,81,122,218,193,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,17,122,182,193,193,193,193,234,81,122,182,182,193,193,193,234,81,122,182,182,164,164,164,234,81,122,182,182,164,164,164,203,81,122,182,182,164,164,164,203,81,122,182,182,164,164,164,203,68,122,182,182,164,164,164,79,15,122,55,55,154,164,164,92,38,122,
+82,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,211,211,211,211,113,111,218,218,218,211,211,211,113,19,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,19,182,182,211,211,211,211,113,253,182,182,245,245,245,245,113,19,182,182,245,245,245,245,88,19,182,182,245,245,245,245,88,19,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+226,87,140,159,254,254,226,226,226,87,140,159,254,254,226,226,226,87,140,159,254,254,226,226,226,87,140,159,254,254,226,226,226,87,140,159,254,254,226,226,226,87,140,159,254,254,254,226,226,4,140,159,254,254,254,226,226,20,140,159,254,254,254,226,226,240,240,159,254,254,226,226,226,240,240,159,254,254,226,226,226,240,240,240,254,254,226,226,226,240,240,240,254,254,226,226,226,240,240,240,254,254,226,226,226,240,240,240,240,254,226,226,226,11,11,11,11,254,226,226,226,224,224,224,224,254,226,226,226,
+226,231,45,148,184,179,198,226,226,231,45,148,184,179,198,226,226,231,45,148,184,179,198,226,226,231,45,148,184,179,198,226,226,231,45,148,184,179,198,226,226,231,45,148,184,179,198,226,226,138,45,148,184,179,198,226,226,48,45,148,184,179,198,226,226,248,45,148,184,179,198,226,226,248,45,148,184,179,198,226,226,248,240,148,184,179,198,226,226,248,240,148,184,179,198,226,226,248,240,148,184,179,198,226,226,240,240,148,184,179,198,226,226,11,11,11,184,179,198,226,226,224,224,148,184,179,198,226,226,
+226,205,205,42,150,179,198,194,226,205,205,42,150,179,198,194,226,205,205,42,150,179,198,194,226,205,205,42,150,179,198,194,226,205,205,42,150,179,198,194,226,158,205,42,150,179,198,194,226,158,143,42,150,179,198,194,226,158,93,42,150,179,198,194,226,158,143,42,150,179,198,194,226,248,143,42,150,179,198,194,226,248,143,42,150,179,198,194,226,248,143,42,150,179,198,194,226,248,248,42,150,179,198,194,226,240,186,42,150,179,198,194,226,11,11,36,150,179,198,194,226,224,64,31,150,179,198,194,226,
+188,249,209,209,41,145,198,194,216,249,209,209,41,145,198,194,216,249,209,209,41,145,198,194,216,249,181,209,41,145,198,194,216,249,181,209,41,145,198,194,216,249,181,209,41,145,198,194,216,249,181,146,41,145,198,194,216,249,181,97,41,145,198,194,216,249,181,146,41,145,198,194,216,249,181,146,41,145,198,194,216,248,181,146,41,145,198,194,216,248,181,146,41,145,198,194,216,248,157,192,41,145,198,194,216,240,157,192,41,145,198,194,216,11,157,129,29,145,198,194,216,206,157,67,27,145,198,194,216,
+188,249,222,222,222,28,136,194,216,249,176,176,222,28,136,194,216,249,176,176,222,28,136,194,216,249,176,176,222,28,136,194,216,249,176,176,222,28,136,194,216,249,176,176,222,28,136,194,216,249,176,176,141,28,136,194,216,249,176,176,105,28,136,194,216,176,176,176,141,28,136,194,216,176,176,176,141,28,136,194,216,176,176,176,141,28,136,194,216,232,176,176,141,28,136,194,216,248,154,154,201,28,136,194,216,206,154,154,201,28,136,194,216,206,154,154,117,23,136,194,216,206,154,154,74,28,136,194,216,
+188,195,195,195,195,227,22,112,216,195,195,195,195,227,22,112,216,249,195,195,195,227,22,112,216,249,195,195,195,227,22,112,216,249,195,195,195,227,22,112,216,249,195,195,195,227,22,112,216,249,195,195,195,128,22,112,216,249,176,176,195,133,22,112,216,195,195,195,195,128,22,112,216,182,195,195,195,128,22,112,216,182,195,195,195,128,22,112,216,182,195,195,195,128,22,112,216,182,168,168,168,204,22,112,216,182,168,168,168,204,22,112,216,182,168,168,168,106,18,112,216,55,154,154,168,99,22,112,216,
+188,218,193,193,193,193,234,17,122,218,193,193,193,193,234,17,122,218,193,193,193,193,234,17,122,218,193,193,193,193,234,17,122,218,193,193,193,193,234,17,122,218,218,193,193,193,234,17,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,17,122,182,193,193,193,193,108,17,122,182,193,193,193,193,108,17,122,182,182,193,193,193,108,17,122,182,182,164,164,164,203,17,122,182,182,164,164,164,203,17,122,182,182,164,164,164,203,17,122,182,182,164,164,164,79,15,122,55,55,154,164,164,92,17,122,
+82,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,218,211,211,211,113,19,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,19,182,182,211,211,211,211,113,19,182,182,245,245,245,245,113,19,182,182,245,245,245,245,88,19,182,182,245,245,245,245,88,19,182,182,182,245,245,245,88,19,182,182,182,245,245,245,88,19,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,19,
+147,21,53,159,254,254,147,147,147,21,53,159,254,254,147,147,147,21,53,159,254,254,254,147,147,21,53,159,254,254,254,147,147,21,53,159,254,254,254,147,147,21,53,159,254,254,254,147,147,21,53,159,254,254,254,147,147,2,53,159,254,254,254,147,147,240,53,159,254,254,147,147,147,240,240,159,254,254,147,147,147,240,240,159,254,254,147,147,147,240,240,159,254,254,147,147,147,240,240,240,254,254,147,147,147,240,240,240,254,254,147,147,147,9,9,9,254,254,147,147,147,9,9,9,254,254,147,147,147,
+147,231,45,96,184,179,179,147,147,231,45,96,184,179,179,147,147,231,45,96,184,179,179,147,147,231,45,96,184,179,179,147,147,231,45,96,184,179,179,147,147,231,45,96,184,179,179,147,147,138,45,96,184,179,179,147,147,48,56,96,184,179,179,147,147,248,56,96,184,179,179,147,147,248,56,96,184,179,179,147,147,248,56,96,184,179,179,147,147,248,240,96,184,179,179,147,147,248,240,96,184,179,179,147,147,240,240,96,184,179,179,147,147,11,9,96,184,179,179,147,147,9,9,9,184,179,179,147,147,
+147,158,205,42,101,179,179,179,147,158,205,42,101,179,179,179,147,158,205,42,101,179,179,179,147,158,205,42,101,179,179,179,147,158,205,42,101,179,179,179,147,158,205,42,101,179,179,179,147,158,143,42,101,179,179,179,147,158,93,52,101,179,179,179,147,158,93,52,101,179,179,179,147,158,93,52,101,179,179,179,147,248,93,52,101,179,179,179,147,248,93,52,101,179,179,179,147,248,186,52,101,179,179,179,147,240,186,52,101,179,179,179,147,11,121,36,101,179,179,179,147,9,9,31,101,179,179,179,147,
+147,249,181,209,41,109,198,194,194,249,181,209,41,109,198,194,194,249,181,209,41,109,198,194,194,249,181,209,41,109,198,194,194,249,181,209,41,109,198,194,194,249,181,209,41,109,198,194,194,249,181,146,41,109,198,194,194,249,181,97,50,109,198,194,194,249,181,97,50,109,198,194,194,249,181,97,50,109,198,194,194,249,181,97,50,109,198,194,194,249,181,97,50,109,198,194,194,248,181,192,50,109,198,194,194,240,157,192,50,109,198,194,194,206,157,129,29,109,198,194,194,206,157,67,27,109,198,194,194,
+151,249,176,176,222,28,135,194,194,249,176,176,222,28,135,194,194,249,176,176,222,28,135,194,194,249,176,176,222,28,135,194,194,249,176,176,222,28,135,194,194,249,176,176,222,28,135,194,194,249,176,176,141,28,135,194,194,249,176,176,105,63,135,194,194,176,176,176,105,63,135,194,194,176,176,176,105,63,135,194,194,176,176,176,105,63,135,194,194,176,176,176,105,63,135,194,194,206,176,176,201,63,135,194,194,206,154,154,201,62,135,194,194,206,154,154,117,23,135,194,194,206,154,154,74,39,135,194,194,
+151,195,195,195,195,227,22,126,216,195,195,195,195,227,22,126,216,249,195,195,195,227,22,126,216,249,195,195,195,227,22,126,216,249,195,195,195,227,22,126,216,249,195,195,195,227,22,126,216,249,195,195,195,128,22,126,216,249,176,176,195,133,78,126,216,195,195,195,195,133,78,126,216,182,195,195,195,133,78,126,216,182,195,195,195,133,78,126,216,182,195,195,195,133,78,126,216,182,168,168,168,204,78,126,216,182,168,168,168,204,59,126,216,182,168,168,168,106,18,126,216,55,154,154,168,99,49,126,216,
+151,218,193,193,193,193,234,17,131,218,193,193,193,193,234,17,131,218,193,193,193,193,234,17,131,218,193,193,193,193,234,17,131,218,193,193,193,193,234,17,131,218,218,193,193,193,234,17,131,218,218,193,193,193,108,17,131,139,139,176,193,193,123,60,131,182,193,193,193,193,123,60,131,182,193,193,193,193,123,60,131,182,182,193,193,193,123,60,131,182,182,164,164,164,203,60,131,182,182,164,164,164,203,60,131,182,182,164,164,164,203,60,131,182,182,164,164,164,79,15,131,55,55,154,164,164,92,38,131,
+58,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,211,211,211,211,113,19,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,70,182,182,211,211,211,211,130,70,182,182,245,245,245,245,130,70,182,182,245,245,245,245,88,70,182,182,245,245,245,245,88,70,182,182,182,245,245,245,88,70,182,182,182,245,245,245,88,70,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+172,236,236,236,236,167,172,172,172,236,236,236,236,167,172,172,172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,142,236,236,236,179,172,172,172,54,236,236,254,179,198,172,172,229,229,159,254,179,198,172,172,229,229,159,254,179,198,172,172,167,167,167,167,167,167,172,172,167,167,167,167,167,167,172,172,134,167,167,167,167,167,172,172,33,167,167,116,167,167,172,172,210,247,247,247,197,199,172,172,110,247,183,190,197,199,172,172,35,247,233,202,202,165,172,172,14,247,233,202,202,165,172,172,
+172,236,236,178,190,212,165,172,172,236,236,178,118,212,198,172,172,236,236,178,118,212,198,172,172,236,236,178,118,179,198,194,172,142,89,219,223,179,198,194,172,54,91,219,223,179,198,194,172,229,45,148,184,179,198,194,172,48,56,96,184,179,198,194,172,167,167,167,116,225,174,215,172,189,167,180,116,225,174,215,172,134,85,180,116,225,174,215,172,246,85,180,116,207,174,200,172,246,85,169,190,197,199,200,172,214,71,183,190,197,199,200,172,107,40,183,190,197,165,163,172,25,34,183,156,153,165,163,172,
+172,236,178,178,190,212,165,163,235,236,178,178,118,212,198,163,235,236,205,178,118,212,198,194,235,236,205,178,118,179,198,194,235,142,205,170,223,179,198,194,235,54,205,84,223,179,198,194,216,158,143,42,150,179,198,194,216,158,93,52,101,179,198,194,216,167,167,180,116,225,174,215,235,189,180,180,116,225,174,215,235,134,180,180,116,225,174,215,235,246,180,180,116,207,174,200,235,246,186,169,190,197,199,200,235,241,186,69,190,197,199,200,235,241,121,36,190,197,165,163,235,137,64,31,190,153,165,163,235,
+238,236,209,209,116,212,165,163,235,236,209,209,118,212,198,163,235,236,209,209,118,212,198,194,235,236,181,209,118,196,198,194,235,249,181,209,83,237,198,194,235,249,181,209,83,237,198,194,216,249,181,146,41,145,198,194,216,249,181,97,50,109,198,194,216,167,116,116,116,225,174,215,235,189,116,116,116,225,174,215,235,134,116,116,116,225,174,215,235,246,116,116,116,207,174,200,235,246,192,192,116,197,199,200,235,206,186,192,66,197,199,200,235,206,157,129,29,197,165,163,235,206,157,67,27,197,165,163,235,
+238,124,212,212,212,212,199,163,235,236,176,176,212,212,166,163,235,236,176,176,222,212,166,194,235,236,176,176,222,196,250,194,235,249,176,176,222,77,250,194,235,249,176,176,222,77,250,194,216,249,176,176,141,28,136,194,216,249,176,176,105,63,135,194,216,167,225,225,225,225,174,215,235,189,225,225,225,225,174,215,235,134,225,225,225,225,174,215,235,246,116,116,116,207,174,200,235,246,201,201,201,207,199,200,235,206,186,192,201,62,199,200,235,206,154,154,117,23,199,163,235,206,154,154,74,23,199,163,235,
+238,218,195,195,195,227,166,200,235,218,195,195,195,227,166,200,235,218,195,195,195,227,166,252,235,218,195,195,195,227,166,252,235,218,195,195,195,227,73,252,235,218,195,195,195,227,73,252,216,218,195,195,195,128,22,112,216,139,176,176,195,133,78,126,216,167,174,174,174,174,174,215,235,189,174,174,174,174,174,215,235,182,174,174,174,174,174,215,235,182,204,204,204,204,174,200,235,182,204,204,204,204,174,200,235,182,168,168,168,204,59,200,235,182,168,168,168,106,18,200,235,55,154,154,168,99,18,200,235,
+152,218,218,193,193,193,234,177,86,218,218,193,193,193,234,177,86,218,218,193,193,193,234,177,86,218,218,193,193,193,234,215,122,218,218,193,193,193,234,81,122,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,60,131,182,215,215,215,215,215,215,253,182,215,215,215,215,215,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,15,86,
+187,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,253,218,218,211,211,211,211,113,253,218,218,218,211,211,211,113,253,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,253,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,70,182,182,245,245,245,245,253,253,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,253,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,16,
+172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,142,236,236,236,236,172,172,172,54,236,236,236,179,172,172,172,229,229,229,254,179,172,172,172,229,229,159,254,179,172,172,172,167,189,189,189,189,189,172,172,189,189,189,189,189,189,172,172,134,189,189,189,189,174,172,172,33,189,180,116,189,174,172,172,210,247,247,247,197,199,172,172,110,247,183,190,197,199,172,172,35,247,233,202,202,165,172,172,14,247,233,202,202,165,172,172,
+172,236,236,180,190,153,165,172,172,236,236,236,190,153,165,172,172,236,236,236,118,212,165,172,172,236,236,236,118,179,198,172,172,142,142,219,223,179,198,172,172,54,91,219,223,179,198,172,172,229,45,148,184,179,198,194,172,242,56,96,184,179,198,194,172,167,167,180,116,225,174,215,172,189,189,180,116,225,174,215,172,134,85,180,116,225,174,163,172,246,85,180,116,207,174,163,172,246,85,169,190,197,199,163,172,214,71,183,190,197,199,163,172,107,40,183,190,153,165,163,172,25,34,183,156,153,165,163,172,
+172,236,180,180,190,153,165,163,235,236,236,178,190,153,165,163,235,236,236,178,118,212,165,163,235,236,236,178,118,179,198,163,235,142,205,170,223,179,198,194,235,54,205,84,223,179,198,194,235,158,143,42,150,179,198,194,235,158,93,52,101,179,198,194,235,167,180,180,116,225,174,215,235,189,180,180,116,225,174,215,235,134,180,180,116,225,174,163,235,246,180,180,116,207,174,163,235,246,186,169,190,197,199,163,235,241,186,69,190,197,199,163,235,241,121,36,190,153,165,163,235,137,64,31,190,153,165,163,235,
+238,236,116,116,116,197,165,163,235,236,209,209,116,197,165,163,235,236,209,209,118,212,165,163,235,236,181,209,118,196,198,163,235,142,181,209,83,237,198,194,235,249,181,209,83,237,198,194,235,249,181,146,41,145,198,194,235,249,181,97,50,109,198,194,235,167,116,116,116,225,174,215,235,189,116,116,116,225,174,215,235,134,116,116,116,225,174,163,235,246,116,116,116,207,174,163,235,246,192,192,116,197,199,163,235,206,186,192,66,197,199,163,235,206,157,129,29,197,165,163,235,206,157,67,27,197,165,163,235,
+238,124,225,225,225,225,199,163,235,236,176,176,212,212,199,163,235,236,176,176,222,212,166,163,235,236,176,176,222,196,250,163,235,249,176,176,222,77,250,194,235,249,176,176,222,77,250,194,235,249,176,176,141,28,136,194,235,249,176,176,105,63,135,194,235,167,225,225,225,225,174,215,235,189,225,225,225,225,174,215,235,134,225,225,225,225,174,163,235,246,116,116,116,207,174,163,235,246,201,201,201,207,199,163,235,206,186,192,201,62,199,163,235,206,154,154,117,23,199,163,235,206,154,154,74,23,199,163,235,
+238,218,168,168,168,174,174,200,235,218,195,195,195,227,166,200,235,218,195,195,195,227,166,200,235,218,195,195,195,227,166,200,235,218,195,195,195,227,73,252,235,218,195,195,195,227,73,252,235,218,195,195,195,128,22,112,235,139,176,176,195,133,78,126,235,167,174,174,174,174,174,215,235,189,174,174,174,174,174,215,235,182,174,174,174,174,174,200,235,182,204,204,204,204,174,200,235,182,204,204,204,204,174,200,235,182,168,168,168,204,59,200,235,182,168,168,168,106,18,200,235,55,154,154,168,99,18,200,235,
+152,218,218,164,164,164,234,215,86,218,218,193,193,193,234,177,86,218,218,193,193,193,234,215,86,218,218,193,193,193,234,215,86,218,218,193,193,193,234,215,86,218,218,193,193,193,234,81,122,218,218,193,193,193,108,17,122,139,139,176,193,193,123,60,131,182,215,215,215,215,215,215,86,182,215,215,215,215,215,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,15,86,
+187,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,253,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,70,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,16,
+172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,142,236,236,236,236,172,172,172,54,236,236,236,236,172,172,172,229,229,229,254,179,172,172,172,229,229,229,254,179,172,172,172,134,134,134,134,134,172,172,172,134,134,134,134,134,172,172,172,134,134,134,134,134,134,172,172,33,134,134,116,134,172,172,172,210,247,247,247,247,199,172,172,110,247,183,190,197,199,172,172,35,247,233,202,202,202,172,172,14,247,233,202,202,202,172,172,
+172,236,236,183,190,153,165,172,172,236,236,236,190,153,165,172,172,236,236,236,190,153,165,172,172,236,236,236,236,153,165,172,172,142,142,236,223,179,165,172,172,54,54,219,223,179,198,172,172,229,229,148,184,179,198,172,172,242,56,96,184,179,198,172,172,167,85,180,116,225,174,172,172,189,85,180,116,225,174,172,172,134,85,180,116,225,174,172,172,246,85,180,116,207,199,163,172,246,85,183,190,197,199,163,172,214,71,183,190,197,199,163,172,107,40,183,190,153,165,163,172,25,34,183,156,153,165,163,172,
+172,236,180,180,190,153,165,163,235,236,236,180,190,153,165,163,235,236,236,178,190,153,165,163,235,236,236,178,118,153,165,163,235,142,205,170,223,179,165,163,235,54,205,84,223,179,198,163,235,229,143,42,150,179,198,194,235,158,93,52,101,179,198,194,235,167,180,180,116,225,174,163,235,189,180,180,116,225,174,163,235,134,180,180,116,225,174,163,235,246,180,180,116,207,199,163,235,246,186,169,190,197,199,163,235,241,186,69,190,197,199,163,235,241,121,36,190,153,165,163,235,137,64,31,190,153,165,163,235,
+238,236,116,116,116,197,165,163,235,236,116,116,116,197,165,163,235,236,209,209,116,197,165,163,235,236,181,209,118,197,165,163,235,142,181,209,83,237,165,163,235,249,181,209,83,237,198,163,235,249,181,146,41,145,198,194,235,249,181,97,50,109,198,194,235,167,116,116,116,225,174,163,235,189,116,116,116,225,174,163,235,134,116,116,116,225,174,163,235,246,116,116,116,207,199,163,235,246,192,192,116,197,199,163,235,206,186,192,66,197,199,163,235,206,157,129,29,197,165,163,235,206,157,67,27,197,165,163,235,
+238,236,225,225,225,225,199,163,235,236,225,225,225,225,199,163,235,236,176,176,222,212,199,163,235,236,176,176,222,196,199,163,235,142,176,176,222,225,250,163,235,249,176,176,222,77,250,163,235,249,176,176,141,28,136,194,235,249,176,176,105,63,135,194,235,167,225,225,225,225,174,163,235,189,225,225,225,225,174,163,235,134,225,225,225,225,174,163,235,246,116,116,116,207,199,163,235,246,201,201,201,207,199,163,235,206,186,192,201,62,199,163,235,206,154,154,117,23,199,163,235,206,154,154,74,23,199,163,235,
+238,218,168,168,168,174,174,200,235,218,195,195,195,174,174,200,235,218,195,195,195,227,166,200,235,218,195,195,195,227,174,200,235,218,195,195,195,227,174,200,235,218,195,195,195,227,73,252,235,218,195,195,195,128,22,112,235,139,176,176,195,133,78,126,235,167,174,174,174,174,174,200,235,174,174,174,174,174,174,200,235,134,174,174,174,174,174,200,235,182,204,204,204,204,174,200,235,182,204,204,204,204,174,200,235,182,168,168,168,204,59,200,235,182,168,168,168,106,18,200,235,206,154,154,168,99,18,200,235,
+152,218,164,164,164,164,203,177,86,218,218,193,193,193,234,177,86,218,218,193,193,193,234,177,86,218,218,193,193,193,234,215,86,218,218,193,193,193,234,81,86,218,218,193,193,193,234,81,86,218,218,193,193,193,108,17,86,139,139,176,193,193,123,60,86,182,215,215,215,215,215,215,86,182,164,164,164,164,203,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,215,86,182,182,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,15,86,
+187,218,218,245,245,245,245,88,171,218,218,211,211,211,211,113,171,218,218,211,211,211,211,113,102,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,70,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,16,
+172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,236,236,236,236,236,172,172,172,142,236,236,236,236,172,172,172,54,236,236,236,236,172,172,172,229,229,229,236,236,172,172,172,229,229,229,254,179,172,172,172,33,247,247,247,247,172,172,172,33,247,247,247,247,172,172,172,33,247,247,247,247,172,172,172,33,247,247,247,247,172,172,172,210,247,247,247,247,172,172,172,110,247,183,202,202,202,172,172,35,247,233,202,202,202,172,172,14,247,233,202,202,202,172,172,
+172,236,236,183,156,153,165,172,172,236,236,236,156,153,165,172,172,236,236,236,156,153,165,172,172,236,236,236,236,153,165,172,172,142,142,236,156,153,165,172,172,54,54,219,223,153,165,172,172,229,229,148,184,179,198,172,172,242,229,96,184,179,198,172,172,167,85,180,116,116,199,172,172,189,85,180,116,116,199,172,172,134,85,180,116,116,199,172,172,246,85,180,116,116,199,172,172,246,85,183,190,197,199,172,172,214,71,183,190,197,199,163,172,107,40,183,156,153,165,163,172,25,34,183,156,153,165,163,172,
+172,236,180,180,190,153,165,163,235,236,236,180,190,153,165,163,235,236,236,180,190,153,165,163,235,236,236,178,190,153,165,163,235,142,142,170,190,153,165,163,235,54,205,84,223,153,165,163,235,229,143,42,150,179,198,163,235,158,93,52,101,179,198,163,235,167,180,180,116,116,199,163,235,180,180,180,116,116,199,163,235,134,180,180,116,116,199,163,235,246,180,180,116,116,199,163,235,246,186,169,190,197,199,163,235,241,186,69,190,197,199,163,235,241,121,36,190,153,165,163,235,137,64,31,190,153,165,163,235,
+238,236,116,116,116,197,165,163,235,236,116,116,116,197,165,163,235,236,236,116,116,197,165,163,235,236,236,209,116,197,165,163,235,142,181,209,116,197,165,163,235,249,181,209,83,237,165,163,235,249,181,146,41,145,198,163,235,249,181,97,50,109,198,163,235,116,116,116,116,116,199,163,235,116,116,116,116,116,199,163,235,116,116,116,116,116,199,163,235,246,116,116,116,116,199,163,235,246,192,192,116,197,199,163,235,206,186,192,66,197,199,163,235,206,157,129,29,197,165,163,235,206,157,67,27,197,165,163,235,
+238,236,154,154,201,207,199,163,235,236,154,154,201,207,199,163,235,236,176,176,222,207,199,163,235,236,176,176,222,196,199,163,235,142,176,176,222,207,199,163,235,249,176,176,222,77,199,163,235,249,176,176,141,28,136,163,235,249,176,176,105,63,135,163,235,167,207,207,207,207,199,163,235,189,207,207,207,207,199,163,235,134,207,207,207,207,199,163,235,246,116,116,116,207,199,163,235,246,201,201,201,207,199,163,235,206,186,192,201,62,199,163,235,206,154,154,117,23,199,163,235,206,154,154,74,23,199,163,235,
+238,218,168,168,168,204,174,200,235,218,168,168,168,204,166,200,235,218,195,195,195,227,166,200,235,218,195,195,195,227,166,200,235,218,195,195,195,227,73,200,235,218,195,195,195,227,73,200,235,218,195,195,195,128,22,200,235,139,176,176,195,133,78,200,235,167,174,174,174,174,174,200,235,174,174,174,174,174,174,200,235,182,204,204,204,204,174,200,235,182,204,204,204,204,174,200,235,182,204,204,204,204,59,200,235,182,168,168,168,204,59,200,235,182,168,168,168,106,18,200,235,206,154,154,168,99,18,200,235,
+152,218,164,164,164,164,203,177,86,218,218,164,164,164,203,177,86,218,218,193,193,193,234,177,86,218,218,193,193,193,234,68,86,218,218,193,193,193,234,81,86,218,218,193,193,193,234,81,86,218,218,193,193,193,108,17,86,139,139,176,193,193,123,60,86,182,203,203,203,203,203,215,86,182,164,164,164,164,203,215,86,182,164,164,164,164,203,215,86,182,182,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,15,86,
+187,218,218,245,245,245,245,88,171,218,218,211,211,211,211,113,102,218,218,211,211,211,211,113,102,218,218,218,211,211,211,113,102,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,19,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,70,182,182,245,245,245,245,88,253,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,182,245,245,245,88,102,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,16,
+172,142,142,142,202,202,172,172,172,142,142,142,142,202,172,172,172,142,142,142,142,142,172,172,172,142,142,142,142,142,172,172,172,142,142,142,142,142,172,172,172,54,142,142,142,142,172,172,172,229,229,229,229,142,172,172,172,229,229,229,229,202,172,172,172,208,247,247,247,247,172,172,172,208,247,247,247,247,172,172,172,208,247,247,247,247,172,172,172,208,247,247,247,247,172,172,172,7,247,247,247,247,172,172,172,110,247,233,202,202,202,172,172,35,247,233,202,202,202,172,172,14,247,233,202,202,202,172,172,
+172,236,85,183,156,153,165,172,172,236,142,183,156,153,165,172,172,236,142,183,156,153,165,172,172,236,142,142,156,153,165,172,172,142,142,142,156,153,165,172,172,54,54,142,156,153,165,172,172,229,229,183,156,153,165,172,172,242,229,183,184,179,165,172,172,246,85,183,190,197,199,172,172,246,85,183,190,197,199,172,172,246,85,183,190,197,199,172,172,246,85,183,190,197,199,172,172,246,85,183,190,197,199,172,172,214,71,183,190,197,199,172,172,107,40,183,156,153,165,163,172,25,34,183,156,153,165,163,172,
+172,236,186,169,190,153,165,163,172,236,186,169,190,153,165,163,172,236,236,169,190,153,165,163,172,236,236,169,190,153,165,163,172,142,142,169,190,153,165,163,172,54,205,84,190,153,165,163,172,229,143,42,190,153,165,163,172,242,93,52,190,179,165,163,172,246,169,169,190,197,199,163,172,246,169,169,190,197,199,163,235,246,186,169,190,197,199,163,235,246,186,169,190,197,199,163,235,246,186,169,190,197,199,163,235,241,186,69,190,197,199,163,235,241,121,36,190,153,165,163,235,137,64,31,190,153,165,163,235,
+238,236,192,192,66,197,165,163,235,236,192,192,66,197,165,163,235,236,192,192,66,197,165,163,235,236,181,209,118,197,165,163,235,142,181,209,66,197,165,163,235,54,181,209,83,197,165,163,235,249,181,146,41,197,165,163,235,249,181,97,50,197,165,163,235,246,192,192,116,197,199,163,235,246,192,192,116,197,199,163,235,246,192,192,116,197,199,163,235,246,192,192,116,197,199,163,235,246,192,192,66,197,199,163,235,206,186,192,66,197,199,163,235,206,157,129,29,197,165,163,235,206,157,67,27,197,165,163,235,
+238,154,154,154,201,62,199,163,235,236,154,154,201,62,199,163,235,236,154,154,201,212,199,163,235,236,176,176,222,196,199,163,235,142,176,176,222,62,199,163,235,249,176,176,222,77,199,163,235,249,176,176,141,28,199,163,235,249,176,176,105,63,199,163,235,201,201,201,201,207,199,163,235,201,201,201,201,207,199,163,235,246,201,201,201,207,199,163,235,246,201,201,201,207,199,163,235,246,201,201,201,62,199,163,235,206,186,192,201,62,199,163,235,206,154,154,117,23,199,163,235,206,154,154,74,23,199,163,235,
+238,218,168,168,168,204,59,200,235,218,168,168,168,204,59,200,235,218,168,168,168,204,166,200,235,218,195,195,195,227,59,200,235,218,195,195,195,227,59,200,235,218,195,195,195,227,73,200,235,218,195,195,195,128,22,200,235,139,176,176,195,133,78,200,235,204,204,204,204,204,174,200,235,204,204,204,204,204,174,200,235,204,204,204,204,204,174,200,235,182,204,204,204,204,59,200,235,182,204,204,204,204,59,200,235,182,168,168,168,204,59,200,235,182,168,168,168,106,18,200,235,206,154,154,168,99,18,200,235,
+152,218,164,164,164,164,203,68,86,218,218,164,164,164,203,177,86,218,218,193,193,193,234,68,86,218,218,193,193,193,234,68,86,218,218,193,193,193,234,68,86,218,218,193,193,193,234,81,86,218,218,193,193,193,108,17,86,139,139,176,193,193,123,60,86,182,203,203,203,203,203,215,86,182,164,164,164,164,203,215,86,182,164,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,15,86,
+187,218,218,245,245,245,245,88,102,218,218,211,211,211,211,88,102,218,218,211,211,211,211,113,102,218,218,218,211,211,211,113,102,218,218,218,211,211,211,113,102,218,218,218,211,211,211,113,102,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,70,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,16,
+172,230,230,230,202,202,172,172,172,230,230,230,202,202,172,172,172,230,230,230,202,202,172,172,172,230,230,230,230,202,172,172,172,230,230,230,230,202,172,172,172,54,54,54,54,54,172,172,172,229,229,229,229,202,172,172,172,229,229,229,229,202,172,172,172,100,213,233,202,202,172,172,172,100,213,233,202,202,172,172,172,100,213,233,202,202,172,172,172,100,213,233,202,202,172,172,172,100,213,233,202,202,172,172,172,5,213,233,202,202,202,172,172,35,213,233,202,202,202,172,172,14,213,233,202,202,202,172,172,
+172,230,71,183,156,153,165,172,172,230,230,183,156,153,165,172,172,230,230,183,156,153,165,172,172,230,230,183,156,153,165,172,172,230,230,183,156,153,165,172,172,54,54,54,156,153,165,172,172,229,229,183,156,153,165,172,172,242,229,183,156,153,165,172,172,246,71,183,183,183,165,172,172,246,71,183,183,183,165,172,172,246,71,183,183,183,165,172,172,246,71,183,183,183,165,172,172,246,71,183,183,183,165,172,172,214,71,183,183,183,165,172,172,107,40,183,156,153,165,172,172,25,34,183,156,153,165,172,172,
+172,230,186,69,190,153,165,163,172,230,186,69,190,153,165,163,172,230,186,69,190,153,165,163,172,230,230,69,190,153,165,163,172,230,230,69,190,153,165,163,172,54,54,69,190,153,165,163,172,229,143,42,190,153,165,163,172,242,93,52,190,153,165,163,172,186,186,69,190,190,165,163,172,186,186,69,190,190,165,163,172,186,186,69,190,190,165,163,172,186,186,69,190,190,165,163,172,241,186,69,190,190,165,163,235,241,186,69,190,190,165,163,235,241,121,36,190,153,165,163,235,137,64,31,190,153,165,163,235,
+238,206,192,192,66,197,165,163,235,230,192,192,66,197,165,163,235,230,192,192,66,197,165,163,235,230,192,192,66,197,165,163,235,230,181,209,66,197,165,163,235,54,181,209,66,197,165,163,235,229,181,146,41,197,165,163,235,249,181,97,50,197,165,163,235,192,192,192,66,197,165,163,235,192,192,192,66,197,165,163,235,192,192,192,66,197,165,163,235,206,192,192,66,197,165,163,235,206,192,192,66,197,165,163,235,206,186,192,66,197,165,163,235,206,157,129,29,197,165,163,235,206,157,67,27,197,165,163,235,
+238,154,154,154,201,62,199,163,235,154,154,154,201,62,199,163,235,230,154,154,201,62,199,163,235,230,154,154,201,62,199,163,235,230,176,176,222,62,199,163,235,54,176,176,222,62,199,163,235,249,176,176,141,28,199,163,235,249,176,176,105,62,199,163,235,201,201,201,201,62,199,163,235,201,201,201,201,62,199,163,235,201,201,201,201,62,199,163,235,206,201,201,201,62,199,163,235,206,201,201,201,62,199,163,235,206,186,192,201,62,199,163,235,206,154,154,117,23,199,163,235,206,154,154,74,23,199,163,235,
+238,168,168,168,168,204,59,200,235,218,168,168,168,204,59,200,235,218,168,168,168,204,59,200,235,218,195,195,195,204,59,200,235,218,195,195,195,227,59,200,235,218,195,195,195,227,59,200,235,218,195,195,195,128,22,200,235,139,176,176,195,133,59,200,235,204,204,204,204,204,59,200,235,204,204,204,204,204,59,200,235,204,204,204,204,204,59,200,235,206,204,204,204,204,59,200,235,206,204,204,204,204,59,200,235,206,168,168,168,204,59,200,235,206,168,168,168,106,18,200,235,206,154,154,168,99,18,200,235,
+152,218,164,164,164,164,203,68,86,218,218,164,164,164,203,68,86,218,218,164,164,164,203,68,86,218,218,193,193,193,234,68,86,218,218,193,193,193,234,68,86,218,218,193,193,193,234,68,86,218,218,193,193,193,108,17,86,139,139,176,193,193,123,60,86,182,203,203,203,203,203,68,86,182,164,164,164,164,203,68,86,182,164,164,164,164,203,68,86,182,164,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,203,68,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,15,86,
+44,218,218,245,245,245,245,88,171,218,218,245,245,245,245,88,16,218,218,211,211,211,211,113,16,218,218,218,211,211,211,113,16,218,218,218,211,211,211,113,111,218,218,218,211,211,211,113,16,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,70,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,102,182,182,245,245,245,245,88,16,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,16,
+172,221,221,233,202,202,172,172,172,221,221,233,202,202,172,172,172,221,221,233,202,202,172,172,172,221,221,221,202,202,172,172,172,221,221,221,202,202,172,172,172,221,221,221,202,202,172,172,172,12,12,12,12,202,172,172,172,242,242,242,202,202,172,172,172,30,255,233,202,202,172,172,172,30,255,233,202,202,172,172,172,30,255,233,202,202,172,172,172,30,255,233,202,202,172,172,172,30,255,233,202,202,172,172,172,30,255,233,202,202,202,172,172,3,104,233,202,202,202,172,172,14,104,233,202,202,202,172,172,
+172,230,40,120,156,153,165,172,172,230,40,120,156,153,165,172,172,230,221,120,156,153,165,172,172,230,221,120,156,153,165,172,172,230,221,120,156,153,165,172,172,221,221,120,156,153,165,172,172,12,12,12,156,153,165,172,172,242,242,120,156,153,165,172,172,246,40,120,156,153,165,172,172,246,40,120,156,153,165,172,172,246,40,120,156,153,165,172,172,246,40,120,156,153,165,172,172,246,40,120,156,153,165,172,172,214,40,120,156,153,165,172,172,107,40,120,156,153,165,172,172,25,34,120,156,153,165,172,172,
+172,241,121,36,127,153,165,163,172,230,121,36,127,153,165,163,172,230,121,36,127,153,165,163,172,230,121,36,127,153,165,163,172,230,230,36,127,153,165,163,172,221,205,36,127,153,165,163,172,12,12,36,127,153,165,163,172,242,93,36,127,153,165,163,172,241,186,36,127,153,165,163,172,241,186,36,127,153,165,163,172,241,186,36,127,153,165,163,172,241,186,36,127,153,165,163,172,241,186,36,127,153,165,163,172,241,186,36,127,153,165,163,172,241,121,36,127,153,165,163,172,137,64,31,127,153,165,163,172,
+238,206,157,129,29,114,165,163,235,206,157,129,29,114,165,163,235,206,157,129,29,114,165,163,235,230,157,129,29,114,165,163,235,230,157,209,29,114,165,163,235,221,181,209,29,114,165,163,235,12,181,146,29,114,165,163,235,249,181,97,29,114,165,163,235,206,192,192,29,114,165,163,235,206,192,192,29,114,165,163,235,206,192,192,29,114,165,163,235,206,157,192,29,114,165,163,235,206,157,192,29,114,165,163,235,206,157,192,29,114,165,163,235,206,157,129,29,114,165,163,235,206,157,67,27,114,165,163,235,
+238,154,154,154,117,23,103,163,235,154,154,154,117,23,103,163,235,154,154,154,117,23,103,163,235,230,154,154,117,23,103,163,235,230,176,176,222,23,103,163,235,221,176,176,222,23,103,163,235,249,176,176,141,23,103,163,235,249,176,176,105,23,103,163,235,206,201,201,201,23,103,163,235,206,154,154,201,23,103,163,235,206,154,154,201,23,103,163,235,206,154,154,201,23,103,163,235,206,154,154,201,23,103,163,235,206,154,154,201,23,103,163,235,206,154,154,117,23,103,163,235,206,154,154,74,23,103,163,235,
+238,168,168,168,168,106,18,76,235,218,168,168,168,106,18,76,235,218,168,168,168,106,18,76,235,218,168,168,168,106,18,76,235,218,195,195,195,227,18,76,235,218,195,195,195,227,18,76,235,218,195,195,195,128,18,76,235,139,176,176,195,133,18,76,235,168,168,168,168,204,18,76,235,168,168,168,168,204,18,76,235,206,168,168,168,204,18,76,235,206,168,168,168,204,18,76,235,206,168,168,168,204,18,76,235,206,168,168,168,204,18,76,235,206,168,168,168,106,18,76,235,206,154,154,168,99,18,76,235,
+152,218,164,164,164,164,79,15,86,218,164,164,164,164,79,15,86,218,218,164,164,164,79,15,86,218,218,193,193,193,234,15,86,218,218,193,193,193,234,15,86,218,218,193,193,193,234,15,86,218,218,193,193,193,108,15,86,139,139,176,193,193,123,15,86,182,164,164,164,164,203,15,86,182,164,164,164,164,203,15,86,182,164,164,164,164,203,15,86,182,164,164,164,164,203,15,86,182,164,164,164,164,203,15,86,182,182,164,164,164,203,15,86,182,182,164,164,164,79,15,86,55,55,154,164,164,92,15,86,
+44,218,218,245,245,245,245,88,16,218,218,245,245,245,245,88,16,218,218,211,211,211,211,88,16,218,218,218,211,211,211,113,16,218,218,218,211,211,211,113,16,218,218,218,211,211,211,113,16,218,218,218,211,211,211,113,16,139,139,139,193,193,211,130,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,16,
+51,217,24,132,202,202,51,51,51,217,217,132,202,202,51,51,51,217,217,132,202,202,51,51,51,217,217,132,202,202,51,51,51,217,217,217,202,202,51,51,51,217,217,217,202,202,51,51,51,217,217,217,202,202,51,51,51,10,10,10,202,202,51,51,51,13,255,132,202,202,51,51,51,13,255,132,202,202,51,51,51,13,255,132,202,202,202,51,51,13,255,132,202,202,202,51,51,13,255,132,202,202,202,51,51,13,255,132,202,202,202,51,51,13,24,132,202,202,202,51,51,1,24,132,202,202,202,51,51,
+51,230,34,61,156,153,153,51,51,230,34,61,156,153,153,51,51,230,34,61,156,153,153,51,51,230,217,61,156,153,153,51,51,230,217,61,156,153,153,51,51,221,217,61,156,153,153,51,51,217,217,61,156,153,153,51,51,10,10,10,156,153,153,51,51,246,34,61,156,153,153,51,51,246,34,61,156,153,153,51,51,246,34,61,156,153,153,51,51,246,34,61,156,153,153,51,51,246,34,61,156,153,153,51,51,214,34,61,156,153,153,51,51,107,34,61,156,153,153,51,51,25,34,61,156,153,153,51,51,
+51,137,64,31,65,153,153,153,51,137,64,31,65,153,153,153,51,230,64,31,65,153,153,153,51,230,64,31,65,153,153,153,51,230,205,31,65,153,153,153,51,221,205,31,65,153,153,153,51,217,143,31,65,153,153,153,51,10,10,31,65,153,153,153,51,241,186,31,65,153,153,153,51,241,186,31,65,153,153,153,51,241,186,31,65,153,153,153,51,241,186,31,65,153,153,153,51,241,186,31,65,153,153,153,51,241,186,31,65,153,153,153,51,241,121,31,65,153,153,153,51,137,64,31,65,153,153,153,51,
+238,206,157,67,27,72,165,163,163,206,157,67,27,72,165,163,163,206,157,67,27,72,165,163,163,206,157,67,27,72,165,163,163,230,157,209,27,72,165,163,163,221,181,209,27,72,165,163,163,217,181,146,27,72,165,163,163,249,181,97,27,72,165,163,163,206,157,192,27,72,165,163,163,206,157,192,27,72,165,163,163,206,157,192,27,72,165,163,163,206,157,192,27,72,165,163,163,206,157,192,27,72,165,163,163,206,157,192,27,72,165,163,163,206,157,129,27,72,165,163,163,206,157,67,27,72,165,163,163,
+238,154,154,154,74,39,98,163,163,154,154,154,74,39,98,163,163,154,154,154,74,39,98,163,163,154,154,154,74,39,98,163,163,230,154,154,222,39,98,163,163,249,176,176,222,39,98,163,163,249,176,176,141,28,98,163,163,249,176,176,105,39,98,163,163,206,154,154,201,23,98,163,163,206,154,154,201,23,98,163,163,206,154,154,201,23,98,163,163,206,154,154,201,23,98,163,163,206,154,154,201,23,98,163,163,206,154,154,201,23,98,163,163,206,154,154,117,23,98,163,163,206,154,154,74,39,98,163,163,
+238,168,168,168,168,99,49,90,173,168,168,168,168,99,49,90,173,218,168,168,168,99,49,90,173,218,168,168,168,99,49,90,173,218,195,195,195,227,49,90,173,218,195,195,195,227,49,90,173,218,195,195,195,128,22,90,173,139,176,176,195,133,49,90,173,168,168,168,168,204,18,90,173,168,168,168,168,204,18,90,173,206,168,168,168,204,18,90,173,206,168,168,168,204,18,90,173,206,168,168,168,204,18,90,173,206,168,168,168,204,18,90,173,206,168,168,168,106,18,90,173,206,154,154,168,99,49,90,173,
+115,218,164,164,164,164,92,38,94,218,164,164,164,164,92,38,94,218,218,164,164,164,92,38,94,218,218,164,164,164,234,38,94,218,218,193,193,193,234,38,94,218,218,193,193,193,234,38,94,218,218,193,193,193,108,17,94,139,139,176,193,193,123,38,94,182,164,164,164,164,203,15,94,182,164,164,164,164,203,15,94,182,164,164,164,164,203,15,94,182,164,164,164,164,203,15,94,182,164,164,164,164,203,15,94,182,182,164,164,164,203,15,94,182,182,164,164,164,79,15,94,55,55,154,164,164,92,38,94,
+26,218,218,175,175,175,175,95,43,218,218,175,175,175,175,95,43,218,218,211,211,211,211,95,43,218,218,218,211,211,211,113,43,218,218,218,211,211,211,113,43,218,218,218,211,211,211,113,43,218,218,218,211,211,211,113,19,139,139,139,193,193,211,130,43,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,245,245,245,245,88,16,182,182,182,245,245,245,88,16,55,55,55,164,164,175,95,43,
+};
+
+#endif // _TAB_TILES_PAIR_H_
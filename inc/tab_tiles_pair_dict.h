@@ -0,0 +1,33 @@
+#ifndef _TAB_TILES_PAIR_DICT_H_
+#define _TAB_TILES_PAIR_DICT_H_
+
+#include <types.h>
+#include "consts.h"
+
+/*
+Dictionary of combined tiles used by RENDER_SINGLE_PLANE_TILES_PAIR (see tab_tiles_pair.h). Entry s is the pair of wall tiles
+(tileA, tileB) loaded into VRAM tile s: left 4 columns of pixels from tileA, right 4 columns from tileB (see render_loadTiles()).
+Slot 0 is the empty pair. Remaining slots are the most frequent pairs along all positions and angles.
+*/
+
+// Table body generated with script tab_tiles_pair_generator.js out of tiles_pair_generator.js output. Check correct values of constants before script execution.
+const u8 tab_tiles_pair_dict[TILES_PAIR_DICT_SIZE * 2] = {
+0,0,121,121,57,57,113,113,49,49,105,105,41,41,97,97,33,33,57,121,121,57,49,113,113,49,121,113,113,121,119,119,
+120,120,55,55,118,118,56,56,49,57,57,49,54,54,117,117,121,122,122,121,128,0,124,124,53,53,116,116,113,105,123,123,
+0,128,89,89,122,122,105,113,115,115,25,25,127,127,125,125,114,114,52,52,51,51,128,128,120,0,50,50,0,120,41,105,
+58,57,126,126,60,60,121,0,59,59,57,58,105,41,0,121,58,58,0,64,64,0,110,110,63,63,122,123,109,109,61,61,
+123,122,123,124,108,108,124,123,111,111,107,107,64,64,106,106,124,125,46,46,125,124,0,56,118,119,45,45,62,62,119,118,
+41,49,47,47,56,0,44,44,43,43,98,98,119,120,49,41,120,119,34,34,126,127,42,42,127,126,59,58,127,128,128,127,
+58,59,60,59,125,126,126,125,105,97,59,60,104,104,117,118,113,114,61,60,118,117,114,113,55,54,60,61,97,105,40,40,
+54,55,56,55,116,117,127,0,92,92,117,116,28,28,0,127,114,115,115,114,55,56,63,62,1,1,17,17,62,63,115,116,
+54,53,116,115,64,63,63,64,121,123,62,61,81,81,61,62,53,54,123,121,50,49,0,57,49,50,53,52,97,33,51,50,
+33,97,52,53,52,51,57,0,50,51,0,63,51,52,63,0,119,0,123,125,125,123,0,119,122,124,124,122,59,57,57,59,
+33,41,9,9,41,33,125,127,127,125,124,126,22,22,65,65,126,124,99,99,35,35,8,8,113,0,126,128,86,86,128,126,
+61,59,15,15,27,27,59,61,91,91,60,58,0,113,106,107,58,60,0,55,107,106,104,0,55,0,73,73,107,108,0,104,
+108,107,63,61,61,63,62,60,29,29,108,109,60,62,109,110,110,111,109,108,121,124,111,110,110,109,43,42,124,121,93,93,
+97,89,44,43,89,97,64,62,21,21,105,106,106,105,79,79,62,64,121,49,0,49,42,43,41,113,113,41,45,44,43,44,
+49,121,85,85,49,0,46,45,0,40,105,49,105,33,42,41,25,89,113,115,47,46,118,120,89,25,44,45,126,0,33,105,
+49,105,115,113,113,57,40,0,0,126,120,118,98,97,97,98,41,97,60,57,45,46,41,42,46,47,72,72,57,60,113,106,
+};
+
+#endif // _TAB_TILES_PAIR_DICT_H_
@@ -0,0 +1,287 @@
+#ifndef _TAB_WALL_HIT_FUSED_H_
+#define _TAB_WALL_HIT_FUSED_H_
+
+#include <types.h>
+#include "consts.h"
+
+/*
+Content for tab_wall_hit_X_fused[]:
+
+    u16 h2 = tab_wall_div[sideDistX];
+    u16 tileAttrib = tab_color_d8_1_X_pals_shft[sideDistX*2 + (mapY&1)];
+    u32 h2_tileAttrib = (h2 << 16) | tileAttrib;
+
+Content for tab_wall_hit_Y_fused[]:
+
+    u16 h2 = tab_wall_div[sideDistY];
+    u16 tileAttrib = tab_color_d8_1_Y_pals_shft[sideDistY*2 + (mapX&1)];
+    u32 h2_tileAttrib = (h2 << 16) | tileAttrib;
+*/
+
+// Table body generated with script tab_wall_hit_fused_generator.js. Check correct values of constants before script execution.
+// The values are interleaved: use (2*sideDistX + (mapY&1)) to access the desired value.
+const u32 tab_wall_hit_X_fused[2 * (FP * (STEP_COUNT + 1))] = {
+0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,
+0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,
+0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,
+0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00000039,0x00000079,0x00010039,0x00010079,0x00010039,0x00010079,0x00020039,0x00020079,0x00030039,0x00030079,0x00040039,0x00040079,0x00040039,0x00040079,0x00050039,0x00050079,0x00060039,0x00060079,0x00070039,0x00070079,0x00070039,0x00070079,0x00080039,0x00080079,0x00090039,0x00090079,0x00090039,0x00090079,0x000A0039,0x000A0079,0x000B0039,0x000B0079,0x000B0039,0x000B0079,0x000C0039,0x000C0079,
+0x000D0039,0x000D0079,0x000D0039,0x000D0079,0x000E0039,0x000E0079,0x000E0039,0x000E0079,0x000F0039,0x000F0079,0x00100039,0x00100079,0x00100039,0x00100079,0x00110039,0x00110079,0x00110039,0x00110079,0x00120039,0x00120079,0x00120039,0x00120079,0x00130039,0x00130079,0x00130039,0x00130079,0x00140039,0x00140079,0x00140039,0x00140079,0x00150039,0x00150079,0x00150039,0x00150079,0x00160039,0x00160079,0x00160039,0x00160079,0x00170039,0x00170079,0x00170039,0x00170079,0x00180039,0x00180079,0x00180039,0x00180079,0x00190039,0x00190079,0x00190039,0x00190079,0x001A0039,0x001A0079,0x001A0039,0x001A0079,0x001A0039,0x001A0079,0x001B0039,0x001B0079,0x001B0039,0x001B0079,0x001C0039,0x001C0079,0x001C0039,0x001C0079,
+0x001C0039,0x001C0079,0x001D0039,0x001D0079,0x001D0039,0x001D0079,0x001E0039,0x001E0079,0x001E0039,0x001E0079,0x001E0039,0x001E0079,0x001F0039,0x001F0079,0x001F0039,0x001F0079,0x001F0039,0x001F0079,0x00200039,0x00200079,0x00200039,0x00200079,0x00200039,0x00200079,0x00210039,0x00210079,0x00210039,0x00210079,0x00210039,0x00210079,0x00220039,0x00220079,0x00220039,0x00220079,0x00220039,0x00220079,0x00230039,0x00230079,0x00230039,0x00230079,0x00230039,0x00230079,0x00240039,0x00240079,0x00240039,0x00240079,0x00240039,0x00240079,0x00250039,0x00250079,0x00250039,0x00250079,0x00250039,0x00250079,0x00260039,0x00260079,0x00260039,0x00260079,0x00260039,0x00260079,0x00260039,0x00260079,0x00270039,0x00270079,
+0x00270039,0x00270079,0x00270039,0x00270079,0x00270039,0x00270079,0x00280039,0x00280079,0x00280039,0x00280079,0x00280039,0x00280079,0x00290039,0x00290079,0x00290039,0x00290079,0x00290039,0x00290079,0x00290039,0x00290079,0x002A0039,0x002A0079,0x002A0039,0x002A0079,0x002A0039,0x002A0079,0x002A0039,0x002A0079,0x002B0039,0x002B0079,0x002B0039,0x002B0079,0x002B0039,0x002B0079,0x002B0039,0x002B0079,0x002B0039,0x002B0079,0x002C0039,0x002C0079,0x002C0039,0x002C0079,0x002C0039,0x002C0079,0x002C0039,0x002C0079,0x002D0039,0x002D0079,0x002D0039,0x002D0079,0x002D0039,0x002D0079,0x002D0039,0x002D0079,0x002D0039,0x002D0079,0x002E0039,0x002E0079,0x002E0039,0x002E0079,0x002E0039,0x002E0079,0x002E0039,0x002E0079,
+0x002E0039,0x002E0079,0x002F0039,0x002F0079,0x002F0039,0x002F0079,0x002F0039,0x002F0079,0x002F0039,0x002F0079,0x002F0039,0x002F0079,0x00300039,0x00300079,0x00300039,0x00300079,0x00300039,0x00300079,0x00300039,0x00300079,0x00300039,0x00300079,0x00310039,0x00310079,0x00310039,0x00310079,0x00310039,0x00310079,0x00310039,0x00310079,0x00310039,0x00310079,0x00320039,0x00320079,0x00320039,0x00320079,0x00320039,0x00320079,0x00320039,0x00320079,0x00320039,0x00320079,0x00320039,0x00320079,0x00330039,0x00330079,0x00330039,0x00330079,0x00330039,0x00330079,0x00330039,0x00330079,0x00330039,0x00330079,0x00330039,0x00330079,0x00340039,0x00340079,0x00340039,0x00340079,0x00340039,0x00340079,0x00340039,0x00340079,
+0x00340031,0x00340071,0x00340031,0x00340071,0x00340031,0x00340071,0x00350031,0x00350071,0x00350031,0x00350071,0x00350031,0x00350071,0x00350031,0x00350071,0x00350031,0x00350071,0x00350031,0x00350071,0x00360031,0x00360071,0x00360031,0x00360071,0x00360031,0x00360071,0x00360031,0x00360071,0x00360031,0x00360071,0x00360031,0x00360071,0x00360031,0x00360071,0x00360031,0x00360071,0x00370031,0x00370071,0x00370031,0x00370071,0x00370031,0x00370071,0x00370031,0x00370071,0x00370031,0x00370071,0x00370031,0x00370071,0x00370031,0x00370071,0x00380031,0x00380071,0x00380031,0x00380071,0x00380031,0x00380071,0x00380031,0x00380071,0x00380031,0x00380071,0x00380031,0x00380071,0x00380031,0x00380071,0x00380031,0x00380071,
+0x00390031,0x00390071,0x00390031,0x00390071,0x00390031,0x00390071,0x00390031,0x00390071,0x00390031,0x00390071,0x00390031,0x00390071,0x00390031,0x00390071,0x00390031,0x00390071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003A0031,0x003A0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003B0031,0x003B0071,0x003C0031,0x003C0071,0x003C0031,0x003C0071,0x003C0031,0x003C0071,0x003C0031,0x003C0071,0x003C0031,0x003C0071,
+0x003C0031,0x003C0071,0x003C0031,0x003C0071,0x003C0031,0x003C0071,0x003C0031,0x003C0071,0x003C0031,0x003C0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003D0031,0x003D0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003E0031,0x003E0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,
+0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x003F0031,0x003F0071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00400031,0x00400071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,0x00410031,0x00410071,
+0x00410031,0x00410071,0x00410031,0x00410071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00420031,0x00420071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,0x00430031,0x00430071,
+0x00430031,0x00430071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00440031,0x00440071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,
+0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00450031,0x00450071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00460031,0x00460071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,
+0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00470031,0x00470071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,0x00480031,0x00480071,
+0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00480029,0x00480069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,
+0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x00490029,0x00490069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,
+0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004A0029,0x004A0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,
+0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004B0029,0x004B0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,
+0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004C0029,0x004C0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,
+0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004D0029,0x004D0069,
+0x004D0029,0x004D0069,0x004D0029,0x004D0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,
+0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004E0029,0x004E0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,0x004F0029,0x004F0069,
+0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,
+0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x004F0021,0x004F0061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,
+0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,
+0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00500021,0x00500061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,
+0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,
+0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,
+0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00510021,0x00510061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,
+0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,0x00520021,0x00520061,
+0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,
+0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00520019,0x00520059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,
+0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,
+0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,
+0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,
+0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00530019,0x00530059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,
+0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,
+0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,0x00540019,0x00540059,
+0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,
+0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,
+0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00540011,0x00540051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,
+0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,
+0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,
+0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,
+0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,
+0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,0x00550011,0x00550051,
+0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,
+0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00550009,0x00550049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,
+0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,
+0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,
+0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,
+0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,
+0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,
+0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,0x00560009,0x00560049,
+0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,
+0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,
+0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00560001,0x00560041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,
+0x00570001,0x00570041,0x00570001,0x00570041,0x00570001,0x00570041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,
+0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00580001,0x00580041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,0x00590001,0x00590041,
+};
+
+// Table body generated with script tab_wall_hit_fused_generator.js. Check correct values of constants before script execution.
+// The values are interleaved: use (2*sideDistY + (mapX&1)) to access the desired value.
+const u32 tab_wall_hit_Y_fused[2 * (FP * (STEP_COUNT + 1))] = {
+0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,
+0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,
+0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,
+0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00002039,0x00002079,0x00012039,0x00012079,0x00012039,0x00012079,0x00022039,0x00022079,0x00032039,0x00032079,0x00042039,0x00042079,0x00042039,0x00042079,0x00052039,0x00052079,0x00062039,0x00062079,0x00072039,0x00072079,0x00072039,0x00072079,0x00082039,0x00082079,0x00092039,0x00092079,0x00092039,0x00092079,0x000A2039,0x000A2079,0x000B2039,0x000B2079,0x000B2039,0x000B2079,0x000C2039,0x000C2079,
+0x000D2039,0x000D2079,0x000D2039,0x000D2079,0x000E2039,0x000E2079,0x000E2039,0x000E2079,0x000F2039,0x000F2079,0x00102039,0x00102079,0x00102039,0x00102079,0x00112039,0x00112079,0x00112039,0x00112079,0x00122039,0x00122079,0x00122039,0x00122079,0x00132039,0x00132079,0x00132039,0x00132079,0x00142039,0x00142079,0x00142039,0x00142079,0x00152039,0x00152079,0x00152039,0x00152079,0x00162039,0x00162079,0x00162039,0x00162079,0x00172039,0x00172079,0x00172039,0x00172079,0x00182039,0x00182079,0x00182039,0x00182079,0x00192039,0x00192079,0x00192039,0x00192079,0x001A2039,0x001A2079,0x001A2039,0x001A2079,0x001A2039,0x001A2079,0x001B2039,0x001B2079,0x001B2039,0x001B2079,0x001C2039,0x001C2079,0x001C2039,0x001C2079,
+0x001C2039,0x001C2079,0x001D2039,0x001D2079,0x001D2039,0x001D2079,0x001E2039,0x001E2079,0x001E2039,0x001E2079,0x001E2039,0x001E2079,0x001F2039,0x001F2079,0x001F2039,0x001F2079,0x001F2039,0x001F2079,0x00202039,0x00202079,0x00202039,0x00202079,0x00202039,0x00202079,0x00212039,0x00212079,0x00212039,0x00212079,0x00212039,0x00212079,0x00222039,0x00222079,0x00222039,0x00222079,0x00222039,0x00222079,0x00232039,0x00232079,0x00232039,0x00232079,0x00232039,0x00232079,0x00242039,0x00242079,0x00242039,0x00242079,0x00242039,0x00242079,0x00252039,0x00252079,0x00252039,0x00252079,0x00252039,0x00252079,0x00262039,0x00262079,0x00262039,0x00262079,0x00262039,0x00262079,0x00262039,0x00262079,0x00272039,0x00272079,
+0x00272039,0x00272079,0x00272039,0x00272079,0x00272039,0x00272079,0x00282039,0x00282079,0x00282039,0x00282079,0x00282039,0x00282079,0x00292039,0x00292079,0x00292039,0x00292079,0x00292039,0x00292079,0x00292039,0x00292079,0x002A2039,0x002A2079,0x002A2039,0x002A2079,0x002A2039,0x002A2079,0x002A2039,0x002A2079,0x002B2039,0x002B2079,0x002B2039,0x002B2079,0x002B2039,0x002B2079,0x002B2039,0x002B2079,0x002B2039,0x002B2079,0x002C2039,0x002C2079,0x002C2039,0x002C2079,0x002C2039,0x002C2079,0x002C2039,0x002C2079,0x002D2039,0x002D2079,0x002D2039,0x002D2079,0x002D2039,0x002D2079,0x002D2039,0x002D2079,0x002D2039,0x002D2079,0x002E2039,0x002E2079,0x002E2039,0x002E2079,0x002E2039,0x002E2079,0x002E2039,0x002E2079,
+0x002E2039,0x002E2079,0x002F2039,0x002F2079,0x002F2039,0x002F2079,0x002F2039,0x002F2079,0x002F2039,0x002F2079,0x002F2039,0x002F2079,0x00302039,0x00302079,0x00302039,0x00302079,0x00302039,0x00302079,0x00302039,0x00302079,0x00302039,0x00302079,0x00312039,0x00312079,0x00312039,0x00312079,0x00312039,0x00312079,0x00312039,0x00312079,0x00312039,0x00312079,0x00322039,0x00322079,0x00322039,0x00322079,0x00322039,0x00322079,0x00322039,0x00322079,0x00322039,0x00322079,0x00322039,0x00322079,0x00332039,0x00332079,0x00332039,0x00332079,0x00332039,0x00332079,0x00332039,0x00332079,0x00332039,0x00332079,0x00332039,0x00332079,0x00342039,0x00342079,0x00342039,0x00342079,0x00342039,0x00342079,0x00342039,0x00342079,
+0x00342031,0x00342071,0x00342031,0x00342071,0x00342031,0x00342071,0x00352031,0x00352071,0x00352031,0x00352071,0x00352031,0x00352071,0x00352031,0x00352071,0x00352031,0x00352071,0x00352031,0x00352071,0x00362031,0x00362071,0x00362031,0x00362071,0x00362031,0x00362071,0x00362031,0x00362071,0x00362031,0x00362071,0x00362031,0x00362071,0x00362031,0x00362071,0x00362031,0x00362071,0x00372031,0x00372071,0x00372031,0x00372071,0x00372031,0x00372071,0x00372031,0x00372071,0x00372031,0x00372071,0x00372031,0x00372071,0x00372031,0x00372071,0x00382031,0x00382071,0x00382031,0x00382071,0x00382031,0x00382071,0x00382031,0x00382071,0x00382031,0x00382071,0x00382031,0x00382071,0x00382031,0x00382071,0x00382031,0x00382071,
+0x00392031,0x00392071,0x00392031,0x00392071,0x00392031,0x00392071,0x00392031,0x00392071,0x00392031,0x00392071,0x00392031,0x00392071,0x00392031,0x00392071,0x00392031,0x00392071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003A2031,0x003A2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003B2031,0x003B2071,0x003C2031,0x003C2071,0x003C2031,0x003C2071,0x003C2031,0x003C2071,0x003C2031,0x003C2071,0x003C2031,0x003C2071,
+0x003C2031,0x003C2071,0x003C2031,0x003C2071,0x003C2031,0x003C2071,0x003C2031,0x003C2071,0x003C2031,0x003C2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003D2031,0x003D2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003E2031,0x003E2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,
+0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x003F2031,0x003F2071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00402031,0x00402071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,0x00412031,0x00412071,
+0x00412031,0x00412071,0x00412031,0x00412071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00422031,0x00422071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,0x00432031,0x00432071,
+0x00432031,0x00432071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00442031,0x00442071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,
+0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00452031,0x00452071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00462031,0x00462071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,
+0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00472031,0x00472071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,0x00482031,0x00482071,
+0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00482029,0x00482069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,
+0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x00492029,0x00492069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,
+0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004A2029,0x004A2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,
+0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004B2029,0x004B2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,
+0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004C2029,0x004C2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,
+0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004D2029,0x004D2069,
+0x004D2029,0x004D2069,0x004D2029,0x004D2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,
+0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004E2029,0x004E2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,0x004F2029,0x004F2069,
+0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,
+0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x004F2021,0x004F2061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,
+0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,
+0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00502021,0x00502061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,
+0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,
+0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,
+0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00512021,0x00512061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,
+0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,0x00522021,0x00522061,
+0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,
+0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00522019,0x00522059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,
+0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,
+0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,
+0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,
+0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00532019,0x00532059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,
+0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,
+0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,0x00542019,0x00542059,
+0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,
+0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,
+0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00542011,0x00542051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,
+0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,
+0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,
+0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,
+0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,
+0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,0x00552011,0x00552051,
+0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,
+0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00552009,0x00552049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,
+0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,
+0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,
+0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,
+0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,
+0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,
+0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,0x00562009,0x00562049,
+0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,
+0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,
+0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00562001,0x00562041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,
+0x00572001,0x00572041,0x00572001,0x00572041,0x00572001,0x00572041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,
+0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00582001,0x00582041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,0x00592001,0x00592041,
+};
+
+#endif // _TAB_WALL_HIT_FUSED_H_
\ No newline at end of file
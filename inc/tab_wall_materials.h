@@ -0,0 +1,162 @@
+#ifndef _TAB_WALL_MATERIALS_H_
+#define _TAB_WALL_MATERIALS_H_
+
+#include <types.h>
+#include "consts.h"
+
+/*
+Materials (map cell value m, see MAP_MATERIALS in map_matrix.h):
+    1: palettes of side X and Y as usual, tile bank alternates by parity of the cell
+    2: palettes of side X and Y swapped, tile bank alternates by parity of the cell
+    3: palettes of side X and Y as usual, first tile bank only
+    4: palettes of side X and Y as usual, second tile bank only (tiles using the second half of wall's palette)
+
+Content for tab_wall_materials_X[] (same for Y with its own palette and mapX&1):
+
+    u16 column = 2*(m-1) + (mapY&1);
+    u16 d8_1 = tab_color_d8_1[sideDistX];
+    u16 color = (palX(m) << TILE_ATTR_PALETTE_SFT) + d8_1 + bank(m, mapY&1)*(8*8);
+*/
+
+// Every column is a sub table of FP*(STEP_COUNT+1) elements accessed by sideDist. Sub tables are stored in column order
+// 4,5,6,7,0,1,2,3 (column ^ 4), so (column << 13) taken as a signed word is the byte offset of its sub table from the
+// middle of the array. Use tab_wall_materials_X[((column ^ 4) * FP*(STEP_COUNT+1)) + sideDistX] in C.
+#define TAB_WALL_MATERIALS_COLUMNS 8
+
+// Table body generated with script tab_wall_materials_generator.js. Check correct values of constants before script execution.
+const u16 tab_wall_materials_X[TAB_WALL_MATERIALS_COLUMNS * (FP * (STEP_COUNT + 1))] = {
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,
+8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,
+8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,
+8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,
+8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,
+8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,
+8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+};
+
+// Table body generated with script tab_wall_materials_generator.js. Check correct values of constants before script execution.
+const u16 tab_wall_materials_Y[TAB_WALL_MATERIALS_COLUMNS * (FP * (STEP_COUNT + 1))] = {
+8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,
+8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,
+8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,
+8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,
+8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,
+8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,
+8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,
+8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,
+8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,
+8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,
+8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,
+8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,
+8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8249,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,8241,
+8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8233,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,8225,
+8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8217,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,8209,
+8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8201,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,8193,
+8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8313,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,8305,
+8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8297,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,8289,
+8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8281,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,8273,
+8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8265,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,8257,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+};
+
+#endif // _TAB_WALL_MATERIALS_H_
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <types.h>
 #include <vdp.h>
+#include "consts.h"
 
 #define STRINGIFY(x) #x
 
@@ -203,7 +204,11 @@ void doDmaFast (u16 len, u32 fromAddr, u32 cmdAddr);
 /// @param op1 
 /// @param op2 
 /// @return u16 data type
+#if HOST_BUILD
+static inline u16 mulu_shft_FS (u16 op1, u16 op2) { return (u16)(((u32)op1 * op2) >> FS); }
+#else
 u16 mulu_shft_FS (u16 op1, u16 op2);
+#endif
 
 /// @brief Same than VDP_showCPULoad() but optimized. Show values up to 255%. Otherwise it crashes or gives innacurate data.
 /// @param xPos screen X position in tiles
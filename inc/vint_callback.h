@@ -7,6 +7,13 @@ void vint_reset ();
 
 void vint_enqueueHudTilemap ();
 
+/// @brief Flags the framebuffer as ready to be DMAed on next VBlank. Used by RENDER_SKIP_STATIC_FRAME.
+void vint_enqueueFramebuffer ();
+
+/// @brief Sets the horizontal scroll of both planes, shifted by offsetPx. Used by RENDER_SMOOTH_ROTATION.
+/// @param withFramebuffer TRUE to hold it until the VBlank that DMAs the framebuffer of the new view, FALSE to apply it on next VBlank.
+void vint_enqueueHScroll (s16 offsetPx, bool withFramebuffer);
+
 void vint_enqueueTiles (void *from, u16 toIndex, u16 lenInWord);
 
 void vint_enqueueTilesBuffered (u16 toIndex, u16 lenInWord);
@@ -57,6 +57,7 @@ exports.TILEMAP_COLUMNS = TILEMAP_COLUMNS
 exports.PLANE_COLUMNS = PLANE_COLUMNS
 exports.PIXEL_COLUMNS = PIXEL_COLUMNS
 exports.MAP_SIZE = MAP_SIZE
+exports.MAP_FRACTION = MAP_FRACTION
 exports.MIN_POS_XY = MIN_POS_XY
 exports.MAX_POS_XY = MAX_POS_XY
 exports.MAP_HIT_MASK_MAPXY = MAP_HIT_MASK_MAPXY
@@ -5,6 +5,7 @@ const { PIXEL_COLUMNS } = require('./consts');
 const BLOCK_SIZE = PIXEL_COLUMNS; // Number of elements per block
 
 const inputFile = 'tab_map_hit_OUTPUT.txt';
+const outputFile = 'map_hit_block_delta_OUTPUT.txt';
 
 function compressMatrix(matrix) {
     const compressedMatrix = [];
@@ -41,6 +42,18 @@ function decompressElement(compressedMatrix, index) {
     return value;
 }
 
+// Output matches the table expected by map_hit_codec_block_delta.c. Deltas are wrapped to 16 bits, one block per line.
+function saveToFile(compressedMatrix, filename) {
+    let output = 'const u16 map_hit_block_delta[] = {\n';
+    for (let i = 0; i < compressedMatrix.length; i += BLOCK_SIZE) {
+        output += compressedMatrix.slice(i, i + BLOCK_SIZE).map(n => (n & 0xFFFF).toString()).join(',') + ',\n';
+    }
+    output += '};';
+
+    fs.writeFileSync(filename, output);
+    console.log('Content saved to ' + filename);
+}
+
 function loadMatrix(filename) {
     const content = fs.readFileSync(filename, 'utf8');
     const rows = content.trim().split('\n');
@@ -94,6 +107,10 @@ function main() {
             }
         }
     }
+
+    if (!mismatchFound) {
+        saveToFile(compressedMatrix, outputFile);
+    }
 }
 
 main();
\ No newline at end of file
@@ -149,7 +149,10 @@ function formatNumber(num, integerWidth, decimalPlaces = 0) {
 
 function saveArraysToFile(compressedMatrix, blockLookupIndex, lookupByteFactor, filename) {
     let fileContent = '';
-    fileContent += `#define MAP_HIT_COMPRESSED_BLOCK_SIZE (PIXEL_COLUMNS*${Math.floor(BLOCK_SIZE/PIXEL_COLUMNS)})\n`;
+    // The block size is defined by map_hit_compressed.h, so the output only checks it matches the one used here
+    fileContent += `#if MAP_HIT_COMPRESSED_BLOCK_ROWS != ${Math.floor(BLOCK_SIZE/PIXEL_COLUMNS)}\n`;
+    fileContent += `#error "Set MAP_HIT_COMPRESSED_BLOCK_ROWS to ${Math.floor(BLOCK_SIZE/PIXEL_COLUMNS)} in map_hit_compressed.h"\n`;
+    fileContent += '#endif\n';
     fileContent += '\n';
     fileContent += 'const u16 map_hit_compressed[] = {\n';
     
@@ -79,31 +79,29 @@ function readMatrixFromFile(filename) {
     }
 }
 
+// Output matches the tables expected by map_hit_codec_rle.c
 function saveToHeader(matrix, filename) {
     let output = '';
     const variableName = 'map_hit_rle';
 
-    // Write RLEEntry array
-    output += `static const RLEEntry ${variableName}_data[] = {\n`;
-    for (let i = 0; i < matrix.totalEntries; i++) {
-        output += `    {${matrix.data[i].value}, ${matrix.data[i].count}},\n`;
+    // Write {value, count} pairs, one row per line
+    output += `const u16 ${variableName}_data[] = {\n`;
+    for (let row = 0; row < matrix.rows; row++) {
+        for (let i = matrix.rowOffsets[row]; i < matrix.rowOffsets[row + 1]; i++) {
+            output += `${matrix.data[i].value},${matrix.data[i].count},`;
+        }
+        output += '\n';
     }
     output += '};\n\n';
 
     // Write row_offsets array
-    output += `static const uint32_t ${variableName}_row_offsets[] = {\n`;
+    output += `const u32 ${variableName}_row_offsets[] = {\n`;
     for (let i = 0; i <= matrix.rows; i++) {
-        output += `    ${matrix.rowOffsets[i]},\n`;
+        output += `${matrix.rowOffsets[i]},`;
+        if ((i % 64) === 63 || i === matrix.rows) {
+            output += '\n';
+        }
     }
-    output += '};\n\n';
-
-    // Write RLEMatrix structure
-    output += `static const RLEMatrix ${variableName} = {\n`;
-    output += `    .rows = ${matrix.rows},\n`;
-    output += `    .cols = ${matrix.cols},\n`;
-    output += `    .data = (RLEEntry*)${variableName}_data,\n`;
-    output += `    .row_offsets = (uint32_t*)${variableName}_row_offsets,\n`;
-    output += `    .total_entries = ${matrix.totalEntries}\n`;
     output += '};';
 
     fs.writeFileSync(filename, output);
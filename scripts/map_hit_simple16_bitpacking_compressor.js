@@ -3,6 +3,7 @@ const fs = require('fs');
 const { PIXEL_COLUMNS } = require('./consts');
 
 const inputFile = 'tab_map_hit_OUTPUT.txt';
+const outputFile = 'map_hit_simple16_OUTPUT.txt';
 
 const CASES = [
     { count: 28, bits: [1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1] },
@@ -358,6 +359,72 @@ function compressWithLookupUnchecked(values) {
     return { compressed: compressedData, rowLookupTable, offsetTable };
 }
 
+// Packs every row on its own, so every row starts on a new word and can be decoded alone (see map_hit_codec_simple16.c).
+function compressRowsUnchecked(values) {
+    const compressedData = [];
+    const rowLookupTable = []; // Index of the first word of every row
+
+    for (let rowFrom = 0; rowFrom < values.length; rowFrom += PIXEL_COLUMNS) {
+        rowLookupTable.push(compressedData.length);
+        const rowTo = Math.min(rowFrom + PIXEL_COLUMNS, values.length);
+        let valFrom = rowFrom;
+        while (valFrom < rowTo) {
+            const { value, count } = pack(values, valFrom, rowTo);
+            valFrom += count;
+            compressedData.push(value >>> 0);
+        }
+    }
+
+    return { compressed: compressedData, rowLookupTable };
+}
+
+// Same than map_hit_codec_decodeRow() in map_hit_codec_simple16.c
+function decompressRow(compressed, rowLookupTable, row) {
+    const out = [];
+    let offset = rowLookupTable[row];
+    let remaining = PIXEL_COLUMNS;
+
+    while (remaining > 0) {
+        let next = compressed[offset];
+        ++offset;
+        const selector = (next >>> 28);
+        const { count: caseCount, bits } = CASES[selector];
+        const count = Math.min(caseCount, remaining);
+        remaining -= count;
+        for (let j = 0; j < count; j++) {
+            out.push(next & 0xFFFF & ((1 << bits[j]) - 1));
+            next >>>= bits[j];
+        }
+    }
+
+    return out;
+}
+
+// Output matches the tables expected by map_hit_codec_simple16.c
+function saveToFile(compressed, rowLookupTable, filename) {
+    let output = 'const u32 map_hit_simple16[] = {\n';
+    for (let row = 0; row < rowLookupTable.length; row++) {
+        const end = row + 1 < rowLookupTable.length ? rowLookupTable[row + 1] : compressed.length;
+        for (let i = rowLookupTable[row]; i < end; i++) {
+            output += '0x' + compressed[i].toString(16).toUpperCase().padStart(8, '0') + ',';
+        }
+        output += '\n';
+    }
+    output += '};\n\n';
+
+    output += 'const u32 map_hit_simple16_row_lookup[] = {\n';
+    for (let row = 0; row < rowLookupTable.length; row++) {
+        output += rowLookupTable[row] + ',';
+        if ((row % 64) === 63 || row === rowLookupTable.length - 1) {
+            output += '\n';
+        }
+    }
+    output += '};';
+
+    fs.writeFileSync(filename, output);
+    console.log('Content saved to ' + filename);
+}
+
 function compress(values) {
     Simple16.check(values);
     return compressUnchecked(values);
@@ -586,6 +653,27 @@ function main() {
 
     if (!mismatchFound)
         console.log("Done.");
+
+    console.log("Compressing row by row for map_hit_codec_simple16.c ...");
+
+    const { compressed: compressedRows, rowLookupTable: rowsLookupTable } = compressRowsUnchecked(matrix);
+    const compressedRowsSizeBytes = compressedRows.length * 4 + rowsLookupTable.length * 4;
+    console.log(`${'Compressed size (row by row):'.padEnd(42)}${formatNumber(compressedRowsSizeBytes, maxIntegerWidth)} bytes`);
+
+    mismatchFound = false;
+    for (let row = 0; row < Math.floor(matrix.length / PIXEL_COLUMNS) && !mismatchFound; row++) {
+        const decompressedRow = decompressRow(compressedRows, rowsLookupTable, row);
+        for (let col = 0; col < PIXEL_COLUMNS && !mismatchFound; col++) {
+            const index = row * PIXEL_COLUMNS + col;
+            if (matrix[index] !== decompressedRow[col]) {
+                console.error(`ERROR: Mismatch at row ${row}, column ${col} (index ${index}) -> Original: ${matrix[index]}, Decompressed: ${decompressedRow[col]}`);
+                mismatchFound = true;
+            }
+        }
+    }
+
+    if (!mismatchFound)
+        saveToFile(compressedRows, rowsLookupTable, outputFile);
 }
 
 main();
\ No newline at end of file
@@ -0,0 +1,892 @@
+/**
+ * Native replacement of tab_map_hit_generator.js and Tiles_Pair_Generator.java (and tiles_pair_generator.js).
+ * Sweeps every position x AP angles x PIXEL_COLUMNS columns using all the cores, and runs the DDA of every
+ * group of 8 columns at once using GCC/Clang vector extensions (SSE/AVX/NEON depending on -march).
+ * Constants are read from ../inc/consts.h, so there is no need to keep consts.js or Consts.java in sync.
+ * Output files are byte-identical to the ones generated by the scripts:
+ *   tab_map_hit_OUTPUT.txt: same than tab_map_hit_generator.js. Jobs are merged in job order, which is the order
+ *     the js script gets them when all the jobs take the same time.
+ *   tiles_pair_OUTPUT.txt: same than Tiles_Pair_Generator.java.
+ * Mode tab_map_hit_banked writes tab_map_hit_banked_OUTPUT.txt instead: the same table split in arrays of whole rows
+ * that fit in a 512KB SSF2 bank, as expected by map_hit_codec_banked.c.
+ *
+ * Compile with (run it from the scripts folder):
+ *   g++ -O3 -march=native -std=c++17 -pthread map_tables_generator.cpp -o map_tables_generator
+ * Execute with:
+ *   ./map_tables_generator [tab_map_hit|tab_map_hit_banked|tiles_pair|all] [--range <startPosX> <endPosX>] [--check]
+ * Default is all.
+ *   --range only sweeps posX in [startPosX, endPosX] (clamped to [MIN_POS_XY, MAX_POS_XY]), keeping the same job split.
+ *     Same than tab_map_hit_generator.js <startPosX> <endPosX>, so both outputs can be compared over a short range.
+ *   --check doesn't write the output files: it compares what it would write against the existing ones (eg: generated by
+ *     the scripts with the same range) and tab_wall_div and tab_color_d8_1 against the committed ones in ../inc, and
+ *     exits with 1 on the first mismatch.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char* constsFile = "../inc/consts.h"; // input
+static const char* tabDeltasFile = "../inc/tab_deltas.h"; // input
+static const char* mapMatrixFile = "../src/map_matrix.c"; // input
+static const char* outputFileMapHit = "tab_map_hit_OUTPUT.txt";
+static const char* outputFileMapHitBanked = "tab_map_hit_banked_OUTPUT.txt";
+static const char* outputFileTilesPair = "tiles_pair_OUTPUT.txt";
+static const char* tabWallDivFile = "../inc/tab_wall_div.h"; // checked with --check
+static const char* tabColorD8_1File = "../inc/tab_color_d8_1.h"; // checked with --check
+
+static const int MAX_JOBS = 256; // Same job split than the scripts. tab_map_hit output depends on it.
+static const int TILE_INDEX_MASK = 0x7FF;
+static const long SSF2_BANK_SIZE = 0x80000; // 512KB
+
+//---------------------
+// SGDK constants
+//---------------------
+static const int PAL0 = 0;
+static const int PAL1 = 1;
+static const int TILE_ATTR_PALETTE_SFT = 13;
+static const int TILE_ATTR_VFLIP_MASK = 1 << 12;
+
+// Lanes of the DDA. PIXEL_COLUMNS must be a multiple of it.
+#define LANES 8
+typedef int32_t vint __attribute__((vector_size(LANES * sizeof(int32_t))));
+
+// ----------------------------------------------------------------------------------------
+// consts.h reading
+// ----------------------------------------------------------------------------------------
+
+/**
+ * Evaluates the #define expressions of consts.h we are interested in.
+ * Supports integer literals, other defines, parenthesis, and the operators: * / % + - << >>
+ */
+class ConstsReader {
+public:
+    explicit ConstsReader (const std::string& file) {
+        std::ifstream in(file);
+        if (!in)
+            throw std::runtime_error("Can't open " + file);
+        const std::regex defineRegex(R"(^\s*#define\s+(\w+)\s+([^/\r\n]*))");
+        std::string line;
+        std::smatch m;
+        while (std::getline(in, line)) {
+            if (std::regex_search(line, m, defineRegex))
+                defines[m[1]] = m[2];
+        }
+    }
+
+    long get (const std::string& name) {
+        auto it = defines.find(name);
+        if (it == defines.end())
+            throw std::runtime_error("Missing #define " + name + " in " + constsFile);
+        const std::string expr = it->second;
+        const char* p = expr.c_str();
+        long v = parseShift(p);
+        skipSpaces(p);
+        if (*p != '\0')
+            throw std::runtime_error("Can't evaluate #define " + name + " " + expr);
+        return v;
+    }
+
+private:
+    std::map<std::string, std::string> defines;
+
+    static void skipSpaces (const char*& p) {
+        while (*p == ' ' || *p == '\t') ++p;
+    }
+
+    long parsePrimary (const char*& p) {
+        skipSpaces(p);
+        if (*p == '(') {
+            ++p;
+            long v = parseShift(p);
+            skipSpaces(p);
+            if (*p++ != ')')
+                throw std::runtime_error("Missing ')'");
+            return v;
+        }
+        if (*p == '-') {
+            ++p;
+            return -parsePrimary(p);
+        }
+        if (std::isdigit((unsigned char)*p)) {
+            char* end;
+            long v = std::strtol(p, &end, 0);
+            p = end;
+            return v;
+        }
+        std::string id;
+        while (std::isalnum((unsigned char)*p) || *p == '_') id += *p++;
+        if (id.empty())
+            throw std::runtime_error(std::string("Unexpected char '") + *p + "'");
+        return get(id);
+    }
+
+    long parseMul (const char*& p) {
+        long v = parsePrimary(p);
+        for (;;) {
+            skipSpaces(p);
+            if (*p == '*') { ++p; v *= parsePrimary(p); }
+            else if (*p == '/') { ++p; v /= parsePrimary(p); }
+            else if (*p == '%') { ++p; v %= parsePrimary(p); }
+            else return v;
+        }
+    }
+
+    long parseAdd (const char*& p) {
+        long v = parseMul(p);
+        for (;;) {
+            skipSpaces(p);
+            if (*p == '+') { ++p; v += parseMul(p); }
+            else if (*p == '-') { ++p; v -= parseMul(p); }
+            else return v;
+        }
+    }
+
+    long parseShift (const char*& p) {
+        long v = parseAdd(p);
+        for (;;) {
+            skipSpaces(p);
+            if (p[0] == '<' && p[1] == '<') { p += 2; v <<= parseAdd(p); }
+            else if (p[0] == '>' && p[1] == '>') { p += 2; v >>= parseAdd(p); }
+            else return v;
+        }
+    }
+};
+
+// Check correct values of constants before script execution. See consts.h.
+static int FS, FP, AP, STEP_COUNT, STEP_COUNT_LOOP, VERTICAL_ROWS, TILEMAP_COLUMNS, PIXEL_COLUMNS,
+    MAP_SIZE, MAP_FRACTION, MIN_POS_XY, MAX_POS_XY,
+    MAP_HIT_MASK_MAPXY, MAP_HIT_MASK_SIDEDISTXY, MAP_HIT_OFFSET_MAPXY, MAP_HIT_OFFSET_SIDEDISTXY;
+
+static void loadConsts () {
+    ConstsReader c(constsFile);
+    FS = c.get("FS");
+    FP = c.get("FP");
+    AP = c.get("AP");
+    STEP_COUNT = c.get("STEP_COUNT");
+    STEP_COUNT_LOOP = c.get("STEP_COUNT_LOOP");
+    VERTICAL_ROWS = c.get("VERTICAL_ROWS");
+    TILEMAP_COLUMNS = c.get("TILEMAP_COLUMNS");
+    PIXEL_COLUMNS = c.get("PIXEL_COLUMNS");
+    MAP_SIZE = c.get("MAP_SIZE");
+    MAP_FRACTION = c.get("MAP_FRACTION");
+    MIN_POS_XY = c.get("MIN_POS_XY");
+    MAX_POS_XY = c.get("MAX_POS_XY");
+    MAP_HIT_MASK_MAPXY = c.get("MAP_HIT_MASK_MAPXY");
+    MAP_HIT_MASK_SIDEDISTXY = c.get("MAP_HIT_MASK_SIDEDISTXY");
+    MAP_HIT_OFFSET_MAPXY = c.get("MAP_HIT_OFFSET_MAPXY");
+    MAP_HIT_OFFSET_SIDEDISTXY = c.get("MAP_HIT_OFFSET_SIDEDISTXY");
+
+    if (PIXEL_COLUMNS % LANES != 0)
+        throw std::runtime_error("PIXEL_COLUMNS must be a multiple of " + std::to_string(LANES));
+}
+
+// ----------------------------------------------------------------------------------------
+// Input tables
+// ----------------------------------------------------------------------------------------
+
+static std::string readFile (const std::string& file) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("Can't open " + file);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+/// @brief Parses the comma separated integers found between the '{' following the marker and the next '}'.
+static std::vector<int> readIntArray (const std::string& file, const std::string& marker) {
+    const std::string content = readFile(file);
+    size_t start = content.find(marker);
+    if (start == std::string::npos)
+        throw std::runtime_error("Failed to find " + marker + " in " + file);
+    start = content.find('{', start);
+    const size_t end = content.find("};", start);
+
+    std::vector<int> result;
+    // Skip inner braces ({ } of every map row), separators, and line comments
+    for (size_t i = start + 1; i < end; ) {
+        if (content[i] == '/' && content[i+1] == '/') {
+            i = content.find('\n', i);
+        }
+        else if (std::isdigit((unsigned char)content[i])) {
+            char* e;
+            result.push_back((int)std::strtol(content.c_str() + i, &e, 10));
+            i = e - content.c_str();
+        }
+        else {
+            ++i;
+        }
+    }
+    return result;
+}
+
+static std::vector<int> tab_deltas;
+static std::vector<int> map;
+static std::vector<int> tab_wall_div;
+static std::vector<int> tab_color_d8_1;
+
+// Same than utils.generateTabWallDiv()
+static void generateTabWallDiv () {
+    // Vertical height calculation starts at the center
+    const int WALL_H2 = (VERTICAL_ROWS * 8) / 2;
+    // Additional column height modification. Positive value increases drawing column height. Negative value decreases it.
+    const int ADDITIONAL_WALL_HEIGHT_MODIF = 4;
+
+    tab_wall_div.assign(FP * (STEP_COUNT + 1), 0);
+    for (size_t i = 0; i < tab_wall_div.size(); ++i) {
+        const double v = (double)(TILEMAP_COLUMNS * FP) / (i + 1);
+        const int div = (int)std::floor(std::min(v, 255.0) + 0.5); // Math.round()
+        tab_wall_div[i] = (div + ADDITIONAL_WALL_HEIGHT_MODIF) >= WALL_H2 ? 0 : WALL_H2 - div - ADDITIONAL_WALL_HEIGHT_MODIF;
+    }
+}
+
+// Same than utils.generateTabColor_d8_1()
+static void generateTabColor_d8_1 () {
+    tab_color_d8_1.assign(FP * (STEP_COUNT + 1), 0);
+    for (int sideDist = 0; sideDist < (int)tab_color_d8_1.size(); ++sideDist) {
+        const int d = 7 - std::min(7, sideDist / FP); // the bigger the distant the darker the color is
+        tab_color_d8_1[sideDist] = 1 + d*8;
+    }
+}
+
+static void loadInputs () {
+    tab_deltas = readIntArray(tabDeltasFile, "const u16 tab_deltas[");
+    if ((int)tab_deltas.size() != AP * PIXEL_COLUMNS * 4)
+        throw std::runtime_error("Invalid number of elements in tab_deltas (expected " + std::to_string(AP * PIXEL_COLUMNS * 4) + "): " + std::to_string(tab_deltas.size()));
+
+    map = readIntArray(mapMatrixFile, "const u8 map[MAP_SIZE][MAP_SIZE] =");
+    if ((int)map.size() != MAP_SIZE * MAP_SIZE)
+        throw std::runtime_error("Invalid map_matrix dimensions (expected " + std::to_string(MAP_SIZE) + " * " + std::to_string(MAP_SIZE) + ")");
+
+    generateTabWallDiv();
+    generateTabColor_d8_1();
+}
+
+// ----------------------------------------------------------------------------------------
+// DDA
+// ----------------------------------------------------------------------------------------
+
+// Result of the DDA of one column
+struct Hit {
+    int32_t hit; // 0 if no hit after STEP_COUNT_LOOP steps
+    int32_t sideX; // -1 when hit on side X, 0 when hit on side Y
+    int32_t sideDist; // sideDistX or sideDistY
+    int32_t mapXY; // mapY when hit on side X, mapX when hit on side Y
+};
+
+// Angle dependent data of the DDA, in lanes friendly layout
+struct AngleData {
+    std::vector<int32_t> deltaDistX, deltaDistY, negX, negY;
+};
+static std::vector<AngleData> angles;
+
+static void prepareAngles () {
+    angles.resize(AP);
+    for (int a = 0; a < AP; ++a) {
+        AngleData& ad = angles[a];
+        ad.deltaDistX.resize(PIXEL_COLUMNS);
+        ad.deltaDistY.resize(PIXEL_COLUMNS);
+        ad.negX.resize(PIXEL_COLUMNS);
+        ad.negY.resize(PIXEL_COLUMNS);
+        for (int column = 0; column < PIXEL_COLUMNS; ++column) {
+            const int base = (a * PIXEL_COLUMNS * 4) + column*4;
+            ad.deltaDistX[column] = tab_deltas[base + 0];
+            ad.deltaDistY[column] = tab_deltas[base + 1];
+            // rayDirX and rayDirY are signed 16 bits
+            ad.negX[column] = tab_deltas[base + 2] >= 32768 ? -1 : 0;
+            ad.negY[column] = tab_deltas[base + 3] >= 32768 ? -1 : 0;
+        }
+    }
+}
+
+// Vectors go by reference: a 32 bytes one passed or returned by value changes the ABI when AVX is not enabled (-Wpsabi),
+// even if every call gets inlined.
+static inline void load (vint& v, const int32_t* p) {
+    std::memcpy(&v, p, sizeof(v));
+}
+
+static inline void splat (vint& v, int32_t x) {
+    for (int l = 0; l < LANES; ++l) v[l] = x;
+}
+
+/**
+ * Same DDA than the scripts (and the game) for all the columns of one angle, LANES columns at a time.
+ * Every lane stops (keeps its values) once it hits a wall, so the steps match the scalar version.
+ */
+static void ddaAngle (int posX, int posY, int a, Hit* out) {
+    const AngleData& ad = angles[a];
+
+    const int sideDistX_l0 = posX - (posX / FP) * FP;
+    const int sideDistX_l1 = (posX / FP + 1) * FP - posX;
+    const int sideDistY_l0 = posY - (posY / FP) * FP;
+    const int sideDistY_l1 = (posY / FP + 1) * FP - posY;
+
+    vint mask16, one, zero, allSet, l0X, l1X, l0Y, l1Y, posMapX, posMapY;
+    splat(mask16, 0xFFFF);
+    splat(one, 1);
+    splat(zero, 0);
+    splat(allSet, -1);
+    splat(l0X, sideDistX_l0);
+    splat(l1X, sideDistX_l1);
+    splat(l0Y, sideDistY_l0);
+    splat(l1Y, sideDistY_l1);
+    splat(posMapX, posX / FP);
+    splat(posMapY, posY / FP);
+
+    for (int column = 0; column < PIXEL_COLUMNS; column += LANES) {
+        vint deltaDistX, deltaDistY, negX, negY;
+        load(deltaDistX, &ad.deltaDistX[column]);
+        load(deltaDistY, &ad.deltaDistY[column]);
+        load(negX, &ad.negX[column]);
+        load(negY, &ad.negY[column]);
+
+        // stepX is -1 (negX) or 1
+        const vint stepX = negX | one;
+        const vint stepY = negY | one;
+        vint sideDistX = ((((l0X & negX) | (l1X & ~negX)) * deltaDistX) >> FS) & mask16;
+        vint sideDistY = ((((l0Y & negY) | (l1Y & ~negY)) * deltaDistY) >> FS) & mask16;
+
+        vint mapX = posMapX;
+        vint mapY = posMapY;
+
+        vint active = allSet;
+        vint hitSideX = zero, hitSideDist = zero, hitMapXY = zero;
+
+        for (int n = 0; n < STEP_COUNT_LOOP; ++n) {
+            const vint sideX = sideDistX < sideDistY;
+            const vint moveX = sideX & active;
+            const vint moveY = ~sideX & active;
+            mapX += stepX & moveX;
+            mapY += stepY & moveY;
+
+            // Gather
+            vint cell;
+            for (int l = 0; l < LANES; ++l)
+                cell[l] = map[mapY[l] * MAP_SIZE + mapX[l]];
+
+            const vint hit = (cell != 0) & active;
+            hitSideX |= sideX & hit;
+            hitSideDist |= ((sideDistX & sideX) | (sideDistY & ~sideX)) & hit;
+            hitMapXY |= ((mapY & sideX) | (mapX & ~sideX)) & hit;
+
+            sideDistX += deltaDistX & moveX & ~hit;
+            sideDistY += deltaDistY & moveY & ~hit;
+            active &= ~hit;
+
+            bool any = false;
+            for (int l = 0; l < LANES; ++l) any |= active[l] != 0;
+            if (!any)
+                break;
+        }
+
+        for (int l = 0; l < LANES; ++l) {
+            Hit& h = out[column + l];
+            h.hit = active[l] == 0;
+            h.sideX = hitSideX[l];
+            h.sideDist = hitSideDist[l];
+            h.mapXY = hitMapXY[l];
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------------------
+// Positions sweep
+// ----------------------------------------------------------------------------------------
+
+static std::atomic<long> completedIterations(0);
+
+// posX range swept by the jobs (see --range)
+static int sweepStartPosX, sweepEndPosX;
+
+/**
+ * Same positions traversal than the scripts for posX in [startPosX, endPosX].
+ * NOTE: here we are moving from the most UPPER-LEFT position of the map[][] layout,
+ * stepping DOWN into Y Axis, and RIGHT into X Axis, where in each position we do a full rotation.
+ * Therefore we only interesting in collisions with x+1 and y+1.
+ */
+template <typename F>
+static void sweepPositions (int startPosX, int endPosX, F&& onPosition) {
+    const int posStepping = 1;
+
+    for (int posX = startPosX; posX <= endPosX; posX += posStepping) {
+        for (int posY = MIN_POS_XY; posY <= MAX_POS_XY; posY += posStepping) {
+
+            // Current location normalized
+            const int x = posX / FP;
+            const int y = posY / FP;
+
+            // Limit Y axis location normalized
+            const int ytop = (posY - (MAP_FRACTION-1)) / FP;
+            const int ybottom = (posY + (MAP_FRACTION-1)) / FP;
+
+            // Check X axis collision
+            // Moving right as per map[][] layout?
+            if (map[y*MAP_SIZE + (x+1)] || map[ytop*MAP_SIZE + (x+1)] || map[ybottom*MAP_SIZE + (x+1)]) {
+                if (posX > ((x+1)*FP - MAP_FRACTION)) {
+                    // Move one block of map: (FP + 2*MAP_FRACTION) = 384 units. The block size is FP, but we account for a safe distant to avoid clipping.
+                    posX += (FP + 2*MAP_FRACTION) - posStepping;
+                    completedIterations += (long)(MAX_POS_XY - posY + 1) * AP;
+                    // Stop current Y and continue with next X until it gets outside the collision
+                    break;
+                }
+            }
+
+            // Limit X axis location normalized
+            const int xleft = (posX - (MAP_FRACTION-1)) / FP;
+            const int xright = (posX + (MAP_FRACTION-1)) / FP;
+
+            // Check Y axis collision
+            // Moving down as per map[][] layout?
+            if (map[(y+1)*MAP_SIZE + x] || map[(y+1)*MAP_SIZE + xleft] || map[(y+1)*MAP_SIZE + xright]) {
+                if (posY > ((y+1)*FP - MAP_FRACTION)) {
+                    // Move one block of map: (FP + 2*MAP_FRACTION) = 384 units. The block size is FP, but we account for a safe distant to avoid clipping.
+                    posY += (FP + 2*MAP_FRACTION) - posStepping;
+                    completedIterations += AP;
+                    // Continue with next Y until it gets outside the collision
+                    continue;
+                }
+            }
+
+            onPosition(posX, posY);
+            completedIterations += AP;
+        }
+    }
+}
+
+struct Job {
+    int startPosX, endPosX;
+};
+
+/// @brief Jobs of the whole posX range cut to [sweepStartPosX, sweepEndPosX], so a reduced range keeps the job boundaries.
+static std::vector<Job> createJobs () {
+    std::vector<Job> jobs;
+    const int chunkSize = (MAX_POS_XY - MIN_POS_XY + 1 + MAX_JOBS - 1) / MAX_JOBS; // Math.ceil()
+    for (int startPosX = MIN_POS_XY; startPosX <= MAX_POS_XY; startPosX += chunkSize) {
+        const int from = std::max(startPosX, sweepStartPosX);
+        const int to = std::min(std::min(startPosX + chunkSize - 1, MAX_POS_XY), sweepEndPosX);
+        if (from <= to)
+            jobs.push_back({ from, to });
+    }
+    return jobs;
+}
+
+static void displayProgress () {
+    const long total = (long)(sweepEndPosX - sweepStartPosX + 1) * (MAX_POS_XY - MIN_POS_XY + 1) * AP;
+    const double progress = (completedIterations.load() / (double)total) * 100;
+    const int bars = std::min(50, (int)(progress / 2));
+    std::printf("\r[%s%s] %.2f%%", std::string(bars, '=').c_str(), std::string(50 - bars, '-').c_str(), progress);
+    std::fflush(stdout);
+}
+
+static void printTime () {
+    const std::time_t t = std::time(nullptr);
+    char buf[64];
+    std::strftime(buf, sizeof(buf), "%c", std::localtime(&t));
+    std::puts(buf);
+}
+
+/// @brief Runs every job in one of the worker threads, taking them in job order, while the main thread displays the progress.
+template <typename F>
+static void runWorkers (const std::vector<Job>& jobs, F&& worker) {
+    const unsigned numCores = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("Utilizing %u core/s for processing %zu jobs.\n", numCores, jobs.size());
+    printTime();
+
+    completedIterations = 0;
+    std::atomic<size_t> nextJob(0);
+    std::atomic<unsigned> finishedThreads(0);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numCores; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t j; (j = nextJob++) < jobs.size(); )
+                worker(t, j, jobs[j]);
+            ++finishedThreads;
+        });
+    }
+
+    while (finishedThreads.load() < numCores) {
+        displayProgress();
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+    for (auto& th : threads)
+        th.join();
+    displayProgress();
+    std::printf("\n");
+}
+
+// ----------------------------------------------------------------------------------------
+// Output
+// ----------------------------------------------------------------------------------------
+
+static bool checkMode = false; // --check
+static bool checkFailed = false;
+
+/// @brief Writes the content into the file, or with --check compares it against the file and reports the first different line.
+static void writeOutput (const char* file, const std::string& content) {
+    if (!checkMode) {
+        std::ofstream(file, std::ios::binary) << content;
+        std::printf("Processing complete. Output saved to %s\n", file);
+        return;
+    }
+
+    std::ifstream in(file, std::ios::binary);
+    if (!in) {
+        std::printf("CHECK FAILED: can't open %s\n", file);
+        checkFailed = true;
+        return;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    const std::string expected = ss.str();
+    if (expected == content) {
+        std::printf("CHECK OK: %s matches\n", file);
+        return;
+    }
+
+    const size_t at = std::mismatch(content.begin(), content.begin() + std::min(content.size(), expected.size()), expected.begin()).first - content.begin();
+    const long line = 1 + std::count(content.begin(), content.begin() + at, '\n');
+    std::printf("CHECK FAILED: %s differs at line %ld (%zu bytes generated, %zu in the file)\n", file, line, content.size(), expected.size());
+    checkFailed = true;
+}
+
+/// @brief Compares a table computed here against the committed one, both of them inputs of the tiles pair DDA.
+static void checkCommittedTable (const char* file, const std::string& marker, const std::vector<int>& table) {
+    const std::vector<int> committed = readIntArray(file, marker);
+    if (committed == table) {
+        std::printf("CHECK OK: %s matches\n", file);
+        return;
+    }
+    size_t i = 0;
+    while (i < committed.size() && i < table.size() && committed[i] == table[i])
+        ++i;
+    std::printf("CHECK FAILED: %s differs at element %zu\n", file, i);
+    checkFailed = true;
+}
+
+// ----------------------------------------------------------------------------------------
+// tab_map_hit
+// ----------------------------------------------------------------------------------------
+
+// Whole rows per bank, so a row never crosses banks. Same than MAP_HIT_BANK_ROWS in map_hit_compressed.h
+static void writeTabMapHitBanked (const std::vector<uint16_t>& table, long minIndex, long finalArraySize) {
+    const long bankRows = SSF2_BANK_SIZE / (PIXEL_COLUMNS * 2);
+    const long rows = finalArraySize / PIXEL_COLUMNS;
+    const long banks = (rows + bankRows - 1) / bankRows;
+
+    std::string content;
+    content.reserve(finalArraySize * 6 + banks * 128);
+    for (long bank = 0; bank < banks; ++bank) {
+        const long rowFrom = bank * bankRows;
+        const long rowTo = std::min(rows, rowFrom + bankRows);
+        content += "// Rows [" + std::to_string(rowFrom) + ", " + std::to_string(rowTo) + ")\n";
+        content += "MAP_HIT_BANK_ATTR const u16 tab_map_hit_bank_" + std::to_string(bank) + "[] = {\n";
+        for (long row = rowFrom; row < rowTo; ++row) {
+            for (long column = 0; column < PIXEL_COLUMNS; ++column) {
+                content += std::to_string(table[minIndex + row * PIXEL_COLUMNS + column]);
+                content += ',';
+            }
+            content += '\n';
+        }
+        content += "};\n\n";
+    }
+
+    content += "const u16* const tab_map_hit_banks[MAP_HIT_BANKS] = {\n";
+    for (long bank = 0; bank < banks; ++bank)
+        content += "tab_map_hit_bank_" + std::to_string(bank) + ",\n";
+    content += "};";
+
+    std::printf("%ld banks of %ld rows\n", banks, bankRows);
+    writeOutput(outputFileMapHitBanked, content);
+}
+
+static void generateTabMapHit (bool banked) {
+    const long tableSize = (long)MAP_SIZE * MAP_SIZE * AP * PIXEL_COLUMNS;
+    const std::vector<Job> jobs = createJobs();
+    const unsigned numCores = std::max(1u, std::thread::hardware_concurrency());
+
+    // Per thread: values written by current job, and the job stamp telling which entries were written by current job
+    struct Scratch {
+        std::vector<uint16_t> values;
+        std::vector<uint32_t> stamps;
+        std::vector<uint32_t> written;
+    };
+    std::vector<Scratch> scratches(numCores);
+
+    std::vector<uint16_t> table(tableSize, 0);
+    std::vector<uint8_t> isSet(tableSize, 0);
+
+    // Jobs results are merged in job order, so later positions overwrite earlier ones like the scripts do
+    std::mutex mergeMutex;
+    std::condition_variable mergeCond;
+    size_t nextJobToMerge = 0;
+    std::atomic<bool> failed(false);
+    std::string failure;
+
+    runWorkers(jobs, [&](unsigned t, size_t j, const Job& job) {
+        Scratch& s = scratches[t];
+        if (s.values.empty()) {
+            s.values.assign(tableSize, 0);
+            s.stamps.assign(tableSize, 0);
+        }
+        s.written.clear();
+        const uint32_t stamp = (uint32_t)j + 1;
+        std::vector<Hit> hits(PIXEL_COLUMNS);
+
+        try {
+            sweepPositions(job.startPosX, job.endPosX, [&](int posX, int posY) {
+                const long tileBase = (long)((posX / FP) * MAP_SIZE + (posY / FP)) * AP;
+                for (int a = 0; a < AP; ++a) {
+                    ddaAngle(posX, posY, a, hits.data());
+                    const long base = (tileBase + a) * PIXEL_COLUMNS;
+                    for (int column = 0; column < PIXEL_COLUMNS; ++column) {
+                        const Hit& h = hits[column];
+                        if (!h.hit)
+                            continue;
+                        // sanity check
+                        if (h.sideDist >= 4096)
+                            throw std::runtime_error("Sanity check failed: sideDistXY >= 4096");
+                        // The value is calculated in next layout:
+                        //   16 bits:  dddddddddddd    mmmm
+                        //              sideDistXY     mapXY
+                        //              (12 bits)    (4 bits)
+                        const uint16_t value = (uint16_t)(((h.sideDist & MAP_HIT_MASK_SIDEDISTXY) << MAP_HIT_OFFSET_SIDEDISTXY)
+                                | ((h.mapXY & MAP_HIT_MASK_MAPXY) << MAP_HIT_OFFSET_MAPXY));
+                        const long index = base + column;
+                        if (s.stamps[index] != stamp) {
+                            s.stamps[index] = stamp;
+                            s.written.push_back((uint32_t)index);
+                        }
+                        s.values[index] = value;
+                    }
+                }
+            });
+        }
+        catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(mergeMutex);
+            failure = e.what();
+            failed = true;
+        }
+
+        std::unique_lock<std::mutex> lock(mergeMutex);
+        mergeCond.wait(lock, [&] { return nextJobToMerge == j; });
+        for (const uint32_t index : s.written) {
+            table[index] = s.values[index];
+            isSet[index] = 1;
+        }
+        ++nextJobToMerge;
+        mergeCond.notify_all();
+    });
+
+    if (failed)
+        throw std::runtime_error(failure);
+
+    // Complete the array of values with the missing elements (those unaccessible map regions)
+    long minIndex = -1, maxIndex = 0;
+    for (long i = 0; i < tableSize; ++i) {
+        if (isSet[i]) {
+            if (minIndex == -1) minIndex = i;
+            maxIndex = i;
+        }
+    }
+    if (minIndex == -1)
+        throw std::runtime_error("No hits were found");
+    const long finalArraySize = (maxIndex - minIndex) + 1;
+    std::printf("min calculated index: %ld\n", minIndex);
+    std::printf("max calculated index: %ld\n", maxIndex);
+    std::printf("final array size: (%ld - %ld) + 1 = %ld\n", maxIndex, minIndex, finalArraySize);
+
+    if (banked) {
+        writeTabMapHitBanked(table, minIndex, finalArraySize);
+        return;
+    }
+
+    // Groups of PIXEL_COLUMNS elems per line
+    std::string content;
+    content.reserve(finalArraySize * 6);
+    for (long i = 0; i < finalArraySize; ++i) {
+        if (i > 0)
+            content += (i % PIXEL_COLUMNS) == 0 ? ",\n" : ",";
+        content += std::to_string(table[minIndex + i]);
+    }
+    writeOutput(outputFileMapHit, content);
+}
+
+// ----------------------------------------------------------------------------------------
+// tiles_pair
+// ----------------------------------------------------------------------------------------
+
+// Same than Utils.writeVline()
+static void writeVline (int h2, int tileAttrib, int* framebuffer, int column) {
+    // Draw a solid vertical line
+    if (h2 == 0) {
+        for (int y = 0; y < VERTICAL_ROWS*TILEMAP_COLUMNS; y += TILEMAP_COLUMNS)
+            framebuffer[y + column] = tileAttrib;
+        return;
+    }
+
+    const int ta = h2 / 8; // vertical tilemap entry position
+    // top tilemap entry
+    framebuffer[ta*TILEMAP_COLUMNS + column] = tileAttrib + (h2 & 7); // offsets the tileAttrib by the halved pixel height modulo 8
+    // bottom tilemap entry (with flipped attribute)
+    framebuffer[((VERTICAL_ROWS-1) - ta)*TILEMAP_COLUMNS + column] = (tileAttrib + (h2 & 7)) | TILE_ATTR_VFLIP_MASK;
+
+    // Set tileAttrib which points to a colored tile. Rows in between both edges
+    for (int row = ta + 1; row <= (VERTICAL_ROWS-2) - ta; ++row)
+        framebuffer[row*TILEMAP_COLUMNS + column] = tileAttrib;
+}
+
+static void generateTilesPair () {
+    const std::vector<Job> jobs = createJobs();
+    const unsigned numCores = std::max(1u, std::thread::hardware_concurrency());
+    const int keys = TILE_INDEX_MASK + 1;
+
+    // Per thread: bitset of the pairs found, and both framebuffers
+    struct Scratch {
+        std::vector<uint64_t> pairs;
+        std::vector<int> planeA, planeB;
+    };
+    std::vector<Scratch> scratches(numCores);
+    std::atomic<bool> failed(false);
+    std::mutex failureMutex;
+    std::string failure;
+
+    runWorkers(jobs, [&](unsigned t, size_t, const Job& job) {
+        Scratch& s = scratches[t];
+        if (s.pairs.empty()) {
+            s.pairs.assign((size_t)keys * keys / 64, 0);
+            s.planeA.assign(VERTICAL_ROWS*TILEMAP_COLUMNS, 0);
+            s.planeB.assign(VERTICAL_ROWS*TILEMAP_COLUMNS, 0);
+        }
+        std::vector<Hit> hits(PIXEL_COLUMNS);
+
+        try {
+            sweepPositions(job.startPosX, job.endPosX, [&](int posX, int posY) {
+                for (int a = 0; a < AP; ++a) {
+                    std::fill(s.planeA.begin(), s.planeA.end(), 0);
+                    std::fill(s.planeB.begin(), s.planeB.end(), 0);
+
+                    ddaAngle(posX, posY, a, hits.data());
+                    for (int column = 0; column < PIXEL_COLUMNS; ++column) {
+                        const Hit& h = hits[column];
+                        if (!h.hit)
+                            continue;
+                        if (h.sideDist >= (int)tab_wall_div.size())
+                            throw std::runtime_error("Sanity check failed: sideDistXY >= " + std::to_string(tab_wall_div.size()));
+
+                        const int h2 = tab_wall_div[h.sideDist]; // height halved
+                        const int d8_1 = tab_color_d8_1[h.sideDist]; // the bigger the distant the darker the color is
+                        // Side X uses PAL0 and side Y uses PAL1. Odd map cells use the tiles that point to second half of wall's palette
+                        const int pal = h.sideX ? PAL0 : PAL1;
+                        const int tileAttrib = (pal << TILE_ATTR_PALETTE_SFT) + d8_1 + ((h.mapXY & 1) ? 8*8 : 0);
+
+                        writeVline(h2, tileAttrib, (column % 2) == 0 ? s.planeA.data() : s.planeB.data(), column / 2);
+                    }
+
+                    // Traverse both framebuffers and track generated pairs between each entry.
+                    // Mirrored combinations are the same pair. Eg: 1-89 is same than 89-1.
+                    for (int i = 0; i < VERTICAL_ROWS*TILEMAP_COLUMNS; ++i) {
+                        const int tileA = s.planeA[i] & TILE_INDEX_MASK;
+                        const int tileB = s.planeB[i] & TILE_INDEX_MASK;
+                        const size_t key = (size_t)std::min(tileA, tileB) * keys + std::max(tileA, tileB);
+                        s.pairs[key / 64] |= (uint64_t)1 << (key % 64);
+                    }
+                }
+            });
+        }
+        catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            failure = e.what();
+            failed = true;
+        }
+    });
+
+    if (failed)
+        throw std::runtime_error(failure);
+
+    // Sorted by first tile index, then by second tile index
+    std::string content;
+    for (size_t key = 0; key < (size_t)keys * keys; ++key) {
+        bool found = false;
+        for (const Scratch& s : scratches)
+            found |= !s.pairs.empty() && ((s.pairs[key / 64] >> (key % 64)) & 1);
+        if (found)
+            content += std::to_string(key / keys) + "-" + std::to_string(key % keys) + "\n";
+    }
+    writeOutput(outputFileTilesPair, content);
+}
+
+static int usage (const char* program) {
+    std::fprintf(stderr, "Usage: %s [tab_map_hit|tab_map_hit_banked|tiles_pair|all] [--range <startPosX> <endPosX>] [--check]\n", program);
+    return 1;
+}
+
+int main (int argc, char** argv) {
+    std::string mode = "all";
+    bool hasRange = false;
+    int rangeStart = 0, rangeEnd = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--check")
+            checkMode = true;
+        else if (arg == "--range" && i + 2 < argc) {
+            hasRange = true;
+            rangeStart = std::atoi(argv[++i]);
+            rangeEnd = std::atoi(argv[++i]);
+        }
+        else if (i == 1 && (arg == "tab_map_hit" || arg == "tab_map_hit_banked" || arg == "tiles_pair" || arg == "all"))
+            mode = arg;
+        else
+            return usage(argv[0]);
+    }
+
+    try {
+        loadConsts();
+        sweepStartPosX = hasRange ? std::max(rangeStart, MIN_POS_XY) : MIN_POS_XY;
+        sweepEndPosX = hasRange ? std::min(rangeEnd, MAX_POS_XY) : MAX_POS_XY;
+        if (sweepStartPosX > sweepEndPosX)
+            throw std::runtime_error("Empty range: posX goes from " + std::to_string(MIN_POS_XY) + " to " + std::to_string(MAX_POS_XY));
+        if (hasRange)
+            std::printf("posX range: [%d, %d]\n", sweepStartPosX, sweepEndPosX);
+
+        loadInputs();
+        prepareAngles();
+
+        if (checkMode) {
+            checkCommittedTable(tabWallDivFile, "const u16 tab_wall_div[", tab_wall_div);
+            checkCommittedTable(tabColorD8_1File, "const u8 tab_color_d8_1[", tab_color_d8_1);
+        }
+
+        if (mode == "tab_map_hit" || mode == "all")
+            generateTabMapHit(false);
+        if (mode == "tab_map_hit_banked")
+            generateTabMapHit(true);
+        if (mode == "tiles_pair" || mode == "all")
+            generateTilesPair();
+
+        printTime();
+    }
+    catch (const std::exception& e) {
+        std::printf("\n");
+        std::fprintf(stderr, "[ERROR] %s\n", e.what());
+        printTime();
+        return 1;
+    }
+    return checkFailed ? 1 : 0;
+}
@@ -0,0 +1,54 @@
+const fs = require('fs');
+// Check correct values of constants before script execution. See consts.h.
+const { VERTICAL_ROWS, PAL0, PAL1, TILE_ATTR_PALETTE_SFT, TILE_ATTR_VFLIP_MASK } = require('./consts');
+
+const outputFile = 'tab_column_patterns_OUTPUT.txt';
+
+// Keep in sync with tab_column_patterns.h
+const PATTERN_STRIDE = 32; // VERTICAL_ROWS entries padded to 64 bytes, so no pattern crosses a 128KB boundary (DMA limitation)
+const H2_VALUES = (VERTICAL_ROWS/2)*8; // every h2 write_vline() accepts
+const KEYS = 32; // 8 shades * 2 tile banks * 2 palettes
+
+// tileAttrib of a key: d8_1 = 1 + d*8, plus 8*8 for the second tile bank, plus the palette (PAL0 or PAL1)
+function keyToTileAttrib (key) {
+    const d = key & 7;
+    const bank = (key >> 3) & 1;
+    const pal = (key >> 4) & 1 ? PAL1 : PAL0;
+    return (pal << TILE_ATTR_PALETTE_SFT) | (1 + d*8 + bank*8*8);
+}
+
+// Same entries write_vline() sets into a cleared column of the framebuffer
+function generatePattern (h2, tileAttrib) {
+    const pattern = new Array(PATTERN_STRIDE).fill(0);
+    // Solid column from top to bottom
+    if (h2 === 0) {
+        pattern.fill(tileAttrib, 0, VERTICAL_ROWS);
+        return pattern;
+    }
+    const ta = Math.floor(h2 / 8);
+    for (let r = ta + 1; r < VERTICAL_ROWS/2; ++r) {
+        pattern[r] = tileAttrib;
+        pattern[(VERTICAL_ROWS-1) - r] = tileAttrib;
+    }
+    pattern[ta] = tileAttrib + (h2 & 7);
+    pattern[(VERTICAL_ROWS-1) - ta] = (tileAttrib + (h2 & 7)) | TILE_ATTR_VFLIP_MASK;
+    return pattern;
+}
+
+// Main execution
+try {
+    const lines = [];
+    // Pattern 0 is the empty column
+    lines.push(`${new Array(PATTERN_STRIDE).fill(0).join(',')},`);
+    // Pattern 1 + (h2 << 5) + key
+    for (let h2 = 0; h2 < H2_VALUES; ++h2) {
+        for (let key = 0; key < KEYS; ++key) {
+            lines.push(`${generatePattern(h2, keyToTileAttrib(key)).join(',')},`);
+        }
+    }
+
+    fs.writeFileSync(outputFile, lines.join('\n'));
+    console.log(`File ${outputFile} created.`);
+} catch (error) {
+    console.error('An error occurred:', error.message);
+}
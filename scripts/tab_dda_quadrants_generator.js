@@ -0,0 +1,79 @@
+const fs = require('fs');
+const utils = require('./utils');
+// Check correct values of constants before script execution. See consts.h.
+const { AP, PIXEL_COLUMNS } = require('./consts');
+
+// Since rayDir = dir + plane*cameraX, each ray component is linear along the columns, so its sign changes at most once.
+// Thus the columns of any angle are split in at most 3 segments of same quadrant.
+const DDA_QUADRANT_SEGMENTS = 3;
+
+// Quadrant bits. Same than in tab_dda_quadrants.h
+const QUADRANT_NEG_X = 1; // rayDirAngleX < 0 => stepX = -1
+const QUADRANT_NEG_Y = 2; // rayDirAngleY < 0 => stepY = -1
+
+const tabDeltasFile = '../inc/tab_deltas.h';
+const outputFile = 'tab_dda_quadrants_OUTPUT.txt';
+
+function toSigned16 (v) {
+    return v >= 0x8000 ? v - 0x10000 : v;
+}
+
+/**
+ * For every angle returns DDA_QUADRANT_SEGMENTS pairs of [endColumn, quadrant].
+ * Unused segments are filled with [PIXEL_COLUMNS, 0] so they are skipped by the render loop.
+ */
+function generateQuadrantSegments (tab_deltas) {
+    const result = [];
+    for (let a = 0; a < AP; ++a) {
+        const segments = [];
+        let signChangesX = 0, signChangesY = 0;
+        let prevQuadrant = -1;
+
+        for (let column = 0; column < PIXEL_COLUMNS; ++column) {
+            const base = (a * PIXEL_COLUMNS + column) * 4;
+            const rayDirAngleX = toSigned16(tab_deltas[base + 2]);
+            const rayDirAngleY = toSigned16(tab_deltas[base + 3]);
+            const quadrant = (rayDirAngleX < 0 ? QUADRANT_NEG_X : 0) | (rayDirAngleY < 0 ? QUADRANT_NEG_Y : 0);
+
+            if (prevQuadrant !== -1 && quadrant !== prevQuadrant) {
+                if ((quadrant ^ prevQuadrant) & QUADRANT_NEG_X) ++signChangesX;
+                if ((quadrant ^ prevQuadrant) & QUADRANT_NEG_Y) ++signChangesY;
+                // close current segment
+                segments[segments.length - 1][0] = column;
+            }
+            if (quadrant !== prevQuadrant) {
+                segments.push([PIXEL_COLUMNS, quadrant]);
+            }
+            prevQuadrant = quadrant;
+        }
+
+        if (signChangesX > 1 || signChangesY > 1 || segments.length > DDA_QUADRANT_SEGMENTS) {
+            throw new Error(`Angle ${a} has ${segments.length} segments. Ray direction signs are expected to change at most once per axis.`);
+        }
+
+        while (segments.length < DDA_QUADRANT_SEGMENTS) {
+            segments.push([PIXEL_COLUMNS, 0]);
+        }
+        result.push(segments);
+    }
+    return result;
+}
+
+// Write output to file
+function writeArray (filename, segmentsPerAngle) {
+    const lines = segmentsPerAngle.map((segments, a) =>
+        `${segments.map(s => `${s[0]},${s[1]}`).join(', ')}, // ${a}`);
+    fs.writeFileSync(filename, lines.join('\n'));
+    console.log(`File ${filename} created.`);
+}
+
+// Main execution
+try {
+    const tab_deltas = utils.readTabDeltas(tabDeltasFile);
+    const segmentsPerAngle = generateQuadrantSegments(tab_deltas);
+    writeArray(outputFile, segmentsPerAngle);
+
+    console.log('Processing completed successfully.');
+} catch (error) {
+    console.error('An error occurred:', error.message);
+}
@@ -2,7 +2,9 @@ const fs = require('fs');
 // Check correct values of constants before script execution. See consts.h.
 const { FP, AP, PIXEL_COLUMNS, M_PI, MAX_U16 } = require('./consts');
 
-const outputFile = 'tab_deltas_OUTPUT.txt';
+// Run with argument 'folded' to only output the first quadrant of angles (see RENDER_USE_TAB_DELTAS_FOLDED)
+const folded = process.argv.includes('folded');
+const outputFile = folded ? 'tab_deltas_folded_OUTPUT.txt' : 'tab_deltas_OUTPUT.txt';
 
 let tabDeltas = new Uint16Array(AP * PIXEL_COLUMNS * 4);
 let deltaPtr = 0;
@@ -111,9 +113,11 @@ for (let i = 0; i < AP; i++) {
     }
 }
 
-// Convert the Uint16Array to a string with the new format
+// Convert the Uint16Array to a string with the new format.
+// Other quadrants are the first one with deltaDist swapped and/or rayDir negated, so folded only keeps the first AP/4 angles.
+const outputLength = folded ? (AP/4) * PIXEL_COLUMNS * 4 : tabDeltas.length;
 let content = '';
-for (let i = 0; i < tabDeltas.length; i += 4) {
+for (let i = 0; i < outputLength; i += 4) {
     content += `${tabDeltas[i+0]}, ${tabDeltas[i+1]}, ${tabDeltas[i+2]}, ${tabDeltas[i+3]},\n`;
 }
 
@@ -1,9 +1,12 @@
 const fs = require('fs');
 const utils = require('./utils');
 const { loadDeltaDists, generateMinPerHashMap } = require('./perf_hash_mulu_256_shft_FS_generator');
+const { AP, PIXEL_COLUMNS } = require('./consts');
 
 const inputFile = '../inc/tab_deltas.h';
-const outputFile = 'tab_deltas_perf_hash_OUTPUT.txt';
+// Run with argument 'folded' to only output the first quadrant of angles (see RENDER_USE_TAB_DELTAS_FOLDED)
+const folded = process.argv.includes('folded');
+const outputFile = folded ? 'tab_deltas_perf_hash_folded_OUTPUT.txt' : 'tab_deltas_perf_hash_OUTPUT.txt';
 
 async function processFile () {
     const tab_deltas = utils.readTabDeltas(inputFile);
@@ -12,7 +15,10 @@ async function processFile () {
     const outputLines = [];
     const asmFactor = 'ASM_PERF_HASH_JUMP_BLOCK_SIZE_BYTES';
 
-    for (let c = 0; c < tab_deltas.length; c+=4) {
+    // Perfect hash is still built from every angle, so folded and full tables share the same perf hash indices
+    const inputLength = folded ? (AP/4) * PIXEL_COLUMNS * 4 : tab_deltas.length;
+
+    for (let c = 0; c < inputLength; c+=4) {
         let ddxph = minPerfHashMap.get(tab_deltas[c+0]); // deltaDistX_perf_hash
         let ddyph = minPerfHashMap.get(tab_deltas[c+1]); // deltaDistY_perf_hash
         outputLines.push(
@@ -0,0 +1,238 @@
+const fs = require('fs');
+const zlib = require('zlib');
+// Check correct values of constants before script execution. See consts.h.
+const { VERTICAL_ROWS, TILEMAP_COLUMNS } = require('./consts');
+
+// Renders the floor and ceiling of every view (angle bucket and position bucket inside a map cell) the same way than the
+// prototype at ceiling_floor_gen/script_context2d.js, but with the camera of the raycaster (see tab_deltas_generator.js).
+// Each view is reduced to FLOOR_CEILING_TILES tiles plus a tilemap of VERTICAL_ROWS*TILEMAP_COLUMNS tile indices.
+// Eg: node tab_floor_ceiling_generator.js
+
+const outputFileTiles = 'tab_floor_ceiling_tiles_OUTPUT.txt';
+const outputFileTilemaps = 'tab_floor_ceiling_tilemaps_OUTPUT.txt';
+
+const floorTextureFile = 'ceiling_floor_gen/floor_texture.png';
+const ceilingTextureFile = 'ceiling_floor_gen/ceiling_texture.png';
+
+// Keep in sync with consts.h
+const FLOOR_CEILING_ANGLES = 16; // angle buckets along the 1024 binary angle units
+const FLOOR_CEILING_POS_STEPS = 2; // position buckets per axis inside a map cell
+const FLOOR_CEILING_TILES = 192; // tiles per view
+
+const WIDTH = TILEMAP_COLUMNS * 8;
+const HALF_HEIGHT = (VERTICAL_ROWS * 8) / 2;
+// Wall half height at distance d (in map cells) is about TILEMAP_COLUMNS/d pixels (see tab_wall_div in utils.js),
+// and the camera is at half the wall height, so the floor at d shows at TILEMAP_COLUMNS/d pixels below the horizon.
+const PROJECTION = TILEMAP_COLUMNS;
+const SUPERSAMPLE = 4; // per axis, to smooth the far rows
+const KMEANS_ITERATIONS = 4;
+
+// Minimal PNG decoder: 8 bits RGB or RGBA, non interlaced. Returns the luminance of every pixel stretched to [0, 1],
+// since the textures are dark and we only have 7 shades of grey.
+function readPngLuminance (file) {
+    const buf = fs.readFileSync(file);
+    let width = 0, height = 0, colorType = 0;
+    const idat = [];
+    for (let off = 8; off < buf.length; ) {
+        const len = buf.readUInt32BE(off);
+        const type = buf.toString('ascii', off + 4, off + 8);
+        const data = buf.subarray(off + 8, off + 8 + len);
+        if (type === 'IHDR') {
+            width = data.readUInt32BE(0);
+            height = data.readUInt32BE(4);
+            colorType = data[9];
+            if (data[8] !== 8 || data[12] !== 0 || (colorType !== 2 && colorType !== 6))
+                throw new Error(`${file}: only 8 bits RGB/RGBA non interlaced is supported`);
+        }
+        else if (type === 'IDAT')
+            idat.push(data);
+        off += 12 + len;
+    }
+    const bpp = colorType === 6 ? 4 : 3;
+    const raw = zlib.inflateSync(Buffer.concat(idat));
+    const stride = width * bpp;
+    const pixels = Buffer.alloc(stride * height);
+    for (let y = 0; y < height; ++y) {
+        const filter = raw[y * (stride + 1)];
+        for (let x = 0; x < stride; ++x) {
+            const v = raw[y * (stride + 1) + 1 + x];
+            const a = x >= bpp ? pixels[y * stride + x - bpp] : 0;
+            const b = y > 0 ? pixels[(y - 1) * stride + x] : 0;
+            const c = x >= bpp && y > 0 ? pixels[(y - 1) * stride + x - bpp] : 0;
+            let p;
+            switch (filter) {
+                case 0: p = 0; break;
+                case 1: p = a; break;
+                case 2: p = b; break;
+                case 3: p = (a + b) >> 1; break;
+                case 4: {
+                    const pa = Math.abs(b - c), pb = Math.abs(a - c), pc = Math.abs(a + b - 2 * c);
+                    p = pa <= pb && pa <= pc ? a : (pb <= pc ? b : c);
+                    break;
+                }
+                default: throw new Error(`${file}: unknown filter ${filter}`);
+            }
+            pixels[y * stride + x] = (v + p) & 0xFF;
+        }
+    }
+    const lum = new Float64Array(width * height);
+    for (let i = 0; i < width * height; ++i)
+        lum[i] = 0.299 * pixels[i * bpp] + 0.587 * pixels[i * bpp + 1] + 0.114 * pixels[i * bpp + 2];
+    const min = Math.min(...lum), max = Math.max(...lum);
+    for (let i = 0; i < lum.length; ++i)
+        lum[i] = max > min ? (lum[i] - min) / (max - min) : 0;
+    return { width, height, lum };
+}
+
+// Color index of every pixel of the view, VERTICAL_ROWS*8 rows of WIDTH pixels. Ceiling on top half, floor on bottom half.
+// Colors 1..7 of PAL0 are the grey ramp from darker to lighter, so 0 (BG color) is never used.
+function renderView (floorTex, ceilingTex, angleBucket, posX, posY) {
+    const a = (angleBucket * 2 * Math.PI) / FLOOR_CEILING_ANGLES;
+    const dirX = Math.sin(a), dirY = Math.cos(a);
+    const pixels = new Uint8Array(WIDTH * HALF_HEIGHT * 2);
+
+    for (let y = 0; y < HALF_HEIGHT; ++y) {
+        // Rows closer to the horizon are darker (exponential falloff as in the prototype)
+        const shade = 1 - Math.pow(1 - (y + 0.5) / HALF_HEIGHT, 4);
+        for (let x = 0; x < WIDTH; ++x) {
+            let sumFloor = 0, sumCeiling = 0;
+            for (let sy = 0; sy < SUPERSAMPLE; ++sy) {
+                const dist = PROJECTION / (y + (sy + 0.5) / SUPERSAMPLE);
+                for (let sx = 0; sx < SUPERSAMPLE; ++sx) {
+                    // Same ray than the raycaster: dir + plane, plane going from +dir rotated to -dir rotated (90 degrees FOV)
+                    const s = 1 - (2 * (x + (sx + 0.5) / SUPERSAMPLE)) / WIDTH;
+                    const wx = posX + (dirX + dirY * s) * dist;
+                    const wy = posY + (dirY - dirX * s) * dist;
+                    sumFloor += sample(floorTex, wx, wy);
+                    sumCeiling += sample(ceilingTex, wx, wy);
+                }
+            }
+            const n = SUPERSAMPLE * SUPERSAMPLE;
+            pixels[(HALF_HEIGHT + y) * WIDTH + x] = 1 + Math.round((sumFloor / n) * shade * 6);
+            pixels[(HALF_HEIGHT - 1 - y) * WIDTH + x] = 1 + Math.round((sumCeiling / n) * shade * 6);
+        }
+    }
+    return pixels;
+}
+
+// A texture covers one map cell
+function sample (tex, wx, wy) {
+    const u = Math.floor((wx - Math.floor(wx)) * tex.width) % tex.width;
+    const v = Math.floor((wy - Math.floor(wy)) * tex.height) % tex.height;
+    return tex.lum[v * tex.width + u];
+}
+
+// Splits the view into 8x8 tiles, as arrays of 64 color indices in tilemap order
+function toTiles (pixels) {
+    const tiles = [];
+    for (let ty = 0; ty < VERTICAL_ROWS; ++ty) {
+        for (let tx = 0; tx < TILEMAP_COLUMNS; ++tx) {
+            const tile = new Uint8Array(64);
+            for (let y = 0; y < 8; ++y)
+                for (let x = 0; x < 8; ++x)
+                    tile[y * 8 + x] = pixels[(ty * 8 + y) * WIDTH + tx * 8 + x];
+            tiles.push(tile);
+        }
+    }
+    return tiles;
+}
+
+function tileDistance (a, b) {
+    let d = 0;
+    for (let i = 0; i < 64; ++i) {
+        const diff = a[i] - b[i];
+        d += diff * diff;
+    }
+    return d;
+}
+
+// k-means over the tiles of the view, starting from the most repeated ones. Returns the tileset and the tilemap.
+function reduceTiles (tiles) {
+    const unique = new Map();
+    for (const t of tiles) {
+        const key = t.join(',');
+        unique.set(key, (unique.get(key) || { tile: t, count: 0 }));
+        unique.get(key).count++;
+    }
+    const entries = [...unique.values()].sort((p, q) => q.count - p.count);
+    let centers = entries.slice(0, FLOOR_CEILING_TILES).map(e => Float64Array.from(e.tile));
+    const assign = new Array(entries.length).fill(0);
+
+    for (let it = 0; it < KMEANS_ITERATIONS && entries.length > FLOOR_CEILING_TILES; ++it) {
+        for (let i = 0; i < entries.length; ++i) {
+            let best = 0, bestDist = Infinity;
+            for (let c = 0; c < centers.length; ++c) {
+                const d = tileDistance(entries[i].tile, centers[c]);
+                if (d < bestDist) { bestDist = d; best = c; }
+            }
+            assign[i] = best;
+        }
+        const sums = centers.map(() => new Float64Array(64));
+        const counts = new Array(centers.length).fill(0);
+        for (let i = 0; i < entries.length; ++i) {
+            const c = assign[i];
+            for (let p = 0; p < 64; ++p)
+                sums[c][p] += entries[i].tile[p] * entries[i].count;
+            counts[c] += entries[i].count;
+        }
+        centers = centers.map((center, c) => counts[c] ? sums[c].map(v => v / counts[c]) : center);
+    }
+
+    const tileset = centers.map(c => Uint8Array.from(c, v => Math.min(7, Math.max(1, Math.round(v)))));
+    while (tileset.length < FLOOR_CEILING_TILES)
+        tileset.push(new Uint8Array(64).fill(1));
+
+    const tilemap = tiles.map(t => {
+        let best = 0, bestDist = Infinity;
+        for (let c = 0; c < tileset.length; ++c) {
+            const d = tileDistance(t, tileset[c]);
+            if (d < bestDist) { bestDist = d; best = c; }
+        }
+        return best;
+    });
+    return { tileset, tilemap };
+}
+
+// 8 u32 per tile, 8 pixels of 4 bits per u32 with the leftmost pixel in the highest nibble (same format than VDP_loadTileData())
+function tileToU32 (tile) {
+    const rows = [];
+    for (let y = 0; y < 8; ++y) {
+        let v = 0;
+        for (let x = 0; x < 8; ++x)
+            v = (v * 16) + tile[y * 8 + x];
+        rows.push('0x' + v.toString(16).toUpperCase().padStart(8, '0'));
+    }
+    return rows.join(',');
+}
+
+// Main execution
+try {
+    const floorTex = readPngLuminance(floorTextureFile);
+    const ceilingTex = readPngLuminance(ceilingTextureFile);
+    const linesTiles = [];
+    const linesTilemaps = [];
+
+    // View index: (angleBucket * FLOOR_CEILING_POS_STEPS + posBucketY) * FLOOR_CEILING_POS_STEPS + posBucketX
+    for (let ab = 0; ab < FLOOR_CEILING_ANGLES; ++ab) {
+        for (let py = 0; py < FLOOR_CEILING_POS_STEPS; ++py) {
+            for (let px = 0; px < FLOOR_CEILING_POS_STEPS; ++px) {
+                // Center of the position bucket, in map cells
+                const posX = (px + 0.5) / FLOOR_CEILING_POS_STEPS;
+                const posY = (py + 0.5) / FLOOR_CEILING_POS_STEPS;
+                const { tileset, tilemap } = reduceTiles(toTiles(renderView(floorTex, ceilingTex, ab, posX, posY)));
+                linesTiles.push(tileset.map(t => tileToU32(t)).join(',\n') + ',');
+                for (let r = 0; r < VERTICAL_ROWS; ++r)
+                    linesTilemaps.push(tilemap.slice(r * TILEMAP_COLUMNS, (r + 1) * TILEMAP_COLUMNS).join(',') + ',');
+                console.log(`View angle ${ab} pos ${px},${py} done.`);
+            }
+        }
+    }
+
+    fs.writeFileSync(outputFileTiles, linesTiles.join('\n'));
+    console.log(`File ${outputFileTiles} created.`);
+    fs.writeFileSync(outputFileTilemaps, linesTilemaps.join('\n'));
+    console.log(`File ${outputFileTilemaps} created.`);
+    console.log('Processing completed successfully.');
+} catch (error) {
+    console.error('An error occurred:', error.message);
+}
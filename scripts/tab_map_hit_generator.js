@@ -15,6 +15,11 @@ const outputFile = 'tab_map_hit_OUTPUT.txt';
 
 const MAX_JOBS = 256;
 
+// Optional posX range: node tab_map_hit_generator.js <startPosX> <endPosX>
+// Same than map_tables_generator --range, so both outputs can be compared with its --check over a short range.
+const rangeStartPosX = process.argv.length > 3 ? Math.max(parseInt(process.argv[2], 10), MIN_POS_XY) : MIN_POS_XY;
+const rangeEndPosX = process.argv.length > 3 ? Math.min(parseInt(process.argv[3], 10), MAX_POS_XY) : MAX_POS_XY;
+
 const MODE_CHECK_LOADED_MATRIX = false;
 const loadedMatrix = [];
 
@@ -312,11 +317,13 @@ function runWorkers () {
         let startTimeStr = new Date().toLocaleString('en-US', { hour12: false });
         console.log(startTimeStr);
 
-        // Create job queue
+        // Create job queue. Jobs are cut to the posX range, if any, keeping the same boundaries than the whole sweep.
         const chunkSize = Math.ceil((MAX_POS_XY - MIN_POS_XY + 1) / MAX_JOBS);
         for (let startPosX = MIN_POS_XY; startPosX <= MAX_POS_XY; startPosX += chunkSize) {
-            const endPosX = Math.min(startPosX + chunkSize - 1, MAX_POS_XY);
-            jobQueue.push({ startPosX, endPosX });
+            const from = Math.max(startPosX, rangeStartPosX);
+            const to = Math.min(startPosX + chunkSize - 1, MAX_POS_XY, rangeEndPosX);
+            if (from <= to)
+                jobQueue.push({ startPosX: from, endPosX: to });
         }
 
         // Reset iterations counter
@@ -0,0 +1,116 @@
+const fs = require('fs');
+
+// Input is the output of tiles_pair_generator.js: one "tileA-tileB occurrences" per line.
+// Eg: node --max-old-space-size=4092 tiles_pair_generator.js 16 && node tab_tiles_pair_generator.js
+const inputFile = 'tiles_pair_OUTPUT.txt';
+const outputFileDict = 'tab_tiles_pair_dict_OUTPUT.txt';
+const outputFileLookup = 'tab_tiles_pair_OUTPUT.txt';
+
+const ELEMENTS_PER_LINE = 129;
+
+// Keep in sync with tab_tiles_pair.h
+const WALL_TILES = 1 + 8*8 + 8*8; // empty tile + 8 heights * 8 shades * 2 banks (see render_loadTiles())
+const DICT_SIZE = 256; // combined tiles loaded into VRAM. Slot fits in a u8
+
+// Tile t > 0 is 1 + bank*64 + shade*8 + top, and its pixel rows top..7 are filled with the shade
+function tileRows (t) {
+    const rows = new Array(8).fill(-1); // -1 is an empty row
+    if (t === 0)
+        return rows;
+    const top = (t - 1) & 7;
+    const shade = ((t - 1) >> 3) & 7;
+    const bank = (t - 1) >> 6;
+    for (let h = top; h < 8; ++h)
+        rows[h] = shade + bank*8;
+    return rows;
+}
+
+// Visual distance between two tiles: a row filled in one and empty in the other costs the most,
+// a row with a shade of the other bank (another color ramp) costs like a full shade ramp, otherwise the shade difference.
+function tileDistance (rowsA, rowsB) {
+    let dist = 0;
+    for (let h = 0; h < 8; ++h) {
+        const a = rowsA[h], b = rowsB[h];
+        if (a === b)
+            continue;
+        if (a === -1 || b === -1)
+            dist += 16;
+        else if ((a >> 3) !== (b >> 3))
+            dist += 8;
+        else
+            dist += Math.abs(a - b);
+    }
+    return dist;
+}
+
+function readPairs () {
+    const pairs = [];
+    const lines = fs.readFileSync(inputFile, 'utf8').split('\n');
+    for (const line of lines) {
+        const m = line.trim().match(/^(\d+)-(\d+)(?:\s+(\d+))?$/);
+        if (!m)
+            continue;
+        // Files without occurrences (old format) give the same weight to every pair
+        pairs.push({ a: parseInt(m[1], 10), b: parseInt(m[2], 10), count: m[3] === undefined ? 1 : parseInt(m[3], 10) });
+    }
+    return pairs;
+}
+
+// Slot 0 is the pair of empty tiles, so a cleared tilemap entry keeps being the empty tile.
+// Remaining slots are the most frequent pairs.
+function generateDict (pairs) {
+    const sorted = pairs.filter(p => p.a !== 0 || p.b !== 0).sort((p, q) => q.count - p.count || p.a - q.a || p.b - q.b);
+    const dict = [{ a: 0, b: 0 }];
+    for (let i = 0; i < sorted.length && dict.length < DICT_SIZE; ++i)
+        dict.push({ a: sorted[i].a, b: sorted[i].b });
+    // Fill unused slots with the empty pair so the table always has DICT_SIZE entries
+    while (dict.length < DICT_SIZE)
+        dict.push({ a: 0, b: 0 });
+
+    const total = pairs.reduce((acc, p) => acc + p.count, 0);
+    const covered = sorted.slice(0, DICT_SIZE - 1).reduce((acc, p) => acc + p.count, 0) + pairs.filter(p => p.a === 0 && p.b === 0).reduce((acc, p) => acc + p.count, 0);
+    console.log(`${pairs.length} distinct pairs. Dictionary of ${DICT_SIZE} covers ${(100 * covered / total).toFixed(2)}% of the tilemap entries.`);
+    return dict;
+}
+
+// Every (tileA, tileB) gets the slot of its dictionary pair, or the visually nearest one when it isn't in the dictionary
+function generateLookup (dict) {
+    const rows = [];
+    for (let t = 0; t < WALL_TILES; ++t)
+        rows.push(tileRows(t));
+
+    const lookup = [];
+    for (let a = 0; a < WALL_TILES; ++a) {
+        for (let b = 0; b < WALL_TILES; ++b) {
+            let best = 0, bestDist = Infinity;
+            for (let s = 0; s < dict.length; ++s) {
+                const d = tileDistance(rows[a], rows[dict[s].a]) + tileDistance(rows[b], rows[dict[s].b]);
+                if (d < bestDist) {
+                    best = s;
+                    bestDist = d;
+                }
+            }
+            lookup.push(best);
+        }
+    }
+    return lookup;
+}
+
+function writeArray (filename, inputArray, elementsPerLine) {
+    const lines = [];
+    for (let i = 0; i < inputArray.length; i += elementsPerLine) {
+        lines.push(`${inputArray.slice(i, i + elementsPerLine).join(',')},`);
+    }
+    fs.writeFileSync(filename, lines.join('\n'));
+    console.log(`File ${filename} created.`);
+}
+
+// Main execution
+try {
+    const dict = generateDict(readPairs());
+    writeArray(outputFileDict, dict.flatMap(p => [p.a, p.b]), 32);
+    writeArray(outputFileLookup, generateLookup(dict), ELEMENTS_PER_LINE);
+    console.log('Processing completed successfully.');
+} catch (error) {
+    console.error('An error occurred:', error.message);
+}
@@ -0,0 +1,56 @@
+const fs = require('fs');
+const utils = require('./utils');
+// Check correct values of constants before script execution. See consts.h.
+const { PAL0, PAL1, TILE_ATTR_PALETTE_SFT } = require('./consts');
+
+const ELEMENTS_PER_LINE = 64;
+
+const outputFileX = 'tab_wall_hit_X_fused_OUTPUT.txt';
+const outputFileY = 'tab_wall_hit_Y_fused_OUTPUT.txt';
+
+// Each element is (h2 << 16) | tileAttrib, interleaved by parity: use (2*sideDist + parity) to access the desired value.
+// tileAttrib is the same than in tab_color_d8_1_X/Y_pals_shft[] and h2 is the same than in tab_wall_div[].
+function fuseArrays (tab_wall_div, tab_color_d8_1, pal) {
+    const result = [];
+    for (let sideDist = 0; sideDist < tab_wall_div.length; ++sideDist) {
+        const h2 = tab_wall_div[sideDist];
+        for (let parity = 0; parity < 2; ++parity) {
+            const tileAttrib = (pal << TILE_ATTR_PALETTE_SFT) | (tab_color_d8_1[sideDist] + (parity === 1 ? 8*8 : 0));
+            // >>> 0 keeps the value as unsigned 32 bits
+            result.push(((h2 << 16) | tileAttrib) >>> 0);
+        }
+    }
+    return result;
+}
+
+// Write output to file
+function writeArray (filename, inputArray) {
+    const lines = [];
+    for (let i = 0; i < inputArray.length; i += ELEMENTS_PER_LINE) {
+        lines.push(`${inputArray.slice(i, i + ELEMENTS_PER_LINE).map(n => '0x' + n.toString(16).toUpperCase().padStart(8, '0')).join(',')},`);
+    }
+    let linesContent = lines.join('\n');
+
+    fs.writeFileSync(filename, linesContent);
+    console.log(`File ${filename} created.`);
+}
+
+// Main execution
+try {
+    const tab_wall_div = utils.generateTabWallDiv();
+    const tab_color_d8_1 = utils.generateTabColor_d8_1();
+
+    // This is what we are pre calculating (same for Y but with PAL1 and mapX):
+    //    u16 h2 = tab_wall_div[sideDistX];
+    //    u16 tileAttrib = tab_color_d8_1_X_pals_shft[sideDistX*2 + (mapY&1)];
+    //    u32 h2_tileAttrib = (h2 << 16) | tileAttrib;
+    const tab_wall_hit_X_fused = fuseArrays(tab_wall_div, tab_color_d8_1, PAL0);
+    const tab_wall_hit_Y_fused = fuseArrays(tab_wall_div, tab_color_d8_1, PAL1);
+
+    writeArray(outputFileX, tab_wall_hit_X_fused);
+    writeArray(outputFileY, tab_wall_hit_Y_fused);
+
+    console.log('Processing completed successfully.');
+} catch (error) {
+    console.error('An error occurred:', error.message);
+}
@@ -0,0 +1,64 @@
+const fs = require('fs');
+const utils = require('./utils');
+// Check correct values of constants before script execution. See consts.h.
+const { PAL0, PAL1, TILE_ATTR_PALETTE_SFT } = require('./consts');
+
+const ELEMENTS_PER_LINE = 512;
+
+const outputFileX = 'tab_wall_materials_X_OUTPUT.txt';
+const outputFileY = 'tab_wall_materials_Y_OUTPUT.txt';
+
+// Keep in sync with MAP_MATERIALS in map_matrix.h and the materials listed in tab_wall_materials.h.
+// Map cell value m (1..MAP_MATERIALS) uses MATERIALS[m-1]: palette on side X, palette on side Y, tile bank for even cells, tile bank for odd cells.
+// Cell parity is mapY&1 for a hit on side X and mapX&1 for a hit on side Y. Bank 1 are the tiles using the second half of wall's palette.
+const MATERIALS = [
+    [PAL0, PAL1, 0, 1], // 1: banks alternate by parity (same than tab_color_d8_1_X/Y_pals_shft)
+    [PAL1, PAL0, 0, 1], // 2: palettes swapped
+    [PAL0, PAL1, 0, 0], // 3: first bank only
+    [PAL0, PAL1, 1, 1], // 4: second bank only
+];
+
+// One sub table of tab_color_d8_1.length elements per column: column = 2*(m-1) + parity.
+// Sub tables are stored in column order 4,5,6,7,0,1,2,3 (column ^ 4), so after a ror.w #3 the column
+// becomes a signed word offset from the middle of the table (see hitOnSideX() in game_loop.c).
+function generateTable (tab_color_d8_1, side) {
+    const columns = MATERIALS.length * 2;
+    const result = [];
+    for (let slot = 0; slot < columns; ++slot) {
+        const column = slot ^ (columns / 2);
+        const material = MATERIALS[column >> 1];
+        const pal = material[side];
+        const bank = material[2 + (column & 1)];
+        for (let sideDist = 0; sideDist < tab_color_d8_1.length; ++sideDist) {
+            result.push((pal << TILE_ATTR_PALETTE_SFT) | (tab_color_d8_1[sideDist] + bank*8*8));
+        }
+    }
+    return result;
+}
+
+// Write output to file
+function writeArray (filename, inputArray) {
+    const lines = [];
+    for (let i = 0; i < inputArray.length; i += ELEMENTS_PER_LINE) {
+        lines.push(`${inputArray.slice(i, i + ELEMENTS_PER_LINE).join(',')},`);
+    }
+    let linesContent = lines.join('\n');
+
+    fs.writeFileSync(filename, linesContent);
+    console.log(`File ${filename} created.`);
+}
+
+// Main execution
+try {
+    if (MATERIALS.length !== 4)
+        throw new Error('The ror.w #3 trick needs exactly 8 columns (4 materials)');
+
+    const tab_color_d8_1 = utils.generateTabColor_d8_1();
+
+    writeArray(outputFileX, generateTable(tab_color_d8_1, 0));
+    writeArray(outputFileY, generateTable(tab_color_d8_1, 1));
+
+    console.log('Processing completed successfully.');
+} catch (error) {
+    console.error('An error occurred:', error.message);
+}
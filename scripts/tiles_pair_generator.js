@@ -12,12 +12,16 @@ const tabDeltasFile = '../inc/tab_deltas.h';
 const mapMatrixFile = '../src/map_matrix.c';
 const outputFile = 'tiles_pair_OUTPUT.txt';
 
+// Position stepping of the sweep. 1 visits every position, bigger values give a faster but sampled enumeration.
+// Eg: node --max-old-space-size=4092 tiles_pair_generator.js 16
+const POS_STEPPING = Math.max(1, parseInt(process.argv[2] || '1', 10));
+
 const TILE_INDEX_MASK = 0x7FF;
 
 const MAX_JOBS = 256;
 
 // Progress tracking
-const totalIterations = (MAX_POS_XY - MIN_POS_XY + 1) * (MAX_POS_XY - MIN_POS_XY + 1) * (1024/(1024/AP));
+const totalIterations = Math.ceil((MAX_POS_XY - MIN_POS_XY + 1) / POS_STEPPING) * Math.ceil((MAX_POS_XY - MIN_POS_XY + 1) / POS_STEPPING) * (1024/(1024/AP));
 let completedIterations = 0;
 
 function createTrackingKey (i, j) {
@@ -28,7 +32,8 @@ function trackTilePairsBetweenPlanes (framebuffer_planeA, framebuffer_planeB, ti
     for (let i = 0; i < VERTICAL_ROWS*TILEMAP_COLUMNS; i++) {
         // Construct the key using the bitmask TILE_INDEX_MASK which only keeps the tile index data of the framebuffer plane entry
         const key = createTrackingKey(framebuffer_planeA[i] & TILE_INDEX_MASK, framebuffer_planeB[i] & TILE_INDEX_MASK);
-        tilePairMap.set(key, 1);
+        // Occurrences of the pair, so the most used ones can be picked when they don't fit in VRAM (see tab_tiles_pair_generator.js)
+        tilePairMap.set(key, (tilePairMap.get(key) || 0) + 1);
     }
 }
 
@@ -36,7 +41,7 @@ function trackTilePairsBetweenPlanes (framebuffer_planeA, framebuffer_planeB, ti
 function processGameChunk (jobId, startPosX, endPosX, tab_deltas, tab_wall_div, tab_color_d8_1, map, framebuffer_planeA, framebuffer_planeB) {
 
     const tilePairMap = new Map();
-    const posStepping = 1;
+    const posStepping = POS_STEPPING;
 
     // NOTE: here we are moving from the most UPPER-LEFT position of the map[][] layout, 
     // stepping DOWN into Y Axis, and RIGHT into X Axis, where in each position we do a full rotation.
@@ -61,7 +66,7 @@ function processGameChunk (jobId, startPosX, endPosX, tab_deltas, tab_wall_div,
                     // Move one block of map: (FP + 2*MAP_FRACTION) = 384 units. The block size is FP, but we account for a safe distant to avoid clipping.
                     posX += (FP + 2*MAP_FRACTION) - posStepping;
                     // Send progress update to main thread
-                    parentPort.postMessage({ type: 'progress', value: (MAX_POS_XY - posY + 1) * (1024/(1024/AP)) });
+                    parentPort.postMessage({ type: 'progress', value: Math.ceil((MAX_POS_XY - posY + 1) / posStepping) * (1024/(1024/AP)) });
                     // Stop current Y and continue with next X until it gets outside the collision
                     break;
                 }
@@ -249,14 +254,15 @@ function writeOutputToFile (finalMap, outputFile) {
 
     let outputString = '';
     for (const [key, value] of mapEntries) {
-        outputString += `${key}\n`; // Format: "key"
+        outputString += `${key} ${value}\n`; // Format: "key occurrences"
     }
 
     fs.writeFileSync(outputFile, outputString, 'utf8');
 }
 
 function displayProgress () {
-    const progress = (completedIterations / totalIterations) * 100;
+    // Skipped collision positions are estimated, so clamp it
+    const progress = Math.min(100, (completedIterations / totalIterations) * 100);
     const progressBar = '='.repeat(Math.floor(progress / 2)) + '-'.repeat(50 - Math.floor(progress / 2));
     process.stdout.write(`\r[${progressBar}] ${progress.toFixed(2)}%`);
 }
@@ -398,7 +404,7 @@ if (isMainThread) {
             const finalMap = new Map();
             results.forEach(resultMap => {
                 for (const [key, value] of resultMap) {
-                    finalMap.set(key, value);
+                    finalMap.set(key, (finalMap.get(key) || 0) + value);
                 }
             });
 
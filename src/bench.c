@@ -0,0 +1,307 @@
+#include <types.h>
+#include <sys.h>
+#include <vdp.h>
+#include <tools.h>
+#include <string.h>
+#include "bench.h"
+#include "consts.h"
+#include "utils.h"
+#if RENDER_USE_MAP_HIT_COMPRESSED
+#include "map_hit_compressed.h"
+#endif
+#if BENCH_KERNELS
+#include <vdp_tile.h>
+#include <pal.h>
+#include "consts_ext.h"
+#include "frame_buffer.h"
+#include "render.h"
+#include "game_loop.h"
+#if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+#include "perf_hash_mulu_256_shft_FS.h"
+#endif
+#endif
+
+#if BENCH_AUTO_RUN || BENCH_KERNELS
+
+static u32 frame;
+static u32 dmaBytes;
+static u16 overrunLines;
+
+// Frame info line of the last frame, held until the VBlank that DMAs its framebuffer is done so it carries that VBlank's DMA bytes
+#define BENCH_ROW_NONE 0
+#define BENCH_ROW_WAITING_VINT 1
+#define BENCH_ROW_READY 2
+static vu16 rowState;
+static u32 rowFrame;
+static u16 rowPosX, rowPosY, rowAngle;
+static u32 rowDmaBytes;
+static u16 rowOverrunLines;
+
+void bench_reset ()
+{
+    frame = 0;
+    dmaBytes = 0;
+    overrunLines = 0;
+    rowState = BENCH_ROW_NONE;
+}
+
+static char* appendNum (char* str, u32 value)
+{
+    *str++ = ',';
+    uintToStr(value, str, 1);
+    while (*str)
+        ++str;
+    return str;
+}
+
+static void emitRow ()
+{
+    char msg[64];
+    strcpy(msg, BENCH_MSG_PREFIX);
+    char* p = msg + (sizeof(BENCH_MSG_PREFIX) - 1);
+    p = appendNum(p, rowFrame);
+    p = appendNum(p, rowPosX);
+    p = appendNum(p, rowPosY);
+    p = appendNum(p, rowAngle);
+    p = appendNum(p, rowDmaBytes);
+    p = appendNum(p, rowOverrunLines);
+    KDebug_Alert(msg);
+    rowState = BENCH_ROW_NONE;
+}
+
+FORCE_INLINE void bench_frameStart ()
+{
+    // Previous frame went through its VBlank, so its line is complete. Emitted before the counter starts so it isn't measured.
+    if (rowState == BENCH_ROW_READY)
+        emitRow();
+    STOPWATCH_68K_CYCLES_START();
+}
+
+void bench_frameEnd (u16 posX, u16 posY, u16 angle)
+{
+    STOPWATCH_68K_CYCLES_STOP();
+
+    rowFrame = frame;
+    rowPosX = posX;
+    rowPosY = posY;
+    rowAngle = angle;
+    rowState = BENCH_ROW_WAITING_VINT;
+
+    ++frame;
+}
+
+FORCE_INLINE void bench_addDmaBytes (u16 bytes)
+{
+    dmaBytes += bytes;
+}
+
+FORCE_INLINE void bench_markVIntEnd ()
+{
+    // VBlank region starts at scanline 224 and the VCounter rolls back to 0 once it ends (NTSC).
+    // So any value below 224 means we are already into the active display.
+    u16 vcnt = GET_VCOUNTER;
+    if (vcnt < 224)
+        overrunLines += vcnt + 1;
+
+    // This VBlank DMAed the framebuffer of the frame that just ended, so its bytes and overrun go with that frame.
+    // DMAs done in HInt during that frame are included too.
+    if (rowState == BENCH_ROW_WAITING_VINT) {
+        rowDmaBytes = dmaBytes;
+        rowOverrunLines = overrunLines;
+        dmaBytes = 0;
+        overrunLines = 0;
+        rowState = BENCH_ROW_READY;
+    }
+}
+
+#if BENCH_AUTO_RUN
+
+#if RENDER_USE_MAP_HIT_COMPRESSED
+void bench_mapHitCodec ()
+{
+    u16 row[PIXEL_COLUMNS];
+    // Rows are sampled evenly over the whole table so every kind of block gets decoded
+    const u16 rowStep = MAP_HIT_ROWS / BENCH_MAP_HIT_CODEC_ROWS;
+
+    STOPWATCH_68K_CYCLES_START();
+    u16 rowIndex = 0;
+    for (u16 i = BENCH_MAP_HIT_CODEC_ROWS; i--;) {
+        map_hit_codec_decodeRow(rowIndex, row);
+        rowIndex += rowStep;
+    }
+    STOPWATCH_68K_CYCLES_STOP();
+
+    char msg[64];
+    strcpy(msg, BENCH_CODEC_MSG_PREFIX "," MAP_HIT_CODEC_NAME);
+    char* p = msg + strlen(msg);
+    p = appendNum(p, map_hit_codec_romSize());
+    p = appendNum(p, BENCH_MAP_HIT_CODEC_ROWS);
+    KDebug_Alert(msg);
+}
+#endif
+
+#endif // BENCH_AUTO_RUN
+
+#if BENCH_KERNELS
+
+// Any tile with attributes, same for every call
+#define BENCH_KERNEL_TILE_ATTRIB ((PAL1 << TILE_ATTR_PALETTE_SFT) + 1)
+// Every h2 value write_vline() accepts: 0 (solid column) up to the edge tile of the middle row
+#define BENCH_KERNEL_H2_VALUES ((VERTICAL_ROWS/2)*8)
+
+// Results of the kernels returning a value go here so their calls are not optimized away
+static vu16 sink;
+
+static NO_INLINE void emptyCall (u16 a, u16 b)
+{
+    __asm volatile ("" : : "d" (a), "d" (b) : "memory");
+}
+
+// clear_buffer() and its variants zero d2-d7/a2-a6 without declaring them as clobbered (they are meant for the top of the game loop),
+// so here they go through this thunk which saves and restores them. Its own cost is timed as clear_buffer_thunk_overhead.
+static NO_INLINE void clearBufferThunk (void (*clearFn)())
+{
+    __asm volatile (
+        "movem.l %%d2-%%d7/%%a2-%%a6,-(%%sp)\n\t"
+        "jsr     (%[clearFn])\n\t"
+        "movem.l (%%sp)+,%%d2-%%d7/%%a2-%%a6"
+        :
+        : [clearFn] "a" (clearFn)
+        : "d0", "d1", "a0", "a1", "cc", "memory"
+    );
+}
+
+static NO_INLINE void emptyClear ()
+{
+    __asm volatile ("" : : : "memory");
+}
+
+static void emitKernel (const char* name, u16 calls)
+{
+    char msg[64];
+    strcpy(msg, BENCH_KERNEL_MSG_PREFIX ",");
+    strcat(msg, name);
+    appendNum(msg + strlen(msg), calls);
+    KDebug_Alert(msg);
+}
+
+// Times the statement called (u16 i) times in a row, with i going from 0 to calls-1
+#define BENCH_KERNEL(name, calls, statement) \
+    STOPWATCH_68K_CYCLES_START(); \
+    _Pragma("GCC unroll 0") \
+    for (u16 i = 0; i < (calls); ++i) { \
+        statement; \
+    } \
+    STOPWATCH_68K_CYCLES_STOP(); \
+    emitKernel(name, calls)
+
+void bench_kernels ()
+{
+    // No VInt nor HInt kicking in while timing, and no DMA contention from the display
+    SYS_disableInts();
+    VDP_setEnable(FALSE);
+
+    BENCH_KERNEL("call_overhead", BENCH_KERNEL_H2_VALUES, emptyCall(i, BENCH_KERNEL_TILE_ATTRIB));
+
+    BENCH_KERNEL("clear_buffer_thunk_overhead", 8, clearBufferThunk(emptyClear));
+    BENCH_KERNEL("clear_buffer", 8, clearBufferThunk(clear_buffer));
+    BENCH_KERNEL("clear_buffer_sp", 8, clearBufferThunk(clear_buffer_sp));
+    #if !RENDER_SINGLE_PLANE_TILES_PAIR
+    // Needs Plane B region of the framebuffer
+    BENCH_KERNEL("clear_buffer_halved_sp", 8, clearBufferThunk(clear_buffer_halved_sp));
+    #endif
+
+    column_ptr = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+    BENCH_KERNEL("write_vline", BENCH_KERNEL_H2_VALUES, write_vline(i, BENCH_KERNEL_TILE_ATTRIB));
+    BENCH_KERNEL("write_vline_fused", BENCH_KERNEL_H2_VALUES, write_vline_fused(((u32)i << 16) | BENCH_KERNEL_TILE_ATTRIB));
+    #if !RENDER_SINGLE_PLANE_TILES_PAIR
+    BENCH_KERNEL("write_vline_halved", BENCH_KERNEL_H2_VALUES, write_vline_halved(i, BENCH_KERNEL_TILE_ATTRIB));
+    BENCH_KERNEL("write_vline_halved_fused", BENCH_KERNEL_H2_VALUES, write_vline_halved_fused(((u32)i << 16) | BENCH_KERNEL_TILE_ATTRIB));
+    #endif
+    #if RENDER_DMA_COLUMNS_FROM_ROM && !RENDER_HALVED_PLANES
+    BENCH_KERNEL("write_vline_rom", BENCH_KERNEL_H2_VALUES, write_vline_rom(i, BENCH_KERNEL_TILE_ATTRIB));
+    #endif
+    #if RENDER_SINGLE_PLANE_TILES_PAIR && !RENDER_HALVED_PLANES
+    // A pair of columns costs write_vline_pair_even + write_vline_pair, against 2 write_vline plus 2/PIXEL_COLUMNS of clear_buffer_sp
+    // for the two planes framebuffer. The even column only keeps its values
+    BENCH_KERNEL("write_vline_pair_even", BENCH_KERNEL_H2_VALUES, write_vline_pair(i, BENCH_KERNEL_TILE_ATTRIB));
+    // Timed on the odd column, the one writing the pair. A solid even column is kept first
+    write_vline_pair(0, BENCH_KERNEL_TILE_ATTRIB);
+    column_ptr += VERTICAL_ROWS*TILEMAP_COLUMNS;
+    BENCH_KERNEL("write_vline_pair", BENCH_KERNEL_H2_VALUES, write_vline_pair(i, BENCH_KERNEL_TILE_ATTRIB));
+    // Both columns with an edge row, so the pair goes through its longest amount of runs
+    column_ptr = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+    write_vline_pair(BENCH_KERNEL_H2_VALUES/2 + 3, BENCH_KERNEL_TILE_ATTRIB);
+    column_ptr += VERTICAL_ROWS*TILEMAP_COLUMNS;
+    BENCH_KERNEL("write_vline_pair_edges", BENCH_KERNEL_H2_VALUES, write_vline_pair(i, BENCH_KERNEL_TILE_ATTRIB));
+    column_ptr = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+    #endif
+
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    // One call per column since every call moves to the next column span. Compare against write_vline plus 1/PIXEL_COLUMNS of clear_buffer_sp.
+    // From empty spans every column is written from its edge row down
+    fb_reset_column_spans_state();
+    BENCH_KERNEL("write_vline_incremental_full", PIXEL_COLUMNS, write_vline_incremental(i, BENCH_KERNEL_TILE_ATTRIB));
+    // Every wall 1 px taller than on previous frame: only the edge rows change
+    fb_reset_column_spans();
+    BENCH_KERNEL("write_vline_incremental_edge", PIXEL_COLUMNS, write_vline_incremental(i + 1, BENCH_KERNEL_TILE_ATTRIB));
+    // Same walls than on previous frame: nothing is written
+    fb_reset_column_spans();
+    BENCH_KERNEL("write_vline_incremental_same", PIXEL_COLUMNS, write_vline_incremental(i + 1, BENCH_KERNEL_TILE_ATTRIB));
+    #endif
+
+    // Distances sweep tab_wall_div[] from the closest to the farthest, once per screen column
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    fb_reset_column_spans();
+    #endif
+    BENCH_KERNEL("hitOnSideX", PIXEL_COLUMNS, game_loop_benchHitOnSideX(i * ((FP*STEP_COUNT)/PIXEL_COLUMNS), i));
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    fb_reset_column_spans();
+    #endif
+    BENCH_KERNEL("hitOnSideY", PIXEL_COLUMNS, game_loop_benchHitOnSideY(i * ((FP*STEP_COUNT)/PIXEL_COLUMNS), i));
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    fb_reset_column_spans();
+    #endif
+
+    BENCH_KERNEL("mulu_shft_FS", FP, sink = mulu_shft_FS(i, 0xFFFF - i));
+    #if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+    // Every row of the table (op1 in [0, FP)) along with a different key each
+    BENCH_KERNEL("perf_hash_mulu_shft_FS", FP,
+        sink = perf_hash_mulu_shft_FS(i * (u32)(MPH_VALUES_DELTADIST_NKEYS*2), (i % MPH_VALUES_DELTADIST_NKEYS) * 2));
+    #endif
+
+    #if !RENDER_SINGLE_PLANE_TILES_PAIR
+    BENCH_KERNEL("fb_mirror_planes_in_RAM", 8, fb_mirror_planes_in_RAM());
+    #endif
+
+    // Both framebuffer planes as queued at VInt. Enqueuing is left out of the measure
+    render_Z80_setBusProtection(TRUE);
+    render_DMA_enqueue_framebuffer();
+    BENCH_KERNEL("render_DMA_flushQueue", 1, render_DMA_flushQueue());
+    // Both framebuffer planes as sent at VInt, row by row from RAM
+    BENCH_KERNEL("render_DMA_row_by_row_framebuffer", 1, render_DMA_row_by_row_framebuffer());
+    #if RENDER_DMA_COLUMNS_FROM_ROM && !RENDER_HALVED_PLANES
+    // Same amount of words, column by column from ROM. Ids left by write_vline_rom() above
+    BENCH_KERNEL("render_DMA_columns_from_ROM", 1, render_DMA_columns_from_ROM());
+    #endif
+    render_Z80_setBusProtection(FALSE);
+
+    clearBufferThunk(clear_buffer_sp);
+
+    VDP_setEnable(TRUE);
+    SYS_enableInts();
+
+    bench_end();
+}
+
+#endif // BENCH_KERNELS
+
+void bench_end ()
+{
+    // Last frame's line, since no bench_frameStart() comes after it
+    if (rowState == BENCH_ROW_READY)
+        emitRow();
+    KDebug_Alert(BENCH_MSG_PREFIX ",END");
+}
+
+#endif // BENCH_AUTO_RUN || BENCH_KERNELS
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <types.h>
+#include "depth_buffer.h"
+#include "consts.h"
+#include "consts_ext.h"
+
+#if RENDER_DEPTH_BUFFER
+
+#if HOST_BUILD
+u8 host_depth_buffer[PIXEL_COLUMNS];
+#endif
+
+u8* depth_ptr;
+
+bool depth_buffer_isVisible (u16 column, u16 width, u8 depth)
+{
+    const u8* ptr = (u8*) RAM_FIXED_DEPTH_BUFFER_ADDRESS + column;
+    for (u16 i = width; i--;) {
+        if (depth < *ptr++)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+u16 depth_buffer_visibleMask (u16 column, u16 width, u8 depth)
+{
+    // Walks the group backwards so every column shifts into bit 0 and the first one ends up at bit 0
+    const u8* ptr = (u8*) RAM_FIXED_DEPTH_BUFFER_ADDRESS + column + width;
+    u16 mask = 0;
+    for (u16 i = width; i--;) {
+        mask <<= 1;
+        if (depth < *--ptr)
+            mask |= 1;
+    }
+    return mask;
+}
+
+bool depth_buffer_clipSpan (u16* left, u16* right, u8 depth)
+{
+    const u8* buffer = (u8*) RAM_FIXED_DEPTH_BUFFER_ADDRESS;
+    u16 l = *left, r = *right;
+
+    while (l < r && depth >= buffer[l])
+        ++l;
+    if (l == r)
+        return FALSE;
+    while (depth >= buffer[r - 1])
+        --r;
+
+    *left = l;
+    *right = r;
+    return TRUE;
+}
+
+#endif
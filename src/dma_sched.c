@@ -0,0 +1,133 @@
+#include <types.h>
+#include <dma.h>
+#include <vdp.h>
+#include <sys.h>
+#include "dma_sched.h"
+#include "consts.h"
+#include "utils.h"
+#include "bench.h"
+#include "dma_stats.h"
+
+#if DMA_SCHEDULER
+
+#define DMA_SCHED_FLAG_BUFFERED 1
+
+u16 dma_sched_dropped;
+
+static u16 elems;
+static void* q_from[DMA_SCHED_QUEUE_CAPACITY];
+static u16 q_to[DMA_SCHED_QUEUE_CAPACITY];
+static u16 q_lenInWord[DMA_SCHED_QUEUE_CAPACITY];
+static u8 q_prio[DMA_SCHED_QUEUE_CAPACITY];
+static u8 q_framesLeft[DMA_SCHED_QUEUE_CAPACITY];
+static u8 q_flags[DMA_SCHED_QUEUE_CAPACITY];
+
+void dma_sched_reset ()
+{
+    elems = 0;
+    dma_sched_dropped = 0;
+}
+
+static void enqueue (void* from, u16 to, u16 lenInWord, u16 prio, u16 maxDelayFrames, u16 flags)
+{
+    // VInt compacts the queue and rewrites elems, so the append can't be split by it. Only a few instructions long.
+    SYS_disableInts();
+    const u16 i = elems;
+    // Full queue: the transfer is dropped, same than SGDK's DMA queue does. Raise DMA_SCHED_QUEUE_CAPACITY if it ever happens.
+    if (i < DMA_SCHED_QUEUE_CAPACITY) {
+        q_from[i] = from;
+        q_to[i] = to;
+        q_lenInWord[i] = lenInWord;
+        q_prio[i] = prio;
+        q_framesLeft[i] = maxDelayFrames;
+        q_flags[i] = flags;
+        elems = i + 1;
+    }
+    else {
+        ++dma_sched_dropped;
+    }
+    SYS_enableInts();
+}
+
+FORCE_INLINE void dma_sched_enqueue (void* from, u16 to, u16 lenInWord, u16 prio, u16 maxDelayFrames)
+{
+    enqueue(from, to, lenInWord, prio, maxDelayFrames, 0);
+}
+
+FORCE_INLINE void dma_sched_enqueueBuffered (void* from, u16 to, u16 lenInWord)
+{
+    enqueue(from, to, lenInWord, DMA_SCHED_PRIO_HIGH, 0, DMA_SCHED_FLAG_BUFFERED);
+}
+
+/// @brief Index of the pending transfer with highest priority and then earliest deadline. -1 if none.
+static s16 pickNext (u16 count)
+{
+    s16 best = -1;
+    u16 bestKey = 0xFFFF;
+    for (u16 i = 0; i < count; ++i) {
+        if (q_lenInWord[i] == 0)
+            continue;
+        u16 key = (q_prio[i] << 8) | q_framesLeft[i];
+        if (key < bestKey) {
+            bestKey = key;
+            best = i;
+        }
+    }
+    return best;
+}
+
+/// @brief DMAs up to maxLenInWord words of the transfer and leaves the rest in the queue. Returns the words DMAed.
+static u16 transfer (u16 i, u16 maxLenInWord)
+{
+    u16 lenInWord = q_lenInWord[i];
+    if (lenInWord > maxLenInWord)
+        lenInWord = maxLenInWord;
+
+    u8* from = q_from[i];
+    doDmaFast(lenInWord, (u32)from, VDP_DMA_VRAM_ADDR(q_to[i]));
+    DMA_COUNT_BYTES(lenInWord * 2);
+    if (q_flags[i] & DMA_SCHED_FLAG_BUFFERED)
+        DMA_releaseTemp(lenInWord);
+
+    q_from[i] = from + lenInWord * 2;
+    q_to[i] += lenInWord * 2;
+    q_lenInWord[i] -= lenInWord;
+    return lenInWord;
+}
+
+void dma_sched_flushHint ()
+{
+    const u16 count = elems;
+    u16 budget = DMA_SCHED_HINT_BUDGET_IN_WORD;
+    s16 i;
+    while (budget && (i = pickNext(count)) >= 0)
+        budget -= transfer(i, budget);
+}
+
+void dma_sched_flushVint ()
+{
+    const u16 count = elems;
+    u16 budget = DMA_SCHED_VINT_BUDGET_IN_WORD;
+    s16 i;
+    while (budget && (i = pickNext(count)) >= 0)
+        budget -= transfer(i, budget);
+
+    // Compact the queue: transfers on their deadline go now regardless of the budget, the others wait for next frame
+    u16 kept = 0;
+    for (u16 k = 0; k < count; ++k) {
+        if (q_lenInWord[k] && q_framesLeft[k] == 0)
+            transfer(k, q_lenInWord[k]);
+        if (q_lenInWord[k] == 0)
+            continue;
+        q_from[kept] = q_from[k];
+        q_to[kept] = q_to[k];
+        q_lenInWord[kept] = q_lenInWord[k];
+        q_prio[kept] = q_prio[k];
+        q_framesLeft[kept] = q_framesLeft[k] - 1;
+        q_flags[kept] = q_flags[k];
+        ++kept;
+    }
+    elems = kept;
+}
+
+#endif // DMA_SCHEDULER
@@ -0,0 +1,147 @@
+#include <types.h>
+#include <vdp.h>
+#include <vdp_bg.h>
+#include <tools.h>
+#include <string.h>
+#include "dma_stats.h"
+#include "consts.h"
+
+#if DMA_STATS
+
+DmaStatsFrame dma_stats_ring[DMA_STATS_RING_FRAMES];
+static DmaStatsFrame* ringSlot;
+static u16 ringFrame;
+static u16* windowBytes;
+static u16 startBlank;
+
+static u16 overlayTilemap[DMA_STATS_OVERLAY_LEN];
+
+void dma_stats_reset ()
+{
+    memset(dma_stats_ring, 0, sizeof(dma_stats_ring));
+    ringSlot = dma_stats_ring;
+    ringFrame = 0;
+    windowBytes = &ringSlot->bytes[DMA_STATS_WINDOW_VINT];
+}
+
+FORCE_INLINE void dma_stats_batchBegin (u16 window)
+{
+    ringSlot->vcntStart[window] = *(vu8*) VDP_HVCOUNTER_PORT; // V-Counter is the high byte
+    startBlank = *(vu16*) VDP_CTRL_PORT & VDP_VBLANK_FLAG;
+    windowBytes = &ringSlot->bytes[window];
+    *windowBytes = 0;
+}
+
+FORCE_INLINE void dma_stats_addBytes (u16 bytes)
+{
+    *windowBytes += bytes;
+}
+
+FORCE_INLINE void dma_stats_batchEnd (u16 window)
+{
+    const u8 start = ringSlot->vcntStart[window];
+    const u8 end = *(vu8*) VDP_HVCOUNTER_PORT;
+    const u16 endBlank = *(vu16*) VDP_CTRL_PORT & VDP_VBLANK_FLAG;
+    ringSlot->vcntEnd[window] = end;
+    // VBlank is told by the status flag and not by the V-Counter value: NTSC counts 0xE0 to 0xEA and jumps back to 0xE5, but
+    // PAL (V28) counts 0xE0 to 0x102 and jumps back to 0x1CA, so its 8 bits VBlank values overlap the display ones [0, 0xDF].
+    // Out of VBlank the V-Counter is the display line on both systems.
+    // Stolen when it ends in active display, either coming from VBlank or having wrapped around from a previous display period
+    if (!endBlank && (startBlank || end < start))
+        ringSlot->stolenLines[window] = end + 1;
+    else
+        ringSlot->stolenLines[window] = 0;
+}
+
+void dma_stats_frameEnd ()
+{
+    ringFrame = (ringFrame + 1) & (DMA_STATS_RING_FRAMES - 1);
+    ringSlot = dma_stats_ring + ringFrame;
+
+    // Only refresh stats once the ring buffer wraps around, so the overlay numbers are readable
+    if (ringFrame != 0)
+        return;
+
+    #if DMA_STATS_OVERLAY && RENDER_ENABLE_FRAME_LOAD_CALCULATION
+    dma_stats_showOverlay();
+    #endif
+    #if DMA_STATS_DUMP_KDEBUG
+    dma_stats_dump();
+    #endif
+}
+
+typedef struct {
+    u16 avgBytes, maxBytes;
+    u16 avgStart, avgEnd;
+    u16 framesStealing, maxStolen;
+} WindowSummary;
+
+static void summarize (u16 window, WindowSummary* sum)
+{
+    u32 bytes = 0, start = 0, end = 0;
+    memset(sum, 0, sizeof(WindowSummary));
+    const DmaStatsFrame* f = dma_stats_ring;
+    for (u16 i=0; i < DMA_STATS_RING_FRAMES; ++i, ++f) {
+        bytes += f->bytes[window];
+        start += f->vcntStart[window];
+        end += f->vcntEnd[window];
+        if (f->bytes[window] > sum->maxBytes) sum->maxBytes = f->bytes[window];
+        if (f->stolenLines[window]) {
+            ++sum->framesStealing;
+            if (f->stolenLines[window] > sum->maxStolen) sum->maxStolen = f->stolenLines[window];
+        }
+    }
+    sum->avgBytes = bytes / DMA_STATS_RING_FRAMES;
+    sum->avgStart = start / DMA_STATS_RING_FRAMES;
+    sum->avgEnd = end / DMA_STATS_RING_FRAMES;
+}
+
+static u16* appendNum (u16* tilemap, u16 value, u16 digits)
+{
+    char str[8];
+    uintToStr(value, str, digits);
+    // 32 is the ascii value for space ' ' character, which is the first char in the font set
+    for (const char* c = str; *c; ++c)
+        *tilemap++ = *c - 32;
+    *tilemap++ = ' ' - 32;
+    return tilemap;
+}
+
+void dma_stats_showOverlay ()
+{
+    u16* tilemap = overlayTilemap;
+    for (u16 window=0; window < DMA_STATS_WINDOWS; ++window) {
+        WindowSummary sum;
+        summarize(window, &sum);
+        tilemap = appendNum(tilemap, sum.avgBytes, 5);
+        tilemap = appendNum(tilemap, sum.avgEnd, 3);
+        tilemap = appendNum(tilemap, sum.maxStolen, 3);
+        *tilemap++ = ' ' - 32;
+    }
+
+    const u16 addr = VDP_getPlaneAddress(WINDOW, DMA_STATS_OVERLAY_X, DMA_STATS_OVERLAY_Y);
+    // CPU copy
+    VDP_setTileMapDataEx(addr, overlayTilemap, TILE_ATTR_FULL(PAL0, 1, FALSE, FALSE, VRAM_INDEX_FONT), 0, DMA_STATS_OVERLAY_LEN, CPU);
+}
+
+void dma_stats_dump ()
+{
+    char msg[64];
+    char tmp[8];
+
+    for (u16 window=0; window < DMA_STATS_WINDOWS; ++window) {
+        WindowSummary sum;
+        summarize(window, &sum);
+        const u16 values[] = { window, sum.avgBytes, sum.maxBytes, sum.avgStart, sum.avgEnd, sum.framesStealing, sum.maxStolen };
+
+        strcpy(msg, "DMA");
+        for (u16 i=0; i < sizeof(values)/sizeof(values[0]); ++i) {
+            strcat(msg, ",");
+            uintToStr(values[i], tmp, 1);
+            strcat(msg, tmp);
+        }
+        KDebug_Alert(msg);
+    }
+}
+
+#endif // DMA_STATS
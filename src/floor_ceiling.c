@@ -0,0 +1,115 @@
+#include <types.h>
+#include <vdp.h>
+#include <vdp_tile.h>
+#include "floor_ceiling.h"
+#include "consts.h"
+#include "consts_ext.h"
+#include "vint_callback.h"
+#include "dma_sched.h"
+
+#if RENDER_FLOOR_CEILING_TEXTURED
+
+#if !RENDER_SINGLE_PLANE_TILES_PAIR
+#error "RENDER_FLOOR_CEILING_TEXTURED needs RENDER_SINGLE_PLANE_TILES_PAIR since walls use both planes otherwise"
+#endif
+
+#if DMA_SCHEDULER && FLOOR_CEILING_DMA_MAX_DELAY_FRAMES > FLOOR_CEILING_TILES/FLOOR_CEILING_DMA_CHUNK_TILES
+#error "FLOOR_CEILING_DMA_MAX_DELAY_FRAMES must be below FLOOR_CEILING_TILES/FLOOR_CEILING_DMA_CHUNK_TILES + 1 so the tilemap buffer isn't rebuilt while queued"
+#endif
+
+#if DMA_SCHEDULER && DMA_MAX_QUEUE_CAPACITY + FLOOR_CEILING_DMA_MAX_DELAY_FRAMES + 1 > DMA_SCHED_QUEUE_CAPACITY
+#error "DMA_SCHED_QUEUE_CAPACITY can't hold a frame of sprites plus the floor and ceiling transfers deferred by FLOOR_CEILING_DMA_MAX_DELAY_FRAMES"
+#endif
+
+#include "tab_floor_ceiling.h"
+
+#define FLOOR_CEILING_VIEW_NONE 0xFFFF
+// Whole Plane B rows, so the columns past TILEMAP_COLUMNS uncovered by RENDER_SMOOTH_ROTATION's horizontal scroll are filled too
+#define FLOOR_CEILING_TILEMAP_LEN_IN_WORD (VERTICAL_ROWS*PLANE_COLUMNS)
+// Columns off screen at each side of the view
+#define FLOOR_CEILING_SIDE_COLUMNS ((PLANE_COLUMNS-TILEMAP_COLUMNS)/2)
+
+static u16 tilemap[FLOOR_CEILING_TILEMAP_LEN_IN_WORD];
+static u16 shown_view; // its tiles are in the front buffer and Plane B points to them
+static u16 streamed_view; // its tiles are being DMAed into the back buffer
+static u16 streamed_tiles; // tiles of streamed_view already enqueued
+static u16 back_buffer; // 0 or 1
+
+void floor_ceiling_reset ()
+{
+    shown_view = FLOOR_CEILING_VIEW_NONE;
+    streamed_view = FLOOR_CEILING_VIEW_NONE;
+    streamed_tiles = 0;
+    back_buffer = 0;
+}
+
+static FORCE_INLINE u16 view_index (u16 posX, u16 posY, u16 angle)
+{
+    // Nearest angle bucket, so bucket 0 covers both sides of angle 0
+    const u16 angleBucket = ((angle + (u16)(1024/FLOOR_CEILING_ANGLES/2)) & (u16)1023) / (u16)(1024/FLOOR_CEILING_ANGLES);
+    const u16 posBucketX = (posX & (u16)(FP-1)) / (u16)(FP/FLOOR_CEILING_POS_STEPS);
+    const u16 posBucketY = (posY & (u16)(FP-1)) / (u16)(FP/FLOOR_CEILING_POS_STEPS);
+    return (angleBucket * (u16)FLOOR_CEILING_POS_STEPS + posBucketY) * (u16)FLOOR_CEILING_POS_STEPS + posBucketX;
+}
+
+static FORCE_INLINE void enqueue (void* from, u16 to, u16 lenInWord)
+{
+    #if DMA_SCHEDULER
+    // Same priority and deadline for every chunk and tilemap, so the scheduler DMAs them in the order they were enqueued:
+    // the tilemap never lands before its tiles, nor the next view tiles before the tilemap that stops showing their buffer
+    dma_sched_enqueue(from, to, lenInWord, DMA_SCHED_PRIO_LOW, FLOOR_CEILING_DMA_MAX_DELAY_FRAMES);
+    #else
+    vint_enqueueTiles(from, to, lenInWord);
+    #endif
+}
+
+static void build_tilemap (u16 view, u16 baseTileAttrib)
+{
+    const u8* src = tab_floor_ceiling_tilemaps + view * (u16)(VERTICAL_ROWS*TILEMAP_COLUMNS);
+    u16* dst = tilemap;
+    for (u16 r = VERTICAL_ROWS; r--;) {
+        #pragma GCC unroll 8
+        for (u16 c = TILEMAP_COLUMNS; c--;) {
+            *dst++ = baseTileAttrib + *src++;
+        }
+        // Columns past the right edge mirror the view's right side, and the ones that wrap around to the left of column 0
+        // mirror its left side. Only a few of them show up while scrolling, better a mirrored floor than a blank strip.
+        u16* row = dst - TILEMAP_COLUMNS;
+        for (u16 k = 0; k < FLOOR_CEILING_SIDE_COLUMNS; ++k) {
+            row[TILEMAP_COLUMNS + k] = row[TILEMAP_COLUMNS-1 - k];
+            row[PLANE_COLUMNS-1 - k] = row[k];
+        }
+        dst += PLANE_COLUMNS - TILEMAP_COLUMNS;
+    }
+}
+
+void floor_ceiling_update (u16 posX, u16 posY, u16 angle)
+{
+    // Current streaming is always finished before starting a new one, otherwise a moving camera would never see a swap
+    if (streamed_view == FLOOR_CEILING_VIEW_NONE) {
+        const u16 view = view_index(posX, posY, angle);
+        if (view == shown_view)
+            return;
+        streamed_view = view;
+        streamed_tiles = 0;
+    }
+
+    const u16 backIndex = VRAM_INDEX_FLOOR_CEILING + back_buffer * (u16)FLOOR_CEILING_TILES;
+
+    if (streamed_tiles < FLOOR_CEILING_TILES) {
+        const u32* from = tab_floor_ceiling_tiles + ((u32)streamed_view * FLOOR_CEILING_TILES + streamed_tiles) * 8;
+        enqueue((void*) FAR_SAFE(from, FLOOR_CEILING_DMA_CHUNK_TILES*32), (backIndex + streamed_tiles) * (u16)32, FLOOR_CEILING_DMA_CHUNK_TILES*16);
+        streamed_tiles += FLOOR_CEILING_DMA_CHUNK_TILES;
+        return;
+    }
+
+    // All the tiles were enqueued on previous frames (and DMAed, unless the scheduler deferred them), so now Plane B can point to them
+    build_tilemap(streamed_view, TILE_ATTR_FULL(PAL0, 0, FALSE, FALSE, backIndex));
+    enqueue(tilemap, PB_ADDR, FLOOR_CEILING_TILEMAP_LEN_IN_WORD);
+
+    shown_view = streamed_view;
+    streamed_view = FLOOR_CEILING_VIEW_NONE;
+    back_buffer ^= 1;
+}
+
+#endif
@@ -2,24 +2,55 @@
 #include <sys.h>
 #include <vdp_tile.h>
 #include <memory.h>
+#include <maths.h>
 #include "frame_buffer.h"
 #include "consts.h"
 #include "consts_ext.h"
 #include "utils.h"
 
+#if RENDER_DMA_COLUMNS_FROM_ROM && !RENDER_HALVED_PLANES
+#include "tab_column_patterns.h"
+#endif
+
+#if RENDER_SINGLE_PLANE_TILES_PAIR && !RENDER_HALVED_PLANES
+#include "tab_tiles_pair.h"
+#endif
+
 u16* column_ptr;
 
+#if HOST_BUILD
+u16 host_frame_buffer[VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES];
+#endif
+
 void fb_allocate_frame_buffer ()
 {
     // Do not use clear_buffer() here because it doesn't save registers in the stack and at this moment in the execution they are actually being used
-    memsetU32((u32*)RAM_FIXED_FRAME_BUFFER_ADDRESS, 0, (VERTICAL_ROWS*TILEMAP_COLUMNS*2)/2);
+    memsetU32((u32*)RAM_FIXED_FRAME_BUFFER_ADDRESS, 0, (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES)/2);
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    fb_reset_column_spans_state();
+    #endif
 }
 
 void fb_free_frame_buffer ()
 {
-    memsetU32((u32*)RAM_FIXED_FRAME_BUFFER_ADDRESS, 0, (VERTICAL_ROWS*TILEMAP_COLUMNS*2)/2);
+    memsetU32((u32*)RAM_FIXED_FRAME_BUFFER_ADDRESS, 0, (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES)/2);
 }
 
+#if HOST_BUILD
+
+// C version of the asm clear routines below
+void clear_buffer ()
+{
+    memsetU32((u32*)RAM_FIXED_FRAME_BUFFER_ADDRESS, 0, (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES)/2);
+}
+
+void clear_buffer_sp ()
+{
+    clear_buffer();
+}
+
+#else
+
 NO_INLINE void clear_buffer ()
 {
 	// We need to clear only first TILEMAP_COLUMNS columns from each row from the framebuffer.
@@ -43,7 +74,7 @@ NO_INLINE void clear_buffer ()
 		"    move.l  %%d0,%%a6\n"
         // Iterate over all rows
         ".set regs, 14\n"
-		".rept %c[_VERTICAL_ROWS]*2\n"
+		".rept %c[_VERTICAL_ROWS]*%c[_FRAME_BUFFER_PLANES]\n"
 		    // Clear all the bytes of current row by using regs registers with long word (4 bytes) access.
         "    .rept (%c[TILEMAP_COLUMNS_BYTES] / (regs*4))\n"
         "    movem.l %%d0-%%d7/%%a1-%%a6,-(%%a0)\n"
@@ -84,8 +115,9 @@ NO_INLINE void clear_buffer ()
             // Remaining conditions (up to regs-1) should be added here and adjusted according the available registers
 		".endr\n"
 		:
-		: [frame_buffer_end] "i" (RAM_FIXED_FRAME_BUFFER_ADDRESS + (VERTICAL_ROWS*TILEMAP_COLUMNS*2)*2), 
-		  [TILEMAP_COLUMNS_BYTES] "i" (TILEMAP_COLUMNS*2), [_VERTICAL_ROWS] "i" (VERTICAL_ROWS)
+		: [frame_buffer_end] "i" (RAM_FIXED_FRAME_BUFFER_ADDRESS + (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES)*2), 
+		  [TILEMAP_COLUMNS_BYTES] "i" (TILEMAP_COLUMNS*2), [_VERTICAL_ROWS] "i" (VERTICAL_ROWS),
+		  [_FRAME_BUFFER_PLANES] "i" (FRAME_BUFFER_PLANES)
 		: "memory"
 	);
 }
@@ -117,7 +149,7 @@ NO_INLINE void clear_buffer_sp ()
 		"    move.l  %%d0,%%a6\n"
         // Iterate over all rows (both planes)
         ".set regs, 15\n"
-		".rept %c[_VERTICAL_ROWS]*2\n"
+		".rept %c[_VERTICAL_ROWS]*%c[_FRAME_BUFFER_PLANES]\n"
 		    // Clear all the bytes of current row by using regs registers with long word (4 bytes) access.
         "    .rept (%c[TILEMAP_COLUMNS_BYTES] / (regs*4))\n"
         "    movem.l %%d0-%%d7/%%a0-%%a6,-(%%sp)\n"
@@ -160,12 +192,15 @@ NO_INLINE void clear_buffer_sp ()
 		// Restore SP
 		"    move.l  %%usp,%%sp"
 		:
-		: [frame_buffer_end] "i" (RAM_FIXED_FRAME_BUFFER_ADDRESS + (VERTICAL_ROWS*TILEMAP_COLUMNS*2)*2),
-		  [TILEMAP_COLUMNS_BYTES] "i" (TILEMAP_COLUMNS*2), [_VERTICAL_ROWS] "i" (VERTICAL_ROWS)
+		: [frame_buffer_end] "i" (RAM_FIXED_FRAME_BUFFER_ADDRESS + (VERTICAL_ROWS*TILEMAP_COLUMNS*FRAME_BUFFER_PLANES)*2),
+		  [TILEMAP_COLUMNS_BYTES] "i" (TILEMAP_COLUMNS*2), [_VERTICAL_ROWS] "i" (VERTICAL_ROWS),
+		  [_FRAME_BUFFER_PLANES] "i" (FRAME_BUFFER_PLANES)
 		:
 	);
 }
 
+#endif // HOST_BUILD
+
 FORCE_INLINE void write_vline (u16 h2, u16 tileAttrib)
 {
 	// Tilemap width in tiles.
@@ -173,9 +208,11 @@ FORCE_INLINE void write_vline (u16 h2, u16 tileAttrib)
 	// Draw a solid vertical line from TOP to BOTTOM
 	if (h2 == 0) {
 		// C version
-		/*for (u16 y = 0; y < VERTICAL_ROWS*TILEMAP_COLUMNS; y += TILEMAP_COLUMNS) {
+		#if HOST_BUILD
+		for (u16 y = 0; y < VERTICAL_ROWS*TILEMAP_COLUMNS; y += TILEMAP_COLUMNS) {
 			column_ptr[y] = tileAttrib;
-		}*/
+		}
+		#else
 
 		// ASM version
 		__asm volatile (
@@ -189,6 +226,7 @@ FORCE_INLINE void write_vline (u16 h2, u16 tileAttrib)
               [_VERTICAL_ROWS] "i" (VERTICAL_ROWS), [_TILEMAP_COLUMNS] "i" (TILEMAP_COLUMNS)
 			:
 		);
+		#endif
 
         return;
 	}
@@ -301,10 +339,28 @@ FORCE_INLINE void write_vline (u16 h2, u16 tileAttrib)
                     break;
     }*/
 
+    #if HOST_BUILD
+
+    // C version of the ASM block below. Same entries in the same order.
+    const u16 ta = h2 / 8; // vertical tilemap entry position
+    for (u16 r = ta + 1; r < VERTICAL_ROWS/2; ++r) {
+        column_ptr[r*TILEMAP_COLUMNS] = tileAttrib;
+        column_ptr[((VERTICAL_ROWS-1)-r)*TILEMAP_COLUMNS] = tileAttrib;
+    }
+    // top tilemap entry
+    column_ptr[ta*TILEMAP_COLUMNS] = tileAttrib + (h2 & 7); // offsets the tileAttrib by the halved pixel height modulo 8
+    // bottom tilemap entry (with flipped attribute)
+    column_ptr[((VERTICAL_ROWS-1)-ta)*TILEMAP_COLUMNS] = (tileAttrib + (h2 & 7)) | TILE_ATTR_VFLIP_MASK;
+
+    #else
+
     // ASM version.
     // This block of code sets tileAttrib which points to a colored tile.
     // This block of code sets top and bottom tilemap entries.
     u16 h2_aux2 = h2;
+    // The block moves the pointer to reach the bottom entry, so it works on a copy. Otherwise the compiler assumes
+    // the register still holds column_ptr, which breaks the next columns once the loop is unrolled.
+    u16* tilemap = column_ptr;
     __asm volatile (
         // Offset h2 comes already multiplied by 8, great, but we need to clear the first 3 bits, 
         // so we can use it as a multiple of the block size (8 bytes) we'll jump into.
@@ -353,11 +409,467 @@ FORCE_INLINE void write_vline (u16 h2, u16 tileAttrib)
         "    lea     %c[H2_BOTTOM](%[tilemap]),%[tilemap]\n"
         "    move.w  %[tileAttrib],(%[tilemap])"
 
-        : [h2] "+d" (h2), [tileAttrib] "+d" (tileAttrib), [h2_aux] "+d" (h2_aux2)
-        : [tilemap] "a" (column_ptr), [CLEAR_BITS_OFFSET] "i" (~(8-1)), 
+        : [h2] "+d" (h2), [tileAttrib] "+d" (tileAttrib), [h2_aux] "+d" (h2_aux2), [tilemap] "+a" (tilemap)
+        : [CLEAR_BITS_OFFSET] "i" (~(8-1)), 
           [_VERTICAL_ROWS] "i" (VERTICAL_ROWS), [_TILEMAP_COLUMNS] "i" (TILEMAP_COLUMNS), 
           [_H2_FOR_TOP_ENTRY] "i" (H2_FOR_TOP_ENTRY), [H2_BOTTOM] "i" (H2_FOR_BOTTOM_ENTRY),
           [_TILE_ATTR_VFLIP_MASK] "i" (TILE_ATTR_VFLIP_MASK)
         :
     );
-}
\ No newline at end of file
+
+    #endif // HOST_BUILD
+}
+
+FORCE_INLINE void write_vline_fused (u32 h2_tileAttrib)
+{
+    #if HOST_BUILD
+
+    write_vline(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+
+    #else
+
+    // Same entries than write_vline() straight out of the packed long: h2 is in the high word (a swap gets it) and
+    // tileAttrib is in the low word, usable as it is by the word sized stores. Saves unpacking it into two words.
+    // By the 68000 timing tables it costs write_vline()'s blocks plus 26 cycles (30 for a solid column): the move.l+swap
+    // unpack, the h2 == 0 test and the h2 copy, which is the least GCC needs for write_vline(h2_tileAttrib >> 16, (u16)h2_tileAttrib).
+    // Kernels write_vline and write_vline_fused (see bench_kernels()) tell whether GCC does worse.
+    u16 h2, h2_aux;
+    // The block moves the pointer to reach the bottom entry, so it works on a copy (see write_vline())
+    u16* tilemap = column_ptr;
+    __asm volatile (
+        "    move.l  %[h2_tileAttrib],%[h2]\n"
+        "    swap    %[h2]\n" // h2 in low word
+        "    tst.w   %[h2]\n"
+        "    bne.s   .wvlf_edge_%=\n"
+
+        // Solid vertical line from TOP to BOTTOM
+        ".set off,0\n"
+        ".rept %c[_VERTICAL_ROWS]\n"
+        "    move.w  %[h2_tileAttrib],off(%[tilemap])\n"
+        "    .set off,off+%c[_TILEMAP_COLUMNS]*2\n" // *2 for byte addressing
+        ".endr\n"
+        "    bra     .wvlf_end_%=\n"
+
+        ".wvlf_edge_%=:\n"
+        "    move.w  %[h2],%[h2_aux]\n"
+        // Offset h2 comes already multiplied by 8, only the first 3 bits need to be cleared to jump into blocks of 8 bytes
+        "    andi.w  %[CLEAR_BITS_OFFSET],%[h2]\n" // (h2 & ~(8-1))
+        "    jmp     .wvlf_table_%=(%%pc,%[h2].w)\n"
+        // Same assignment ranges than write_vline()
+        ".wvlf_table_%=:\n"
+        ".set offup, 1 * %c[_TILEMAP_COLUMNS] * 2\n" // *2 for byte convertion
+        ".set offdown, (%c[_VERTICAL_ROWS] - 2) * %c[_TILEMAP_COLUMNS] * 2\n" // *2 for byte convertion
+        ".rept (%c[_VERTICAL_ROWS] - 2) / 2\n"
+        "    move.w  %[h2_tileAttrib],offup(%[tilemap])\n"
+        "    move.w  %[h2_tileAttrib],offdown(%[tilemap])\n"
+        "    .set offup, offup + %c[_TILEMAP_COLUMNS] * 2\n" // *2 for byte convertion
+        "    .set offdown, offdown - (%c[_TILEMAP_COLUMNS] * 2)\n" // *2 for byte convertion
+        ".endr\n"
+
+        // Setup for top and bottom tilemap entries. Only the low word of h2_tileAttrib is used from now on
+        "    andi.w  #7,%[h2_aux]\n" // h2_aux = (h2 & 7) <-- this is to offset the tile idx
+        "    add.w   %[h2_aux],%[h2_tileAttrib]\n" // tileAttrib += (h2 & 7);
+
+        // Top tilemap entry
+        #if H2_FOR_TOP_ENTRY == 10
+        "    move.w  %[h2],%[h2_aux]\n"
+        "    add.w   %[h2],%[h2]\n"
+        "    add.w   %[h2],%[h2]\n"
+        "    add.w   %[h2_aux],%[h2]\n"
+        "    add.w   %[h2],%[h2]\n"
+        #elif H2_FOR_TOP_ENTRY == 8
+        "    lsl.w   #3,%[h2]\n"
+        #else
+        "    mulu.w  %[_H2_FOR_TOP_ENTRY],%[h2]\n" // h2 = ((h2 & ~(8-1)) * (TILEMAP_COLUMNS/8))
+        #endif
+        "    move.w  %[h2_tileAttrib],(%[tilemap],%[h2].w)\n"
+
+        // Bottom tilemap entry
+        "    ori.w   %[_TILE_ATTR_VFLIP_MASK],%[h2_tileAttrib]\n" // tileAttrib = (tileAttrib + (h2 & 7)) | TILE_ATTR_VFLIP_MASK;
+        // h2 = (VERTICAL_ROWS-1)*TILEMAP_COLUMNS - ((h2 & ~(8-1))*(TILEMAP_COLUMNS/8))
+        "    suba.w  %[h2],%[tilemap]\n"
+        "    lea     %c[H2_BOTTOM](%[tilemap]),%[tilemap]\n"
+        "    move.w  %[h2_tileAttrib],(%[tilemap])\n"
+        ".wvlf_end_%=:"
+
+        : [h2_tileAttrib] "+d" (h2_tileAttrib), [h2] "=&d" (h2), [h2_aux] "=&d" (h2_aux), [tilemap] "+a" (tilemap)
+        : [CLEAR_BITS_OFFSET] "i" (~(8-1)),
+          [_VERTICAL_ROWS] "i" (VERTICAL_ROWS), [_TILEMAP_COLUMNS] "i" (TILEMAP_COLUMNS),
+          [_H2_FOR_TOP_ENTRY] "i" (H2_FOR_TOP_ENTRY), [H2_BOTTOM] "i" (H2_FOR_BOTTOM_ENTRY),
+          [_TILE_ATTR_VFLIP_MASK] "i" (TILE_ATTR_VFLIP_MASK)
+        : "cc"
+    );
+
+    #endif // HOST_BUILD
+}
+
+#if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+
+// What was written in the column on previous frame. Only the top half rows are tracked since the bottom half is the mirror of it.
+typedef struct {
+    u16 firstRow; // first non empty row. VERTICAL_ROWS/2 means empty column
+    u16 firstSolidRow; // first row using the solid tileAttrib. Row firstRow holds the edge tile when firstRow != firstSolidRow
+    u16 edge; // tileAttrib + (h2 & 7). Bottom counterpart has the VFLIP attribute
+    u16 solid; // tileAttrib
+} ColumnSpan;
+
+static ColumnSpan column_spans[PIXEL_COLUMNS];
+static ColumnSpan* column_span_ptr;
+
+#if RENDER_DMA_DIRTY_ROWS
+u16 fb_dirty_rows_A;
+u16 fb_dirty_rows_B;
+#endif
+
+void fb_reset_column_spans_state ()
+{
+    for (u16 i=0; i < PIXEL_COLUMNS; ++i) {
+        column_spans[i].firstRow = VERTICAL_ROWS/2;
+        column_spans[i].firstSolidRow = VERTICAL_ROWS/2;
+        column_spans[i].edge = 0;
+        column_spans[i].solid = 0;
+    }
+    column_span_ptr = column_spans;
+    #if RENDER_DMA_DIRTY_ROWS
+    // Whole planes have to be sent at least once
+    fb_dirty_rows_A = FB_DIRTY_ROWS_ALL;
+    fb_dirty_rows_B = FB_DIRTY_ROWS_ALL;
+    #endif
+}
+
+FORCE_INLINE void fb_reset_column_spans ()
+{
+    column_span_ptr = column_spans;
+}
+
+/// @brief First row after r where the column entry changes: its edge row, its first solid row, or the middle of the column.
+static FORCE_INLINE u16 span_next_change (u16 r, u16 firstRow, u16 firstSolidRow)
+{
+    if (r < firstRow)
+        return firstRow;
+    if (r < firstSolidRow)
+        return firstSolidRow;
+    return VERTICAL_ROWS/2;
+}
+
+/// @brief Bottom half entry mirroring top row r. Compared along with the top one since an edge tile with (h2 & 7) == 0
+/// has the same top entry than the solid tile but a V-flipped bottom one.
+static FORCE_INLINE u16 span_bottom_entry (u16 r, u16 firstRow, u16 firstSolidRow, u16 edge, u16 solid)
+{
+    if (r < firstRow)
+        return 0;
+    if (r < firstSolidRow)
+        return edge | TILE_ATTR_VFLIP_MASK;
+    return solid;
+}
+
+static FORCE_INLINE u16 span_top_entry (u16 r, u16 firstRow, u16 firstSolidRow, u16 edge, u16 solid)
+{
+    if (r < firstRow)
+        return 0;
+    if (r < firstSolidRow)
+        return edge;
+    return solid;
+}
+
+static FORCE_INLINE void update_column_span (u16 firstRow, u16 firstSolidRow, u16 edge, u16 solid)
+{
+    ColumnSpan* span = column_span_ptr++;
+
+    if (firstRow == span->firstRow && firstSolidRow == span->firstSolidRow && edge == span->edge && solid == span->solid)
+        return;
+
+    #if RENDER_DMA_DIRTY_ROWS
+    u16 dirty = 0;
+    #endif
+
+    // Both frames are empty, edge, then solid along the top half rows, so they are equal by runs split at any of their
+    // first rows and first solid rows. Only the runs whose entries differ get rewritten, eg: a 1 px taller wall only
+    // touches its edge row and the row below. Rows above both first rows are empty in both frames.
+    for (u16 r = min(firstRow, span->firstRow); r < VERTICAL_ROWS/2;) {
+        const u16 end = min(span_next_change(r, firstRow, firstSolidRow), span_next_change(r, span->firstRow, span->firstSolidRow));
+        const u16 topEntry = span_top_entry(r, firstRow, firstSolidRow, edge, solid);
+        const u16 bottomEntry = span_bottom_entry(r, firstRow, firstSolidRow, edge, solid);
+
+        if (topEntry != span_top_entry(r, span->firstRow, span->firstSolidRow, span->edge, span->solid)
+                || bottomEntry != span_bottom_entry(r, span->firstRow, span->firstSolidRow, span->edge, span->solid)) {
+            #if RENDER_DMA_DIRTY_ROWS
+            dirty |= (1 << end) - (1 << r);
+            #endif
+            u16* top = column_ptr + r*TILEMAP_COLUMNS;
+            u16* bottom = column_ptr + ((VERTICAL_ROWS-1) - r)*TILEMAP_COLUMNS;
+            for (u16 n = end - r; n--;) {
+                *top = topEntry;
+                *bottom = bottomEntry;
+                top += TILEMAP_COLUMNS;
+                bottom -= TILEMAP_COLUMNS;
+            }
+        }
+        r = end;
+    }
+
+    #if RENDER_DMA_DIRTY_ROWS
+    // Top rows and their bottom mirrors. Columns are interleaved between Plane A and Plane B regions.
+    if ((u32)column_ptr < (RAM_FIXED_FRAME_BUFFER_ADDRESS + VERTICAL_ROWS*TILEMAP_COLUMNS*2))
+        fb_dirty_rows_A |= dirty;
+    else
+        fb_dirty_rows_B |= dirty;
+    #endif
+
+    span->firstRow = firstRow;
+    span->firstSolidRow = firstSolidRow;
+    span->edge = edge;
+    span->solid = solid;
+}
+
+FORCE_INLINE void write_vline_incremental (u16 h2, u16 tileAttrib)
+{
+    // Same layout than write_vline(): h2 == 0 is a full solid column, otherwise the edge tile is at row (h2 / 8)
+    if (h2 == 0) {
+        update_column_span(0, 0, tileAttrib, tileAttrib);
+    }
+    else {
+        const u16 ta = h2 / 8;
+        update_column_span(ta, ta + 1, tileAttrib + (h2 & 7), tileAttrib);
+    }
+}
+
+FORCE_INLINE void write_vline_incremental_empty ()
+{
+    update_column_span(VERTICAL_ROWS/2, VERTICAL_ROWS/2, 0, 0);
+}
+
+#endif
+
+#if RENDER_DMA_COLUMNS_FROM_ROM && !RENDER_HALVED_PLANES
+
+FORCE_INLINE void write_vline_rom (u16 h2, u16 tileAttrib)
+{
+    // Only one entry per column. The id goes in the first row, so column_ptr walks the columns as usual
+    *column_ptr = 1 + h2*TAB_COLUMN_PATTERNS_KEYS + TAB_COLUMN_PATTERNS_KEY(tileAttrib);
+}
+
+FORCE_INLINE void write_vline_rom_empty ()
+{
+    *column_ptr = TAB_COLUMN_PATTERNS_EMPTY;
+}
+
+#if HOST_BUILD
+
+void fb_expand_columns_from_ROM ()
+{
+    u16* frame_buffer = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+
+    // Ids share the first row with the expanded columns, so all of them are read first
+    u16 ids[PIXEL_COLUMNS];
+    for (u16 i=0; i < TILEMAP_COLUMNS; ++i) {
+        ids[i] = frame_buffer[i];
+        ids[TILEMAP_COLUMNS + i] = frame_buffer[VERTICAL_ROWS*TILEMAP_COLUMNS + i];
+    }
+
+    for (u16 i=0; i < PIXEL_COLUMNS; ++i) {
+        u16* column = frame_buffer + (i / TILEMAP_COLUMNS)*(VERTICAL_ROWS*TILEMAP_COLUMNS) + (i % TILEMAP_COLUMNS);
+        const u16* pattern = tab_column_patterns + (ids[i] << TAB_COLUMN_PATTERNS_STRIDE_SFT);
+        for (u16 r=0; r < VERTICAL_ROWS; ++r)
+            column[r*TILEMAP_COLUMNS] = pattern[r];
+    }
+}
+
+#else
+
+/// @brief Sets source and length of the DMA and triggers it. Length high was already set.
+static FORCE_INLINE void dma_column (vu32* vdpCtrl_ptr_l, u32 from, u32 cmdAddr)
+{
+    *(vu16*)vdpCtrl_ptr_l = 0x9300 | (VERTICAL_ROWS & 0xff); // DMA length low
+    *vdpCtrl_ptr_l = 0x95009600 | ((from & 0xff) << 16) | ((from >> 8) & 0xff); // low and mid address
+    *(vu16*)vdpCtrl_ptr_l = 0x9700 | ((from >> 16) & 0x7f); // high address
+    *vdpCtrl_ptr_l = cmdAddr; // trigger DMA
+}
+
+FORCE_INLINE void fb_DMA_columns_from_ROM ()
+{
+    // Arguments must be in byte addressing mode, except the length since DMA ROM to VRAM copies 2 bytes on every cycle.
+
+    vu32* vdpCtrl_ptr_l = (vu32*) VDP_CTRL_PORT;
+    const u16* ids_A = (const u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+    const u16* ids_B = (const u16*) (RAM_FIXED_FRAME_BUFFER_ADDRESS + (VERTICAL_ROWS*TILEMAP_COLUMNS)*2);
+    const u32 patterns = ((u32) tab_column_patterns) >> 1;
+
+    // VDP stepping is the plane row stride, so the pattern goes down the column
+    *(vu16*)vdpCtrl_ptr_l = 0x8F00 | (PLANE_COLUMNS*2);
+    // Setup DMA length high ONLY ONCE. It stays 0 after every DMA since VERTICAL_ROWS < 256
+    *(vu16*)vdpCtrl_ptr_l = 0x9400 | ((VERTICAL_ROWS >> 8) & 0xff); // DMA length high
+
+    #pragma GCC unroll 256 // Always set a big number since it does not accept defines
+    for (u16 i=0; i < TILEMAP_COLUMNS; ++i) {
+        // Plane A column
+        dma_column(vdpCtrl_ptr_l, patterns + ((u32)ids_A[i] << TAB_COLUMN_PATTERNS_STRIDE_SFT), VDP_DMA_VRAM_ADDR(PA_ADDR + i*2));
+    }
+
+    #pragma GCC unroll 256 // Always set a big number since it does not accept defines
+    for (u16 i=0; i < TILEMAP_COLUMNS; ++i) {
+        // Plane B column
+        dma_column(vdpCtrl_ptr_l, patterns + ((u32)ids_B[i] << TAB_COLUMN_PATTERNS_STRIDE_SFT), VDP_DMA_VRAM_ADDR(PB_ADDR + i*2));
+    }
+
+    // Restore VDP stepping
+    *(vu16*)vdpCtrl_ptr_l = 0x8F00 | 2;
+}
+
+#endif // HOST_BUILD
+
+#endif
+#if RENDER_SMOOTH_ROTATION && !RENDER_HALVED_PLANES
+
+#if RENDER_DMA_COLUMNS_FROM_ROM
+// Pattern id of the left and right edge columns of every plane region
+static u16 guard_ids[FRAME_BUFFER_PLANES*2];
+#else
+// Left and right edge columns of every plane region, rows laid out contiguous so each one goes in a single DMA
+static u16 guard_columns[FRAME_BUFFER_PLANES*2][VERTICAL_ROWS];
+#endif
+
+FORCE_INLINE void fb_fill_guard_columns ()
+{
+    const u16* frame_buffer = (const u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+
+    for (u16 p=0; p < FRAME_BUFFER_PLANES; ++p) {
+        const u16* left = frame_buffer + p*(VERTICAL_ROWS*TILEMAP_COLUMNS);
+        const u16* right = left + (TILEMAP_COLUMNS-1);
+        #if RENDER_DMA_COLUMNS_FROM_ROM
+        guard_ids[2*p] = *left;
+        guard_ids[2*p + 1] = *right;
+        #else
+        u16* guard_left = guard_columns[2*p];
+        u16* guard_right = guard_columns[2*p + 1];
+        for (u16 r=VERTICAL_ROWS; r--;) {
+            *guard_left++ = *left;
+            *guard_right++ = *right;
+            left += TILEMAP_COLUMNS;
+            right += TILEMAP_COLUMNS;
+        }
+        #endif
+    }
+}
+
+#if !HOST_BUILD
+
+/// @brief Sets source and length of the DMA and triggers it. Length high was already set.
+static FORCE_INLINE void dma_guard_column (vu32* vdpCtrl_ptr_l, u32 from, u32 cmdAddr)
+{
+    *(vu16*)vdpCtrl_ptr_l = 0x9300 | (VERTICAL_ROWS & 0xff); // DMA length low
+    *vdpCtrl_ptr_l = 0x95009600 | ((from & 0xff) << 16) | ((from >> 8) & 0xff); // low and mid address
+    *(vu16*)vdpCtrl_ptr_l = 0x9700 | ((from >> 16) & 0x7f); // high address
+    *vdpCtrl_ptr_l = cmdAddr; // trigger DMA
+}
+
+FORCE_INLINE void fb_DMA_guard_columns ()
+{
+    // Arguments must be in byte addressing mode, except the length since DMA RAM/ROM to VRAM copies 2 bytes on every cycle.
+
+    vu32* vdpCtrl_ptr_l = (vu32*) VDP_CTRL_PORT;
+
+    // VDP stepping is the plane row stride, so the column goes down the plane
+    *(vu16*)vdpCtrl_ptr_l = 0x8F00 | (PLANE_COLUMNS*2);
+    // Setup DMA length high ONLY ONCE. It stays 0 after every DMA since VERTICAL_ROWS < 256
+    *(vu16*)vdpCtrl_ptr_l = 0x9400 | ((VERTICAL_ROWS >> 8) & 0xff); // DMA length high
+
+    for (u16 p=0; p < FRAME_BUFFER_PLANES; ++p) {
+        const u16 plane_addr = p == 0 ? PA_ADDR : PB_ADDR;
+        #if RENDER_DMA_COLUMNS_FROM_ROM
+        const u32 from_left = (((u32) tab_column_patterns) >> 1) + ((u32)guard_ids[2*p] << TAB_COLUMN_PATTERNS_STRIDE_SFT);
+        const u32 from_right = (((u32) tab_column_patterns) >> 1) + ((u32)guard_ids[2*p + 1] << TAB_COLUMN_PATTERNS_STRIDE_SFT);
+        #else
+        const u32 from_left = ((u32) guard_columns[2*p]) >> 1;
+        const u32 from_right = ((u32) guard_columns[2*p + 1]) >> 1;
+        #endif
+        #pragma GCC unroll 256 // Always set a big number since it does not accept defines
+        for (u16 i=0; i < RENDER_SMOOTH_ROTATION_GUARD_COLUMNS; ++i) {
+            dma_guard_column(vdpCtrl_ptr_l, from_left, VDP_DMA_VRAM_ADDR(plane_addr + (PLANE_COLUMNS-1 - i)*2));
+            dma_guard_column(vdpCtrl_ptr_l, from_right, VDP_DMA_VRAM_ADDR(plane_addr + (TILEMAP_COLUMNS + i)*2));
+        }
+    }
+
+    // Restore VDP stepping
+    *(vu16*)vdpCtrl_ptr_l = 0x8F00 | 2;
+}
+
+#endif // !HOST_BUILD
+
+#endif
+#if RENDER_SINGLE_PLANE_TILES_PAIR && !RENDER_HALVED_PLANES
+
+// Even column waiting for its odd neighbour. h2 of an empty column is out of write_vline() range, so it never matches a row.
+#define PAIR_EMPTY_H2 ((VERTICAL_ROWS/2)*8)
+static u16 pair_h2;
+static u16 pair_tileAttrib;
+
+/// @brief Tile index and palette of the top half row r of a column, same than clear_buffer() + write_vline() would set.
+/// A solid column (h2 = 0) has its edge at row 0 with the full tile, so it needs no special case.
+static FORCE_INLINE u16 pair_row_entry (u16 r, u16 ta, u16 edge, u16 tileAttrib)
+{
+    if (r < ta)
+        return 0;
+    if (r == ta)
+        return edge;
+    return tileAttrib;
+}
+
+/// @brief First row after r whose entry differs from the one of row r: the edge row, the row after it, or the middle of the column.
+static FORCE_INLINE u16 pair_next_change (u16 r, u16 ta)
+{
+    if (r < ta)
+        return ta;
+    if (r == ta)
+        return ta + 1;
+    return VERTICAL_ROWS/2;
+}
+
+static FORCE_INLINE void write_pair (u16 h2, u16 tileAttrib)
+{
+    // column_ptr only points into Plane B region on odd columns (see the columns loop in game_loop.c)
+    if ((u32)column_ptr < (RAM_FIXED_FRAME_BUFFER_ADDRESS + VERTICAL_ROWS*TILEMAP_COLUMNS*2)) {
+        pair_h2 = h2;
+        pair_tileAttrib = tileAttrib;
+        return;
+    }
+
+    // Plane B region doesn't exist, the pair goes into the column of its even neighbour
+    u16* top = column_ptr - VERTICAL_ROWS*TILEMAP_COLUMNS;
+    u16* bottom = top + (VERTICAL_ROWS-1)*TILEMAP_COLUMNS;
+
+    const u16 taA = pair_h2 / 8, edgeA = pair_tileAttrib + (pair_h2 & 7);
+    const u16 taB = h2 / 8, edgeB = tileAttrib + (h2 & 7);
+
+    // Every column is empty, edge, then full, so the pair changes at most 4 times along the top half rows.
+    // One dictionary lookup per run of equal rows, then only stores.
+    for (u16 r = 0; r < VERTICAL_ROWS/2;) {
+        const u16 a = pair_row_entry(r, taA, edgeA, pair_tileAttrib);
+        const u16 b = pair_row_entry(r, taB, edgeB, tileAttrib);
+        const u16 slot = tab_tiles_pair[(a & TILE_INDEX_MASK)*TILES_PAIR_WALL_TILES + (b & TILE_INDEX_MASK)];
+        // A combined tile has only one palette: the even column's one, unless it's empty (see RENDER_SINGLE_PLANE_TILES_PAIR in consts.h)
+        const u16 pal = (a & TILE_INDEX_MASK) ? (a & TILE_ATTR_PALETTE_MASK) : (b & TILE_ATTR_PALETTE_MASK);
+        const u16 topEntry = pal | slot;
+        // Bottom half rows are the V-flipped top half rows, for both halves of the combined tile
+        const u16 bottomEntry = slot ? (pal | slot | TILE_ATTR_VFLIP_MASK) : 0;
+        const u16 end = min(pair_next_change(r, taA), pair_next_change(r, taB));
+        for (; r < end; ++r) {
+            *top = topEntry;
+            *bottom = bottomEntry;
+            top += TILEMAP_COLUMNS;
+            bottom -= TILEMAP_COLUMNS;
+        }
+    }
+}
+
+FORCE_INLINE void write_vline_pair (u16 h2, u16 tileAttrib)
+{
+    write_pair(h2, tileAttrib);
+}
+
+FORCE_INLINE void write_vline_pair_empty ()
+{
+    write_pair(PAIR_EMPTY_H2, 0);
+}
+
+#endif
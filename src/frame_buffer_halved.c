@@ -1,6 +1,7 @@
 #include <types.h>
 #include <sys.h>
 #include <vdp_tile.h>
+#include <memory.h>
 #include "frame_buffer.h"
 #include "consts.h"
 #include "consts_ext.h"
@@ -45,6 +46,23 @@
     "    .endif\n"
         // Remaining conditions (up to regs-1) should be added here and adjusted according the available registers
 
+#if HOST_BUILD
+
+// C version of the asm clear routines below. Only the bottom half rows of Plane A and Plane B regions.
+void clear_buffer_halved ()
+{
+    u16* frame_buffer = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+    memsetU32((u32*)(frame_buffer + (VERTICAL_ROWS/2)*TILEMAP_COLUMNS), 0, ((VERTICAL_ROWS/2)*TILEMAP_COLUMNS)/2);
+    memsetU32((u32*)(frame_buffer + VERTICAL_ROWS*TILEMAP_COLUMNS + (VERTICAL_ROWS/2)*TILEMAP_COLUMNS), 0, ((VERTICAL_ROWS/2)*TILEMAP_COLUMNS)/2);
+}
+
+void clear_buffer_halved_sp ()
+{
+    clear_buffer_halved();
+}
+
+#else
+
 NO_INLINE void clear_buffer_halved ()
 {
     // We need to clear only first TILEMAP_COLUMNS columns from each row from the framebuffer.
@@ -177,6 +195,8 @@ NO_INLINE void clear_buffer_halved_sp ()
 	);
 }
 
+#endif // HOST_BUILD
+
 #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
 // Stores top tilemap entry value followed by h2 row value, for evey processed column.
 static u16 top_entries[2*PIXEL_COLUMNS];
@@ -205,10 +225,18 @@ FORCE_INLINE void write_vline_halved (u16 h2, u16 tileAttrib)
 
 	// Draw HALF a solid vertical line from CENTER to BOTTOM
 	if (h2 == 0) {
+        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
+        // The top entry of a solid line is a plain one at row 0. Otherwise the mirroring sets the one left by a previous frame.
+        top_entries[top_entries_current_col] = tileAttrib;
+        top_entries[top_entries_current_col + 1] = 0;
+        #endif
+
 		// C version
-		/*for (u16 y = 0; y < (VERTICAL_ROWS*TILEMAP_COLUMNS)/2; y+=TILEMAP_COLUMNS) {
+		#if HOST_BUILD
+		for (u16 y = (VERTICAL_ROWS/2)*TILEMAP_COLUMNS; y < VERTICAL_ROWS*TILEMAP_COLUMNS; y += TILEMAP_COLUMNS) {
 			column_ptr[y] = tileAttrib;
-		}*/
+		}
+		#else
 
 		// ASM version
 		__asm volatile (
@@ -222,17 +250,39 @@ FORCE_INLINE void write_vline_halved (u16 h2, u16 tileAttrib)
               [_VERTICAL_ROWS] "i" (VERTICAL_ROWS), [_TILEMAP_COLUMNS] "i" (TILEMAP_COLUMNS)
 			:
 		);
+		#endif
 
         return;
 	}
 
+    #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
+    u16* top_entries_ptr = top_entries + top_entries_current_col;
+    #endif
+
+    #if HOST_BUILD
+
+    // C version of the ASM block below. Same entries in the same order.
+    const u16 ta = h2 / 8; // vertical tilemap entry position
+    for (u16 r = (VERTICAL_ROWS-2) - ta; r >= VERTICAL_ROWS/2; --r) {
+        column_ptr[r*TILEMAP_COLUMNS] = tileAttrib;
+    }
+    tileAttrib += h2 & 7; // offsets the tileAttrib by the halved pixel height modulo 8
+    #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
+    // top tilemap entry, and its row in byte addressing
+    top_entries_ptr[0] = tileAttrib;
+    top_entries_ptr[1] = ta*TILEMAP_COLUMNS*2;
+    #endif
+    // bottom tilemap entry (with flipped attribute)
+    column_ptr[((VERTICAL_ROWS-1)-ta)*TILEMAP_COLUMNS] = tileAttrib | TILE_ATTR_VFLIP_MASK;
+
+    #else
+
     // ASM version.
     // This block of code sets tileAttrib which points to a colored tile.
     // This block of code sets bottom tilemap entry and save the top value into an array for later use.
     u16 h2_aux = h2;
-    #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-    u16* top_entries_ptr = top_entries + top_entries_current_col;
-    #endif
+    // The block moves the pointer to reach the bottom entry, so it works on a copy (see write_vline())
+    u16* tilemap = column_ptr;
     __asm volatile (
         // Offset h2 comes already multiplied by 8, great, but we need to clear the first 3 bits and then 
         // divided by 2 so we can use it as a multiple of the block size (4 bytes) we'll jump into
@@ -284,18 +334,46 @@ FORCE_INLINE void write_vline_halved (u16 h2, u16 tileAttrib)
         "    lea     %c[H2_BOTTOM](%[tilemap]),%[tilemap]\n"
         "    move.w  %[tileAttrib],(%[tilemap])"
 
-        : [h2] "+d" (h2), [tileAttrib] "+d" (tileAttrib), [h2_aux] "+d" (h2_aux)
+        : [h2] "+d" (h2), [tileAttrib] "+d" (tileAttrib), [h2_aux] "+d" (h2_aux), [tilemap] "+a" (tilemap)
           #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
           , [top_entries_ptr] "+a" (top_entries_ptr)
           #endif
-        : [tilemap] "a" (column_ptr), [CLEAR_BITS_OFFSET] "i" (~(8-1)), 
+        : [CLEAR_BITS_OFFSET] "i" (~(8-1)), 
           [_VERTICAL_ROWS] "i" (VERTICAL_ROWS), [_TILEMAP_COLUMNS] "i" (TILEMAP_COLUMNS), 
           [_H2_FOR_TOP_ENTRY] "i" (H2_FOR_TOP_ENTRY), [H2_BOTTOM] "i" (H2_FOR_BOTTOM_ENTRY),
           [_TILE_ATTR_VFLIP_MASK] "i" (TILE_ATTR_VFLIP_MASK)
         :
     );
+
+    #endif // HOST_BUILD
+}
+
+FORCE_INLINE void write_vline_halved_fused (u32 h2_tileAttrib)
+{
+    // Only unpacks: h2 is in the high word (a swap gets it) and tileAttrib is in the low word (usable as it is).
+    // Unlike write_vline_fused() there is no dedicated ASM block for the halved planes: the block would only pin the same
+    // move.l+swap unpack, and it would have to be repeated for the top entries stored by each RENDER_MIRROR_PLANES_* mode.
+    // Worth it only if kernel write_vline_fused turns out faster than write_vline (compare write_vline_halved_fused too).
+    write_vline_halved(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+}
+
+#if HOST_BUILD
+
+// C version of the asm macro below. Bottom half row i goes into top half row (VERTICAL_ROWS/2 - 1) - i.
+static FORCE_INLINE void copy_bottom_half_into_top_half (u32 srcAddr, u32 dstAddr)
+{
+    const u16* src = (const u16*) srcAddr;
+    u16* dst = (u16*) dstAddr;
+    for (u16 i = 0; i < VERTICAL_ROWS/2; ++i) {
+        for (u16 x = 0; x < TILEMAP_COLUMNS; ++x)
+            dst[x] = src[x];
+        src += TILEMAP_COLUMNS;
+        dst -= TILEMAP_COLUMNS;
+    }
 }
 
+#else
+
 #define copy_bottom_half_into_top_half(srcAddr,dstAddr) \
     __asm volatile ( \
         /* Save all registers (except scratch pad) */ \
@@ -341,6 +419,8 @@ FORCE_INLINE void write_vline_halved (u16 h2, u16 tileAttrib)
                 "lea     7*4(%%a1),%%a1\n\t" \
             ".endif\n" \
             /* Remaining conditions (up to regs-1) should be added here and adjusted according the available registers */ \
+            /* Target goes up: back from the end of the row just copied to the start of the previous one */ \
+            "lea     -2*%c[TILEMAP_COLUMNS_BYTES](%%a1),%%a1\n\t" \
         ".endr\n\t" \
         /* Restore SP */ \
 		"move.l  %%usp,%%sp\n\t" \
@@ -352,6 +432,8 @@ FORCE_INLINE void write_vline_halved (u16 h2, u16 tileAttrib)
         : \
     )
 
+#endif // HOST_BUILD
+
 static FORCE_INLINE void copy_top_entries_in_RAM ()
 {
     #if RENDER_MIRROR_PLANES_USING_CPU_RAM
@@ -370,6 +452,22 @@ static FORCE_INLINE void copy_top_entries_in_RAM ()
         frame_buffer[VERTICAL_ROWS*TILEMAP_COLUMNS + i + h2] = val; // h2 comes in byte addressing
     }*/
 
+    #if HOST_BUILD
+
+    // C version of the ASM block below. Rows come in byte addressing.
+    u16* frame_buffer = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+    u16* entries_ptr = top_entries;
+    for (u16 i=0; i < PIXEL_COLUMNS/2; ++i) {
+        u16 val = *entries_ptr++;
+        u16 h2 = *entries_ptr++;
+        frame_buffer[i + h2/2] = val;
+        val = *entries_ptr++;
+        h2 = *entries_ptr++;
+        frame_buffer[VERTICAL_ROWS*TILEMAP_COLUMNS + i + h2/2] = val;
+    }
+
+    #else
+
     // ASM version: set tilemap top entries (already inverted)
     u16* frame_buffer = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
     u32* entries_ptr = (u32*) top_entries;
@@ -396,6 +494,8 @@ static FORCE_INLINE void copy_top_entries_in_RAM ()
         :
     );
 
+    #endif // HOST_BUILD
+
     #endif
 }
 
@@ -412,6 +512,17 @@ FORCE_INLINE void fb_mirror_planes_in_RAM ()
     copy_top_entries_in_RAM();
 }
 
+#if HOST_BUILD
+
+// The VRAM to VRAM copies have no host counterpart, so only the framebuffer side is done: clearing the bottom halves.
+// host_main.c calls it once the frame was hashed, as the VInt does once the frame was DMAed. Top entries stay in VRAM.
+void fb_mirror_planes_in_VRAM ()
+{
+    clear_buffer_halved();
+}
+
+#else
+
 static FORCE_INLINE void clear_buffer_row (u32* ptr)
 {
     // C version
@@ -512,4 +623,6 @@ FORCE_INLINE void fb_copy_top_entries_in_VRAM ()
     /// TODO: use same snippet than in copy_top_entries_in_RAM() but replacing %[fb] by ctrl_port and data_port
 
     #endif
-}
\ No newline at end of file
+}
+
+#endif // HOST_BUILD
@@ -10,30 +10,111 @@
 #include "map_matrix.h"
 #include "frame_buffer.h"
 #include "render.h"
+#include "vint_callback.h"
 #include "vgm_res.h"
 #include "hud.h"
 #include "weapon.h"
 //#include <sprite_eng.h>
 #include "spr_eng_override.h"
+#include "bench.h"
+#include "profiler.h"
+#include "dma_stats.h"
+#include "floor_ceiling.h"
+#include "depth_buffer.h"
 
 #include "tab_dir_xy.h"
 #include "tab_wall_div.h"
 
-#if RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED && !RENDER_SHOW_TEXCOORD
+#if RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD
+    #include "tab_wall_hit_fused.h"
+#elif RENDER_WALL_MATERIALS && !RENDER_SHOW_TEXCOORD
+    #include "tab_wall_materials.h"
+#elif RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED && !RENDER_SHOW_TEXCOORD
     #include "tab_color_d8_1_pals_shft.h"
 #elif !RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED && !RENDER_SHOW_TEXCOORD
     #include "tab_color_d8_1.h"
 #endif
 
+#if RENDER_SMOOTH_ROTATION && !RENDER_SKIP_STATIC_FRAME
+#error "RENDER_SMOOTH_ROTATION needs RENDER_SKIP_STATIC_FRAME to skip dda() on the frames in between angle steps"
+#endif
+
+#if RENDER_SMOOTH_ROTATION && RENDER_HALVED_PLANES
+#error "RENDER_SMOOTH_ROTATION is not used along with RENDER_HALVED_PLANES, whose framebuffer has no bottom rows to fill the guard columns with"
+#endif
+
+#if RENDER_SMOOTH_ROTATION && (TILEMAP_COLUMNS + 2*RENDER_SMOOTH_ROTATION_GUARD_COLUMNS) > PLANE_COLUMNS
+#error "RENDER_SMOOTH_ROTATION_GUARD_COLUMNS at both screen edges don't fit in PLANE_COLUMNS"
+#endif
+
+#if HOST_BUILD && RENDER_SHOW_TEXCOORD
+#error "HOST_BUILD doesn't support RENDER_SHOW_TEXCOORD"
+#endif
+
+#if RENDER_USE_TAB_DELTAS_FOLDED && RENDER_USE_DDA_QUADRANT_KERNELS
+#error "RENDER_USE_TAB_DELTAS_FOLDED is not used along with RENDER_USE_DDA_QUADRANT_KERNELS"
+#endif
+
+#if MAP_RUNTIME_LEVELS && RENDER_USE_MAP_HIT_COMPRESSED
+#error "MAP_RUNTIME_LEVELS is not used along with RENDER_USE_MAP_HIT_COMPRESSED"
+#endif
+
+#if RENDER_WALL_MATERIALS && (!MAP_RUNTIME_LEVELS || RENDER_USE_TAB_WALL_HIT_FUSED || RENDER_SHOW_TEXCOORD)
+#error "RENDER_WALL_MATERIALS needs MAP_RUNTIME_LEVELS, and is not used along with RENDER_USE_TAB_WALL_HIT_FUSED nor RENDER_SHOW_TEXCOORD"
+#endif
+
+#if RENDER_DMA_DIRTY_ROWS && !RENDER_INCREMENTAL_FRAMEBUFFER
+#error "RENDER_DMA_DIRTY_ROWS needs RENDER_INCREMENTAL_FRAMEBUFFER, otherwise no row is ever flagged as dirty"
+#endif
+
+#if RENDER_DMA_COLUMNS_FROM_ROM && (RENDER_HALVED_PLANES || RENDER_INCREMENTAL_FRAMEBUFFER || RENDER_SHOW_TEXCOORD)
+#error "RENDER_DMA_COLUMNS_FROM_ROM is not used along with RENDER_HALVED_PLANES, RENDER_INCREMENTAL_FRAMEBUFFER nor RENDER_SHOW_TEXCOORD"
+#endif
+
+#if RENDER_SINGLE_PLANE_TILES_PAIR && (RENDER_HALVED_PLANES || RENDER_INCREMENTAL_FRAMEBUFFER || RENDER_DMA_COLUMNS_FROM_ROM || RENDER_SHOW_TEXCOORD)
+#error "RENDER_SINGLE_PLANE_TILES_PAIR is not used along with RENDER_HALVED_PLANES, RENDER_INCREMENTAL_FRAMEBUFFER, RENDER_DMA_COLUMNS_FROM_ROM nor RENDER_SHOW_TEXCOORD"
+#endif
+
+#if RENDER_COLUMNS_UNROLL < 1 || ((PIXEL_COLUMNS) % RENDER_COLUMNS_UNROLL) != 0
+#error "RENDER_COLUMNS_UNROLL must divide PIXEL_COLUMNS"
+#endif
+
 #if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
     #include "perf_hash_mulu_256_shft_FS.h"
+    #if RENDER_USE_TAB_DELTAS_FOLDED
+    #include "tab_deltas_perf_hash_folded.h"
+    #else
     #include "tab_deltas_perf_hash.h"
+    #endif
 #else
+    #if RENDER_USE_TAB_DELTAS_FOLDED
+    #include "tab_deltas_folded.h"
+    #else
     #include "tab_deltas.h"
+    #endif
+#endif
+
+#if RENDER_USE_TAB_DELTAS_FOLDED
+// Angle a of quadrant q = a/(AP/4) uses the entries of angle a%(AP/4) at the same column:
+//   q=0: as is
+//   q=1: deltaDistX/Y swapped, rayDirAngleX = rayDirAngleY, rayDirAngleY = -rayDirAngleX
+//   q=2: rayDirAngleX and rayDirAngleY negated
+//   q=3: deltaDistX/Y swapped, rayDirAngleX = -rayDirAngleY, rayDirAngleY = rayDirAngleX
+#define DELTAS_ANGLE(a) ((a) & (AP/4 - 1))
+#define DELTAS_QUADRANT(a) ((a) / (AP/4))
+// Quadrant of the current viewing angle. Set along with delta_a_ptr.
+static u16 deltas_quadrant;
+#else
+#define DELTAS_ANGLE(a) (a)
 #endif
 
 #if RENDER_USE_MAP_HIT_COMPRESSED
 #include "map_hit_compressed.h"
+#elif RENDER_USE_DDA_QUADRANT_KERNELS
+#include "tab_dda_quadrants.h"
+#define DDA_SEGMENTS(a) (tab_dda_quadrants + (a) * DDA_QUADRANT_SEGMENTS * 2)
+// Segments of the current viewing angle. Set along with delta_a_ptr, so dda() doesn't divide to recover the angle.
+static const u8* dda_segment_ptr;
 #endif
 
 #include "game_loop.h"
@@ -41,23 +122,45 @@
 static void dda (u16 posX, u16 posY, u16* delta_a_ptr);
 
 #if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
-static void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u32 sideDistX_l0, u32 sideDistX_l1, u32 sideDistY_l0, u32 sideDistY_l1);
+static void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u32 sideDistX_l0, u32 sideDistX_l1, u32 sideDistY_l0, u32 sideDistY_l1, const u16 quadrant);
+#else
+static void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u16 sideDistX_l0, u16 sideDistX_l1, u16 sideDistY_l0, u16 sideDistY_l1, const u16 quadrant);
+#endif
+
+#if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+static void dda_columns (u16 column, u16* delta_a_ptr, u16 posX, u16 posY, u32 sideDistX_l0, u32 sideDistX_l1, u32 sideDistY_l0, u32 sideDistY_l1, const u16 quadrant);
 #else
-static void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u16 sideDistX_l0, u16 sideDistX_l1, u16 sideDistY_l0, u16 sideDistY_l1);
+static void dda_columns (u16 column, u16* delta_a_ptr, u16 posX, u16 posY, u16 sideDistX_l0, u16 sideDistX_l1, u16 sideDistY_l0, u16 sideDistY_l1, const u16 quadrant);
 #endif
 
 #if RENDER_USE_MAP_HIT_COMPRESSED
 static void do_stepping (u16 posX, u16 posY, u16 sideDistX, u16 sideDistY, s16 rayDirAngleX, s16 rayDirAngleY);
 #else
 static void do_stepping (u16 posX, u16 posY, u16 deltaDistX, u16 deltaDistY, u16 sideDistX, u16 sideDistY, s16 stepX, s16 stepY, s16 stepYMS, s16 rayDirAngleX, s16 rayDirAngleY);
+static void do_stepping_inline (u16 posX, u16 posY, u16 deltaDistX, u16 deltaDistY, u16 sideDistX, u16 sideDistY, s16 stepX, s16 stepY, s16 stepYMS, s16 rayDirAngleX, s16 rayDirAngleY);
 #endif
 
+#if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+#if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+static void dda_quadrant_columns (u16 column, u16 end, u16* delta_a_ptr, s16* offset_xor_ptr, u16 posX, u16 posY, u32 sideDistX_l, u32 sideDistY_l, const s16 stepX, const s16 stepY);
+#else
+static void dda_quadrant_columns (u16 column, u16 end, u16* delta_a_ptr, s16* offset_xor_ptr, u16 posX, u16 posY, u16 sideDistX_l, u16 sideDistY_l, const s16 stepX, const s16 stepY);
+#endif
+#endif
+
+// With RENDER_WALL_MATERIALS mapY/mapX receive the map cell that was hit instead (see map_matrix.h)
 static void hitOnSideX (u16 sideDistX, u16 mapY, u16 posY, s16 rayDirAngleY);
 static void hitOnSideY (u16 sideDistY, u16 mapX, u16 posX, s16 rayDirAngleX);
 
 static void clearBuffer ()
 {
-    #if RENDER_MIRROR_PLANES_USING_VDP_VRAM
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+        // Nothing to clear. Every column rewrites only the rows that changed since previous frame. See write_vline_incremental().
+    #elif RENDER_DMA_COLUMNS_FROM_ROM
+        // Nothing to clear. Every column stores its pattern id, even when no wall was hit. See write_vline_rom().
+    #elif RENDER_SINGLE_PLANE_TILES_PAIR
+        // Nothing to clear. Every pair of columns writes all its rows, even when no wall was hit. See write_vline_pair().
+    #elif RENDER_MIRROR_PLANES_USING_VDP_VRAM
         // ramebuffer is cleared while VRAM to VRAM copy async ops are running. See fb_mirror_planes_in_VRAM().
     #else
         #if RENDER_CLEAR_FRAMEBUFFER
@@ -76,12 +179,59 @@ static void clearBuffer ()
     #endif
 }
 
-static void handle_input(u16* posX, u16* posY, u16* angle, u16** delta_a_ptr)
+#if RENDER_SMOOTH_ROTATION
+// Angle steps turned since last recast, in (-RENDER_SMOOTH_ROTATION_SUBSTEPS, RENDER_SMOOTH_ROTATION_SUBSTEPS). Positive is left.
+static s16 rotation_substep;
+#endif
+
+#if MAP_RUNTIME_LEVELS
+static u16 current_level;
+static u16 prev_joy_state;
+
+/// @brief Loads the given level into map[][] and moves the player to its start.
+static void load_level (u16 level, u16* posX, u16* posY, u16* angle, u16** delta_a_ptr)
+{
+    current_level = level;
+    map_loadLevel(level);
+    *posX = map_levels[level].posX;
+    *posY = map_levels[level].posY;
+    *angle = map_levels[level].angle;
+
+    #if RENDER_SMOOTH_ROTATION
+    // New level starts right at its angle
+    rotation_substep = 0;
+    vint_enqueueHScroll(0, TRUE);
+    #endif
+
+    u16 a = *angle / (u16)(1024/AP); // a range is [0, 128)
+    *delta_a_ptr = (u16*) (tab_deltas + DELTAS_ANGLE(a) * PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT);
+    #if RENDER_USE_TAB_DELTAS_FOLDED
+    deltas_quadrant = DELTAS_QUADRANT(a);
+    #endif
+    #if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+    dda_segment_ptr = DDA_SEGMENTS(a);
+    #endif
+}
+#endif
+
+/// @brief Reads the joypad and updates the player's view.
+/// @return FALSE if posX, posY and angle remain the same (only when RENDER_SKIP_STATIC_FRAME, otherwise always TRUE).
+static bool handle_input(u16* posX, u16* posY, u16* angle, u16** delta_a_ptr)
 {
     u16 joyState = joy_readJoypad_joy1();
     // if (joyState & BUTTON_START)
     //     break;
 
+    #if MAP_RUNTIME_LEVELS
+    // Only on press, otherwise levels keep cycling while START is held
+    const u16 pressed = joyState & ~prev_joy_state;
+    prev_joy_state = joyState;
+    if (pressed & (u16)BUTTON_START) {
+        load_level(current_level + 1 == MAP_LEVELS ? 0 : current_level + 1, posX, posY, angle, delta_a_ptr);
+        return TRUE;
+    }
+    #endif
+
     if (joyState & (u16)BUTTON_X) {
         weapon_next(-1);
     }
@@ -95,6 +245,14 @@ static void handle_input(u16* posX, u16* posY, u16* angle, u16** delta_a_ptr)
     // movement and collisions
     if (joyState & (u16)(BUTTON_UP | BUTTON_DOWN | BUTTON_B | BUTTON_LEFT | BUTTON_RIGHT)) {
 
+        #if RENDER_SKIP_STATIC_FRAME
+        const u16 prevPosX = *posX, prevPosY = *posY, prevAngle = *angle;
+        #endif
+
+        #if RENDER_SMOOTH_ROTATION
+        bool turned = FALSE;
+        #endif
+
         // Direction amount and sign depending on angle
         s16 dx=0, dy=0;
 
@@ -123,10 +281,29 @@ static void handle_input(u16* posX, u16* posY, u16* angle, u16** delta_a_ptr)
         }
         // Rotation (only when not strafing)
         else {
+            #if RENDER_SMOOTH_ROTATION
+            // Still one angle step per frame, but the angle only changes every RENDER_SMOOTH_ROTATION_SUBSTEPS steps. Meanwhile
+            // the last view is shifted by the steps turned so far: turning left moves the view to the right.
+            if (joyState & (u16)BUTTON_LEFT) {
+                if (++rotation_substep == RENDER_SMOOTH_ROTATION_SUBSTEPS) {
+                    rotation_substep = 0;
+                    *angle = (*angle + (u16)(RENDER_SMOOTH_ROTATION_SUBSTEPS*(1024/AP))) & (u16)1023;
+                }
+                turned = TRUE;
+            }
+            else if (joyState & (u16)BUTTON_RIGHT) {
+                if (--rotation_substep == -RENDER_SMOOTH_ROTATION_SUBSTEPS) {
+                    rotation_substep = 0;
+                    *angle = (*angle - (u16)(RENDER_SMOOTH_ROTATION_SUBSTEPS*(1024/AP))) & (u16)1023;
+                }
+                turned = TRUE;
+            }
+            #else
             if (joyState & (u16)BUTTON_LEFT)
                 *angle = (*angle + (u16)(1024/AP)) & (u16)1023;
             else if (joyState & (u16)BUTTON_RIGHT)
                 *angle = (*angle - (u16)(1024/AP)) & (u16)1023;
+            #endif
         }
 
         // Current location (normalized) before displacement
@@ -174,16 +351,112 @@ static void handle_input(u16* posX, u16* posY, u16* angle, u16** delta_a_ptr)
         }
 
         u16 a = *angle / (u16)(1024/AP); // a range is [0, 128)
-        *delta_a_ptr = (u16*) (tab_deltas + a * PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT);
+        *delta_a_ptr = (u16*) (tab_deltas + DELTAS_ANGLE(a) * PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT);
+        #if RENDER_USE_TAB_DELTAS_FOLDED
+        deltas_quadrant = DELTAS_QUADRANT(a);
+        #endif
+        #if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+        dda_segment_ptr = DDA_SEGMENTS(a);
+        #endif
 
         #if RENDER_USE_MAP_HIT_COMPRESSED
         map_hit_setRow(*posX, *posY, a);
         #endif
 
         weapon_updateSway(dx | dy);
+
+        #if RENDER_SKIP_STATIC_FRAME
+        // Moving against a wall gets the position clamped back to the previous one
+        const bool changed = (*posX != prevPosX) | (*posY != prevPosY) | (*angle != prevAngle);
+        #if RENDER_SMOOTH_ROTATION
+        // The new shift waits for the framebuffer whenever this frame recasts, also when moving while turning in between steps
+        if (turned)
+            vint_enqueueHScroll(rotation_substep * RENDER_SMOOTH_ROTATION_STEP_PX, changed);
+        #endif
+        return changed;
+        #endif
     }
+
+    #if RENDER_SKIP_STATIC_FRAME
+    return FALSE;
+    #else
+    return TRUE;
+    #endif
+}
+
+#if RENDER_SKIP_STATIC_FRAME
+// Kept in memory (not a local) since clearBuffer() doesn't save registers in the stack
+static bool view_changed;
+#endif
+
+#if HOST_BUILD
+
+void game_loop_renderFrame (u16 posX, u16 posY, u16 angle)
+{
+    u16 a = angle / (1024/AP); // a range is [0, 128)
+    u16* delta_a_ptr = (u16*) (tab_deltas + DELTAS_ANGLE(a) * PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT);
+    #if RENDER_USE_TAB_DELTAS_FOLDED
+    deltas_quadrant = DELTAS_QUADRANT(a);
+    #endif
+    #if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+    dda_segment_ptr = DDA_SEGMENTS(a);
+    #endif
+
+    #if RENDER_USE_MAP_HIT_COMPRESSED
+    map_hit_reset_vars();
+    map_hit_setRow(posX, posY, a);
+    #endif
+
+    clearBuffer();
+    dda(posX, posY, delta_a_ptr);
 }
 
+static u16* host_delta_a_ptr;
+
+void game_loop_inputStart (u16 posX, u16 posY, u16 angle)
+{
+    u16 a = angle / (1024/AP); // a range is [0, 128)
+    host_delta_a_ptr = (u16*) (tab_deltas + DELTAS_ANGLE(a) * PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT);
+    #if RENDER_USE_TAB_DELTAS_FOLDED
+    deltas_quadrant = DELTAS_QUADRANT(a);
+    #endif
+    #if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+    dda_segment_ptr = DDA_SEGMENTS(a);
+    #endif
+
+    #if RENDER_USE_MAP_HIT_COMPRESSED
+    map_hit_reset_vars();
+    map_hit_setRow(posX, posY, a);
+    #endif
+
+    #if RENDER_SMOOTH_ROTATION
+    rotation_substep = 0;
+    #endif
+
+    #if RENDER_SKIP_STATIC_FRAME
+    // First frame always renders
+    view_changed = TRUE;
+    #endif
+}
+
+bool game_loop_inputFrame (u16* posX, u16* posY, u16* angle)
+{
+    #if RENDER_SKIP_STATIC_FRAME
+    view_changed |= handle_input(posX, posY, angle, &host_delta_a_ptr);
+    if (!view_changed)
+        return FALSE;
+    view_changed = FALSE;
+    #else
+    handle_input(posX, posY, angle, &host_delta_a_ptr);
+    #endif
+
+    clearBuffer();
+    dda(*posX, *posY, host_delta_a_ptr);
+    return TRUE;
+}
+
+#else
+
 void game_loop ()
 {
     XGM2_play(vgm_01_at_dooms_gate);
@@ -197,31 +470,107 @@ void game_loop ()
 	// 0 points down in the map[], 256 points right, 512 points up, 768 points left, 1024 = 0.
 	u16 angle = 0;
     u16* delta_a_ptr = (u16*)tab_deltas;
+    #if RENDER_USE_TAB_DELTAS_FOLDED
+    deltas_quadrant = 0;
+    #endif
+    #if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+    dda_segment_ptr = DDA_SEGMENTS(0);
+    #endif
+
+    #if MAP_RUNTIME_LEVELS
+    prev_joy_state = 0;
+    load_level(0, &posX, &posY, &angle, &delta_a_ptr);
+    #endif
 
     #if RENDER_USE_MAP_HIT_COMPRESSED
     map_hit_reset_vars();
     map_hit_setRow(posX, posY, angle / (1024/AP));
+    #endif
+
+    #if PROFILER
+    prof_reset();
+    #endif
+
+    #if DMA_STATS
+    dma_stats_reset();
+    #endif
+
+    #if RENDER_SMOOTH_ROTATION
+    rotation_substep = 0;
+    #endif
+
+    #if RENDER_SKIP_STATIC_FRAME
+    // First frame always renders
+    view_changed = TRUE;
     #endif
 
 	usergameloop:
 	{
+        #if RENDER_SKIP_STATIC_FRAME
+        // Input goes first so a static view skips the clear, dda() and the framebuffer DMA altogether
+        PROF_ZONE_BEGIN(PROF_ZONE_HANDLE_INPUT);
+        // Only a new view triggers a render. Once rendered it stays in VRAM until the view changes again
+        view_changed |= handle_input(&posX, &posY, &angle, &delta_a_ptr);
+        PROF_ZONE_END(PROF_ZONE_HANDLE_INPUT);
+
+        if (view_changed) {
+            // clear the frame buffer
+            PROF_ZONE_BEGIN(PROF_ZONE_CLEAR_BUFFER);
+            clearBuffer();
+            PROF_ZONE_END(PROF_ZONE_CLEAR_BUFFER);
+        }
+        #else
 		// clear the frame buffer
+        PROF_ZONE_BEGIN(PROF_ZONE_CLEAR_BUFFER);
         clearBuffer();
+        PROF_ZONE_END(PROF_ZONE_CLEAR_BUFFER);
+        #endif
 
-        // ceiling_copy_tilemap(BG_B, angle);
-        // floor_copy_tilemap(BG_B, angle);
-        // ceiling_dma_tileset(angle);
-        // floor_dma_tileset(angle);
-
+        #if !RENDER_SKIP_STATIC_FRAME
+        PROF_ZONE_BEGIN(PROF_ZONE_HANDLE_INPUT);
         handle_input(&posX, &posY, &angle, &delta_a_ptr);
+        PROF_ZONE_END(PROF_ZONE_HANDLE_INPUT);
+        #endif
+
+        #if RENDER_FLOOR_CEILING_TEXTURED
+        // Streams the tileset of the view nearest to the camera, or swaps to it once streamed
+        floor_ceiling_update(posX, posY, angle);
+        #endif
+
+        PROF_ZONE_BEGIN(PROF_ZONE_WEAPON_UPDATE);
         weapon_update();
+        PROF_ZONE_END(PROF_ZONE_WEAPON_UPDATE);
+
+        PROF_ZONE_BEGIN(PROF_ZONE_HUD_UPDATE);
         hud_update();
-        spr_eng_update();
+        PROF_ZONE_END(PROF_ZONE_HUD_UPDATE);
 
+        PROF_ZONE_BEGIN(PROF_ZONE_SPR_ENG_UPDATE);
+        spr_eng_update();
+        PROF_ZONE_END(PROF_ZONE_SPR_ENG_UPDATE);
+
+        #if RENDER_SKIP_STATIC_FRAME
+        if (view_changed) {
+            view_changed = FALSE;
+            PROF_ZONE_BEGIN(PROF_ZONE_DDA);
+            dda(posX, posY, delta_a_ptr);
+            PROF_ZONE_END(PROF_ZONE_DDA);
+            #if RENDER_SMOOTH_ROTATION
+            fb_fill_guard_columns();
+            #endif
+            vint_enqueueFramebuffer();
+        }
+        #else
+        PROF_ZONE_BEGIN(PROF_ZONE_DDA);
 		dda(posX, posY, delta_a_ptr);
+        PROF_ZONE_END(PROF_ZONE_DDA);
+        #endif
 
         render_SYS_doVBlankProcessEx_ON_VBLANK();
 
+        PROF_FRAME_END();
+        DMA_STATS_FRAME_END();
+
         goto usergameloop;
 	}
 }
@@ -232,7 +581,19 @@ void game_loop_auto ()
     // stepping DOWN into Y Axis, and RIGHT into X Axis, where in each position we do a full rotation.
     // Therefore we only interesting in collisions with x+1 and y+1.
 
-    const u16 posStepping = 1;
+    const u16 posStepping = BENCH_POS_STEPPING;
+
+    #if MAP_RUNTIME_LEVELS
+    // The sweep always runs over level 0
+    map_loadLevel(0);
+    #endif
+
+    #if BENCH_AUTO_RUN
+    bench_reset();
+    #if RENDER_USE_MAP_HIT_COMPRESSED
+    bench_mapHitCodec();
+    #endif
+    #endif
 
     #pragma GCC unroll 0 // do not unroll
     for (u16 posX = MIN_POS_XY; posX <= MAX_POS_XY; posX += posStepping) {
@@ -290,17 +651,37 @@ void game_loop_auto ()
 
             for (u16 angle = 0; angle < 1024; angle += (1024/AP)) {
 
+                #if BENCH_AUTO_RUN
+                bench_frameStart();
+                #endif
+
                 // clear the frame buffer
                 clearBuffer();
 
                 weapon_update();
                 hud_update();
                 spr_eng_update();
+                #if RENDER_FLOOR_CEILING_TEXTURED
+                floor_ceiling_update(posX, posY, angle);
+                #endif
 
                 u16 a = angle / (1024/AP); // a range is [0, 128)
-                u16* delta_a_ptr = (u16*) (tab_deltas + a * PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT);
+                u16* delta_a_ptr = (u16*) (tab_deltas + DELTAS_ANGLE(a) * PIXEL_COLUMNS * DELTA_PTR_OFFSET_AMNT);
+                #if RENDER_USE_TAB_DELTAS_FOLDED
+                deltas_quadrant = DELTAS_QUADRANT(a);
+                #endif
+                #if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+                dda_segment_ptr = DDA_SEGMENTS(a);
+                #endif
 
                 dda(posX, posY, delta_a_ptr);
+                #if RENDER_SKIP_STATIC_FRAME
+                vint_enqueueFramebuffer();
+                #endif
+
+                #if BENCH_AUTO_RUN
+                bench_frameEnd(posX, posY, angle);
+                #endif
 
                 render_SYS_doVBlankProcessEx_ON_VBLANK();
 
@@ -311,8 +692,14 @@ void game_loop_auto ()
             }
         }
     }
+
+    #if BENCH_AUTO_RUN
+    bench_end();
+    #endif
 }
 
+#endif // HOST_BUILD
+
 /// @brief Digital Differential Analyzer algorithm
 /// @param posX 
 /// @param posY 
@@ -351,108 +738,137 @@ static void dda (u16 posX, u16 posY, u16* delta_a_ptr)
 
     // reset to the start of frame_buffer
     column_ptr = (u16*) RAM_FIXED_FRAME_BUFFER_ADDRESS;
+    #if RENDER_DEPTH_BUFFER
+    depth_ptr = (u8*) RAM_FIXED_DEPTH_BUFFER_ADDRESS;
+    #endif
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    fb_reset_column_spans();
+    #endif
 
-    #if RENDER_COLUMNS_UNROLL == 1
+    #if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+
+    const u8* segment_ptr = dda_segment_ptr;
+    // cycles between (-VERTICAL_ROWS*TILEMAP_COLUMNS + 1) and (VERTICAL_ROWS*TILEMAP_COLUMNS). Kept along all the segments.
     s16 offset_xor = -VERTICAL_ROWS*TILEMAP_COLUMNS + 1;
-    #endif
 
-    // 256p or 320p width, but 4 "pixels" wide column => effectively 256/4=64 or 320/4=80 pixels width.
+    // Every segment is a run of columns whose ray direction signs are the same, so stepping is resolved at compile time
     #pragma GCC unroll 0 // do not unroll
-    for (; column < (u16)PIXEL_COLUMNS; column += (u16)RENDER_COLUMNS_UNROLL) {
-        #if RENDER_COLUMNS_UNROLL == 1
-
-        process_column(delta_a_ptr, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1);
-        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-        fb_increment_entries_column();
-        #endif
-        #if RENDER_USE_MAP_HIT_COMPRESSED
-        map_hit_incrementColumn();
-        #endif
-        // cycles between (-VERTICAL_ROWS*TILEMAP_COLUMNS + 1) and (VERTICAL_ROWS*TILEMAP_COLUMNS)
-        offset_xor ^= (-VERTICAL_ROWS*TILEMAP_COLUMNS + 1) ^ (VERTICAL_ROWS*TILEMAP_COLUMNS);
-        column_ptr += offset_xor;
+    for (u16 s = 0; s < DDA_QUADRANT_SEGMENTS; ++s) {
+        const u16 end = segment_ptr[0];
+        const u16 quadrant = segment_ptr[1];
+        segment_ptr += 2;
+
+        switch (quadrant) {
+            case 0:
+                dda_quadrant_columns(column, end, delta_a_ptr, &offset_xor, posX, posY, sideDistX_l1, sideDistY_l1, 1, 1);
+                break;
+            case DDA_QUADRANT_NEG_X:
+                dda_quadrant_columns(column, end, delta_a_ptr, &offset_xor, posX, posY, sideDistX_l0, sideDistY_l1, -1, 1);
+                break;
+            case DDA_QUADRANT_NEG_Y:
+                dda_quadrant_columns(column, end, delta_a_ptr, &offset_xor, posX, posY, sideDistX_l1, sideDistY_l0, 1, -1);
+                break;
+            default:
+                dda_quadrant_columns(column, end, delta_a_ptr, &offset_xor, posX, posY, sideDistX_l0, sideDistY_l0, -1, -1);
+                break;
+        }
 
-        #elif RENDER_COLUMNS_UNROLL == 2
+        delta_a_ptr += (end - column) * DELTA_PTR_OFFSET_AMNT;
+        column = end;
+    }
 
-        process_column(delta_a_ptr + 0*DELTA_PTR_OFFSET_AMNT, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1);
-        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-        fb_increment_entries_column();
-        #endif
-        #if RENDER_USE_MAP_HIT_COMPRESSED
-        map_hit_incrementColumn();
-        #endif
-        column_ptr += VERTICAL_ROWS*TILEMAP_COLUMNS; // jumps into Plane B region of framebuffer
+    #else
 
-        process_column(delta_a_ptr + 1*DELTA_PTR_OFFSET_AMNT, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1);
-        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-        fb_increment_entries_column();
-        #endif
-        #if RENDER_USE_MAP_HIT_COMPRESSED
-        map_hit_incrementColumn();
-        #endif
-        column_ptr += -VERTICAL_ROWS*TILEMAP_COLUMNS + 1; // go back to Plane A region of framebuffer and advance one tilemap entry
+    #if RENDER_USE_TAB_DELTAS_FOLDED
+    // Only one switch per frame: every quadrant gets its own columns loop with the tab_deltas transformation resolved at compile time
+    switch (deltas_quadrant) {
+        case 0:
+            dda_columns(column, delta_a_ptr, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1, 0);
+            break;
+        case 1:
+            dda_columns(column, delta_a_ptr, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1, 1);
+            break;
+        case 2:
+            dda_columns(column, delta_a_ptr, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1, 2);
+            break;
+        default:
+            dda_columns(column, delta_a_ptr, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1, 3);
+            break;
+    }
+    #else
+    dda_columns(column, delta_a_ptr, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1, 0);
+    #endif
 
-        #elif RENDER_COLUMNS_UNROLL == 4
+    #endif // RENDER_USE_DDA_QUADRANT_KERNELS
 
-        process_column(delta_a_ptr + 0*DELTA_PTR_OFFSET_AMNT, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1);
-        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-        fb_increment_entries_column();
-        #endif
-        #if RENDER_USE_MAP_HIT_COMPRESSED
-        map_hit_incrementColumn();
-        #endif
-        column_ptr += VERTICAL_ROWS*TILEMAP_COLUMNS; // jumps into Plane B region of framebuffer
+    #if RENDER_MIRROR_PLANES_USING_CPU_RAM
+    fb_mirror_planes_in_RAM();
+    #endif
+}
 
-        process_column(delta_a_ptr + 1*DELTA_PTR_OFFSET_AMNT, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1);
-        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-        fb_increment_entries_column();
-        #endif
-        #if RENDER_USE_MAP_HIT_COMPRESSED
-        map_hit_incrementColumn();
-        #endif
-        column_ptr += -VERTICAL_ROWS*TILEMAP_COLUMNS + 1; // go back to Plane A region of framebuffer and advance one tilemap entry
+/// @brief Raycasts the columns from the given one up to PIXEL_COLUMNS.
+/// @param quadrant quadrant of the viewing angle when RENDER_USE_TAB_DELTAS_FOLDED, otherwise 0. Always a constant.
+#if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+static FORCE_INLINE void dda_columns (u16 column, u16* delta_a_ptr, u16 posX, u16 posY, u32 sideDistX_l0, u32 sideDistX_l1, u32 sideDistY_l0, u32 sideDistY_l1, const u16 quadrant)
+#else
+static FORCE_INLINE void dda_columns (u16 column, u16* delta_a_ptr, u16 posX, u16 posY, u16 sideDistX_l0, u16 sideDistX_l1, u16 sideDistY_l0, u16 sideDistY_l1, const u16 quadrant)
+#endif
+{
+    #if RENDER_COLUMNS_UNROLL & 1
+    // cycles between (-VERTICAL_ROWS*TILEMAP_COLUMNS + 1) and (VERTICAL_ROWS*TILEMAP_COLUMNS)
+    s16 offset_xor = -VERTICAL_ROWS*TILEMAP_COLUMNS + 1;
+    #endif
 
-        process_column(delta_a_ptr + 2*DELTA_PTR_OFFSET_AMNT, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1);
-        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-        fb_increment_entries_column();
-        #endif
-        #if RENDER_USE_MAP_HIT_COMPRESSED
-        map_hit_incrementColumn();
-        #endif
-        column_ptr += VERTICAL_ROWS*TILEMAP_COLUMNS; // jumps into Plane B region of framebuffer
+    // 256p or 320p width, but 4 "pixels" wide column => effectively 256/4=64 or 320/4=80 pixels width.
+    #pragma GCC unroll 0 // do not unroll
+    for (; column < (u16)PIXEL_COLUMNS; column += (u16)RENDER_COLUMNS_UNROLL) {
 
-        process_column(delta_a_ptr + 3*DELTA_PTR_OFFSET_AMNT, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1);
-        #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
-        fb_increment_entries_column();
-        #endif
-        #if RENDER_USE_MAP_HIT_COMPRESSED
-        map_hit_incrementColumn();
-        #endif
-        column_ptr += -VERTICAL_ROWS*TILEMAP_COLUMNS + 1; // go back to Plane A region of framebuffer and advance one tilemap entry
+        // Single template for every unroll factor: this loop has a constant trip count so it is fully unrolled,
+        // which turns k into a constant for the tab_deltas offsets and the Plane A/B alternation.
+        #pragma GCC unroll 256 // Always set a big number since it does not accept defines
+        for (u16 k = 0; k < (u16)RENDER_COLUMNS_UNROLL; ++k) {
+            process_column(delta_a_ptr + k*DELTA_PTR_OFFSET_AMNT, posX, posY, sideDistX_l0, sideDistX_l1, sideDistY_l0, sideDistY_l1, quadrant);
+            #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
+            fb_increment_entries_column();
+            #endif
+            #if RENDER_USE_MAP_HIT_COMPRESSED
+            map_hit_incrementColumn();
+            #endif
 
-        #endif
+            #if RENDER_COLUMNS_UNROLL & 1
+            // Odd factors start every iteration on a different plane, so the alternation is carried over
+            offset_xor ^= (-VERTICAL_ROWS*TILEMAP_COLUMNS + 1) ^ (VERTICAL_ROWS*TILEMAP_COLUMNS);
+            column_ptr += offset_xor;
+            #else
+            if ((k & 1) == 0)
+                column_ptr += VERTICAL_ROWS*TILEMAP_COLUMNS; // jumps into Plane B region of framebuffer
+            else
+                column_ptr += -VERTICAL_ROWS*TILEMAP_COLUMNS + 1; // go back to Plane A region of framebuffer and advance one tilemap entry
+            #endif
+        }
 
         delta_a_ptr += RENDER_COLUMNS_UNROLL * DELTA_PTR_OFFSET_AMNT;
     }
 
-    #if RENDER_MIRROR_PLANES_USING_CPU_RAM
-    fb_mirror_planes_in_RAM();
-    #endif
 }
 
 #if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
-static FORCE_INLINE void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u32 sideDistX_l0, u32 sideDistX_l1, u32 sideDistY_l0, u32 sideDistY_l1)
+static FORCE_INLINE void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u32 sideDistX_l0, u32 sideDistX_l1, u32 sideDistY_l0, u32 sideDistY_l1, const u16 quadrant)
 #else
-static FORCE_INLINE void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u16 sideDistX_l0, u16 sideDistX_l1, u16 sideDistY_l0, u16 sideDistY_l1)
+static FORCE_INLINE void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u16 sideDistX_l0, u16 sideDistX_l1, u16 sideDistY_l0, u16 sideDistY_l1, const u16 quadrant)
 #endif
 {
     // Length of ray from one X or Y side to next X or Y side. Value from 182 up to 65535, but only 915 different values
-	const u16 deltaDistX = delta_a_ptr[0], deltaDistY = delta_a_ptr[1];
+    // quadrant is a constant, so the swap resolves into the read offsets and the negations into a neg.w where needed
+    const u16 swap = quadrant & 1;
+	const u16 deltaDistX = delta_a_ptr[swap], deltaDistY = delta_a_ptr[1 - swap];
     // Value from 0 up to 65535 (unsigned), but only 717 signed different values in [-360, 360]
-	const s16 rayDirAngleX = (s16) delta_a_ptr[2], rayDirAngleY = (s16) delta_a_ptr[3];
+	const s16 rayDirX = (s16) delta_a_ptr[2 + swap], rayDirY = (s16) delta_a_ptr[3 - swap];
+	const s16 rayDirAngleX = (quadrant == 2 || quadrant == 3) ? -rayDirX : rayDirX;
+	const s16 rayDirAngleY = (quadrant == 1 || quadrant == 2) ? -rayDirY : rayDirY;
     #if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
     // 0..MPH_VALUES_DELTADIST_NKEYS-1 multiplied by 2 for faster memory access in ASM
-    const u16 deltaDistX_perf_hash = delta_a_ptr[4], deltaDistY_perf_hash = delta_a_ptr[5];
+    const u16 deltaDistX_perf_hash = delta_a_ptr[4 + swap], deltaDistY_perf_hash = delta_a_ptr[5 - swap];
     #endif
 
     // Length of ray from current position to next X or Y side. Wffective value goes up to 4096-1 once in the stepping loop due to condition control
@@ -509,6 +925,67 @@ static FORCE_INLINE void process_column (u16* delta_a_ptr, u16 posX, u16 posY, u
     #endif
 }
 
+#if RENDER_USE_DDA_QUADRANT_KERNELS && !RENDER_USE_MAP_HIT_COMPRESSED
+
+/// @brief Raycasts the column at delta_a_ptr with the steps of its segment and moves column_ptr to the next column.
+#if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+static FORCE_INLINE void dda_quadrant_column (u16* delta_a_ptr, s16* offset_xor, u16 posX, u16 posY, u32 sideDistX_l, u32 sideDistY_l, const s16 stepX, const s16 stepY)
+#else
+static FORCE_INLINE void dda_quadrant_column (u16* delta_a_ptr, s16* offset_xor, u16 posX, u16 posY, u16 sideDistX_l, u16 sideDistY_l, const s16 stepX, const s16 stepY)
+#endif
+{
+    const u16 deltaDistX = delta_a_ptr[0], deltaDistY = delta_a_ptr[1];
+    const s16 rayDirAngleX = (s16) delta_a_ptr[2], rayDirAngleY = (s16) delta_a_ptr[3];
+    #if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+    const u16 sideDistX = perf_hash_mulu_shft_FS(sideDistX_l, delta_a_ptr[4]);
+    const u16 sideDistY = perf_hash_mulu_shft_FS(sideDistY_l, delta_a_ptr[5]);
+    #else
+    const u16 sideDistX = mulu_shft_FS(sideDistX_l, deltaDistX);
+    const u16 sideDistY = mulu_shft_FS(sideDistY_l, deltaDistY);
+    #endif
+
+    do_stepping_inline(posX, posY, deltaDistX, deltaDistY, sideDistX, sideDistY, stepX, stepY, stepY * MAP_SIZE, rayDirAngleX, rayDirAngleY);
+
+    #if RENDER_MIRROR_PLANES_USING_CPU_RAM || RENDER_MIRROR_PLANES_USING_VDP_VRAM
+    fb_increment_entries_column();
+    #endif
+    *offset_xor ^= (-VERTICAL_ROWS*TILEMAP_COLUMNS + 1) ^ (VERTICAL_ROWS*TILEMAP_COLUMNS);
+    column_ptr += *offset_xor;
+}
+
+/// @brief Same than process_column() but for a run of columns in the same quadrant, so stepX and stepY are
+/// known at compile time and the initial sideDist uses the already selected sideDistX_l and sideDistY_l.
+#if RENDER_USE_PERF_HASH_TAB_MULU_DIST_256_SHFT_FS
+static FORCE_INLINE void dda_quadrant_columns (u16 column, u16 end, u16* delta_a_ptr, s16* offset_xor_ptr, u16 posX, u16 posY, u32 sideDistX_l, u32 sideDistY_l, const s16 stepX, const s16 stepY)
+#else
+static FORCE_INLINE void dda_quadrant_columns (u16 column, u16 end, u16* delta_a_ptr, s16* offset_xor_ptr, u16 posX, u16 posY, u16 sideDistX_l, u16 sideDistY_l, const s16 stepX, const s16 stepY)
+#endif
+{
+    s16 offset_xor = *offset_xor_ptr;
+
+    // Segments have any length, so RENDER_COLUMNS_UNROLL columns per iteration and then the remaining ones one by one
+    #pragma GCC unroll 0 // do not unroll
+    for (; (u16)(column + RENDER_COLUMNS_UNROLL) <= end; column += (u16)RENDER_COLUMNS_UNROLL) {
+        #pragma GCC unroll 256 // Always set a big number since it does not accept defines
+        for (u16 k = 0; k < (u16)RENDER_COLUMNS_UNROLL; ++k) {
+            dda_quadrant_column(delta_a_ptr + k*DELTA_PTR_OFFSET_AMNT, &offset_xor, posX, posY, sideDistX_l, sideDistY_l, stepX, stepY);
+        }
+        delta_a_ptr += RENDER_COLUMNS_UNROLL * DELTA_PTR_OFFSET_AMNT;
+    }
+
+    #if RENDER_COLUMNS_UNROLL > 1
+    #pragma GCC unroll 0 // do not unroll
+    for (; column < end; ++column) {
+        dda_quadrant_column(delta_a_ptr, &offset_xor, posX, posY, sideDistX_l, sideDistY_l, stepX, stepY);
+        delta_a_ptr += DELTA_PTR_OFFSET_AMNT;
+    }
+    #endif
+
+    *offset_xor_ptr = offset_xor;
+}
+
+#endif
+
 #if RENDER_USE_MAP_HIT_COMPRESSED
 static void do_stepping (u16 posX, u16 posY, u16 sideDistX, u16 sideDistY, s16 rayDirAngleX, s16 rayDirAngleY)
 {
@@ -535,6 +1012,13 @@ static void do_stepping (u16 posX, u16 posY, u16 sideDistX, u16 sideDistY, s16 r
 }
 #else
 static void do_stepping (u16 posX, u16 posY, u16 deltaDistX, u16 deltaDistY, u16 sideDistX, u16 sideDistY, s16 stepX, s16 stepY, s16 stepYMS, s16 rayDirAngleX, s16 rayDirAngleY)
+{
+    do_stepping_inline(posX, posY, deltaDistX, deltaDistY, sideDistX, sideDistY, stepX, stepY, stepYMS, rayDirAngleX, rayDirAngleY);
+}
+
+/// @brief Stepping loop shared by do_stepping() and the quadrant kernels. When inlined with constant stepX, stepY and stepYMS
+/// the compiler resolves them as immediates, which frees registers inside the loop.
+static FORCE_INLINE void do_stepping_inline (u16 posX, u16 posY, u16 deltaDistX, u16 deltaDistY, u16 sideDistX, u16 sideDistY, s16 stepX, s16 stepY, s16 stepYMS, s16 rayDirAngleX, s16 rayDirAngleY)
 {
     // Which box of the map we're in
     u16 mapX = posX / (u16)FP;
@@ -554,7 +1038,11 @@ static void do_stepping (u16 posX, u16 posY, u16 deltaDistX, u16 deltaDistY, u16
 			map_ptr += stepX;
 			u16 hit = *map_ptr; // map[mapY][mapX];
 			if (hit) {
+                #if RENDER_WALL_MATERIALS
+                hitOnSideX(sideDistX, hit, posY, rayDirAngleY);
+                #else
                 hitOnSideX(sideDistX, mapY, posY, rayDirAngleY);
+                #endif
 				return;
 			}
 			sideDistX += deltaDistX;
@@ -565,17 +1053,41 @@ static void do_stepping (u16 posX, u16 posY, u16 deltaDistX, u16 deltaDistY, u16
 			map_ptr += stepYMS;
 			u16 hit = *map_ptr; // map[mapY][mapX];
 			if (hit) {
+                #if RENDER_WALL_MATERIALS
+                hitOnSideY(sideDistY, hit, posX, rayDirAngleX);
+                #else
                 hitOnSideY(sideDistY, mapX, posX, rayDirAngleX);
+                #endif
 				return;
 			}
 			sideDistY += deltaDistY;
 		}
 	}
+
+    #if RENDER_DEPTH_BUFFER
+    *depth_ptr++ = DEPTH_BUFFER_FAR;
+    #endif
+
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    // No wall hit: the column has to be emptied since the framebuffer isn't cleared anymore
+    write_vline_incremental_empty();
+    #elif RENDER_DMA_COLUMNS_FROM_ROM
+    // No wall hit: the column still needs its pattern id since the framebuffer isn't cleared
+    write_vline_rom_empty();
+    #elif RENDER_SINGLE_PLANE_TILES_PAIR
+    // No wall hit: the column is still needed to complete its pair since the framebuffer isn't cleared
+    write_vline_pair_empty();
+    #endif
 }
 #endif
 
 static void hitOnSideX (u16 sideDistX, u16 mapY, u16 posY, s16 rayDirAngleY)
 {
+    #if RENDER_DEPTH_BUFFER
+    // Before the tables lookup since the asm versions clobber sideDistX
+    *depth_ptr++ = sideDistX >> DEPTH_BUFFER_SHIFT;
+    #endif
+
     #if RENDER_SHOW_TEXCOORD
 
     // We only need the Texture X coordinate because we stay in the same vertical stripe of the screen.
@@ -591,11 +1103,75 @@ static void hitOnSideX (u16 sideDistX, u16 mapY, u16 posY, s16 rayDirAngleY)
     else tileAttrib = (PAL0 << TILE_ATTR_PALETTE_SFT) + 1 + min(d, wallTexX)*8
     u16 h2 = tab_wall_div[sideDistX]; // height halved
 
+    #elif RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD
+
+    #if HOST_BUILD
+
+    // C version
+    u32 h2_tileAttrib = tab_wall_hit_X_fused[sideDistX*2 + (mapY&1)]; // *2 because each element has one value for (mapY&1)=0 and other for (mapY&1)=1
+
+    #else
+
+    // ASM version
+    u32 h2_tileAttrib;
+    __asm volatile (
+        "\n#NO_APP\n\t" // Let's the optimization script see this block
+        "andi.w  #1,%[mapY]\n\t"                       // mapY &= 1
+        "add.w   %[sideDistX],%[sideDistX]\n\t"        // sideDistX *= 2 (discern between element for (mapY&1)=0 and element for (mapY&1)=1)
+        "add.w   %[mapY],%[sideDistX]\n\t"             // index = 2*sideDistX + (mapY & 1)
+        "add.w   %[sideDistX],%[sideDistX]\n\t"        // index *= 2
+        "add.w   %[sideDistX],%[sideDistX]\n\t"        // index *= 2 (long stride)
+        "move.l  (%[tab_fused],%[sideDistX].w),%[h2_tileAttrib]" // h2_tileAttrib = tab_wall_hit_X_fused[index]
+        "\n#APP"
+        : [h2_tileAttrib] "=d" (h2_tileAttrib), [sideDistX] "+d" (sideDistX), [mapY] "+d" (mapY)
+        : [tab_fused] "a" (tab_wall_hit_X_fused)
+        :
+    );
+
+    #endif // HOST_BUILD
+
+    #elif RENDER_WALL_MATERIALS && !RENDER_SHOW_TEXCOORD
+
+    #if HOST_BUILD
+
+    // C version
+    u16 h2 = tab_wall_div[sideDistX]; // height halved
+    u16 tileAttrib = tab_wall_materials_X[(((mapY & MAP_CELL_COLUMN_X_MASK) ^ (TAB_WALL_MATERIALS_COLUMNS/2)) * (FP * (STEP_COUNT + 1))) + sideDistX];
+
+    #else
+
+    // ASM version. Same amount of loads than the RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED block, the material only adds a rotation (68 cycles against 60).
+    // sub table offset + 2*sideDistX never carries into bit 13 since 2*sideDistX < 2*FP*(STEP_COUNT+1) = 8192.
+    u16* a_reg = (u16*)tab_wall_div;
+    u16 tileAttrib;
+    u16 h2;
+    __asm volatile (
+        "\n#NO_APP\n\t" // Let's the optimization script see this block
+        "andi.w  %[_COLUMN_MASK],%[mapY]\n\t"          // column = cell & MAP_CELL_COLUMN_X_MASK
+        "ror.w   #3,%[mapY]\n\t"                      // column << 13: signed byte offset of its sub table from the middle of the array
+        "add.w   %[sideDistX],%[sideDistX]\n\t"        // byte offset (word stride)
+        "move.w  (%[a_reg],%[sideDistX].w),%[h2]\n\t"  // h2 = tab_wall_div[sideDistX]
+        "lea     %c[tab_materials_mid],%[a_reg]\n\t"   // middle of the array, this way we save one register
+        "add.w   %[mapY],%[sideDistX]\n\t"             // index = sub table offset + 2*sideDistX
+        "move.w  (%[a_reg],%[sideDistX].w),%[tileAttrib]" // tileAttrib = tab_wall_materials_X[column ^ 4][sideDistX]
+        "\n#APP"
+        : [a_reg] "+a" (a_reg), [h2] "=d" (h2), [tileAttrib] "=d" (tileAttrib), [sideDistX] "+d" (sideDistX), [mapY] "+d" (mapY)
+        : [tab_materials_mid] "s" (tab_wall_materials_X + (TAB_WALL_MATERIALS_COLUMNS/2) * (FP * (STEP_COUNT + 1))),
+          [_COLUMN_MASK] "i" (MAP_CELL_COLUMN_X_MASK)
+        :
+    );
+
+    #endif // HOST_BUILD
+
     #elif RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED && !RENDER_SHOW_TEXCOORD
 
+    #if HOST_BUILD
+
     // C version
-    // u16 h2 = tab_wall_div[sideDistX]; // height halved
-    // u16 tileAttrib = tab_color_d8_1_X_pals_shft[sideDistX*2 + (mapY&1)]; // *2 because each element has one value for (mapY&1)=0 and other for (mapY&1)=1
+    u16 h2 = tab_wall_div[sideDistX]; // height halved
+    u16 tileAttrib = tab_color_d8_1_X_pals_shft[sideDistX*2 + (mapY&1)]; // *2 because each element has one value for (mapY&1)=0 and other for (mapY&1)=1
+
+    #else
 
     // ASM version
     u16* a_reg = (u16*)tab_wall_div;
@@ -616,6 +1192,8 @@ static void hitOnSideX (u16 sideDistX, u16 mapY, u16 posY, s16 rayDirAngleY)
         :
     );
 
+    #endif // HOST_BUILD
+
     #else
 
     u8 d8_1 = tab_color_d8_1[sideDistX]; // the bigger the distant the darker the color is
@@ -626,7 +1204,23 @@ static void hitOnSideX (u16 sideDistX, u16 mapY, u16 posY, s16 rayDirAngleY)
 
     #endif
 
-    #if RENDER_HALVED_PLANES
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES && RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD
+    write_vline_incremental(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+    #elif RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    write_vline_incremental(h2, tileAttrib);
+    #elif RENDER_DMA_COLUMNS_FROM_ROM && RENDER_USE_TAB_WALL_HIT_FUSED
+    write_vline_rom(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+    #elif RENDER_DMA_COLUMNS_FROM_ROM
+    write_vline_rom(h2, tileAttrib);
+    #elif RENDER_SINGLE_PLANE_TILES_PAIR && RENDER_USE_TAB_WALL_HIT_FUSED
+    write_vline_pair(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+    #elif RENDER_SINGLE_PLANE_TILES_PAIR
+    write_vline_pair(h2, tileAttrib);
+    #elif RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD && RENDER_HALVED_PLANES
+    write_vline_halved_fused(h2_tileAttrib);
+    #elif RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD
+    write_vline_fused(h2_tileAttrib);
+    #elif RENDER_HALVED_PLANES
     write_vline_halved(h2, tileAttrib);
     #else
     write_vline(h2, tileAttrib);
@@ -635,6 +1229,11 @@ static void hitOnSideX (u16 sideDistX, u16 mapY, u16 posY, s16 rayDirAngleY)
 
 static void hitOnSideY (u16 sideDistY, u16 mapX, u16 posX, s16 rayDirAngleX)
 {
+    #if RENDER_DEPTH_BUFFER
+    // Before the tables lookup since the asm versions clobber sideDistY
+    *depth_ptr++ = sideDistY >> DEPTH_BUFFER_SHIFT;
+    #endif
+
     #if RENDER_SHOW_TEXCOORD
 
     // We only need the Texture X coordinate because we stay in the same vertical stripe of the screen.
@@ -650,11 +1249,75 @@ static void hitOnSideY (u16 sideDistY, u16 mapX, u16 posX, s16 rayDirAngleX)
     else tileAttrib = (PAL1 << TILE_ATTR_PALETTE_SFT) + 1 + min(d, wallTexX)*8;
     u16 h2 = tab_wall_div[sideDistY]; // height halved
 
+    #elif RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD
+
+    #if HOST_BUILD
+
+    // C version
+    u32 h2_tileAttrib = tab_wall_hit_Y_fused[sideDistY*2 + (mapX&1)]; // *2 because each element has one value for (mapX&1)=0 and other for (mapX&1)=1
+
+    #else
+
+    // ASM version
+    u32 h2_tileAttrib;
+    __asm volatile (
+        "\n#NO_APP\n\t" // Let's the optimization script see this block
+        "andi.w  #1,%[mapX]\n\t"                       // mapX &= 1
+        "add.w   %[sideDistY],%[sideDistY]\n\t"        // sideDistY *= 2 (discern between element for (mapX&1)=0 and element for (mapX&1)=1)
+        "add.w   %[mapX],%[sideDistY]\n\t"             // index = 2*sideDistY + (mapX & 1)
+        "add.w   %[sideDistY],%[sideDistY]\n\t"        // index *= 2
+        "add.w   %[sideDistY],%[sideDistY]\n\t"        // index *= 2 (long stride)
+        "move.l  (%[tab_fused],%[sideDistY].w),%[h2_tileAttrib]" // h2_tileAttrib = tab_wall_hit_Y_fused[index]
+        "\n#APP"
+        : [h2_tileAttrib] "=d" (h2_tileAttrib), [sideDistY] "+d" (sideDistY), [mapX] "+d" (mapX)
+        : [tab_fused] "a" (tab_wall_hit_Y_fused)
+        :
+    );
+
+    #endif // HOST_BUILD
+
+    #elif RENDER_WALL_MATERIALS && !RENDER_SHOW_TEXCOORD
+
+    #if HOST_BUILD
+
+    // C version
+    u16 h2 = tab_wall_div[sideDistY]; // height halved
+    u16 tileAttrib = tab_wall_materials_Y[((((mapX & MAP_CELL_COLUMN_Y_MASK) >> 3) ^ (TAB_WALL_MATERIALS_COLUMNS/2)) * (FP * (STEP_COUNT + 1))) + sideDistY];
+
+    #else
+
+    // ASM version. Same amount of loads than the RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED block, the material only adds a rotation (74 cycles against 60).
+    // sub table offset + 2*sideDistY never carries into bit 13 since 2*sideDistY < 2*FP*(STEP_COUNT+1) = 8192.
+    u16* a_reg = (u16*)tab_wall_div;
+    u16 tileAttrib;
+    u16 h2;
+    __asm volatile (
+        "\n#NO_APP\n\t" // Let's the optimization script see this block
+        "andi.w  %[_COLUMN_MASK],%[mapX]\n\t"          // column << 3 = cell & MAP_CELL_COLUMN_Y_MASK
+        "ror.w   #6,%[mapX]\n\t"                      // column << 13: signed byte offset of its sub table from the middle of the array
+        "add.w   %[sideDistY],%[sideDistY]\n\t"        // byte offset (word stride)
+        "move.w  (%[a_reg],%[sideDistY].w),%[h2]\n\t"  // h2 = tab_wall_div[sideDistY]
+        "lea     %c[tab_materials_mid],%[a_reg]\n\t"   // middle of the array, this way we save one register
+        "add.w   %[mapX],%[sideDistY]\n\t"             // index = sub table offset + 2*sideDistY
+        "move.w  (%[a_reg],%[sideDistY].w),%[tileAttrib]" // tileAttrib = tab_wall_materials_Y[column ^ 4][sideDistY]
+        "\n#APP"
+        : [a_reg] "+a" (a_reg), [h2] "=d" (h2), [tileAttrib] "=d" (tileAttrib), [sideDistY] "+d" (sideDistY), [mapX] "+d" (mapX)
+        : [tab_materials_mid] "s" (tab_wall_materials_Y + (TAB_WALL_MATERIALS_COLUMNS/2) * (FP * (STEP_COUNT + 1))),
+          [_COLUMN_MASK] "i" (MAP_CELL_COLUMN_Y_MASK)
+        :
+    );
+
+    #endif // HOST_BUILD
+
     #elif RENDER_USE_TAB_COLOR_D8_1_PALS_SHIFTED && !RENDER_SHOW_TEXCOORD
 
+    #if HOST_BUILD
+
     // C version
-    // u16 h2 = tab_wall_div[sideDistY]; // height halved
-    // u16 tileAttrib = tab_color_d8_1_Y_pals_shft[sideDistY*2 + (mapX&1)]; // *2 because each element has one value for (mapX&1)=0 and other for (mapX&1)=1
+    u16 h2 = tab_wall_div[sideDistY]; // height halved
+    u16 tileAttrib = tab_color_d8_1_Y_pals_shft[sideDistY*2 + (mapX&1)]; // *2 because each element has one value for (mapX&1)=0 and other for (mapX&1)=1
+
+    #else
 
     // ASM version
     u16* a_reg = (u16*)tab_wall_div;
@@ -675,6 +1338,8 @@ static void hitOnSideY (u16 sideDistY, u16 mapX, u16 posX, s16 rayDirAngleX)
         :
     );
 
+    #endif // HOST_BUILD
+
     #else
 
     u8 d8_1 = tab_color_d8_1[sideDistY]; // the bigger the distant the darker the color is
@@ -685,9 +1350,45 @@ static void hitOnSideY (u16 sideDistY, u16 mapX, u16 posX, s16 rayDirAngleX)
 
     #endif
 
-    #if RENDER_HALVED_PLANES
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES && RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD
+    write_vline_incremental(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+    #elif RENDER_INCREMENTAL_FRAMEBUFFER && !RENDER_HALVED_PLANES
+    write_vline_incremental(h2, tileAttrib);
+    #elif RENDER_DMA_COLUMNS_FROM_ROM && RENDER_USE_TAB_WALL_HIT_FUSED
+    write_vline_rom(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+    #elif RENDER_DMA_COLUMNS_FROM_ROM
+    write_vline_rom(h2, tileAttrib);
+    #elif RENDER_SINGLE_PLANE_TILES_PAIR && RENDER_USE_TAB_WALL_HIT_FUSED
+    write_vline_pair(h2_tileAttrib >> 16, (u16)h2_tileAttrib);
+    #elif RENDER_SINGLE_PLANE_TILES_PAIR
+    write_vline_pair(h2, tileAttrib);
+    #elif RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD && RENDER_HALVED_PLANES
+    write_vline_halved_fused(h2_tileAttrib);
+    #elif RENDER_USE_TAB_WALL_HIT_FUSED && !RENDER_SHOW_TEXCOORD
+    write_vline_fused(h2_tileAttrib);
+    #elif RENDER_HALVED_PLANES
     write_vline_halved(h2, tileAttrib);
     #else
     write_vline(h2, tileAttrib);
     #endif
-}
\ No newline at end of file
+}
+
+#if BENCH_KERNELS
+void game_loop_benchHitOnSideX (u16 sideDistX, u16 mapY)
+{
+    #if RENDER_DEPTH_BUFFER
+    // Every call stores one depth, so keep it inside the buffer
+    depth_ptr = (u8*) RAM_FIXED_DEPTH_BUFFER_ADDRESS;
+    #endif
+    hitOnSideX(sideDistX, mapY, 0, 0);
+}
+
+void game_loop_benchHitOnSideY (u16 sideDistY, u16 mapX)
+{
+    #if RENDER_DEPTH_BUFFER
+    // Every call stores one depth, so keep it inside the buffer
+    depth_ptr = (u8*) RAM_FIXED_DEPTH_BUFFER_ADDRESS;
+    #endif
+    hitOnSideY(sideDistY, mapX, 0, 0);
+}
+#endif
\ No newline at end of file
@@ -16,6 +16,9 @@
 #include "hud_256.h"
 #endif
 #include "frame_buffer.h"
+#include "bench.h"
+#include "dma_stats.h"
+#include "dma_sched.h"
 
 #if DMA_ENQUEUE_HUD_TILEMAP_TO_FLUSH_AT_HINT
 bool hud_tilemap_set;
@@ -164,6 +167,8 @@ HINTERRUPT_CALLBACK hint_load_hud_pals_callback ()
 {
     vu32* vdpCtrl_ptr_l = (vu32*) VDP_CTRL_PORT;
 
+    DMA_STATS_BATCH_BEGIN(DMA_STATS_WINDOW_HINT);
+
     // DMA the 2 HUD palettes immediately
     doDmaFast_fixed_args(vdpCtrl_ptr_l, RAM_FIXED_HUD_PALETTES_ADDRESS + 1*2, VDP_DMA_CRAM_ADDR((HUD_BASE_PAL*16 + 1) * 2), 16*HUD_USED_PALS - 1);
 
@@ -203,9 +208,14 @@ HINTERRUPT_CALLBACK hint_load_hud_pals_callback ()
         for (u16 i=0; i < HUD_BG_H; ++i) {
             doDmaFast_fixed_args_loop_ready(vdpCtrl_ptr_l, VDP_DMA_VRAM_ADDR(PW_ADDR_AT_HUD + i*PLANE_COLUMNS*2), TILEMAP_COLUMNS);
         }
+        DMA_COUNT_BYTES(HUD_BG_H * TILEMAP_COLUMNS * 2);
     }
     #endif
 
+    #if DMA_SCHEDULER
+    // Tiles go as per the window budget, priority and deadline
+    dma_sched_flushHint();
+    #else
     // Have any tiles to DMA?
     while (tiles_elems) {
         --tiles_elems;
@@ -216,7 +226,9 @@ HINTERRUPT_CALLBACK hint_load_hud_pals_callback ()
         u16 to = tiles_toIndex[tiles_elems];
         //DMA_doDmaFast(DMA_VRAM, from, to, lenInWord, (s16)-1);
         doDmaFast(lenInWord, (u32)from, VDP_DMA_VRAM_ADDR(to));
+        DMA_COUNT_BYTES(lenInWord * 2);
     }
+    #endif
 
     #if DMA_ENQUEUE_VDP_SPRITE_CACHE_TO_FLUSH_AT_HINT
     // Have any update for vdp sprite cache?
@@ -225,10 +237,11 @@ HINTERRUPT_CALLBACK hint_load_hud_pals_callback ()
         vdpSpriteCache_lenInWord = 0;
         //DMA_doDmaFast(DMA_VRAM, (void*) RAM_FIXED_VDP_SPRITE_CACHE_ADDRESS, VDP_SPRITE_TABLE, lenInWord, (s16)-1);
         doDmaFast(lenInWord, RAM_FIXED_VDP_SPRITE_CACHE_ADDRESS, VDP_DMA_VRAM_ADDR((u32)VDP_SPRITE_TABLE));
+        DMA_COUNT_BYTES(lenInWord * 2);
     }
     #endif
 
-    #if DMA_ALLOW_COMPRESSED_SPRITE_TILES
+    #if DMA_ALLOW_COMPRESSED_SPRITE_TILES && !DMA_SCHEDULER
     // Have any buffered tiles to DMA?
     while (tiles_buf_elems) {
         --tiles_buf_elems;
@@ -238,10 +251,13 @@ HINTERRUPT_CALLBACK hint_load_hud_pals_callback ()
         u16 toIndex = tiles_buf_toIndex[tiles_buf_elems];
         //DMA_doDmaFast(DMA_VRAM, tiles_buf_dmaBufPtr, toIndex, lenInWord, (s16)-1);
         doDmaFast(lenInWord, (u32)tiles_buf_dmaBufPtr, VDP_DMA_VRAM_ADDR(toIndex));
+        DMA_COUNT_BYTES(lenInWord * 2);
         DMA_releaseTemp(lenInWord);
     }
     #endif
 
+    DMA_STATS_BATCH_END(DMA_STATS_WINDOW_HINT);
+
     // USE THIS TO SEE HOW MUCH DEEP IN THE HUD IMAGE THE WHOLE DMA GOES
     // turnOffVDP_m(vdpCtrl_ptr_l, 0x74);
     // waitHCounter_opt3(vdpCtrl_ptr_l, 160);
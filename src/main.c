@@ -23,9 +23,12 @@
 #include "game_loop.h"
 #include "vint_callback.h"
 #include "hint_callback.h"
+#include "dma_sched.h"
+#include "bench.h"
 #include "hud.h"
 #include "weapon.h"
 #include "spr_vram_selector.h"
+#include "floor_ceiling.h"
 #if DISPLAY_LOGOS_AT_START
 #include "teddyBearLogo.h"
 #endif
@@ -93,6 +96,9 @@ int main (bool hardReset)
     render_loadWallPalettes();
     vint_reset();
     hint_reset();
+    #if DMA_SCHEDULER
+    dma_sched_reset();
+    #endif
 	render_loadTiles();
     render_loadFontCPULoad();
 	hud_loadInitialState();
@@ -119,7 +125,16 @@ int main (bool hardReset)
 	VDP_setPlaneSize(PLANE_COLUMNS, 32, TRUE);
 	VDP_setScrollingMode(HSCROLL_PLANE, VSCROLL_PLANE);
 	VDP_setHorizontalScroll(BG_A, 0);
-	VDP_setHorizontalScroll(BG_B, 4); // offset plane by 4 pixels
+    #if RENDER_SINGLE_PLANE_TILES_PAIR
+    // Walls only use Plane A (combined tiles), so Plane B is left empty and free for other uses
+	VDP_setHorizontalScroll(BG_B, PLANE_B_HSCROLL);
+    VDP_clearPlane(BG_B, TRUE);
+        #if RENDER_FLOOR_CEILING_TEXTURED
+    floor_ceiling_reset();
+        #endif
+    #else
+	VDP_setHorizontalScroll(BG_B, PLANE_B_HSCROLL); // offset plane by 4 pixels
+    #endif
     VDP_setWindowHPos(FALSE, HUD_XP);
     VDP_setWindowVPos(TRUE, HUD_YP);
     #if RENDER_SET_FLOOR_AND_ROOF_COLORS_ON_HINT
@@ -160,7 +175,13 @@ int main (bool hardReset)
     // Game Loop
     // ----------------------
 
+    #if BENCH_KERNELS
+    bench_kernels();
+    #elif BENCH_AUTO_RUN
+    game_loop_auto();
+    #else
 	game_loop();
+    #endif
 
     // ----------------------
     // Clear used RAM
@@ -0,0 +1,52 @@
+#include <types.h>
+#include <config.h>
+#include <sys.h>
+#include <string.h>
+#include "map_hit_compressed.h"
+
+#if MAP_HIT_CODEC == MAP_HIT_CODEC_BANKED
+
+#if (ENABLE_BANK_SWITCH == 0)
+#error "MAP_HIT_CODEC_BANKED needs ENABLE_BANK_SWITCH set to 1 in SGDK's config.h"
+#endif
+
+#define MAP_HIT_BANK_WINDOW ((const u16*) (MAP_HIT_BANK_REGION * MAP_HIT_BANK_SIZE))
+
+// Every array starts at its own bank: far data goes after the linear 4MB, and the alignment keeps each array in one bank.
+#define MAP_HIT_BANK_ATTR __attribute__((section(".rodata_binf"), aligned(MAP_HIT_BANK_SIZE)))
+
+// Output of map_tables_generator tab_map_hit_banked
+MAP_HIT_BANK_ATTR const u16 tab_map_hit_bank_0[] = {
+0
+};
+
+const u16* const tab_map_hit_banks[MAP_HIT_BANKS] = {
+tab_map_hit_bank_0,
+};
+
+const u16* map_hit_codec_mapRow (u16 rowIndex)
+{
+    const u16 bank = rowIndex / (u16)MAP_HIT_BANK_ROWS;
+    const u16 rowInBank = rowIndex % (u16)MAP_HIT_BANK_ROWS;
+    const u16 romBank = (u32) tab_map_hit_banks[bank] / MAP_HIT_BANK_SIZE;
+
+    // Consecutive rows mostly live in the same bank, so the mapper is rarely touched. The mapped bank is asked to SGDK instead
+    // of being cached here, since SGDK's far data access (FAR_SAFE) also maps into this region and then our copy would be stale.
+    // Switching goes through SGDK too, so its own bank state stays in sync.
+    if (SYS_getBank(MAP_HIT_BANK_REGION) != romBank)
+        SYS_setBank(MAP_HIT_BANK_REGION, romBank);
+
+    return MAP_HIT_BANK_WINDOW + rowInBank * (u16)PIXEL_COLUMNS;
+}
+
+void map_hit_codec_decodeRow (u16 rowIndex, u16* dst)
+{
+    memcpy(dst, map_hit_codec_mapRow(rowIndex), PIXEL_COLUMNS * 2);
+}
+
+u32 map_hit_codec_romSize ()
+{
+    return (u32) MAP_HIT_ROWS * (PIXEL_COLUMNS * 2);
+}
+
+#endif
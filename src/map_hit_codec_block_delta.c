@@ -0,0 +1,38 @@
+#include <types.h>
+#include "map_hit_compressed.h"
+
+#if MAP_HIT_CODEC == MAP_HIT_CODEC_BLOCK_DELTA
+
+#if HOST_BUILD && HOST_MAP_HIT_TABLES
+
+// Generated by host/map_hit_tables.sh
+#include "map_hit/map_hit_block_delta_OUTPUT.txt"
+
+#else
+
+// Output of map_hit_block_delta_compressor.js
+// Every row has PIXEL_COLUMNS elems: the first value followed by the deltas against the previous value (wrapped to 16 bits).
+const u16 map_hit_block_delta[] = {
+0
+};
+
+#endif
+
+void map_hit_codec_decodeRow (u16 rowIndex, u16* dst)
+{
+    const u16* src = map_hit_block_delta + rowIndex * (u32)PIXEL_COLUMNS;
+    u16 value = *src++;
+    *dst++ = value;
+
+    for (u16 i = PIXEL_COLUMNS - 1; i--;) {
+        value += *src++;
+        *dst++ = value;
+    }
+}
+
+u32 map_hit_codec_romSize ()
+{
+    return sizeof(map_hit_block_delta);
+}
+
+#endif
@@ -0,0 +1,45 @@
+#include <types.h>
+#include "map_hit_compressed.h"
+
+#if MAP_HIT_CODEC == MAP_HIT_CODEC_RLE
+
+#if HOST_BUILD && HOST_MAP_HIT_TABLES
+
+// Generated by host/map_hit_tables.sh
+#include "map_hit/map_hit_rle_OUTPUT.txt"
+
+#else
+
+// Output of map_hit_rle_compressor.js
+// Pairs of {value, count}. Runs never cross rows.
+const u16 map_hit_rle_data[] = {
+0
+};
+
+// Index of the first pair of every row, plus the end of the last row
+const u32 map_hit_rle_row_offsets[] = {
+0
+};
+
+#endif
+
+void map_hit_codec_decodeRow (u16 rowIndex, u16* dst)
+{
+    const u32* offsets = map_hit_rle_row_offsets + rowIndex;
+    const u32 first = offsets[0];
+    const u16 runs = offsets[1] - first;
+    const u16* src = map_hit_rle_data + first * 2;
+
+    for (u16 i = runs; i--;) {
+        const u16 value = *src++;
+        for (u16 count = *src++; count--;)
+            *dst++ = value;
+    }
+}
+
+u32 map_hit_codec_romSize ()
+{
+    return sizeof(map_hit_rle_data) + sizeof(map_hit_rle_row_offsets);
+}
+
+#endif
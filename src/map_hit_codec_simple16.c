@@ -0,0 +1,79 @@
+#include <types.h>
+#include "map_hit_compressed.h"
+
+#if MAP_HIT_CODEC == MAP_HIT_CODEC_SIMPLE16
+
+#if HOST_BUILD && HOST_MAP_HIT_TABLES
+
+// Generated by host/map_hit_tables.sh
+#include "map_hit/map_hit_simple16_OUTPUT.txt"
+
+#else
+
+// Output of map_hit_simple16_bitpacking_compressor.js
+// Words of 32 bits: selector in the upper 4 bits and the values packed from the lowest bit.
+const u32 map_hit_simple16[] = {
+0
+};
+
+// Index of the first word of every row
+const u32 map_hit_simple16_row_lookup[] = {
+0
+};
+
+#endif
+
+// Same selectors than CASES[] in map_hit_simple16_bitpacking_compressor.js
+static const u8 simple16_counts[16] = {
+    28, 21, 21, 21, 14, 9, 8, 7, 6, 6, 5, 5, 4, 3, 2, 1
+};
+
+static const u8 simple16_bits[16][28] = {
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {4,3,3,3,3,3,3,3,3},
+    {3,4,4,4,4,3,3,3},
+    {4,4,4,4,4,4,4},
+    {5,5,5,5,4,4},
+    {4,4,5,5,5,5},
+    {6,6,6,5,5},
+    {5,5,6,6,6},
+    {7,7,7,7},
+    {10,9,9},
+    {14,14},
+    {28}
+};
+
+void map_hit_codec_decodeRow (u16 rowIndex, u16* dst)
+{
+    const u32* src = map_hit_simple16 + map_hit_simple16_row_lookup[rowIndex];
+    u16 remaining = PIXEL_COLUMNS;
+
+    while (remaining) {
+        u32 word = *src++;
+        const u16 selector = word >> 28;
+        const u8* bits = simple16_bits[selector];
+        // Last word of the row might not use all the selector slots
+        u16 count = simple16_counts[selector];
+        if (count > remaining)
+            count = remaining;
+        remaining -= count;
+
+        for (u16 i = count; i--;) {
+            const u16 b = *bits++;
+            // Values are 16 bits at most, so a 16 bits mask is enough even for the 28 bits selector
+            *dst++ = (u16)word & (u16)((1UL << b) - 1);
+            word >>= b;
+        }
+    }
+}
+
+u32 map_hit_codec_romSize ()
+{
+    return sizeof(map_hit_simple16) + sizeof(map_hit_simple16_row_lookup) + sizeof(simple16_counts) + sizeof(simple16_bits);
+}
+
+#endif
@@ -0,0 +1,61 @@
+#include <types.h>
+#include "map_hit_compressed.h"
+
+#if MAP_HIT_CODEC == MAP_HIT_CODEC_TURBOPFOR
+
+#if HOST_BUILD && HOST_MAP_HIT_TABLES
+
+// Generated by host/map_hit_tables.sh
+#include "map_hit/map_hit_block_turbopfor_OUTPUT.txt"
+
+#else
+
+// Output of map_hit_block_turbopfor_16_compressor.js
+const u16 map_hit_compressed[] = {
+0
+};
+
+// values grouped by same delta (might be useful for further compression?)
+const u32 map_hit_lookup[] = {
+0
+};
+
+#endif
+
+/// @brief Rows are PIXEL_COLUMNS long and blocks hold MAP_HIT_COMPRESSED_BLOCK_ROWS rows, so a row never crosses blocks and
+/// the block base and bit width are read only once.
+void map_hit_codec_decodeRow (u16 rowIndex, u16* dst)
+{
+    const u16 blockIndex = rowIndex / (u16)MAP_HIT_COMPRESSED_BLOCK_ROWS;
+    const u16 elemIndex = (rowIndex % (u16)MAP_HIT_COMPRESSED_BLOCK_ROWS) * (u16)PIXEL_COLUMNS;
+
+    const u16* src = map_hit_compressed + map_hit_lookup[blockIndex];
+    const u16 base = *src++;
+    const u16 bits = *src++;
+    const u16 mask = (1U << bits) - 1;
+
+    const u16 totalBits = elemIndex * bits;
+    src += totalBits / 16;
+    const u16 bitOffset = totalBits % 16;
+
+    // Bit reader: acc holds the next avail bits of the stream
+    u32 acc = *src++ >> bitOffset;
+    u16 avail = 16 - bitOffset;
+
+    for (u16 i = PIXEL_COLUMNS; i--;) {
+        if (avail < bits) {
+            acc |= (u32)(*src++) << avail;
+            avail += 16;
+        }
+        *dst++ = base + ((u16)acc & mask);
+        acc >>= bits;
+        avail -= bits;
+    }
+}
+
+u32 map_hit_codec_romSize ()
+{
+    return sizeof(map_hit_compressed) + sizeof(map_hit_lookup);
+}
+
+#endif
@@ -4,20 +4,28 @@
 #include "map_hit_compressed.h"
 #include "utils.h"
 
-#define MAP_HIT_COMPRESSED_BLOCK_SIZE (PIXEL_COLUMNS*4)
-
-const u16 map_hit_compressed[] = {
-0
-};
-
-// values grouped by same delta (might be useful for further compression?)
-const u32 map_hit_lookup[] = {
-0
-};
-
+// Unpacks the whole (cell, angle) row of PIXEL_COLUMNS hits into RAM when the row is set, so columns just read the buffer.
+// Takes precedence over MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX.
+#define MAP_HIT_COMPRESSED_DECODE_ROW TRUE
 #define MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX FALSE
 
-#if MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
+#if !MAP_HIT_COMPRESSED_DECODE_ROW
+#if MAP_HIT_CODEC != MAP_HIT_CODEC_TURBOPFOR
+#error "Decoding elem by elem is only supported by MAP_HIT_CODEC_TURBOPFOR. Set MAP_HIT_COMPRESSED_DECODE_ROW to TRUE"
+#endif
+// See map_hit_codec_turbopfor.c
+extern const u16 map_hit_compressed[];
+extern const u32 map_hit_lookup[];
+#endif
+
+#if MAP_HIT_COMPRESSED_DECODE_ROW && MAP_HIT_CODEC == MAP_HIT_CODEC_BANKED
+// Rows are read straight from the ROM bank window
+static const u16* row_hits;
+static const u16* row_hits_ptr;
+#elif MAP_HIT_COMPRESSED_DECODE_ROW
+static u16 row_hits[PIXEL_COLUMNS];
+static u16* row_hits_ptr;
+#elif MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
 static u32 blockIndex;
 static u16 elemIndex;
 #else
@@ -27,7 +35,9 @@ static u32 index;
 
 void map_hit_reset_vars ()
 {
-    #if MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
+    #if MAP_HIT_COMPRESSED_DECODE_ROW
+    row_hits_ptr = row_hits;
+    #elif MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
     // To avoid repetitive calculations while traversing pixel columns we can initialize some vars
     elemIndex = MAP_HIT_COMPRESSED_BLOCK_SIZE;
     #endif
@@ -37,7 +47,15 @@ FORCE_INLINE void map_hit_setRow(u16 posX, u16 posY, u16 a)
 {
     u16 mapX = posX / (u16)FP;
     u16 mapY = posY / (u16)FP;
-    #if MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
+    #if MAP_HIT_COMPRESSED_DECODE_ROW
+    // MAP_HIT_MIN_CALCULATED_INDEX is a multiple of PIXEL_COLUMNS, so the row index is free of any division
+    const u16 rowIndex = ((mapX * (u16)MAP_SIZE + mapY) * (u16)(1024/(1024/AP)) + a) - (u16)(MAP_HIT_MIN_CALCULATED_INDEX / PIXEL_COLUMNS);
+    #if MAP_HIT_CODEC == MAP_HIT_CODEC_BANKED
+    row_hits = map_hit_codec_mapRow(rowIndex);
+    #else
+    map_hit_codec_decodeRow(rowIndex, row_hits);
+    #endif
+    #elif MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
     // The compressed array has a row length of MAP_HIT_COMPRESSED_BLOCK_SIZE = PIXEL_COLUMNS * k.
     // So we just divide by that length to get the row into the lookup index.
     u32 row = (((mapX * (u16)MAP_SIZE + mapY) * (u16)(1024/(1024/AP)) + a) * (u16)PIXEL_COLUMNS) - (u16)MAP_HIT_MIN_CALCULATED_INDEX;
@@ -49,7 +67,9 @@ FORCE_INLINE void map_hit_setRow(u16 posX, u16 posY, u16 a)
 
 FORCE_INLINE void map_hit_setIndexForStartingColumn (u16 column)
 {
-    #if MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
+    #if MAP_HIT_COMPRESSED_DECODE_ROW
+    row_hits_ptr = row_hits + column;
+    #elif MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
     // The compressed array has a row length of MAP_HIT_COMPRESSED_BLOCK_SIZE = PIXEL_COLUMNS * k.
     // So once the column exceed that length we need to wrap up. The correct thing should be % MAP_HIT_COMPRESSED_BLOCK_SIZE
     // but we know before hand that parameter "column" is smaller than MAP_HIT_COMPRESSED_BLOCK_SIZE.
@@ -62,7 +82,9 @@ FORCE_INLINE void map_hit_setIndexForStartingColumn (u16 column)
 
 FORCE_INLINE void map_hit_incrementColumn ()
 {
-    #if MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
+    #if MAP_HIT_COMPRESSED_DECODE_ROW
+    ++row_hits_ptr;
+    #elif MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
     // The compressed array has a row length of MAP_HIT_COMPRESSED_BLOCK_SIZE = PIXEL_COLUMNS * k.
     // And since we are incrementing columns by 1 then we can just leave the wrap up of elemIndex to map_hit_setIndexForStartingColumn().
     ++elemIndex;
@@ -71,6 +93,15 @@ FORCE_INLINE void map_hit_incrementColumn ()
     #endif
 }
 
+#if MAP_HIT_COMPRESSED_DECODE_ROW
+
+FORCE_INLINE u16 map_hit_decompressAt ()
+{
+    return *row_hits_ptr;
+}
+
+#else
+
 u16 map_hit_decompressAt ()
 {
     #if MAP_HIT_COMPRESSED_PRE_CALCULATE_INDEX
@@ -94,4 +125,6 @@ u16 map_hit_decompressAt ()
     value &= (1U << bits) - 1;
 
     return base + (u16)value;
-}
\ No newline at end of file
+}
+
+#endif
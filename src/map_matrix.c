@@ -1,7 +1,15 @@
 #include <types.h>
+#include <memory.h>
 #include "map_matrix.h"
 
+#if MAP_RUNTIME_LEVELS
+// The layout below becomes level 0 and map[] is the RAM copy of the current level. Name is kept in the definition
+// because the table generator scripts look for it.
+#define map map_level_0
+#endif
+
 // IMPORTANT: if you modify the map you'll need to run all the scripts that generates static pre calculed tables.
+// With MAP_RUNTIME_LEVELS only RENDER_USE_MAP_HIT_COMPRESSED depends on it, and that is why it isn't supported.
 const u8 map[MAP_SIZE][MAP_SIZE] = {
 	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
 	{1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1},
@@ -19,4 +27,58 @@ const u8 map[MAP_SIZE][MAP_SIZE] = {
 	{1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1},
 	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1},
 	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-};
\ No newline at end of file
+};
+
+#if MAP_RUNTIME_LEVELS
+
+#undef map
+
+u8 map[MAP_SIZE][MAP_SIZE];
+
+// Pillars hall. Wall values above 1 are materials (see RENDER_WALL_MATERIALS), otherwise they render the same than 1.
+static const u8 map_level_1[MAP_SIZE][MAP_SIZE] = {
+	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+	{1, 0, 0, 3, 3, 0, 0, 4, 4, 0, 0, 3, 3, 0, 0, 1},
+	{1, 0, 0, 3, 3, 0, 0, 4, 4, 0, 0, 3, 3, 0, 0, 1},
+	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+	{1, 2, 2, 2, 2, 0, 0, 4, 4, 0, 0, 2, 2, 2, 2, 1},
+	{1, 0, 0, 0, 2, 0, 0, 4, 4, 0, 0, 2, 0, 0, 0, 1},
+	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+	{1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1},
+	{1, 0, 0, 3, 3, 0, 0, 4, 4, 0, 0, 3, 3, 0, 0, 1},
+	{1, 0, 0, 3, 3, 0, 0, 4, 4, 0, 0, 3, 3, 0, 0, 1},
+	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+	{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+};
+
+const MapLevel map_levels[MAP_LEVELS] = {
+	{ .posX = 2*FP - 3*MAP_FRACTION, .posY = 2*FP, .angle = 0, .layout = map_level_0 },
+	{ .posX = FP + FP/2, .posY = FP + FP/2, .angle = 0, .layout = map_level_1 },
+};
+
+void map_loadLevel (u16 level)
+{
+	#if RENDER_WALL_MATERIALS
+	// Resolved once per level, so at a hit the renderer only masks (and shifts) the column of its side
+	const u8 (*layout)[MAP_SIZE] = map_levels[level].layout;
+	for (u16 y = 0; y < MAP_SIZE; ++y) {
+		for (u16 x = 0; x < MAP_SIZE; ++x) {
+			const u16 material = layout[y][x];
+			if (material == 0) {
+				map[y][x] = 0;
+				continue;
+			}
+			const u16 column = (material - 1) * 2;
+			map[y][x] = MAP_CELL_WALL | (column + (y & 1)) | ((column + (x & 1)) << 3);
+		}
+	}
+	#else
+	memcpy(map, map_levels[level].layout, MAP_SIZE*MAP_SIZE);
+	#endif
+}
+
+#endif // MAP_RUNTIME_LEVELS
\ No newline at end of file
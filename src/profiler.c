@@ -0,0 +1,119 @@
+#include <types.h>
+#include <vdp.h>
+#include <vdp_bg.h>
+#include <tools.h>
+#include <string.h>
+#include "profiler.h"
+#include "consts.h"
+
+#if PROFILER
+
+// Lookup tables defined in utils.c. Each one gives the ascii char of a digit for numbers in [0, 255].
+extern const unsigned char div_100[];
+extern const unsigned char div_10_mod_10[];
+extern const unsigned char mod_10[];
+
+static u8 zoneStart[PROF_ZONES_STRIDE];
+static u8 ring[PROF_RING_FRAMES * PROF_ZONES_STRIDE];
+static u8* ringSlot;
+static u16 ringFrame;
+
+static u16 overlayTilemap[PROF_ZONES_TOTAL * 4];
+
+void prof_reset ()
+{
+    memset(zoneStart, 0, PROF_ZONES_STRIDE);
+    memset(ring, 0, PROF_RING_FRAMES * PROF_ZONES_STRIDE);
+    ringSlot = ring;
+    ringFrame = 0;
+}
+
+FORCE_INLINE void prof_zoneBegin (u16 zone)
+{
+    zoneStart[zone] = *(vu8*) VDP_HVCOUNTER_PORT; // V-Counter is the high byte
+}
+
+FORCE_INLINE void prof_zoneEnd (u16 zone)
+{
+    // u8 arithmetic takes care of the V-Counter wrapping around
+    ringSlot[zone] = (u8)(*(vu8*) VDP_HVCOUNTER_PORT - zoneStart[zone]);
+}
+
+void prof_frameEnd ()
+{
+    ringFrame = (ringFrame + 1) & (PROF_RING_FRAMES - 1);
+    ringSlot = ring + ringFrame * PROF_ZONES_STRIDE;
+
+    // Only refresh stats once the ring buffer wraps around, so the overlay numbers are readable
+    if (ringFrame != 0)
+        return;
+
+    #if PROFILER_OVERLAY && RENDER_ENABLE_FRAME_LOAD_CALCULATION
+    prof_showOverlay();
+    #endif
+    #if PROFILER_DUMP_KDEBUG
+    prof_dump();
+    #endif
+}
+
+static u16 zoneAverage (u16 zone)
+{
+    u16 sum = 0;
+    const u8* p = ring + zone;
+    for (u16 i=0; i < PROF_RING_FRAMES; ++i) {
+        sum += *p;
+        p += PROF_ZONES_STRIDE;
+    }
+    return sum / PROF_RING_FRAMES;
+}
+
+void prof_showOverlay ()
+{
+    u16* tilemap = overlayTilemap;
+    for (u16 zone=0; zone < PROF_ZONES_TOTAL; ++zone) {
+        u16 num = zoneAverage(zone);
+        // 32 is the ascii value for space ' ' character, which is the first char in the font set
+        *tilemap++ = div_100[num] - 32;
+        *tilemap++ = div_10_mod_10[num] - 32;
+        *tilemap++ = mod_10[num] - 32;
+        *tilemap++ = ' ' - 32;
+    }
+
+    const u16 addr = VDP_getPlaneAddress(WINDOW, PROF_OVERLAY_X, PROF_OVERLAY_Y);
+    // CPU copy
+    VDP_setTileMapDataEx(addr, overlayTilemap, TILE_ATTR_FULL(PAL0, 1, FALSE, FALSE, VRAM_INDEX_FONT), 0, PROF_ZONES_TOTAL * 4, CPU);
+}
+
+void prof_dump ()
+{
+    char msg[40];
+    char tmp[8];
+
+    for (u16 zone=0; zone < PROF_ZONES_TOTAL; ++zone) {
+        u16 min = 255, max = 0, sum = 0;
+        const u8* p = ring + zone;
+        for (u16 i=0; i < PROF_RING_FRAMES; ++i) {
+            u16 v = *p;
+            p += PROF_ZONES_STRIDE;
+            sum += v;
+            if (v < min) min = v;
+            if (v > max) max = v;
+        }
+
+        strcpy(msg, "PROF,");
+        uintToStr(zone, tmp, 1);
+        strcat(msg, tmp);
+        strcat(msg, ",");
+        uintToStr(min, tmp, 1);
+        strcat(msg, tmp);
+        strcat(msg, ",");
+        uintToStr(sum / PROF_RING_FRAMES, tmp, 1);
+        strcat(msg, tmp);
+        strcat(msg, ",");
+        uintToStr(max, tmp, 1);
+        strcat(msg, tmp);
+        KDebug_Alert(msg);
+    }
+}
+
+#endif // PROFILER
\ No newline at end of file
@@ -14,6 +14,11 @@
 #include "utils.h"
 #include "frame_buffer.h"
 #include "vint_callback.h"
+#include "profiler.h"
+
+#if RENDER_SINGLE_PLANE_TILES_PAIR
+#include "tab_tiles_pair_dict.h"
+#endif
 
 extern VoidCallback *vblankCB;
 
@@ -33,10 +38,18 @@ void render_loadTiles ()
 	u8* tile = MEM_alloc(32); // 32 bytes per tile, layout: tile[4*8]
 	memset(tile, 0, 32); // clear the tile with color index 0 (which is the BG color index)
 
+    #if RENDER_SINGLE_PLANE_TILES_PAIR
+    // Wall tiles are kept in RAM and only the combined tiles made of them go into VRAM
+    u8* wallTiles = MEM_alloc(TILES_PAIR_WALL_TILES*32);
+    #define LOAD_WALL_TILE(index) memcpy(wallTiles + (index)*32, tile, 32)
+    #else
+    #define LOAD_WALL_TILE(index) VDP_loadTileData((u32*)tile, (index), 1, CPU)
+    #endif
+
 	// 9 possible tile heights: from 0 to 8 pixels
 
 	// Tile with height 0 goes at index 0, and its color is 0
-	VDP_loadTileData((u32*)tile, 0, 1, CPU);
+	LOAD_WALL_TILE(0);
 
 	// Remaining 8 possible tile heights, distributed in 8 sets
 
@@ -77,7 +90,7 @@ void render_loadTiles ()
                         //tile[4*h + 2 + b] = color;
                     }
                 }
-                VDP_loadTileData((u32*)tile, t + c*8 + (pass*(8*8)), 1, CPU);
+                LOAD_WALL_TILE(t + c*8 + (pass*(8*8)));
             }
         }
     }
@@ -119,6 +132,24 @@ void render_loadTiles ()
         VDP_loadTileData((u32*)tile, floorTileStart + t, 1, CPU);
     }*/
 
+    #if RENDER_SINGLE_PLANE_TILES_PAIR
+    // Combined tile: left 4 columns of pixels from the Plane A tile and right 4 columns from the Plane B tile.
+    // Wall tiles only fill their left 4 columns, which is what Plane B displaced 4 pixels to the right used to show.
+    for (u16 slot = 0; slot < TILES_PAIR_DICT_SIZE; ++slot) {
+        const u8* tileA = wallTiles + tab_tiles_pair_dict[slot*2 + 0]*32;
+        const u8* tileB = wallTiles + tab_tiles_pair_dict[slot*2 + 1]*32;
+        for (u16 h = 0; h < 8; h++) {
+            tile[4*h + 0] = tileA[4*h + 0];
+            tile[4*h + 1] = tileA[4*h + 1];
+            tile[4*h + 2] = tileB[4*h + 0];
+            tile[4*h + 3] = tileB[4*h + 1];
+        }
+        VDP_loadTileData((u32*)tile, slot, 1, CPU);
+    }
+    MEM_free(wallTiles);
+    #endif
+    #undef LOAD_WALL_TILE
+
     MEM_free(tile);
 }
 
@@ -238,7 +269,9 @@ void render_SYS_doVBlankProcessEx_ON_VBLANK ()
     joy_update_6btn();
 
     // Waits until SGDK's vint is triggered and returned from the user vintCB().
+    PROF_ZONE_BEGIN(PROF_ZONE_VBLANK_WAIT);
     waitVInt_vtimer();
+    PROF_ZONE_END(PROF_ZONE_VBLANK_WAIT);
 
     #if RENDER_ENABLE_FRAME_LOAD_CALCULATION
     render_calculateFrameLoad();
@@ -253,8 +286,10 @@ void render_DMA_enqueue_framebuffer ()
     // All the frame_buffer Plane A
     DMA_queueDmaFast(DMA_VRAM, frame_buffer, PA_ADDR, (u16)(VERTICAL_ROWS*PLANE_COLUMNS) - (PLANE_COLUMNS-TILEMAP_COLUMNS), (u16)2);
  
+    #if !RENDER_SINGLE_PLANE_TILES_PAIR
     // All the frame_buffer Plane B
     DMA_queueDmaFast(DMA_VRAM, frame_buffer + (VERTICAL_ROWS*PLANE_COLUMNS), PB_ADDR, (u16)(VERTICAL_ROWS*PLANE_COLUMNS) - (u16)(PLANE_COLUMNS-TILEMAP_COLUMNS), (u16)2);
+    #endif
 }
 
 FORCE_INLINE void render_DMA_row_by_row_framebuffer ()
@@ -335,6 +370,9 @@ FORCE_INLINE void render_DMA_row_by_row_framebuffer ()
         doDmaFast_fixed_args_loop_ready(vdpCtrl_ptr_l, VDP_DMA_VRAM_ADDR(PA_ADDR + i*PLANE_COLUMNS*2), TILEMAP_COLUMNS);
     }
 
+    // RENDER_SINGLE_PLANE_TILES_PAIR has no Plane B region in the framebuffer
+    #if !RENDER_SINGLE_PLANE_TILES_PAIR
+
     // Plane B rows
 
     // Setup DMA length high ONLY ONCE. Length in words because DMA RAM/ROM to VRAM moves 2 bytes per VDP cycle op
@@ -357,9 +395,107 @@ FORCE_INLINE void render_DMA_row_by_row_framebuffer ()
         doDmaFast_fixed_args_loop_ready(vdpCtrl_ptr_l, VDP_DMA_VRAM_ADDR(PB_ADDR + i*PLANE_COLUMNS*2), TILEMAP_COLUMNS);
     }
 
+    #endif // !RENDER_SINGLE_PLANE_TILES_PAIR
+
     #endif
 }
 
+#if RENDER_INCREMENTAL_FRAMEBUFFER && RENDER_DMA_DIRTY_ROWS && !RENDER_HALVED_PLANES
+
+// Every row of a plane must sit in the same 16KB VRAM window, so the DMA command of the next row is the previous one plus the row stride in its address bits
+#if ((PA_ADDR & 0x3FFF) + VERTICAL_ROWS*PLANE_COLUMNS*2) > 0x4000 || ((PB_ADDR & 0x3FFF) + VERTICAL_ROWS*PLANE_COLUMNS*2) > 0x4000
+#error "RENDER_DMA_DIRTY_ROWS expects the VERTICAL_ROWS rows of PA_ADDR and PB_ADDR to not cross a 16KB VRAM boundary"
+#endif
+
+#define DMA_ROW_CMD_STRIDE (((u32)PLANE_COLUMNS*2) << 16)
+
+/// @brief DMAs rows [firstRow, firstRow + rows) of one plane. Rows are contiguous in RAM so the source address is set only once.
+/// Row stride in VRAM is PLANE_COLUMNS, so every row needs its own command.
+static FORCE_INLINE void dma_rows_span (vu32* vdpCtrl_ptr_l, u32 from, u32 cmd, u16 firstRow, u16 rows)
+{
+    from += firstRow*TILEMAP_COLUMNS*2;
+    from >>= 1;
+    *(vu16*)vdpCtrl_ptr_l = 0x9500 | (from & 0xff); // low address
+    from >>= 8;
+    *(vu16*)vdpCtrl_ptr_l = 0x9600 | (from & 0xff); // mid address
+    from >>= 8;
+    *(vu16*)vdpCtrl_ptr_l = 0x9700 | (from & 0x7f); // high address
+
+    cmd += (u32)(firstRow*PLANE_COLUMNS*2) << 16;
+    for (u16 i=rows; i--;) {
+        *(vu16*)vdpCtrl_ptr_l = 0x9300 | (TILEMAP_COLUMNS & 0xff); // DMA length low
+        *vdpCtrl_ptr_l = cmd; // trigger DMA
+        cmd += DMA_ROW_CMD_STRIDE;
+    }
+}
+
+/// @brief Walks the dirty mask of one plane and DMAs every span of contiguous dirty top rows along with its bottom mirror span.
+/// @return amount of rows sent.
+static FORCE_INLINE u16 dma_dirty_rows (vu32* vdpCtrl_ptr_l, u16 dirty, u32 from, u32 cmd)
+{
+    u16 total = 0;
+    u16 r = 0;
+
+    while (dirty) {
+        // Skip clean rows
+        while (!(dirty & 1)) {
+            dirty >>= 1;
+            ++r;
+        }
+        const u16 first = r;
+        while (dirty & 1) {
+            dirty >>= 1;
+            ++r;
+        }
+        const u16 rows = r - first;
+        total += 2*rows;
+
+        // Span reaching the middle row is contiguous with its mirror, so send both as one span
+        if (r == VERTICAL_ROWS/2) {
+            dma_rows_span(vdpCtrl_ptr_l, from, cmd, first, 2*rows);
+        }
+        else {
+            dma_rows_span(vdpCtrl_ptr_l, from, cmd, first, rows);
+            dma_rows_span(vdpCtrl_ptr_l, from, cmd, VERTICAL_ROWS - r, rows);
+        }
+    }
+
+    return total;
+}
+
+FORCE_INLINE u16 render_DMA_dirty_rows_framebuffer ()
+{
+    vu32* vdpCtrl_ptr_l = (vu32*) VDP_CTRL_PORT;
+
+    // Setup DMA length high ONLY ONCE. It stays 0 after every DMA since TILEMAP_COLUMNS < 256
+    *(vu16*)vdpCtrl_ptr_l = 0x9400 | ((TILEMAP_COLUMNS >> 8) & 0xff); // DMA length high
+
+    u16 rows = dma_dirty_rows(vdpCtrl_ptr_l, fb_dirty_rows_A, RAM_FIXED_FRAME_BUFFER_ADDRESS, VDP_DMA_VRAM_ADDR(PA_ADDR));
+    rows += dma_dirty_rows(vdpCtrl_ptr_l, fb_dirty_rows_B, RAM_FIXED_FRAME_BUFFER_ADDRESS + (VERTICAL_ROWS*TILEMAP_COLUMNS)*2, VDP_DMA_VRAM_ADDR(PB_ADDR));
+
+    // Rows written by the renderer after this point (frame overrun) are flagged again and sent on next VBlank
+    fb_dirty_rows_A = 0;
+    fb_dirty_rows_B = 0;
+
+    return rows;
+}
+
+#endif
+
+#if RENDER_DMA_COLUMNS_FROM_ROM && !RENDER_HALVED_PLANES
+FORCE_INLINE void render_DMA_columns_from_ROM ()
+{
+    fb_DMA_columns_from_ROM();
+}
+#endif
+
+#if RENDER_SMOOTH_ROTATION && !RENDER_HALVED_PLANES
+FORCE_INLINE void render_DMA_guard_columns ()
+{
+    fb_DMA_guard_columns();
+}
+#endif
+
 FORCE_INLINE void render_mirror_planes_in_VRAM ()
 {
     fb_mirror_planes_in_VRAM();
@@ -9,6 +9,7 @@
 #include "consts.h"
 #include "hint_callback.h"
 #include "vint_callback.h"
+#include "dma_sched.h"
 #include "utils.h"
 
 #define VISIBILITY_ON                       0xFFFF
@@ -354,6 +355,9 @@ static FORCE_INLINE void loadTiles (Sprite* sprite)
                 //DMA_releaseTemp(lenInWord);
 
                 u16 baseIndex = (sprite->attribut & TILE_INDEX_MASK);
+                #if DMA_SCHEDULER
+                dma_sched_enqueueBuffered(buf, baseIndex * 32, lenInWord);
+                #else
                 if (canDMAinHint(lenInWord)) {
                     hint_enqueueTilesBuffered(baseIndex * 32, lenInWord);
                 }
@@ -361,6 +365,7 @@ static FORCE_INLINE void loadTiles (Sprite* sprite)
                     hint_enqueueTilesBuffered(baseIndex * 32, DMA_LENGTH_IN_WORD_THRESHOLD_FOR_HINT);
                     vint_enqueueTilesBuffered(baseIndex * 32 + DMA_TILES_THRESHOLD_FOR_HINT * 32, lenInWord - DMA_LENGTH_IN_WORD_THRESHOLD_FOR_HINT);
                 }
+                #endif
             }
         }
         else
@@ -372,6 +377,10 @@ static FORCE_INLINE void loadTiles (Sprite* sprite)
             //DMA_queueDma(DMA_VRAM, FAR_SAFE(tileset->tiles, lenInWord * 2), (sprite->attribut & (u16)TILE_INDEX_MASK) * (u16)32, lenInWord, (u16)2);
 
             u16 baseIndex = (sprite->attribut & TILE_INDEX_MASK);
+            #if DMA_SCHEDULER
+            // Current sprite frame is visible right away, so it can't wait for next frame
+            dma_sched_enqueue(FAR_SAFE(tileset->tiles, lenInWord * 2), baseIndex * (u16)32, lenInWord, DMA_SCHED_PRIO_HIGH, 0);
+            #else
             if (canDMAinHint(lenInWord)) {
                 hint_enqueueTiles(FAR_SAFE(tileset->tiles, lenInWord * 2), baseIndex * 32, lenInWord);
             }
@@ -381,6 +390,7 @@ static FORCE_INLINE void loadTiles (Sprite* sprite)
                 vint_enqueueTiles(FAR_SAFE(tileset->tiles + DMA_TILES_THRESHOLD_FOR_HINT*8, (lenInWord - DMA_LENGTH_IN_WORD_THRESHOLD_FOR_HINT) * 2), 
                     baseIndex * (u16)32 + (u16)DMA_TILES_THRESHOLD_FOR_HINT * 32, lenInWord - (u16)DMA_LENGTH_IN_WORD_THRESHOLD_FOR_HINT);
             }
+            #endif
         }
     }
 }
@@ -19,11 +19,24 @@
 #include "utils.h"
 #include "render.h"
 #include "hint_callback.h"
+#include "bench.h"
+#include "dma_stats.h"
+#include "dma_sched.h"
 
 #if DMA_ENQUEUE_HUD_TILEMAP_TO_FLUSH_AT_VINT
 bool hud_tilemap_set;
 #endif
 
+#if RENDER_SKIP_STATIC_FRAME
+static bool framebuffer_set;
+#endif
+
+#if RENDER_SMOOTH_ROTATION
+static bool hscroll_set;
+static s16 hscroll_offset;
+static bool hscroll_waits_framebuffer; // latched until the VBlank that DMAs the new framebuffer
+#endif
+
 static u16 tiles_elems;
 static void* tiles_from[DMA_MAX_QUEUE_CAPACITY] = {0};
 static u16 tiles_toIndex[DMA_MAX_QUEUE_CAPACITY] = {0};
@@ -46,6 +59,16 @@ void vint_reset ()
     hud_tilemap_set= FALSE;
     #endif
 
+    #if RENDER_SKIP_STATIC_FRAME
+    framebuffer_set = FALSE;
+    #endif
+
+    #if RENDER_SMOOTH_ROTATION
+    hscroll_set = FALSE;
+    hscroll_offset = 0;
+    hscroll_waits_framebuffer = FALSE;
+    #endif
+
     memset(tiles_from, 0, DMA_MAX_QUEUE_CAPACITY);
     memsetU16(tiles_toIndex, 0, DMA_MAX_QUEUE_CAPACITY);
     memsetU16(tiles_lenInWord, 0, DMA_MAX_QUEUE_CAPACITY);
@@ -70,6 +93,24 @@ FORCE_INLINE void vint_enqueueHudTilemap ()
     #endif
 }
 
+FORCE_INLINE void vint_enqueueFramebuffer ()
+{
+    #if RENDER_SKIP_STATIC_FRAME
+    framebuffer_set = TRUE;
+    #endif
+}
+
+FORCE_INLINE void vint_enqueueHScroll (s16 offsetPx, bool withFramebuffer)
+{
+    #if RENDER_SMOOTH_ROTATION
+    // Cleared first so a VInt in between never takes a half updated request
+    hscroll_set = FALSE;
+    hscroll_offset = offsetPx;
+    hscroll_waits_framebuffer = withFramebuffer;
+    hscroll_set = TRUE;
+    #endif
+}
+
 FORCE_INLINE void vint_enqueueTiles (void* from, u16 toIndex, u16 lenInWord)
 {
     u16 prev = tiles_elems;
@@ -107,6 +148,8 @@ void vint_callback ()
     // VDP Off
 	turnOffVDP_m(vdpCtrl_ptr_l, 0x74);
 
+    DMA_STATS_BATCH_BEGIN(DMA_STATS_WINDOW_VINT);
+
     render_Z80_setBusProtection(TRUE);
 
     // delay enabled ? --> wait a bit (10 ticks) to improve PCM playback (test on SOR2)
@@ -115,7 +158,42 @@ void vint_callback ()
 
     render_DMA_flushQueue();
 
+    #if RENDER_SKIP_STATIC_FRAME
+    // Only when the game loop finished a new framebuffer. Otherwise VRAM already holds current view (static camera)
+    if (framebuffer_set) {
+    #endif
+
+    #if RENDER_INCREMENTAL_FRAMEBUFFER && RENDER_DMA_DIRTY_ROWS && !RENDER_HALVED_PLANES
+    DMA_COUNT_BYTES(render_DMA_dirty_rows_framebuffer() * TILEMAP_COLUMNS*2);
+    #elif RENDER_DMA_COLUMNS_FROM_ROM && !RENDER_HALVED_PLANES
+    // Same amount of words than the row by row DMA, but sent from ROM as PIXEL_COLUMNS transfers of VERTICAL_ROWS words
+    render_DMA_columns_from_ROM();
+    DMA_COUNT_BYTES(BENCH_FRAMEBUFFER_DMA_BYTES);
+    #else
     render_DMA_row_by_row_framebuffer();
+    DMA_COUNT_BYTES(BENCH_FRAMEBUFFER_DMA_BYTES);
+    #endif
+
+    #if RENDER_SMOOTH_ROTATION
+    // Columns past the screen edges uncovered while turning, from the same view
+    render_DMA_guard_columns();
+    DMA_COUNT_BYTES(FRAME_BUFFER_PLANES*2*RENDER_SMOOTH_ROTATION_GUARD_COLUMNS*VERTICAL_ROWS*2);
+    #endif
+
+    #if RENDER_SKIP_STATIC_FRAME
+    }
+    #endif
+
+    #if RENDER_SMOOTH_ROTATION
+    // A scroll that comes with a new view waits for the VBlank that DMAs its framebuffer, so when dda() overruns the frame
+    // the old view keeps its shift. Otherwise (frames in between steps) it applies on next VBlank.
+    if (hscroll_set && (!hscroll_waits_framebuffer || framebuffer_set)) {
+        hscroll_set = FALSE;
+        *vdpCtrl_ptr_l = VDP_WRITE_VRAM_ADDR((u32)VDP_HSCROLL_TABLE);
+        // Plane A and Plane B entries are consecutive in HSCROLL_PLANE mode
+        *(vu32*)VDP_DATA_PORT = ((u32)(u16)hscroll_offset << 16) | (u16)(PLANE_B_HSCROLL + hscroll_offset);
+    }
+    #endif
 
 	render_Z80_setBusProtection(FALSE);
 
@@ -147,9 +225,14 @@ void vint_callback ()
         for (u16 i=0; i < HUD_BG_H; ++i) {
             doDmaFast_fixed_args_loop_ready(vdpCtrl_ptr_l, VDP_DMA_VRAM_ADDR(PW_ADDR_AT_HUD + i*PLANE_COLUMNS*2), TILEMAP_COLUMNS);
         }
+        DMA_COUNT_BYTES(HUD_BG_H * TILEMAP_COLUMNS * 2);
     }
     #endif
 
+    #if DMA_SCHEDULER
+    // Tiles go as per the window budget, priority and deadline
+    dma_sched_flushVint();
+    #else
     // Have any tiles to DMA?
     while (tiles_elems) {
         --tiles_elems;
@@ -159,7 +242,9 @@ void vint_callback ()
         u16 to = tiles_toIndex[tiles_elems];
         //DMA_doDmaFast(DMA_VRAM, from, to, lenInWord, (s16)-1);
         doDmaFast(lenInWord, (u32)from, VDP_DMA_VRAM_ADDR(to));
+        DMA_COUNT_BYTES(lenInWord * 2);
     }
+    #endif
 
     #if DMA_ENQUEUE_VDP_SPRITE_CACHE_TO_FLUSH_AT_VINT
     // Have any update for vdp sprite cache?
@@ -168,10 +253,11 @@ void vint_callback ()
         vdpSpriteCache_lenInWord = 0;
         //DMA_doDmaFast(DMA_VRAM, (void*) RAM_FIXED_VDP_SPRITE_CACHE_ADDRESS, VDP_SPRITE_TABLE, lenInWord, (s16)-1);
         doDmaFast(lenInWord, RAM_FIXED_VDP_SPRITE_CACHE_ADDRESS, VDP_DMA_VRAM_ADDR((u32)VDP_SPRITE_TABLE));
+        DMA_COUNT_BYTES(lenInWord * 2);
     }
     #endif
 
-    #if DMA_ALLOW_COMPRESSED_SPRITE_TILES
+    #if DMA_ALLOW_COMPRESSED_SPRITE_TILES && !DMA_SCHEDULER
     // Have any buffered tiles to DMA?
     while (tiles_buf_elems) {
         --tiles_buf_elems;
@@ -180,23 +266,40 @@ void vint_callback ()
         u16 toIndex = tiles_buf_toIndex[tiles_buf_elems];
         //DMA_doDmaFast(DMA_VRAM, tiles_buf_dmaBufPtr, toIndex, lenInWord, (s16)-1);
         doDmaFast(lenInWord, (u32)tiles_buf_dmaBufPtr, VDP_DMA_VRAM_ADDR(toIndex));
+        DMA_COUNT_BYTES(lenInWord * 2);
         DMA_releaseTemp(lenInWord);
     }
     #endif
 
     #if RENDER_MIRROR_PLANES_USING_VDP_VRAM
+        #if RENDER_SKIP_STATIC_FRAME
+        if (framebuffer_set)
+        #endif
     render_mirror_planes_in_VRAM();
     #endif
 
+    DMA_STATS_BATCH_END(DMA_STATS_WINDOW_VINT);
+
+    #if BENCH_AUTO_RUN
+    bench_markVIntEnd();
+    #endif
+
     // VDP On
     turnOnVDP_m(vdpCtrl_ptr_l, 0x74);
 
     #if RENDER_MIRROR_PLANES_USING_VDP_VRAM
     // Called once the other half planes were effectively DMAed into VRAM.
     // Do this after the display is turned on, because is CPU and VDP intense and we don't want any black scanlines leak into active display.
+        #if RENDER_SKIP_STATIC_FRAME
+        if (framebuffer_set)
+        #endif
     render_copy_top_entries_in_VRAM();
     #endif
 
+    #if RENDER_SKIP_STATIC_FRAME
+    framebuffer_set = FALSE;
+    #endif
+
     #if RENDER_SET_FLOOR_AND_ROOF_COLORS_ON_HINT & !(RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT | RENDER_MIRROR_PLANES_USING_VSCROLL_IN_HINT_MULTI_CALLBACKS)
     hint_reset_change_bg_state();
     #endif